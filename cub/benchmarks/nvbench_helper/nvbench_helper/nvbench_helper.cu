@@ -1,5 +1,3 @@
-#include <cub/device/device_copy.cuh>
-
 #include <thrust/binary_search.h>
 #include <thrust/count.h>
 #include <thrust/detail/raw_pointer_cast.h>
@@ -16,13 +14,19 @@
 #include <thrust/tabulate.h>
 
 #include <cstdint>
+#include <optional>
 #include <random>
 #include <type_traits>
 
 #include "thrust/device_vector.h"
-#include <curand.h>
 #include <nvbench_helper.cuh>
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+#include <cub/device/device_copy.cuh>
+
+#include <curand.h>
+#endif
+
 namespace 
 {
 
@@ -89,6 +93,7 @@ const double *host_generator_t::new_constant(std::size_t num_items, double val)
   return h_distribution;
 }
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 class device_generator_t
 {
 public:
@@ -107,6 +112,10 @@ private:
   curandGenerator_t m_gen;
   thrust::device_vector<double> m_distribution;
 };
+#else
+// without CUDA the device system lives in host memory
+using device_generator_t = host_generator_t;
+#endif
 
 template <typename T>
 struct random_to_item_t
@@ -132,6 +141,7 @@ struct random_to_item_t
   }
 };
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 const double *device_generator_t::new_uniform_distribution(seed_t seed, std::size_t num_items)
 {
   m_distribution.resize(num_items);
@@ -161,6 +171,7 @@ const double *device_generator_t::new_constant(std::size_t num_items, double val
   thrust::fill_n(thrust::device, d_distribution, num_items, val);
   return d_distribution;
 }
+#endif
 
 struct and_t
 {
@@ -644,6 +655,7 @@ void gen_key_segments(executor exec,
   auto d_range_sizes = thrust::make_transform_iterator(iota,
                                                        offset_to_size_t{segment_offsets.data()});
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
   if (exec == executor::device)
   {
     std::uint8_t *d_temp_storage   = nullptr;
@@ -665,13 +677,15 @@ void gen_key_segments(executor exec,
                              d_range_sizes,
                              total_segments);
     cudaDeviceSynchronize();
+    return;
   }
-  else
+#else
+  (void)exec;
+#endif
+
+  for (std::size_t sid = 0; sid < total_segments; sid++)
   {
-    for (std::size_t sid = 0; sid < total_segments; sid++)
-    {
-      thrust::copy(d_range_srcs[sid], d_range_srcs[sid] + d_range_sizes[sid], d_range_dsts[sid]);
-    }
+    thrust::copy(d_range_srcs[sid], d_range_srcs[sid] + d_range_sizes[sid], d_range_dsts[sid]);
   }
 }
 
@@ -0,0 +1,208 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/atomic>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include "sync_benchmark.h"
+
+// notify_one with nobody waiting, which every release of a lock or
+// semaphore built on the atomic pays.
+template <class Atomic>
+static void BM_AtomicNotifyOneNoWaiters(benchmark::State& st) {
+  Atomic flag{0};
+  benchmark::DoNotOptimize(&flag);
+  for (auto _ : st) {
+    flag.notify_one();
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK_TEMPLATE(BM_AtomicNotifyOneNoWaiters, cuda::std::atomic<int>);
+#if defined(__cpp_lib_atomic_wait)
+BENCHMARK_TEMPLATE(BM_AtomicNotifyOneNoWaiters, std::atomic<int>);
+#endif
+
+// wait on a value the atomic no longer holds, which returns at once.
+template <class Atomic>
+static void BM_AtomicWaitChanged(benchmark::State& st) {
+  Atomic flag{1};
+  benchmark::DoNotOptimize(&flag);
+  for (auto _ : st) {
+    flag.wait(0);
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK_TEMPLATE(BM_AtomicWaitChanged, cuda::std::atomic<int>);
+#if defined(__cpp_lib_atomic_wait)
+BENCHMARK_TEMPLATE(BM_AtomicWaitChanged, std::atomic<int>);
+#endif
+
+// Every thread increments the same atomic and notifies all its waiters, of
+// which there are none, so the threads contend for the atomic and for the
+// entry of the waiter table it hashes to.
+template <class Atomic>
+static void BM_AtomicNotifyAllContended(benchmark::State& st) {
+  static Shared<Atomic> flag;
+  flag.Construct(st, 0);
+  for (auto _ : st) {
+    flag->fetch_add(1);
+    flag->notify_all();
+  }
+  flag.Destroy(st);
+}
+BENCHMARK_TEMPLATE(BM_AtomicNotifyAllContended, cuda::std::atomic<int>)->Apply(ThreadCounts);
+#if defined(__cpp_lib_atomic_wait)
+BENCHMARK_TEMPLATE(BM_AtomicNotifyAllContended, std::atomic<int>)->Apply(ThreadCounts);
+#endif
+
+// Two threads take turns: each one waits for the other to change the atomic
+// and changes it back. An iteration is two wake ups, from the store and
+// notify_one of one thread to the return from wait in the other.
+template <class Atomic>
+static void BM_AtomicWakeUpLatency(benchmark::State& st) {
+  Atomic flag{0};
+  std::thread partner([&flag] {
+    for (int value = 0;; value += 2) {
+      flag.wait(value);
+      if (flag.load() < 0)
+        return;
+      flag.store(value + 2);
+      flag.notify_one();
+    }
+  });
+  int value = 0;
+  for (auto _ : st) {
+    flag.store(value + 1);
+    flag.notify_one();
+    flag.wait(value + 1);
+    value += 2;
+  }
+  flag.store(-1);
+  flag.notify_one();
+  partner.join();
+}
+BENCHMARK_TEMPLATE(BM_AtomicWakeUpLatency, cuda::std::atomic<int>)->UseRealTime();
+#if defined(__cpp_lib_atomic_wait)
+BENCHMARK_TEMPLATE(BM_AtomicWakeUpLatency, std::atomic<int>)->UseRealTime();
+#endif
+
+// Every thread woken by a notify which was not meant for it switches in and
+// out again, and so does every thread which polls the atomic with a backoff.
+// The context switches per notify count both.
+static long ContextSwitches() {
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_nvcsw + usage.ru_nivcsw;
+}
+
+template <class Atomic>
+struct alignas(64) PaddedFlag {
+  Atomic value{0};
+};
+
+// Many threads wait, each on its own cache line aligned flag, and are woken
+// one after the other with notify_one.
+template <class Atomic>
+static void BM_AtomicNotifyOneManyWaiters(benchmark::State& st) {
+  const int waiters = st.range(0);
+  std::vector<PaddedFlag<Atomic>> flags(waiters);
+  Atomic done{0};
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < waiters; ++i) {
+    threads.emplace_back([&, i] {
+      for (;;) {
+        flags[i].value.wait(0);
+        if (flags[i].value.exchange(0) < 0)
+          return;
+        done.fetch_add(1);
+        done.notify_one();
+      }
+    });
+  }
+
+  long notifies = 0;
+  const long switches = ContextSwitches();
+  for (auto _ : st) {
+    const long long before = done.load();
+    PaddedFlag<Atomic>& flag = flags[notifies++ % waiters];
+    flag.value.store(1);
+    flag.value.notify_one();
+    for (long long now = before; now == before; now = done.load())
+      done.wait(now);
+  }
+  st.counters["switches_per_notify"] =
+      benchmark::Counter(double(ContextSwitches() - switches) / notifies);
+
+  for (auto& flag : flags) {
+    flag.value.store(-1);
+    flag.value.notify_one();
+  }
+  for (auto& thread : threads)
+    thread.join();
+}
+BENCHMARK_TEMPLATE(BM_AtomicNotifyOneManyWaiters, cuda::std::atomic<long long>)->Arg(4)->Arg(16)->Arg(64)->UseRealTime();
+#if defined(__cpp_lib_atomic_wait)
+BENCHMARK_TEMPLATE(BM_AtomicNotifyOneManyWaiters, std::atomic<long long>)->Arg(4)->Arg(16)->Arg(64)->UseRealTime();
+#endif
+
+// Many threads wait on the same flag, and are released one at a time.
+template <class Atomic>
+static void BM_AtomicNotifyOneSharedFlag(benchmark::State& st) {
+  const int waiters = st.range(0);
+  Atomic tokens{0};
+  Atomic taken{0};
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < waiters; ++i) {
+    threads.emplace_back([&] {
+      for (;;) {
+        long long available = tokens.load();
+        if (available < 0)
+          return;
+        if (available == 0)
+          tokens.wait(0);
+        else if (tokens.compare_exchange_weak(available, available - 1)) {
+          taken.fetch_add(1);
+          taken.notify_one();
+        }
+      }
+    });
+  }
+
+  long notifies = 0;
+  const long switches = ContextSwitches();
+  for (auto _ : st) {
+    const long long before = taken.load();
+    tokens.fetch_add(1);
+    tokens.notify_one();
+    ++notifies;
+    for (long long now = before; now == before; now = taken.load())
+      taken.wait(now);
+  }
+  st.counters["switches_per_notify"] =
+      benchmark::Counter(double(ContextSwitches() - switches) / notifies);
+
+  tokens.store(-1);
+  tokens.notify_all();
+  for (auto& thread : threads)
+    thread.join();
+}
+BENCHMARK_TEMPLATE(BM_AtomicNotifyOneSharedFlag, cuda::std::atomic<long long>)->Arg(4)->Arg(16)->Arg(64)->UseRealTime();
+#if defined(__cpp_lib_atomic_wait)
+BENCHMARK_TEMPLATE(BM_AtomicNotifyOneSharedFlag, std::atomic<long long>)->Arg(4)->Arg(16)->Arg(64)->UseRealTime();
+#endif
+
+BENCHMARK_MAIN();
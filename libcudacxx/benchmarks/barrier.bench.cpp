@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/barrier>
+#include <cuda/std/latch>
+
+#if __has_include(<barrier>)
+#  include <barrier>
+#endif
+#if __has_include(<latch>)
+#  include <latch>
+#endif
+
+#include "sync_benchmark.h"
+
+// All the threads go through a phase of the same barrier on every
+// iteration. At one thread no thread waits; at more threads the last one to
+// arrive wakes the others, so an iteration is the wake up latency of the
+// barrier plus the contention on its counter.
+template <class Barrier>
+static void BM_BarrierArriveAndWait(benchmark::State& st) {
+  static Shared<Barrier> barrier;
+  barrier.Construct(st, st.threads);
+  for (auto _ : st)
+    barrier->arrive_and_wait();
+  barrier.Destroy(st);
+}
+BENCHMARK_TEMPLATE(BM_BarrierArriveAndWait, cuda::std::barrier<>)->Apply(ThreadCounts);
+#if defined(__cpp_lib_barrier)
+BENCHMARK_TEMPLATE(BM_BarrierArriveAndWait, std::barrier<>)->Apply(ThreadCounts);
+#endif
+
+// arrive without waiting, the split phase a producer uses, by the only
+// thread the barrier expects, so that every arrival completes a phase. More
+// threads cannot share the barrier this way, since a thread would arrive
+// again before the phase it arrived at is over.
+template <class Barrier>
+static void BM_BarrierArrive(benchmark::State& st) {
+  Barrier barrier(1);
+  for (auto _ : st)
+    benchmark::DoNotOptimize(barrier.arrive());
+}
+BENCHMARK_TEMPLATE(BM_BarrierArrive, cuda::std::barrier<>);
+#if defined(__cpp_lib_barrier)
+BENCHMARK_TEMPLATE(BM_BarrierArrive, std::barrier<>);
+#endif
+
+// A latch used once by one thread: constructed, counted down and waited on.
+template <class Latch>
+static void BM_LatchUncontended(benchmark::State& st) {
+  for (auto _ : st) {
+    Latch latch(1);
+    latch.count_down();
+    latch.wait();
+    benchmark::DoNotOptimize(&latch);
+  }
+}
+BENCHMARK_TEMPLATE(BM_LatchUncontended, cuda::std::latch);
+#if defined(__cpp_lib_latch)
+BENCHMARK_TEMPLATE(BM_LatchUncontended, std::latch);
+#endif
+
+// All the threads count down the same latch, which expects every count down
+// they make. The timed loops end together, so the latch has been released by
+// the time the first thread checks it.
+template <class Latch>
+static void BM_LatchCountDown(benchmark::State& st) {
+  static Shared<Latch> latch;
+  latch.Construct(st, static_cast<std::ptrdiff_t>(st.max_iterations) * st.threads);
+  for (auto _ : st)
+    latch->count_down();
+  if (st.thread_index == 0 && !latch->try_wait())
+    st.SkipWithError("the latch was not released");
+  latch.Destroy(st);
+}
+BENCHMARK_TEMPLATE(BM_LatchCountDown, cuda::std::latch)->Apply(ThreadCounts);
+#if defined(__cpp_lib_latch)
+BENCHMARK_TEMPLATE(BM_LatchCountDown, std::latch)->Apply(ThreadCounts);
+#endif
+
+BENCHMARK_MAIN();
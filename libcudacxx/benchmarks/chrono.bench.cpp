@@ -0,0 +1,41 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/chrono>
+
+#include <chrono>
+
+#include "benchmark/benchmark.h"
+
+// Backoff loops and timed waits read a clock on every iteration, so the cost
+// of now() adds to every one of them. Under cuda::std, high_resolution_clock
+// is the system clock, which the backoff loop read before __fast_steady_clock.
+template <class Clock>
+static void BM_ClockNow(benchmark::State& st) {
+  Clock::now();
+  for (auto _ : st)
+    benchmark::DoNotOptimize(Clock::now());
+}
+BENCHMARK_TEMPLATE(BM_ClockNow, cuda::std::chrono::system_clock);
+BENCHMARK_TEMPLATE(BM_ClockNow, cuda::std::chrono::__fast_steady_clock);
+BENCHMARK_TEMPLATE(BM_ClockNow, std::chrono::steady_clock);
+
+// The time elapsed since a start, as the backoff loop measures it.
+template <class Clock>
+static void BM_ClockElapsed(benchmark::State& st) {
+  const typename Clock::time_point start = Clock::now();
+  for (auto _ : st)
+    benchmark::DoNotOptimize(Clock::now() - start);
+}
+BENCHMARK_TEMPLATE(BM_ClockElapsed, cuda::std::chrono::system_clock);
+BENCHMARK_TEMPLATE(BM_ClockElapsed, cuda::std::chrono::__fast_steady_clock);
+BENCHMARK_TEMPLATE(BM_ClockElapsed, std::chrono::steady_clock);
+
+BENCHMARK_MAIN();
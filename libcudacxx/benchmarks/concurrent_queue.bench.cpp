@@ -0,0 +1,97 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/concurrent_queue>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include "sync_benchmark.h"
+
+// The baseline: a ring buffer behind a mutex, with a condition variable for
+// each side to block on.
+template <class T, std::size_t Capacity>
+class LockedQueue {
+public:
+  void push(const T& value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] { return tail_ - head_ != Capacity; });
+    slots_[tail_++ % Capacity] = value;
+    lock.unlock();
+    not_empty_.notify_one();
+  }
+
+  void pop(T& value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return tail_ != head_; });
+    value = slots_[head_++ % Capacity];
+    lock.unlock();
+    not_full_.notify_one();
+  }
+
+private:
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+  std::size_t head_ = 0;
+  std::size_t tail_ = 0;
+  T slots_[Capacity];
+};
+
+// Producers and consumers in pairs, from 1 of each to 16 of each.
+static void ProducerConsumerPairs(benchmark::internal::Benchmark* b) {
+  for (int pairs = 1; pairs <= 16; pairs *= 2)
+    b->Threads(2 * pairs);
+  b->UseRealTime();
+}
+
+// The even threads push and the odd threads pop, one element each per
+// iteration, with the blocking operations. The items processed are the
+// elements which went through the queue.
+template <class Queue>
+static void BM_QueueThroughput(benchmark::State& st) {
+  static Shared<Queue> queue;
+  queue.Construct(st);
+  const bool producer = st.thread_index % 2 == 0;
+  std::uint64_t value = 0;
+  for (auto _ : st) {
+    if (producer) {
+      queue->push(value++);
+    } else {
+      queue->pop(value);
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  if (!producer)
+    st.SetItemsProcessed(st.iterations());
+  queue.Destroy(st);
+}
+BENCHMARK_TEMPLATE(BM_QueueThroughput, cuda::spsc_queue<std::uint64_t, 1024>)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueueThroughput, cuda::mpmc_queue<std::uint64_t, 1024>)->Apply(ProducerConsumerPairs);
+BENCHMARK_TEMPLATE(BM_QueueThroughput, LockedQueue<std::uint64_t, 1024>)->Apply(ProducerConsumerPairs);
+
+// A single thread pushes and pops, so that every operation is uncontended.
+template <class Queue>
+static void BM_QueueUncontended(benchmark::State& st) {
+  static Queue queue;
+  std::uint64_t value = 0;
+  for (auto _ : st) {
+    queue.push(value);
+    queue.pop(value);
+    benchmark::DoNotOptimize(value);
+  }
+}
+BENCHMARK_TEMPLATE(BM_QueueUncontended, cuda::spsc_queue<std::uint64_t, 1024>);
+BENCHMARK_TEMPLATE(BM_QueueUncontended, cuda::mpmc_queue<std::uint64_t, 1024>);
+BENCHMARK_TEMPLATE(BM_QueueUncontended, LockedQueue<std::uint64_t, 1024>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/mdspan>
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+
+#include "benchmark/benchmark.h"
+
+using Extents2D = cuda::std::dextents<int, 2>;
+
+template <class T, class Accessor>
+using Matrix = cuda::std::mdspan<T, Extents2D, cuda::std::layout_right, Accessor>;
+
+struct FreeDeleter {
+  void operator()(void* p) const { std::free(p); }
+};
+
+// Page aligned storage, which satisfies every aligned_accessor.
+template <class T>
+static std::unique_ptr<T[], FreeDeleter> Allocate(std::size_t n) {
+  void* p = std::aligned_alloc(4096, (n * sizeof(T) + 4095) / 4096 * 4096);
+  T* data = static_cast<T*>(p);
+  for (std::size_t i = 0; i < n; ++i)
+    data[i] = static_cast<T>(i % 7);
+  return std::unique_ptr<T[], FreeDeleter>(data);
+}
+
+template <class M, class... Indices>
+static auto Element(const M& m, Indices... idx) -> decltype(m.accessor().access(m.data_handle(), 0)) {
+  return m.accessor().access(m.data_handle(), m.mapping()(idx...));
+}
+
+// A five point stencil. With the default_accessor the compiler must assume
+// that out and in overlap, so it either checks for overlap before every row
+// or keeps the loop scalar. With the restrict_accessor the rows are
+// vectorized unconditionally. The aligned_accessor tells the compiler where
+// the matrices start, which matters on targets that peel loops to reach an
+// aligned address.
+template <class OutAccessor, class InAccessor>
+__attribute__((noinline)) static void Stencil(Matrix<float, OutAccessor> out, Matrix<const float, InAccessor> in) {
+  for (int i = 1; i + 1 < out.extent(0); ++i)
+    for (int j = 1; j + 1 < out.extent(1); ++j)
+      Element(out, i, j) = 0.25f * (Element(in, i - 1, j) + Element(in, i + 1, j) +
+                                    Element(in, i, j - 1) + Element(in, i, j + 1));
+}
+
+template <class OutAccessor, class InAccessor>
+static void BM_Stencil(benchmark::State& st) {
+  const int n = st.range(0);
+  auto out = Allocate<float>(std::size_t(n) * n);
+  auto in = Allocate<float>(std::size_t(n) * n);
+  Matrix<float, OutAccessor> o(out.get(), n, n);
+  Matrix<const float, InAccessor> i(in.get(), n, n);
+  for (auto _ : st) {
+    Stencil(o, i);
+    benchmark::ClobberMemory();
+  }
+  st.SetBytesProcessed(st.iterations() * 2 * sizeof(float) * n * n);
+}
+BENCHMARK_TEMPLATE(BM_Stencil, cuda::std::default_accessor<float>, cuda::std::default_accessor<const float>)
+    ->Arg(256)->Arg(2048);
+BENCHMARK_TEMPLATE(BM_Stencil, cuda::restrict_accessor<float>, cuda::restrict_accessor<const float>)
+    ->Arg(256)->Arg(2048);
+BENCHMARK_TEMPLATE(BM_Stencil, cuda::aligned_accessor<float, 64>, cuda::aligned_accessor<const float, 64>)
+    ->Arg(256)->Arg(2048);
+
+// Writes a matrix far larger than the caches, which the streaming_accessor
+// does without reading every line in first.
+template <class Accessor>
+static void BM_Fill(benchmark::State& st) {
+  const int n = st.range(0);
+  auto data = Allocate<double>(std::size_t(n) * n);
+  Matrix<double, Accessor> m(data.get(), n, n);
+  for (auto _ : st) {
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j)
+        Element(m, i, j) = static_cast<double>(j);
+    benchmark::ClobberMemory();
+  }
+  st.SetBytesProcessed(st.iterations() * sizeof(double) * n * n);
+}
+BENCHMARK_TEMPLATE(BM_Fill, cuda::std::default_accessor<double>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_Fill, cuda::streaming_accessor<double>)->Arg(4096);
+
+// Sums a row major matrix column by column, a stride of a whole row between
+// the loads, which the prefetching_accessor fetches ahead of.
+template <class Accessor>
+static void BM_ColumnSum(benchmark::State& st) {
+  const int n = st.range(0);
+  auto data = Allocate<double>(std::size_t(n) * n);
+  Matrix<const double, Accessor> m(data.get(), n, n);
+  for (auto _ : st) {
+    double sum = 0;
+    for (int j = 0; j < n; ++j)
+      for (int i = 0; i < n; ++i)
+        sum += Element(m, i, j);
+    benchmark::DoNotOptimize(sum);
+  }
+  st.SetBytesProcessed(st.iterations() * sizeof(double) * n * n);
+}
+BENCHMARK_TEMPLATE(BM_ColumnSum, cuda::std::default_accessor<const double>)->Arg(2048);
+BENCHMARK_TEMPLATE(BM_ColumnSum, cuda::prefetching_accessor<const double, 2048 * 4>)->Arg(2048);
+
+BENCHMARK_MAIN();
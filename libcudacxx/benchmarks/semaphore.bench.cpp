@@ -0,0 +1,90 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/semaphore>
+
+#include <atomic>
+#include <thread>
+
+#if __has_include(<semaphore>)
+#  include <semaphore>
+#endif
+
+#include "sync_benchmark.h"
+
+// Every thread acquires and releases the same semaphore, which admits one
+// thread at a time, the way a lock is used. At one thread this is the cost
+// of the uncontended fast path, at more threads the throughput of the
+// handover.
+template <class Semaphore>
+static void BM_SemaphoreAcquireRelease(benchmark::State& st) {
+  static Shared<Semaphore> sem;
+  sem.Construct(st, 1);
+  for (auto _ : st) {
+    sem->acquire();
+    sem->release();
+  }
+  sem.Destroy(st);
+}
+BENCHMARK_TEMPLATE(BM_SemaphoreAcquireRelease, cuda::std::binary_semaphore)->Apply(ThreadCounts);
+BENCHMARK_TEMPLATE(BM_SemaphoreAcquireRelease, cuda::std::counting_semaphore<>)->Apply(ThreadCounts);
+#if defined(__cpp_lib_semaphore)
+BENCHMARK_TEMPLATE(BM_SemaphoreAcquireRelease, std::binary_semaphore)->Apply(ThreadCounts);
+BENCHMARK_TEMPLATE(BM_SemaphoreAcquireRelease, std::counting_semaphore<>)->Apply(ThreadCounts);
+#endif
+
+// try_acquire on a semaphore with no count left, which polls return at once.
+template <class Semaphore>
+static void BM_SemaphoreTryAcquireFailed(benchmark::State& st) {
+  Semaphore sem(0);
+  benchmark::DoNotOptimize(&sem);
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(sem.try_acquire());
+  }
+}
+BENCHMARK_TEMPLATE(BM_SemaphoreTryAcquireFailed, cuda::std::binary_semaphore);
+BENCHMARK_TEMPLATE(BM_SemaphoreTryAcquireFailed, cuda::std::counting_semaphore<>);
+#if defined(__cpp_lib_semaphore)
+BENCHMARK_TEMPLATE(BM_SemaphoreTryAcquireFailed, std::binary_semaphore);
+BENCHMARK_TEMPLATE(BM_SemaphoreTryAcquireFailed, std::counting_semaphore<>);
+#endif
+
+// Two threads hand a token back and forth through two semaphores. An
+// iteration is two wake ups, from the release in one thread to the return
+// from acquire in the other.
+template <class Semaphore>
+static void BM_SemaphoreWakeUpLatency(benchmark::State& st) {
+  Semaphore ping(0);
+  Semaphore pong(0);
+  std::atomic<bool> done{false};
+  std::thread partner([&] {
+    for (;;) {
+      ping.acquire();
+      if (done.load())
+        return;
+      pong.release();
+    }
+  });
+  for (auto _ : st) {
+    ping.release();
+    pong.acquire();
+  }
+  done.store(true);
+  ping.release();
+  partner.join();
+}
+BENCHMARK_TEMPLATE(BM_SemaphoreWakeUpLatency, cuda::std::binary_semaphore)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SemaphoreWakeUpLatency, cuda::std::counting_semaphore<>)->UseRealTime();
+#if defined(__cpp_lib_semaphore)
+BENCHMARK_TEMPLATE(BM_SemaphoreWakeUpLatency, std::binary_semaphore)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SemaphoreWakeUpLatency, std::counting_semaphore<>)->UseRealTime();
+#endif
+
+BENCHMARK_MAIN();
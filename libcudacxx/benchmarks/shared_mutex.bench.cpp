@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/seqlock>
+#include <cuda/shared_mutex>
+
+#include <cstdint>
+#include <shared_mutex>
+
+#include "sync_benchmark.h"
+
+// The value the threads read and write, bigger than one atomic operation.
+struct Pair {
+  std::uint64_t first;
+  std::uint64_t second;
+};
+
+// A Pair behind a reader-writer lock.
+template <class Mutex>
+class Locked {
+public:
+  Pair read() {
+    mutex_.lock_shared();
+    const Pair value = value_;
+    mutex_.unlock_shared();
+    return value;
+  }
+
+  void write(std::uint64_t n) {
+    mutex_.lock();
+    value_ = Pair{n, n};
+    mutex_.unlock();
+  }
+
+private:
+  Mutex mutex_;
+  Pair value_{};
+};
+
+// A Pair in a seqlock, which readers do not write to.
+class Sequenced {
+public:
+  Pair read() { return value_.load(); }
+  void write(std::uint64_t n) { value_.store(Pair{n, n}); }
+
+private:
+  cuda::seqlock<Pair> value_;
+};
+
+// 1, 2, 4, ... 128 threads, for each of which every thread writes once per
+// 1000 reads, once per 100 reads, and never.
+static void ReadHeavyMixes(benchmark::internal::Benchmark* b) {
+  b->ArgName("reads_per_write")->Arg(1000)->Arg(100)->Arg(0);
+  for (int threads = 1; threads <= 128; threads *= 2)
+    b->Threads(threads);
+  b->UseRealTime();
+}
+
+// Every thread reads the value, and after every reads_per_write reads writes
+// it instead, or never does if reads_per_write is 0. The items processed are
+// the reads and the writes.
+template <class Guarded>
+static void BM_ReadHeavy(benchmark::State& st) {
+  static Shared<Guarded> guarded;
+  guarded.Construct(st);
+  const std::int64_t reads_per_write = st.range(0);
+  std::int64_t reads = 0;
+  std::uint64_t n = 0;
+  for (auto _ : st) {
+    if (reads_per_write != 0 && reads == reads_per_write) {
+      guarded->write(++n);
+      reads = 0;
+    } else {
+      const Pair value = guarded->read();
+      benchmark::DoNotOptimize(value);
+      ++reads;
+    }
+  }
+  st.SetItemsProcessed(st.iterations());
+  guarded.Destroy(st);
+}
+BENCHMARK_TEMPLATE(BM_ReadHeavy, Locked<cuda::shared_mutex<>>)->Apply(ReadHeavyMixes);
+BENCHMARK_TEMPLATE(BM_ReadHeavy, Locked<std::shared_mutex>)->Apply(ReadHeavyMixes);
+BENCHMARK_TEMPLATE(BM_ReadHeavy, Sequenced)->Apply(ReadHeavyMixes);
+
+BENCHMARK_MAIN();
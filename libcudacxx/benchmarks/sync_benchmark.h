@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LIBCUDACXX_BENCHMARKS_SYNC_BENCHMARK_H
+#define LIBCUDACXX_BENCHMARKS_SYNC_BENCHMARK_H
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+#if __has_include(<version>)
+#  include <version>
+#endif
+
+#include "benchmark/benchmark.h"
+
+// The synchronization primitives are measured at 1, 2, 4, ... threads up to
+// the number of hardware threads, and at least at 2 threads, so that every
+// primitive is measured both uncontended and contended. The times are wall
+// clock times, since the threads spend much of them blocked.
+inline void ThreadCounts(benchmark::internal::Benchmark* b) {
+  const int max_threads = std::max(2u, std::thread::hardware_concurrency());
+  for (int threads = 1; threads < max_threads; threads *= 2)
+    b->Threads(threads);
+  b->Threads(max_threads);
+  b->UseRealTime();
+}
+
+// An object shared by the threads of a benchmark. The first thread constructs
+// it before, and destroys it after, the timed loops of all the threads, which
+// the benchmark library starts and stops together.
+template <class T>
+class Shared {
+public:
+  template <class... Args>
+  void Construct(const benchmark::State& st, Args&&... args) {
+    if (st.thread_index == 0)
+      object_ = new T(std::forward<Args>(args)...);
+  }
+
+  void Destroy(const benchmark::State& st) {
+    if (st.thread_index == 0) {
+      delete object_;
+      object_ = nullptr;
+    }
+  }
+
+  T& operator*() const { return *object_; }
+  T* operator->() const { return object_; }
+
+private:
+  T* object_ = nullptr;
+};
+
+#endif // LIBCUDACXX_BENCHMARKS_SYNC_BENCHMARK_H
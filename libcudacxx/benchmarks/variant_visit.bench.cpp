@@ -0,0 +1,118 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/variant>
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <variant>
+
+#include "benchmark/benchmark.h"
+
+// The variant and visit of cuda::std and, for comparison, of std.
+struct CudaStd {
+  template <class... Ts>
+  using variant = cuda::std::variant<Ts...>;
+
+  template <class Visitor, class... Variants>
+  static decltype(auto) visit(Visitor&& visitor, Variants&&... variants) {
+    return cuda::std::visit(std::forward<Visitor>(visitor), std::forward<Variants>(variants)...);
+  }
+};
+
+struct Std {
+  template <class... Ts>
+  using variant = std::variant<Ts...>;
+
+  template <class Visitor, class... Variants>
+  static decltype(auto) visit(Visitor&& visitor, Variants&&... variants) {
+    return std::visit(std::forward<Visitor>(visitor), std::forward<Variants>(variants)...);
+  }
+};
+
+template <std::size_t I>
+struct Alternative {
+  int value = static_cast<int>(I);
+};
+
+template <class Lib, class Indices>
+struct MakeVariant;
+
+template <class Lib, std::size_t... Is>
+struct MakeVariant<Lib, std::index_sequence<Is...>> {
+  using type = typename Lib::template variant<Alternative<Is>...>;
+};
+
+template <class Lib, std::size_t N>
+using Variant = typename MakeVariant<Lib, std::make_index_sequence<N>>::type;
+
+template <class Lib, std::size_t N, std::size_t... Is>
+static Variant<Lib, N> MakeAlternative(std::size_t index, std::index_sequence<Is...>) {
+  Variant<Lib, N> result;
+  ((index == Is ? (void)result.template emplace<Is>() : (void)0), ...);
+  return result;
+}
+
+// Enough variants holding random alternatives for the branch predictor not to
+// learn the sequence, so that the cost of dispatching on the index shows.
+template <class Lib, std::size_t N>
+static std::array<Variant<Lib, N>, 1 << 16> MakeVariants() {
+  std::array<Variant<Lib, N>, 1 << 16> result;
+  std::mt19937 generator;
+  std::uniform_int_distribution<std::size_t> distribution(0, N - 1);
+  for (auto& v : result)
+    v = MakeAlternative<Lib, N>(distribution(generator), std::make_index_sequence<N>{});
+  return result;
+}
+
+struct Visitor {
+  template <class... Alternatives>
+  int operator()(const Alternatives&... alternatives) const {
+    return (alternatives.value + ... + 0);
+  }
+};
+
+template <class Lib, std::size_t N>
+static void BM_Visit1(benchmark::State& st) {
+  static const auto variants = MakeVariants<Lib, N>();
+  std::size_t i = 0;
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(Lib::visit(Visitor{}, variants[i]));
+    i = (i + 1) % variants.size();
+  }
+}
+BENCHMARK_TEMPLATE(BM_Visit1, CudaStd, 2);
+BENCHMARK_TEMPLATE(BM_Visit1, CudaStd, 8);
+BENCHMARK_TEMPLATE(BM_Visit1, CudaStd, 32);
+BENCHMARK_TEMPLATE(BM_Visit1, Std, 2);
+BENCHMARK_TEMPLATE(BM_Visit1, Std, 8);
+BENCHMARK_TEMPLATE(BM_Visit1, Std, 32);
+
+// Two variants of 32 alternatives make 1024 combinations, which cuda::std
+// visits through a table of function pointers rather than a switch.
+template <class Lib, std::size_t N>
+static void BM_Visit2(benchmark::State& st) {
+  static const auto variants = MakeVariants<Lib, N>();
+  std::size_t i = 0;
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(Lib::visit(Visitor{}, variants[i], variants[variants.size() - 1 - i]));
+    i = (i + 1) % variants.size();
+  }
+}
+BENCHMARK_TEMPLATE(BM_Visit2, CudaStd, 2);
+BENCHMARK_TEMPLATE(BM_Visit2, CudaStd, 8);
+BENCHMARK_TEMPLATE(BM_Visit2, CudaStd, 32);
+BENCHMARK_TEMPLATE(BM_Visit2, Std, 2);
+BENCHMARK_TEMPLATE(BM_Visit2, Std, 8);
+BENCHMARK_TEMPLATE(BM_Visit2, Std, 32);
+
+BENCHMARK_MAIN();
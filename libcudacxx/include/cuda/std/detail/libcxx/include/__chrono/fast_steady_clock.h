@@ -0,0 +1,277 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CHRONO_FAST_STEADY_CLOCK_H
+#define _LIBCUDACXX___CHRONO_FAST_STEADY_CLOCK_H
+
+#ifndef __cuda_std__
+#include <__config>
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../chrono"
+
+#include <nv/target>
+
+#if !defined(_CCCL_COMPILER_NVRTC)
+#  if defined(__linux__)
+#    include <time.h>
+#  endif // __linux__
+#  if defined(_CCCL_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#  endif // _CCCL_COMPILER_MSVC
+#endif // _CCCL_COMPILER_NVRTC
+
+#if !defined(_CCCL_COMPILER_NVRTC)
+#  if defined(_CCCL_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+#    define _LIBCUDACXX_FAST_STEADY_CLOCK_TSC
+#  elif !defined(_CCCL_COMPILER_MSVC) && defined(__x86_64__)
+#    define _LIBCUDACXX_FAST_STEADY_CLOCK_TSC
+#  elif !defined(_CCCL_COMPILER_MSVC) && defined(__aarch64__)
+#    define _LIBCUDACXX_FAST_STEADY_CLOCK_CNTVCT
+#  endif
+#endif // _CCCL_COMPILER_NVRTC
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace chrono {
+
+// __fast_steady_clock is a steady clock which is cheap enough to be read on
+// every iteration of a backoff loop. On the host, it counts the invariant
+// time stamp counter of x86 processors, calibrated against the monotonic
+// clock between two of its reads, or the virtual counter of ARM processors.
+// Elsewhere, it reads CLOCK_MONOTONIC_COARSE, or steady_clock. On the device,
+// it reads the global timer. Its time points are only comparable within a
+// process.
+class __fast_steady_clock
+{
+public:
+    typedef nanoseconds                                       duration;
+    typedef duration::rep                                     rep;
+    typedef duration::period                                  period;
+    typedef chrono::time_point<__fast_steady_clock, duration> time_point;
+    static _LIBCUDACXX_CONSTEXPR_AFTER_CXX11 const bool is_steady = true;
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    static time_point now() noexcept;
+};
+
+#if !defined(_CCCL_COMPILER_NVRTC)
+
+inline _LIBCUDACXX_HOST
+long long __monotonic_clock_ns() noexcept
+{
+#if defined(__linux__)
+    timespec __ts;
+    clock_gettime(CLOCK_MONOTONIC, &__ts);
+    return static_cast<long long>(__ts.tv_sec) * 1000000000ll + __ts.tv_nsec;
+#elif defined(__cuda_std__)
+    return ::std::chrono::duration_cast<::std::chrono::nanoseconds>(
+        ::std::chrono::steady_clock::now().time_since_epoch()).count();
+#elif !defined(_LIBCUDACXX_HAS_NO_MONOTONIC_CLOCK)
+    return steady_clock::now().time_since_epoch().count();
+#else
+    return duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// the monotonic clock at the resolution of the scheduler tick, which is read
+// without entering the kernel
+inline _LIBCUDACXX_HOST
+long long __coarse_monotonic_clock_ns() noexcept
+{
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_COARSE)
+    timespec __ts;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &__ts);
+    return static_cast<long long>(__ts.tv_sec) * 1000000000ll + __ts.tv_nsec;
+#else
+    return __monotonic_clock_ns();
+#endif
+}
+
+#if defined(_LIBCUDACXX_FAST_STEADY_CLOCK_TSC) || defined(_LIBCUDACXX_FAST_STEADY_CLOCK_CNTVCT)
+
+inline _LIBCUDACXX_HOST
+unsigned long long __fast_steady_clock_ticks() noexcept
+{
+#if defined(_LIBCUDACXX_FAST_STEADY_CLOCK_TSC) && defined(_CCCL_COMPILER_MSVC)
+    return __rdtsc();
+#elif defined(_LIBCUDACXX_FAST_STEADY_CLOCK_TSC)
+    unsigned __lo, __hi;
+    __asm__ __volatile__("rdtsc" : "=a"(__lo), "=d"(__hi));
+    return (static_cast<unsigned long long>(__hi) << 32) | __lo;
+#else
+    unsigned long long __ticks;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(__ticks));
+    return __ticks;
+#endif
+}
+
+// Reads the monotonic clock along with the counter at the middle of the read,
+// from the quickest of a few reads, since the first read of the clock can be
+// slowed down by page faults.
+inline _LIBCUDACXX_HOST
+void __fast_steady_clock_sample(unsigned long long& __ticks, long long& __ns) noexcept
+{
+    unsigned long long __best = ~0ull;
+    for (int __i = 0; __i < 4; ++__i) {
+        unsigned long long const __before = __fast_steady_clock_ticks();
+        long long const __now = __monotonic_clock_ns();
+        unsigned long long const __after = __fast_steady_clock_ticks();
+        if (__after - __before < __best) {
+            __best  = __after - __before;
+            __ticks = __before + __best / 2;
+            __ns    = __now;
+        }
+    }
+}
+
+struct __fast_steady_clock_source
+{
+    double             __ns_per_tick; // zero without a usable counter
+    unsigned long long __base_ticks;
+    long long          __base_ns;
+};
+
+#if defined(_LIBCUDACXX_FAST_STEADY_CLOCK_TSC)
+
+// The counter ticks which pass between the two samples of the calibration,
+// which are at least a third of a millisecond at the rates of current
+// processors, and bound the error of the rate to a few parts in ten thousand.
+#define _LIBCUDACXX_FAST_STEADY_CLOCK_CALIBRATION_TICKS (1ll << 21)
+
+struct __fast_steady_clock_origin
+{
+    bool               __usable;
+    unsigned long long __ticks;
+    long long          __ns;
+};
+
+inline _LIBCUDACXX_HOST
+__fast_steady_clock_origin __fast_steady_clock_start() noexcept
+{
+    __fast_steady_clock_origin __origin = {false, 0, 0};
+    // The counter must tick at a constant rate through frequency and power
+    // state changes, as the invariant TSC flag of CPUID leaf 0x80000007 says.
+    unsigned __regs[4];
+#  if defined(_CCCL_COMPILER_MSVC)
+    __cpuid(reinterpret_cast<int*>(__regs), static_cast<int>(0x80000000u));
+    unsigned const __max_leaf = __regs[0];
+    __cpuid(reinterpret_cast<int*>(__regs), static_cast<int>(0x80000007u));
+#  else
+    __asm__ __volatile__("cpuid" : "=a"(__regs[0]), "=b"(__regs[1]), "=c"(__regs[2]), "=d"(__regs[3]) : "a"(0x80000000u), "c"(0u));
+    unsigned const __max_leaf = __regs[0];
+    __asm__ __volatile__("cpuid" : "=a"(__regs[0]), "=b"(__regs[1]), "=c"(__regs[2]), "=d"(__regs[3]) : "a"(0x80000007u), "c"(0u));
+#  endif
+    if (__max_leaf < 0x80000007u || !(__regs[3] & (1u << 8)))
+        return __origin;
+    __fast_steady_clock_sample(__origin.__ticks, __origin.__ns);
+    __origin.__usable = true;
+    return __origin;
+}
+
+// Computes the rate of the counter from the sample of the first read of the
+// clock and a sample taken now, once the counter advanced far enough.
+inline _LIBCUDACXX_HOST
+__fast_steady_clock_source __fast_steady_clock_calibrate(__fast_steady_clock_origin const& __origin) noexcept
+{
+    __fast_steady_clock_source __source = {0.0, 0, 0};
+    unsigned long long __ticks = 0;
+    long long __ns = 0;
+    __fast_steady_clock_sample(__ticks, __ns);
+    if (__ticks <= __origin.__ticks || __ns <= __origin.__ns)
+        return __source;
+    __source.__ns_per_tick = static_cast<double>(__ns - __origin.__ns) / static_cast<double>(__ticks - __origin.__ticks);
+    __source.__base_ticks  = __ticks;
+    __source.__base_ns     = __ns;
+    return __source;
+}
+
+#else
+
+inline _LIBCUDACXX_HOST
+__fast_steady_clock_source __fast_steady_clock_calibrate() noexcept
+{
+    __fast_steady_clock_source __source = {0.0, 0, 0};
+    unsigned long long __frequency;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(__frequency));
+    if (__frequency == 0)
+        return __source;
+    __source.__ns_per_tick = 1e9 / static_cast<double>(__frequency);
+    __source.__base_ticks  = __fast_steady_clock_ticks();
+    __source.__base_ns     = __monotonic_clock_ns();
+    return __source;
+}
+
+#endif // _LIBCUDACXX_FAST_STEADY_CLOCK_TSC
+
+inline _LIBCUDACXX_HOST
+long long __fast_steady_clock_ns(__fast_steady_clock_source const& __source, unsigned long long __ticks) noexcept
+{
+    return __source.__base_ns + static_cast<long long>(
+        static_cast<double>(static_cast<long long>(__ticks - __source.__base_ticks)) * __source.__ns_per_tick);
+}
+
+#endif // _LIBCUDACXX_FAST_STEADY_CLOCK_TSC || _LIBCUDACXX_FAST_STEADY_CLOCK_CNTVCT
+
+inline _LIBCUDACXX_HOST
+long long __fast_steady_clock_ns() noexcept
+{
+#if defined(_LIBCUDACXX_FAST_STEADY_CLOCK_TSC)
+    // The first read samples the counter, and the first read after the
+    // counter advanced by the calibration ticks takes the second sample, so
+    // that no read waits for the calibration. Until then, the clock reads the
+    // monotonic clock, which the calibrated counter continues from.
+    static __fast_steady_clock_origin const __origin = __fast_steady_clock_start();
+    if (__origin.__usable) {
+        unsigned long long const __ticks = __fast_steady_clock_ticks();
+        if (static_cast<long long>(__ticks - __origin.__ticks) < _LIBCUDACXX_FAST_STEADY_CLOCK_CALIBRATION_TICKS)
+            return __monotonic_clock_ns();
+        static __fast_steady_clock_source const __source = __fast_steady_clock_calibrate(__origin);
+        if (__source.__ns_per_tick != 0.0)
+            return __fast_steady_clock_ns(__source, __ticks);
+        return __monotonic_clock_ns();
+    }
+#elif defined(_LIBCUDACXX_FAST_STEADY_CLOCK_CNTVCT)
+    static __fast_steady_clock_source const __source = __fast_steady_clock_calibrate();
+    if (__source.__ns_per_tick != 0.0)
+        return __fast_steady_clock_ns(__source, __fast_steady_clock_ticks());
+#endif
+    return __coarse_monotonic_clock_ns();
+}
+
+#endif // _CCCL_COMPILER_NVRTC
+
+inline _LIBCUDACXX_INLINE_VISIBILITY
+__fast_steady_clock::time_point __fast_steady_clock::now() noexcept
+{
+NV_DISPATCH_TARGET(
+NV_IS_DEVICE, (
+    uint64_t __time;
+    asm volatile("mov.u64 %0, %%globaltimer;":"=l"(__time)::);
+    return time_point(duration(static_cast<rep>(__time)));
+),
+NV_IS_HOST, (
+    return time_point(duration(__fast_steady_clock_ns()));
+));
+}
+
+} // namespace chrono
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___CHRONO_FAST_STEADY_CLOCK_H
@@ -0,0 +1,377 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_CONCURRENT_QUEUE_H
+#define _LIBCUDACXX___CUDA_CONCURRENT_QUEUE_H
+
+#ifndef __cuda_std__
+#error "<__cuda/concurrent_queue> should only be included in from <cuda/concurrent_queue>"
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../__memory/construct_at.h"
+#include "../__type_traits/integral_constant.h"
+#include "../__type_traits/is_nothrow_constructible.h"
+#include "../__type_traits/is_nothrow_move_assignable.h"
+#include "../__type_traits/is_nothrow_move_constructible.h"
+#include "../__utility/forward.h"
+#include "../__utility/move.h"
+#include "../atomic"
+
+#ifndef _CCCL_COMPILER_NVRTC
+#  include <new> // placement new
+#endif // _CCCL_COMPILER_NVRTC
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// Uninitialized storage for one element of a queue. Whether it holds an
+// element is tracked by the indices of the queue.
+template <class _Tp>
+struct __queue_slot {
+    alignas(_Tp) unsigned char __bytes[sizeof(_Tp)];
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    _Tp* __get() noexcept { return reinterpret_cast<_Tp*>(__bytes); }
+};
+
+// A bounded single producer, single consumer queue.
+//
+// __head is the index of the next element to pop and __tail the index of the
+// next one to push. Both only ever grow; an index is taken modulo _Capacity to
+// find its slot. The consumer owns __head and the producer owns __tail, and
+// each keeps a copy of the index the other owns, which it only reloads when
+// the queue looks empty or full to it. Each index and its copy sit on their
+// own cache line, so that the two threads only share a line when one of them
+// has to look at the progress of the other.
+//
+// The blocking push and pop wait on the index of the other side, which is
+// notified whenever it changes.
+template <class _Tp, size_t _Capacity, thread_scope _Sco = thread_scope_system>
+class spsc_queue {
+    static_assert(_Capacity > 0, "spsc_queue needs a capacity other than zero.");
+
+    alignas(64) atomic<size_t, _Sco> __head{0};
+    size_t __tail_copy = 0;
+
+    alignas(64) atomic<size_t, _Sco> __tail{0};
+    size_t __head_copy = 0;
+
+    alignas(64) __queue_slot<_Tp> __slots[_Capacity];
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    _Tp* __slot(size_t __index) noexcept { return __slots[__index % _Capacity].__get(); }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool __full(size_t __t) noexcept {
+        if (__t - __head_copy != _Capacity)
+            return false;
+        __head_copy = __head.load(_CUDA_VSTD::memory_order_acquire);
+        return __t - __head_copy == _Capacity;
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool __empty(size_t __h) noexcept {
+        if (__h != __tail_copy)
+            return false;
+        __tail_copy = __tail.load(_CUDA_VSTD::memory_order_acquire);
+        return __h == __tail_copy;
+    }
+
+    template <class... _Args>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __push_at(size_t __t, _Args&&... __args) {
+        _CUDA_VSTD::__construct_at(__slot(__t), _CUDA_VSTD::forward<_Args>(__args)...);
+        __tail.store(__t + 1, _CUDA_VSTD::memory_order_release);
+        __tail.notify_one();
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __pop_at(size_t __h, _Tp& __value) {
+        _Tp* const __p = __slot(__h);
+        __value = _CUDA_VSTD::move(*__p);
+        _CUDA_VSTD::__destroy_at(__p);
+        __head.store(__h + 1, _CUDA_VSTD::memory_order_release);
+        __head.notify_one();
+    }
+
+public:
+    using value_type = _Tp;
+    using size_type = size_t;
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    static constexpr size_t capacity() noexcept { return _Capacity; }
+
+    spsc_queue() = default;
+    spsc_queue(const spsc_queue&) = delete;
+    spsc_queue& operator=(const spsc_queue&) = delete;
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    ~spsc_queue() {
+        const size_t __t = __tail.load(_CUDA_VSTD::memory_order_relaxed);
+        for (size_t __h = __head.load(_CUDA_VSTD::memory_order_relaxed); __h != __t; ++__h)
+            _CUDA_VSTD::__destroy_at(__slot(__h));
+    }
+
+    // Called by the producer only.
+    template <class... _Args>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_emplace(_Args&&... __args) {
+        const size_t __t = __tail.load(_CUDA_VSTD::memory_order_relaxed);
+        if (__full(__t))
+            return false;
+        __push_at(__t, _CUDA_VSTD::forward<_Args>(__args)...);
+        return true;
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_push(const _Tp& __value) { return try_emplace(__value); }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_push(_Tp&& __value) { return try_emplace(_CUDA_VSTD::move(__value)); }
+
+    // Called by the producer only. Waits for the consumer while the queue is full.
+    template <class... _Args>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void emplace(_Args&&... __args) {
+        const size_t __t = __tail.load(_CUDA_VSTD::memory_order_relaxed);
+        while (__full(__t))
+            __head.wait(__head_copy, _CUDA_VSTD::memory_order_relaxed);
+        __push_at(__t, _CUDA_VSTD::forward<_Args>(__args)...);
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void push(const _Tp& __value) { emplace(__value); }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void push(_Tp&& __value) { emplace(_CUDA_VSTD::move(__value)); }
+
+    // Called by the consumer only.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_pop(_Tp& __value) {
+        const size_t __h = __head.load(_CUDA_VSTD::memory_order_relaxed);
+        if (__empty(__h))
+            return false;
+        __pop_at(__h, __value);
+        return true;
+    }
+
+    // Called by the consumer only. Waits for the producer while the queue is empty.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void pop(_Tp& __value) {
+        const size_t __h = __head.load(_CUDA_VSTD::memory_order_relaxed);
+        while (__empty(__h))
+            __tail.wait(__tail_copy, _CUDA_VSTD::memory_order_relaxed);
+        __pop_at(__h, __value);
+    }
+};
+
+// A bounded multi producer, multi consumer queue, after the one by Dmitry
+// Vyukov.
+//
+// Every slot carries a sequence number, which tells the index that may use it
+// next: the slot of index __i is free for the push of __i while its sequence
+// is __i, and holds the element of __i for the pop of __i while its sequence
+// is __i + 1. The pop moves the sequence on to __i + _Capacity, the next index
+// to map to the slot. The threads claim indices from __head and __tail, which
+// are on separate cache lines, and otherwise only touch the slots they claimed.
+//
+// try_push and try_pop only claim an index whose slot is ready, and so never
+// wait. push and pop claim the next index unconditionally and wait on the
+// sequence of its slot, which is notified whenever it changes. Both kinds of
+// operations can be used on the same queue.
+//
+// Once an index is claimed, its slot must be filled or emptied, or the threads
+// of the following laps wait for it forever. The element is moved in and out
+// of a claimed slot, which must not throw; an element which may throw on
+// construction is constructed before an index is claimed.
+template <class _Tp, size_t _Capacity, thread_scope _Sco = thread_scope_system>
+class mpmc_queue {
+    static_assert(_Capacity >= 2 && (_Capacity & (_Capacity - 1)) == 0,
+                  "mpmc_queue needs a capacity which is a power of two other than one.");
+    static_assert(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_move_constructible, _Tp)
+                      && _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_move_assignable, _Tp),
+                  "mpmc_queue needs an element type which is moved without throwing.");
+
+    struct __cell {
+        atomic<size_t, _Sco> __sequence;
+        __queue_slot<_Tp> __slot;
+    };
+
+    alignas(64) atomic<size_t, _Sco> __head{0};
+    alignas(64) atomic<size_t, _Sco> __tail{0};
+    alignas(64) __cell __cells[_Capacity];
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    __cell& __cell_of(size_t __index) noexcept { return __cells[__index & (_Capacity - 1)]; }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    static void __wait_for(__cell& __c, size_t __sequence) noexcept {
+        for (size_t __s = __c.__sequence.load(_CUDA_VSTD::memory_order_acquire); __s != __sequence;
+             __s = __c.__sequence.load(_CUDA_VSTD::memory_order_acquire))
+            __c.__sequence.wait(__s, _CUDA_VSTD::memory_order_relaxed);
+    }
+
+    template <class... _Args>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    static void __push_at(__cell& __c, size_t __index, _Args&&... __args) {
+        _CUDA_VSTD::__construct_at(__c.__slot.__get(), _CUDA_VSTD::forward<_Args>(__args)...);
+        __c.__sequence.store(__index + 1, _CUDA_VSTD::memory_order_release);
+        __c.__sequence.notify_all();
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    static void __pop_at(__cell& __c, size_t __index, _Tp& __value) {
+        _Tp* const __p = __c.__slot.__get();
+        __value = _CUDA_VSTD::move(*__p);
+        _CUDA_VSTD::__destroy_at(__p);
+        __c.__sequence.store(__index + _Capacity, _CUDA_VSTD::memory_order_release);
+        __c.__sequence.notify_all();
+    }
+
+    // Claims the index __counter holds if the sequence of its slot is that
+    // index plus __ready, and returns it in __index.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool __try_claim(atomic<size_t, _Sco>& __counter, size_t __ready, size_t& __index) noexcept {
+        __index = __counter.load(_CUDA_VSTD::memory_order_relaxed);
+        for (;;) {
+            const size_t __s = __cell_of(__index).__sequence.load(_CUDA_VSTD::memory_order_acquire);
+            const ptrdiff_t __diff = static_cast<ptrdiff_t>(__s - (__index + __ready));
+            if (__diff == 0) {
+                if (__counter.compare_exchange_weak(__index, __index + 1, _CUDA_VSTD::memory_order_relaxed,
+                                                    _CUDA_VSTD::memory_order_relaxed))
+                    return true;
+            }
+            else if (__diff < 0) {
+                // the slot still holds the element of, or waits for the pop
+                // of, the index one lap before
+                return false;
+            }
+            else {
+                __index = __counter.load(_CUDA_VSTD::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Whether an element is constructed from _Args in its claimed slot, or
+    // constructed first and moved in.
+    template <class... _Args>
+    using __nothrow_constructible = _CUDA_VSTD::integral_constant<bool,
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, _Tp, _Args...)>;
+
+    template <class... _Args>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool __try_emplace(_CUDA_VSTD::true_type, _Args&&... __args) {
+        size_t __index;
+        if (!__try_claim(__tail, 0, __index))
+            return false;
+        __push_at(__cell_of(__index), __index, _CUDA_VSTD::forward<_Args>(__args)...);
+        return true;
+    }
+
+    template <class... _Args>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool __try_emplace(_CUDA_VSTD::false_type, _Args&&... __args) {
+        _Tp __value(_CUDA_VSTD::forward<_Args>(__args)...);
+        return __try_emplace(_CUDA_VSTD::true_type(), _CUDA_VSTD::move(__value));
+    }
+
+    template <class... _Args>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __emplace(_CUDA_VSTD::true_type, _Args&&... __args) {
+        const size_t __index = __tail.fetch_add(1, _CUDA_VSTD::memory_order_relaxed);
+        __cell& __c = __cell_of(__index);
+        __wait_for(__c, __index);
+        __push_at(__c, __index, _CUDA_VSTD::forward<_Args>(__args)...);
+    }
+
+    template <class... _Args>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __emplace(_CUDA_VSTD::false_type, _Args&&... __args) {
+        _Tp __value(_CUDA_VSTD::forward<_Args>(__args)...);
+        __emplace(_CUDA_VSTD::true_type(), _CUDA_VSTD::move(__value));
+    }
+
+public:
+    using value_type = _Tp;
+    using size_type = size_t;
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    static constexpr size_t capacity() noexcept { return _Capacity; }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    mpmc_queue() noexcept {
+        for (size_t __i = 0; __i < _Capacity; ++__i)
+            __cells[__i].__sequence.store(__i, _CUDA_VSTD::memory_order_relaxed);
+    }
+
+    mpmc_queue(const mpmc_queue&) = delete;
+    mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    ~mpmc_queue() {
+        const size_t __t = __tail.load(_CUDA_VSTD::memory_order_relaxed);
+        for (size_t __h = __head.load(_CUDA_VSTD::memory_order_relaxed); __h < __t; ++__h)
+            _CUDA_VSTD::__destroy_at(__cell_of(__h).__slot.__get());
+    }
+
+    template <class... _Args>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_emplace(_Args&&... __args) {
+        return __try_emplace(__nothrow_constructible<_Args...>(), _CUDA_VSTD::forward<_Args>(__args)...);
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_push(const _Tp& __value) { return try_emplace(__value); }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_push(_Tp&& __value) { return try_emplace(_CUDA_VSTD::move(__value)); }
+
+    // Waits for the pop of the index one lap before while the queue is full.
+    template <class... _Args>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void emplace(_Args&&... __args) {
+        __emplace(__nothrow_constructible<_Args...>(), _CUDA_VSTD::forward<_Args>(__args)...);
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void push(const _Tp& __value) { emplace(__value); }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void push(_Tp&& __value) { emplace(_CUDA_VSTD::move(__value)); }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_pop(_Tp& __value) {
+        size_t __index;
+        if (!__try_claim(__head, 1, __index))
+            return false;
+        __pop_at(__cell_of(__index), __index, __value);
+        return true;
+    }
+
+    // Waits for the push of the claimed index while the queue is empty.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void pop(_Tp& __value) {
+        const size_t __index = __head.fetch_add(1, _CUDA_VSTD::memory_order_relaxed);
+        __cell& __c = __cell_of(__index);
+        __wait_for(__c, __index + 1);
+        __pop_at(__c, __index, __value);
+    }
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _LIBCUDACXX___CUDA_CONCURRENT_QUEUE_H
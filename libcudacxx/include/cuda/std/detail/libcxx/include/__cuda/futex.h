@@ -0,0 +1,112 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_FUTEX_H
+#define _LIBCUDACXX___CUDA_FUTEX_H
+
+#ifndef __cuda_std__
+#error "<__cuda/futex> should only be included in from <cuda/shared_mutex> or <cuda/seqlock>"
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../atomic"
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// The threads which sleep on some int atomics of a lock.
+//
+// atomic::wait polls with a growing backoff on the host, so a thread could
+// oversleep a release by up to a millisecond. On the Linux host, threads
+// sleep on the atomic itself with a futex instead, which is shared between
+// processes for thread_scope_system and private to the process otherwise.
+// The count of sleepers lets a release skip the system call while no thread
+// sleeps. Elsewhere, this is atomic::wait and atomic::notify.
+template <thread_scope _Sco>
+class __futex_sleepers {
+    mutable atomic<int, _Sco> __count{0};
+
+#if defined(_LIBCUDACXX_HAS_FUTEX)
+    static_assert(sizeof(atomic<int, _Sco>) == sizeof(int), "a futex needs the atomic to be a plain int.");
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    static int const volatile* __address(const atomic<int, _Sco>& __word) noexcept {
+        return reinterpret_cast<int const volatile*>(&__word);
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __host_wait(const atomic<int, _Sco>& __word, int __old) const noexcept {
+        for (int __i = 0; __i < _LIBCUDACXX_POLLING_COUNT; ++__i) {
+            if (__word.load(_CUDA_VSTD::memory_order_relaxed) != __old)
+                return;
+            _CUDA_VSTD::__libcpp_thread_yield_processor();
+        }
+        // the count must be seen by a release which changes __word after the
+        // kernel has compared it to __old
+        __count.fetch_add(1, _CUDA_VSTD::memory_order_seq_cst);
+        _CUDA_VSTD::__libcpp_futex_wait(__address(__word), __old, _Sco == thread_scope_system);
+        __count.fetch_sub(1, _CUDA_VSTD::memory_order_relaxed);
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __host_wake(const atomic<int, _Sco>& __word, bool __all) const noexcept {
+        atomic_thread_fence(_CUDA_VSTD::memory_order_seq_cst, _Sco);
+        if (__count.load(_CUDA_VSTD::memory_order_relaxed) != 0)
+            _CUDA_VSTD::__libcpp_futex_wake(__address(__word), __all, _Sco == thread_scope_system);
+    }
+#endif // _LIBCUDACXX_HAS_FUTEX
+
+public:
+    // Returns once __word may no longer hold __old. May return early.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __wait(const atomic<int, _Sco>& __word, int __old) const noexcept {
+#if defined(_LIBCUDACXX_HAS_FUTEX)
+        NV_IF_ELSE_TARGET(NV_IS_HOST,
+            (__host_wait(__word, __old);),
+            (__word.wait(__old, _CUDA_VSTD::memory_order_relaxed);))
+#else
+        __word.wait(__old, _CUDA_VSTD::memory_order_relaxed);
+#endif // _LIBCUDACXX_HAS_FUTEX
+    }
+
+    // Wakes one thread waiting on __word, which has just been changed.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __wake_one(atomic<int, _Sco>& __word) const noexcept {
+#if defined(_LIBCUDACXX_HAS_FUTEX)
+        NV_IF_ELSE_TARGET(NV_IS_HOST,
+            (__host_wake(__word, false);),
+            (__word.notify_one();))
+#else
+        __word.notify_one();
+#endif // _LIBCUDACXX_HAS_FUTEX
+    }
+
+    // Wakes every thread waiting on __word, which has just been changed.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __wake_all(atomic<int, _Sco>& __word) const noexcept {
+#if defined(_LIBCUDACXX_HAS_FUTEX)
+        NV_IF_ELSE_TARGET(NV_IS_HOST,
+            (__host_wake(__word, true);),
+            (__word.notify_all();))
+#else
+        __word.notify_all();
+#endif // _LIBCUDACXX_HAS_FUTEX
+    }
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _LIBCUDACXX___CUDA_FUTEX_H
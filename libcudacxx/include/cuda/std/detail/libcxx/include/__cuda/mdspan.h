@@ -0,0 +1,219 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_MDSPAN_H
+#define _LIBCUDACXX___CUDA_MDSPAN_H
+
+#ifndef __cuda_std__
+#error "<__cuda/mdspan> should only be included in from <cuda/mdspan>"
+#endif // __cuda_std__
+
+#if _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// layout_blocked splits the index space into blocks with the given static
+// extents. The elements of a block are contiguous and laid out like
+// layout_right, and the blocks follow each other like the elements of a
+// layout_right mapping of the extents rounded up to whole blocks. Blocks
+// which stick out of the extents are padded.
+template <size_t... _BlockExtents>
+struct layout_blocked {
+  template <class _Extents>
+    class mapping;
+};
+
+template <size_t... _BlockExtents>
+template <class _Extents>
+class layout_blocked<_BlockExtents...>::mapping {
+  public:
+    using extents_type = _Extents;
+    using index_type = typename extents_type::index_type;
+    using size_type = typename extents_type::size_type;
+    using rank_type = typename extents_type::rank_type;
+    using layout_type = layout_blocked<_BlockExtents...>;
+  private:
+
+    static_assert(_CUDA_VSTD::__detail::__is_extents_v<extents_type>, "layout_blocked::mapping must be instantiated with a specialization of cuda::std::extents.");
+    static_assert(sizeof...(_BlockExtents) == extents_type::rank(), "layout_blocked needs one block extent for each extent.");
+    static_assert(__MDSPAN_FOLD_AND((_BlockExtents > 0) /* && ... */), "layout_blocked needs block extents other than zero.");
+
+    template <class>
+    friend class mapping;
+
+    static constexpr rank_type __rank = extents_type::rank();
+
+    __MDSPAN_INLINE_FUNCTION
+    static constexpr index_type __block_extent(rank_type __r) noexcept {
+      return _CUDA_VSTD::array<index_type, __rank + 1>{{static_cast<index_type>(_BlockExtents)..., 1}}[__r];
+    }
+
+    __MDSPAN_INLINE_FUNCTION
+    static constexpr index_type __block_size() noexcept {
+      return __MDSPAN_FOLD_TIMES_RIGHT((static_cast<index_type>(_BlockExtents)), /* * ... * */ 1);
+    }
+
+    // the number of blocks along dimension __r
+    __MDSPAN_INLINE_FUNCTION
+    constexpr index_type __blocks(rank_type __r) const noexcept {
+      return (__extents.extent(__r) + __block_extent(__r) - 1) / __block_extent(__r);
+    }
+
+    // The block and the offset within it are accumulated like the offset of a
+    // layout_right mapping. The block extents are compile time constants, so
+    // the divisions by them are cheap.
+    template <size_t _r>
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __compute_offset(index_type __block, index_type __inner) const noexcept {
+      return __block * __block_size() + __inner;
+    }
+
+    template <size_t _r, class... _Indices>
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __compute_offset(index_type __block, index_type __inner, index_type __i, _Indices... __idx) const noexcept {
+      return __compute_offset<_r+1>(
+        __block * __blocks(_r) + __i / _CUDA_VSTD::integral_constant<index_type, __block_extent(_r)>::value,
+        __inner * __block_extent(_r) + __i % _CUDA_VSTD::integral_constant<index_type, __block_extent(_r)>::value,
+        __idx...);
+    }
+
+  public:
+
+    //--------------------------------------------------------------------------------
+
+    __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping() noexcept = default;
+    __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(mapping const&) noexcept = default;
+
+    _LIBCUDACXX_HOST_DEVICE
+    constexpr mapping(extents_type const& __exts) noexcept
+      :__extents(__exts)
+    { }
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _OtherExtents,
+      /* requires */ (
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents)
+      )
+    )
+    __MDSPAN_CONDITIONAL_EXPLICIT((!_CUDA_VSTD::is_convertible<_OtherExtents, extents_type>::value)) // needs two () due to comma
+    __MDSPAN_INLINE_FUNCTION constexpr
+    mapping(mapping<_OtherExtents> const& __other) noexcept // NOLINT(google-explicit-constructor)
+      :__extents(__other.extents())
+    { }
+
+    __MDSPAN_INLINE_FUNCTION_DEFAULTED __MDSPAN_CONSTEXPR_14_DEFAULTED mapping& operator=(mapping const&) noexcept = default;
+
+    __MDSPAN_INLINE_FUNCTION
+    constexpr const extents_type& extents() const noexcept {
+      return __extents;
+    }
+
+    __MDSPAN_INLINE_FUNCTION
+    constexpr index_type required_span_size() const noexcept {
+      index_type __value = 1;
+      for(rank_type __r=0; __r<__rank; __r++) __value*=__blocks(__r)*__block_extent(__r);
+      return __value;
+    }
+
+    //--------------------------------------------------------------------------------
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class... _Indices,
+      /* requires */ (
+        (sizeof...(_Indices) == extents_type::rank()) &&
+        __MDSPAN_FOLD_AND(
+           (_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _Indices, index_type) &&
+            _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _Indices))
+        )
+      )
+    )
+    _LIBCUDACXX_HOST_DEVICE
+    constexpr index_type operator()(_Indices... __idxs) const noexcept {
+      return __compute_offset<0>(0, 0, static_cast<index_type>(__idxs)...);
+    }
+
+    __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept { return true; }
+    __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept {
+      for(rank_type __r=0; __r<__rank; __r++) {
+        if (extents_type::static_extent(__r) == _CUDA_VSTD::dynamic_extent ||
+            extents_type::static_extent(__r) % __block_extent(__r) != 0) {
+          return false;
+        }
+      }
+      return true;
+    }
+    // Only a single block along every dimension but the first keeps the mapping strided.
+    __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept {
+      for(rank_type __r=1; __r<__rank; __r++) {
+        if (extents_type::static_extent(__r) == _CUDA_VSTD::dynamic_extent ||
+            extents_type::static_extent(__r) > static_cast<size_t>(__block_extent(__r))) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    __MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept { return true; }
+    __MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept {
+      for(rank_type __r=0; __r<__rank; __r++) {
+        if (__extents.extent(__r) % __block_extent(__r) != 0) {
+          return false;
+        }
+      }
+      return true;
+    }
+    __MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept {
+      for(rank_type __r=1; __r<__rank; __r++) {
+        if (__extents.extent(__r) > __block_extent(__r)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // Precondition: is_strided() is true
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _Ext = _Extents,
+      /* requires */ (
+        _Ext::rank() > 0
+      )
+    )
+    __MDSPAN_INLINE_FUNCTION
+    constexpr index_type stride(rank_type __i) const noexcept {
+      index_type __value = 1;
+      for(rank_type __r=__rank-1; __r>__i; __r--) __value*=__block_extent(__r);
+      return __value;
+    }
+
+    template<class _OtherExtents>
+    __MDSPAN_INLINE_FUNCTION
+    friend constexpr bool operator==(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept {
+      return __lhs.extents() == __rhs.extents();
+    }
+
+    // In C++ 20 the not equal exists if equal is found
+#if !(__MDSPAN_HAS_CXX_20)
+    template<class _OtherExtents>
+    __MDSPAN_INLINE_FUNCTION
+    friend constexpr bool operator!=(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept {
+      return __lhs.extents() != __rhs.extents();
+    }
+#endif
+
+private:
+   _LIBCUDACXX_NO_UNIQUE_ADDRESS extents_type __extents{};
+
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _LIBCUDACXX___CUDA_MDSPAN_H
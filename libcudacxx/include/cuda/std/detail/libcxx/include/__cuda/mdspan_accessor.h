@@ -0,0 +1,376 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_MDSPAN_ACCESSOR_H
+#define _LIBCUDACXX___CUDA_MDSPAN_ACCESSOR_H
+
+#ifndef __cuda_std__
+#error "<__cuda/mdspan_accessor> should only be included in from <cuda/mdspan>"
+#endif // __cuda_std__
+
+#if _CCCL_STD_VER > 2011
+
+#include "../__mdspan/default_accessor.h"
+#include "../__mdspan/macros.h"
+#include "../__memory/addressof.h"
+#include "../__type_traits/conditional.h"
+#include "../__type_traits/integral_constant.h"
+#include "../__type_traits/is_const.h"
+#include "../__type_traits/is_convertible.h"
+#include "../__type_traits/is_trivially_copyable.h"
+#include "../cstdint"
+#include "../cstring"
+
+#include <nv/target>
+
+#if !defined(_CCCL_COMPILER_NVRTC) && defined(_CCCL_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+#  include <intrin.h>
+#endif // _CCCL_COMPILER_MSVC
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// Tells the compiler that __p is aligned to _Alignment bytes.
+template <size_t _Alignment, class _Tp>
+_LIBCUDACXX_INLINE_VISIBILITY
+_Tp* __assume_aligned(_Tp* __p) noexcept
+{
+  _LIBCUDACXX_ASSERT(reinterpret_cast<_CUDA_VSTD::uintptr_t>(__p) % _Alignment == 0,
+    "aligned_accessor requires data handles aligned to its byte_alignment.");
+#if defined(_CCCL_COMPILER_MSVC)
+  __assume(reinterpret_cast<_CUDA_VSTD::uintptr_t>(__p) % _Alignment == 0);
+  return __p;
+#else
+  return static_cast<_Tp*>(__builtin_assume_aligned(__p, _Alignment));
+#endif
+}
+
+// aligned_accessor promises that every data handle it is given is aligned to
+// _ByteAlignment bytes, which spares the compiler the code that reaches an
+// aligned address before a vectorized loop. Offsetting a data handle loses the
+// alignment, so its offset_policy is default_accessor.
+template <class _ElementType, size_t _ByteAlignment>
+struct aligned_accessor {
+  static_assert(_ByteAlignment != 0 && (_ByteAlignment & (_ByteAlignment - 1)) == 0,
+    "aligned_accessor requires a power of two alignment.");
+  static_assert(_ByteAlignment >= alignof(_ElementType),
+    "aligned_accessor requires an alignment of at least the alignment of the element type.");
+
+  using offset_policy = _CUDA_VSTD::default_accessor<_ElementType>;
+  using element_type = _ElementType;
+  using reference = _ElementType&;
+  using data_handle_type = _ElementType*;
+
+  static constexpr size_t byte_alignment = _ByteAlignment;
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr aligned_accessor() noexcept = default;
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType, size_t _OtherByteAlignment,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _OtherElementType(*)[], element_type(*)[]) &&
+      _OtherByteAlignment >= _ByteAlignment
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  constexpr aligned_accessor(aligned_accessor<_OtherElementType, _OtherByteAlignment>) noexcept {}
+
+  // The alignment of the data handles of a default_accessor is unknown.
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  explicit constexpr aligned_accessor(_CUDA_VSTD::default_accessor<_OtherElementType>) noexcept {}
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, element_type(*)[], _OtherElementType(*)[])
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  constexpr operator _CUDA_VSTD::default_accessor<_OtherElementType>() const noexcept {
+    return {};
+  }
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr typename offset_policy::data_handle_type
+  offset(data_handle_type __p, size_t __i) const noexcept {
+    return __p + __i;
+  }
+
+  __MDSPAN_FORCE_INLINE_FUNCTION
+  reference access(data_handle_type __p, size_t __i) const noexcept {
+    return __assume_aligned<byte_alignment>(__p)[__i];
+  }
+};
+
+// restrict_accessor promises that the elements it accesses are not accessed
+// through any other data handle for as long as it is used, the way a
+// __restrict pointer does, so that loops over several mdspans need no checks
+// for overlap before they are vectorized.
+template <class _ElementType>
+struct restrict_accessor {
+  using offset_policy = restrict_accessor;
+  using element_type = _ElementType;
+  using reference = _ElementType&;
+  using data_handle_type = _ElementType* __restrict;
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr restrict_accessor() noexcept = default;
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  constexpr restrict_accessor(restrict_accessor<_OtherElementType>) noexcept {}
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  // Whether the elements are aliased is unknown, so the promise is made
+  // explicitly.
+  __MDSPAN_INLINE_FUNCTION
+  explicit constexpr restrict_accessor(_CUDA_VSTD::default_accessor<_OtherElementType>) noexcept {}
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr _ElementType*
+  offset(data_handle_type __p, size_t __i) const noexcept {
+    return __p + __i;
+  }
+
+  __MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr reference access(data_handle_type __p, size_t __i) const noexcept {
+    return __p[__i];
+  }
+};
+
+#if !defined(_CCCL_COMPILER_NVRTC)
+template <class _Bits>
+inline _LIBCUDACXX_HOST
+void __streaming_store_host(void* __p, _Bits __bits) noexcept
+{
+#if defined(_CCCL_COMPILER_MSVC) && defined(_M_X64)
+  if (sizeof(_Bits) == 4) {
+    _mm_stream_si32(static_cast<int*>(__p), static_cast<int>(__bits));
+  } else {
+    _mm_stream_si64x(static_cast<long long*>(__p), static_cast<long long>(__bits));
+  }
+#elif !defined(_CCCL_COMPILER_MSVC) && defined(__x86_64__)
+  __asm__ __volatile__("movnti %1, %0" : "=m"(*static_cast<_Bits*>(__p)) : "r"(__bits));
+#else
+  _CUDA_VSTD::memcpy(__p, &__bits, sizeof(_Bits));
+#endif
+}
+#endif // _CCCL_COMPILER_NVRTC
+
+// Stores __v to __p without keeping the line in the caches: movnti on x86
+// hosts and st.cs on the device. Other element sizes and hosts store plainly.
+// The stores on x86 are not ordered with other stores, so a sequentially
+// consistent fence must separate them from the store which publishes them.
+template <class _Tp, class _Bits>
+_LIBCUDACXX_INLINE_VISIBILITY
+void __streaming_store_bits(_Tp* __p, const _Tp& __v) noexcept
+{
+  _Bits __bits;
+  _CUDA_VSTD::memcpy(&__bits, &__v, sizeof(_Tp));
+NV_DISPATCH_TARGET(
+NV_IS_DEVICE, (
+  if (sizeof(_Bits) == 4) {
+    asm volatile("st.cs.b32 [%0], %1;" :: "l"(__p), "r"(static_cast<_CUDA_VSTD::uint32_t>(__bits)) : "memory");
+  } else {
+    asm volatile("st.cs.b64 [%0], %1;" :: "l"(__p), "l"(static_cast<_CUDA_VSTD::uint64_t>(__bits)) : "memory");
+  }
+),
+NV_IS_HOST, (
+  __streaming_store_host(__p, __bits);
+))
+}
+
+template <class _Tp>
+_LIBCUDACXX_INLINE_VISIBILITY
+void __streaming_store(_Tp* __p, const _Tp& __v, _CUDA_VSTD::integral_constant<size_t, 4>) noexcept
+{
+  __streaming_store_bits<_Tp, _CUDA_VSTD::uint32_t>(__p, __v);
+}
+
+template <class _Tp>
+_LIBCUDACXX_INLINE_VISIBILITY
+void __streaming_store(_Tp* __p, const _Tp& __v, _CUDA_VSTD::integral_constant<size_t, 8>) noexcept
+{
+  __streaming_store_bits<_Tp, _CUDA_VSTD::uint64_t>(__p, __v);
+}
+
+template <class _Tp, size_t _Size>
+_LIBCUDACXX_INLINE_VISIBILITY
+void __streaming_store(_Tp* __p, const _Tp& __v, _CUDA_VSTD::integral_constant<size_t, _Size>) noexcept
+{
+  *__p = __v;
+}
+
+template <class _Tp>
+class __streaming_reference {
+  _Tp* __p_;
+
+public:
+  _LIBCUDACXX_INLINE_VISIBILITY
+  explicit __streaming_reference(_Tp& __r) noexcept : __p_(_CUDA_VSTD::addressof(__r)) {}
+
+  __streaming_reference(const __streaming_reference&) = default;
+
+  _LIBCUDACXX_INLINE_VISIBILITY
+  const __streaming_reference& operator=(const _Tp& __v) const noexcept {
+    __streaming_store(__p_, __v, _CUDA_VSTD::integral_constant<size_t, sizeof(_Tp)>{});
+    return *this;
+  }
+
+  _LIBCUDACXX_INLINE_VISIBILITY
+  const __streaming_reference& operator=(const __streaming_reference& __other) const noexcept {
+    return *this = static_cast<_Tp>(__other);
+  }
+
+  _LIBCUDACXX_INLINE_VISIBILITY
+  operator _Tp() const noexcept {
+    return *__p_;
+  }
+};
+
+// streaming_accessor writes its elements around the caches, which leaves
+// them to the data that is read again when an mdspan is only written once,
+// and saves reading the lines in before they are overwritten. Its reference
+// is a proxy which converts to the element and stores on assignment.
+template <class _ElementType>
+struct streaming_accessor {
+  static_assert(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_trivially_copyable, _ElementType),
+    "streaming_accessor requires a trivially copyable element type.");
+
+  using offset_policy = streaming_accessor;
+  using element_type = _ElementType;
+  using reference = _CUDA_VSTD::__conditional_t<_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_const, _ElementType),
+    _ElementType&, __streaming_reference<_ElementType>>;
+  using data_handle_type = _ElementType*;
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr streaming_accessor() noexcept = default;
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  constexpr streaming_accessor(streaming_accessor<_OtherElementType>) noexcept {}
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  constexpr streaming_accessor(_CUDA_VSTD::default_accessor<_OtherElementType>) noexcept {}
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr data_handle_type
+  offset(data_handle_type __p, size_t __i) const noexcept {
+    return __p + __i;
+  }
+
+  __MDSPAN_FORCE_INLINE_FUNCTION
+  reference access(data_handle_type __p, size_t __i) const noexcept {
+    return reference(__p[__i]);
+  }
+};
+
+// Prefetches the line which holds __p into all levels of the host caches. The
+// address is formed as an integer, since it may point past the end of the
+// elements.
+#if !defined(_CCCL_COMPILER_NVRTC)
+inline _LIBCUDACXX_HOST
+void __prefetch_host(_CUDA_VSTD::uintptr_t __p) noexcept
+{
+#if defined(_CCCL_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+  _mm_prefetch(reinterpret_cast<const char*>(__p), _MM_HINT_T0);
+#elif !defined(_CCCL_COMPILER_MSVC)
+  __builtin_prefetch(reinterpret_cast<const void*>(__p));
+#else
+  (void)__p;
+#endif
+}
+#endif // _CCCL_COMPILER_NVRTC
+
+_LIBCUDACXX_INLINE_VISIBILITY
+void __prefetch(_CUDA_VSTD::uintptr_t __p) noexcept
+{
+NV_IF_ELSE_TARGET(NV_IS_HOST, (
+  __prefetch_host(__p);
+), (
+  (void)__p;
+))
+}
+
+// prefetching_accessor prefetches the element _Distance elements after the
+// one it accesses, for traversals in the order of the offsets whose strides
+// the hardware prefetchers do not follow. Device code does not prefetch, and
+// relies on other warps to hide the latency of the loads instead.
+template <class _ElementType, size_t _Distance = 64>
+struct prefetching_accessor {
+  using offset_policy = prefetching_accessor;
+  using element_type = _ElementType;
+  using reference = _ElementType&;
+  using data_handle_type = _ElementType*;
+
+  static constexpr size_t distance = _Distance;
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr prefetching_accessor() noexcept = default;
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  constexpr prefetching_accessor(prefetching_accessor<_OtherElementType, _Distance>) noexcept {}
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  constexpr prefetching_accessor(_CUDA_VSTD::default_accessor<_OtherElementType>) noexcept {}
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr data_handle_type
+  offset(data_handle_type __p, size_t __i) const noexcept {
+    return __p + __i;
+  }
+
+  __MDSPAN_FORCE_INLINE_FUNCTION
+  reference access(data_handle_type __p, size_t __i) const noexcept {
+    __prefetch(reinterpret_cast<_CUDA_VSTD::uintptr_t>(__p + __i) + _Distance * sizeof(_ElementType));
+    return __p[__i];
+  }
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _LIBCUDACXX___CUDA_MDSPAN_ACCESSOR_H
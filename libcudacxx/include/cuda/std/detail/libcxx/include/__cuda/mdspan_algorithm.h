@@ -0,0 +1,727 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_MDSPAN_ALGORITHM_H
+#define _LIBCUDACXX___CUDA_MDSPAN_ALGORITHM_H
+
+#ifndef __cuda_std__
+#error "<__cuda/mdspan_algorithm> should only be included in from <cuda/mdspan>"
+#endif // __cuda_std__
+
+#if _CCCL_STD_VER > 2011
+
+#include "../__algorithm/fill_n.h"
+#include "../__type_traits/integral_constant.h"
+#include "../__type_traits/is_assignable.h"
+#include "../__type_traits/is_same.h"
+#include "../__type_traits/is_trivially_copyable.h"
+#include "../__type_traits/remove_const.h"
+#include "../__utility/integer_sequence.h"
+#include "../array"
+#include "../cstring"
+
+#if !defined(_CCCL_COMPILER_NVRTC)
+#  include <thread>
+#  include <vector>
+#endif // _CCCL_COMPILER_NVRTC
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// The traversals below visit the indices of a box [__lo, __hi) of an index
+// space. __order lists the dimensions from the one which varies slowest to the
+// one which varies fastest.
+template <class _Extents>
+using __mdspan_indices = _CUDA_VSTD::array<typename _Extents::index_type, _Extents::rank()>;
+
+template <class _Extents>
+using __mdspan_order = _CUDA_VSTD::array<typename _Extents::rank_type, _Extents::rank()>;
+
+// The extent of a tile along the two dimensions a blocked traversal tiles. Two
+// tiles of 32 x 32 doubles fit into the L1 cache of any processor.
+static constexpr size_t __mdspan_tile_extent = 32;
+
+// The dimension which varies fastest, zero for rank 0.
+template <class _Tp, size_t _Rank>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+_Tp __mdspan_innermost(const _CUDA_VSTD::array<_Tp, _Rank>& __order)
+{
+  return __order[_Rank - 1];
+}
+
+template <class _Tp>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+_Tp __mdspan_innermost(const _CUDA_VSTD::array<_Tp, 0>&)
+{
+  return 0;
+}
+
+// stride() is only declared for mappings of rank other than zero.
+template <class _Mapping>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+typename _Mapping::index_type __mdspan_stride(const _Mapping& __m, size_t __r, _CUDA_VSTD::true_type)
+{
+  return __m.stride(__r);
+}
+
+template <class _Mapping>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+typename _Mapping::index_type __mdspan_stride(const _Mapping&, size_t, _CUDA_VSTD::false_type)
+{
+  return 1;
+}
+
+template <class _Mapping>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+typename _Mapping::index_type __mdspan_stride(const _Mapping& __m, size_t __r)
+{
+  return __mdspan_stride(__m, __r, _CUDA_VSTD::integral_constant<bool, (_Mapping::extents_type::rank() > 0)>{});
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Extents, class _Fn>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __mdspan_for_each_in_box(const __mdspan_indices<_Extents>& __lo, const __mdspan_indices<_Extents>& __hi,
+                              const __mdspan_order<_Extents>& __order, const _Fn& __fn)
+{
+  constexpr size_t __rank = _Extents::rank();
+  __mdspan_indices<_Extents> __idx = __lo;
+  if (__rank == 0) {
+    __fn(__idx);
+    return;
+  }
+  for (size_t __r = 0; __r < __rank; ++__r) {
+    if (__lo[__r] >= __hi[__r]) {
+      return;
+    }
+  }
+  const auto __inner = __mdspan_innermost(__order);
+  for (;;) {
+    for (__idx[__inner] = __lo[__inner]; __idx[__inner] < __hi[__inner]; ++__idx[__inner]) {
+      __fn(__idx);
+    }
+    // advance the outer dimensions like an odometer
+    size_t __k = __rank - 1;
+    for (;;) {
+      if (__k == 0) {
+        return;
+      }
+      const auto __r = __order[--__k];
+      if (++__idx[__r] < __hi[__r]) {
+        break;
+      }
+      __idx[__r] = __lo[__r];
+    }
+  }
+}
+
+// Visits the box tile by tile. The tiles are visited in __order, and so are
+// the indices within a tile.
+template <class _Extents, class _Fn>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __mdspan_for_each_tiled(const __mdspan_indices<_Extents>& __lo, const __mdspan_indices<_Extents>& __hi,
+                             const __mdspan_order<_Extents>& __order, const __mdspan_indices<_Extents>& __tile,
+                             const _Fn& __fn)
+{
+  constexpr size_t __rank = _Extents::rank();
+  for (size_t __r = 0; __r < __rank; ++__r) {
+    if (__lo[__r] >= __hi[__r]) {
+      return;
+    }
+  }
+  __mdspan_indices<_Extents> __origin = __lo;
+  __mdspan_indices<_Extents> __end;
+  for (;;) {
+    for (size_t __r = 0; __r < __rank; ++__r) {
+      __end[__r] = __hi[__r] - __origin[__r] > __tile[__r] ? __origin[__r] + __tile[__r] : __hi[__r];
+    }
+    __mdspan_for_each_in_box<_Extents>(__origin, __end, __order, __fn);
+    size_t __k = __rank;
+    for (;;) {
+      if (__k == 0) {
+        return;
+      }
+      const auto __r = __order[--__k];
+      if (__hi[__r] - __origin[__r] > __tile[__r]) {
+        __origin[__r] += __tile[__r];
+        break;
+      }
+      __origin[__r] = __lo[__r];
+    }
+  }
+}
+
+// How the index space of an algorithm is traversed: dimension by dimension
+// in __order, tile by tile.
+template <class _Extents>
+struct __mdspan_traversal
+{
+  __mdspan_order<_Extents> __order;
+  __mdspan_indices<_Extents> __tile;
+};
+
+// The order of layout_right, the last dimension varying fastest.
+template <class _Extents>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+__mdspan_order<_Extents> __mdspan_right_order()
+{
+  __mdspan_order<_Extents> __order{};
+  for (size_t __r = 0; __r < _Extents::rank(); ++__r) {
+    __order[__r] = static_cast<typename _Extents::rank_type>(__r);
+  }
+  return __order;
+}
+
+// The dimensions of a mapping ordered from the largest stride to the smallest,
+// or the order of layout_right if the mapping is not strided.
+template <class _Mapping>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+__mdspan_order<typename _Mapping::extents_type> __mdspan_memory_order(const _Mapping& __m)
+{
+  constexpr size_t __rank = _Mapping::extents_type::rank();
+  auto __order = __mdspan_right_order<typename _Mapping::extents_type>();
+  if (__m.is_strided()) {
+    for (size_t __i = 1; __i < __rank; ++__i) {
+      const auto __r = __order[__i];
+      size_t __j = __i;
+      for (; __j > 0 && __mdspan_stride(__m, __order[__j - 1]) < __mdspan_stride(__m, __r); --__j) {
+        __order[__j] = __order[__j - 1];
+      }
+      __order[__j] = __r;
+    }
+  }
+  return __order;
+}
+
+// Traverses the destination in memory order. If the dimension along which the
+// source is contiguous is another one, the two are tiled, so that the cache
+// lines of both are reused before they are evicted.
+template <class _Extents>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+__mdspan_traversal<_Extents> __mdspan_make_traversal(const _Extents& __exts, __mdspan_order<_Extents> __order,
+                                                     typename _Extents::rank_type __src_inner)
+{
+  constexpr size_t __rank = _Extents::rank();
+  __mdspan_traversal<_Extents> __traversal;
+  __traversal.__order = __order;
+  for (size_t __r = 0; __r < __rank; ++__r) {
+    __traversal.__tile[__r] = 1;
+  }
+  if (__rank == 0) {
+    return __traversal;
+  }
+  const auto __dst_inner = __mdspan_innermost(__order);
+  if (__src_inner == __dst_inner) {
+    __traversal.__tile[__dst_inner] = __exts.extent(__dst_inner);
+  }
+  else {
+    size_t __i = 0;
+    while (__order[__i] != __src_inner) {
+      ++__i;
+    }
+    for (; __i + 2 < __rank; ++__i) {
+      __order[__i] = __order[__i + 1];
+    }
+    __order[__rank - 2] = __src_inner;
+    __traversal.__tile[__src_inner] = static_cast<typename _Extents::index_type>(__mdspan_tile_extent);
+    __traversal.__tile[__dst_inner] = static_cast<typename _Extents::index_type>(__mdspan_tile_extent);
+    __traversal.__order = __order;
+  }
+  return __traversal;
+}
+
+// Runs the parts of an algorithm one after the other on the calling thread.
+struct __mdspan_sequential
+{};
+
+// The fewest elements worth the start of a thread.
+static constexpr size_t __mdspan_min_elements_per_thread = 16384;
+
+template <class _Extents>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __mdspan_full_box(const _Extents& __exts, __mdspan_indices<_Extents>& __lo, __mdspan_indices<_Extents>& __hi)
+{
+  for (size_t __r = 0; __r < _Extents::rank(); ++__r) {
+    __lo[__r] = 0;
+    __hi[__r] = __exts.extent(__r);
+  }
+}
+
+template <class _Extents, class _Fn>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __mdspan_traverse(__mdspan_sequential, const _Extents& __exts, const __mdspan_traversal<_Extents>& __traversal,
+                       const _Fn& __fn)
+{
+  __mdspan_indices<_Extents> __lo;
+  __mdspan_indices<_Extents> __hi;
+  __mdspan_full_box(__exts, __lo, __hi);
+  __mdspan_for_each_tiled<_Extents>(__lo, __hi, __traversal.__order, __traversal.__tile, __fn);
+}
+
+// Calls __fn(__first, __last) for the range [0, __n) of a span.
+template <class _Fn>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __mdspan_for_span(__mdspan_sequential, size_t __n, const _Fn& __fn)
+{
+  __fn(size_t(0), __n);
+}
+
+#if !defined(_CCCL_COMPILER_NVRTC)
+
+// host_threads runs mdspan_copy, mdspan_transpose, mdspan_fill and
+// mdspan_for_each_index on several host threads, the calling one included.
+// The slowest varying dimension of the traversal, or the span as a whole, is
+// split into parts of at least a few thousand elements, one for each thread.
+class host_threads
+{
+public:
+  _LIBCUDACXX_HOST explicit host_threads(unsigned __count = ::std::thread::hardware_concurrency()) noexcept
+      : __count_(__count == 0 ? 1 : __count)
+  {}
+
+  _LIBCUDACXX_HOST unsigned count() const noexcept
+  {
+    return __count_;
+  }
+
+  // Calls __fn(__i) for every __i in [0, __n), each on its own thread, and
+  // waits for all of them. Parts no thread could be started for are run on
+  // the calling thread. An exception thrown by __fn on the calling thread
+  // propagates once the other threads are done; one thrown on another thread
+  // calls std::terminate, as it does for any ::std::thread.
+  template <class _Fn>
+  _LIBCUDACXX_HOST void __run(unsigned __n, const _Fn& __fn) const
+  {
+    ::std::vector<::std::thread> __threads;
+    unsigned __i = 1;
+#ifndef _LIBCUDACXX_NO_EXCEPTIONS
+    try
+    {
+#endif // _LIBCUDACXX_NO_EXCEPTIONS
+      __threads.reserve(__n - 1);
+      for (; __i < __n; ++__i) {
+        __threads.emplace_back([&__fn, __i] { __fn(__i); });
+      }
+#ifndef _LIBCUDACXX_NO_EXCEPTIONS
+    }
+    catch (...)
+    {}
+#endif // _LIBCUDACXX_NO_EXCEPTIONS
+    // joins the threads on the way out, whether __fn returns or throws
+    __joiner __join{__threads};
+    for (unsigned __j = __i; __j < __n; ++__j) {
+      __fn(__j);
+    }
+    __fn(0u);
+  }
+
+  _LIBCUDACXX_HOST unsigned __parts(size_t __elements, size_t __max_parts) const noexcept
+  {
+    size_t __n = (__elements + __mdspan_min_elements_per_thread - 1) / __mdspan_min_elements_per_thread;
+    __n = __n < __max_parts ? __n : __max_parts;
+    return static_cast<unsigned>(__n < __count_ ? __n : __count_);
+  }
+
+private:
+  struct __joiner
+  {
+    ::std::vector<::std::thread>& __threads;
+
+    _LIBCUDACXX_HOST ~__joiner()
+    {
+      for (auto& __t : __threads) {
+        __t.join();
+      }
+    }
+  };
+
+  unsigned __count_;
+};
+
+template <class _Extents, class _Fn>
+_LIBCUDACXX_HOST void __mdspan_traverse(const host_threads& __threads, const _Extents& __exts,
+                                        const __mdspan_traversal<_Extents>& __traversal, const _Fn& __fn)
+{
+  __mdspan_indices<_Extents> __lo;
+  __mdspan_indices<_Extents> __hi;
+  __mdspan_full_box(__exts, __lo, __hi);
+  if (_Extents::rank() == 0) {
+    __mdspan_for_each_tiled<_Extents>(__lo, __hi, __traversal.__order, __traversal.__tile, __fn);
+    return;
+  }
+  size_t __elements = 1;
+  for (size_t __r = 0; __r < _Extents::rank(); ++__r) {
+    __elements *= static_cast<size_t>(__exts.extent(__r));
+  }
+  // the parts of the outermost dimension are made of whole tiles
+  const auto __outer  = __traversal.__order[0];
+  const size_t __tile  = static_cast<size_t>(__traversal.__tile[__outer]);
+  const size_t __tiles = (static_cast<size_t>(__exts.extent(__outer)) + __tile - 1) / __tile;
+  const unsigned __n   = __threads.__parts(__elements, __tiles);
+  if (__n <= 1) {
+    __mdspan_for_each_tiled<_Extents>(__lo, __hi, __traversal.__order, __traversal.__tile, __fn);
+    return;
+  }
+  __threads.__run(__n, [&](unsigned __i) {
+    __mdspan_indices<_Extents> __part_lo = __lo;
+    __mdspan_indices<_Extents> __part_hi = __hi;
+    __part_lo[__outer] = static_cast<typename _Extents::index_type>(__tile * (__tiles * __i / __n));
+    if (__i + 1 < __n) {
+      __part_hi[__outer] = static_cast<typename _Extents::index_type>(__tile * (__tiles * (__i + 1) / __n));
+    }
+    __mdspan_for_each_tiled<_Extents>(__part_lo, __part_hi, __traversal.__order, __traversal.__tile, __fn);
+  });
+}
+
+template <class _Fn>
+_LIBCUDACXX_HOST void __mdspan_for_span(const host_threads& __threads, size_t __size, const _Fn& __fn)
+{
+  const unsigned __n = __threads.__parts(__size, __size);
+  if (__n <= 1) {
+    __fn(size_t(0), __size);
+    return;
+  }
+  __threads.__run(__n, [&](unsigned __i) {
+    __fn(__size * __i / __n, __size * (__i + 1) / __n);
+  });
+}
+
+#endif // _CCCL_COMPILER_NVRTC
+
+template <class _Mdspan, class _Index, size_t... _Is>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+typename _Mdspan::reference __mdspan_element(const _Mdspan& __m, const _Index& __idx,
+                                             _CUDA_VSTD::index_sequence<_Is...>)
+{
+  return __m.accessor().access(__m.data_handle(), __m.mapping()(__idx[_Is]...));
+}
+
+template <class _Src, class _Dst, class _SrcIndices>
+struct __mdspan_copy_element
+{
+  const _Src& __src;
+  const _Dst& __dst;
+
+  template <class _Index>
+  _LIBCUDACXX_INLINE_VISIBILITY
+  void operator()(const _Index& __idx) const {
+    __mdspan_element(__dst, __idx, _CUDA_VSTD::make_index_sequence<_Dst::rank()>{}) =
+      __mdspan_element(__src, __idx, _SrcIndices{});
+  }
+};
+
+template <class _Dst, class _Tp>
+struct __mdspan_fill_element
+{
+  const _Dst& __dst;
+  const _Tp& __value;
+
+  template <class _Index>
+  _LIBCUDACXX_INLINE_VISIBILITY
+  void operator()(const _Index& __idx) const {
+    __mdspan_element(__dst, __idx, _CUDA_VSTD::make_index_sequence<_Dst::rank()>{}) = __value;
+  }
+};
+
+template <class _Fn, class _Extents>
+struct __mdspan_call_with_indices
+{
+  _Fn& __fn;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Index, size_t... _Is>
+  _LIBCUDACXX_INLINE_VISIBILITY
+  void __call(const _Index& __idx, _CUDA_VSTD::index_sequence<_Is...>) const {
+    __fn(__idx[_Is]...);
+  }
+
+  template <class _Index>
+  _LIBCUDACXX_INLINE_VISIBILITY
+  void operator()(const _Index& __idx) const {
+    __call(__idx, _CUDA_VSTD::make_index_sequence<_Extents::rank()>{});
+  }
+};
+
+// Whether the elements are reached through plain pointers and can be copied
+// as bytes.
+template <class _Mdspan>
+using __mdspan_has_default_accessor = _CUDA_VSTD::is_same<typename _Mdspan::accessor_type,
+                                                          _CUDA_VSTD::default_accessor<typename _Mdspan::element_type>>;
+
+template <class _Src, class _Dst>
+using __mdspan_is_memcpyable = _CUDA_VSTD::integral_constant<bool,
+  _CUDA_VSTD::is_same<_CUDA_VSTD::__remove_const_t<typename _Src::element_type>, typename _Dst::element_type>::value &&
+  _CUDA_VSTD::is_trivially_copyable<typename _Dst::element_type>::value &&
+  __mdspan_has_default_accessor<_Src>::value && __mdspan_has_default_accessor<_Dst>::value>;
+
+// Whether both spans lay out the same elements the same way without gaps, so
+// that the whole span can be copied at once.
+template <class _Src, class _Dst>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+bool __mdspan_same_contiguous_span(const _Src&, const _Dst&, _CUDA_VSTD::false_type)
+{
+  return false;
+}
+
+template <class _Src, class _Dst>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+bool __mdspan_same_contiguous_span(const _Src& __src, const _Dst& __dst, _CUDA_VSTD::true_type)
+{
+  if (!__src.is_exhaustive() || !__dst.is_exhaustive() || !__src.is_strided() || !__dst.is_strided()) {
+    return false;
+  }
+  for (size_t __r = 0; __r < _Dst::rank(); ++__r) {
+    if (__dst.extent(__r) > 1 && __mdspan_stride(__src.mapping(), __r) != __mdspan_stride(__dst.mapping(), __r)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class _Tp>
+struct __mdspan_copy_span_part
+{
+  const _Tp* __src;
+  _Tp* __dst;
+
+  _LIBCUDACXX_INLINE_VISIBILITY
+  void operator()(size_t __first, size_t __last) const {
+    NV_IF_ELSE_TARGET(NV_IS_HOST, (
+      _CUDA_VSTD::memcpy(__dst + __first, __src + __first, (__last - __first) * sizeof(_Tp));
+    ), (
+      for (size_t __i = __first; __i < __last; ++__i) {
+        __dst[__i] = __src[__i];
+      }
+    ))
+  }
+};
+
+template <class _Tp, class _Up>
+struct __mdspan_fill_span_part
+{
+  _Tp* __dst;
+  const _Up& __value;
+
+  _LIBCUDACXX_INLINE_VISIBILITY
+  void operator()(size_t __first, size_t __last) const {
+    _CUDA_VSTD::fill_n(__dst + __first, __last - __first, __value);
+  }
+};
+
+template <class _Src, class _Dst>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __mdspan_check_copy(const _Src& __src, const _Dst& __dst)
+{
+  static_assert(_Src::rank() == _Dst::rank(), "mdspan_copy requires mdspans of the same rank.");
+  static_assert(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_assignable, typename _Dst::reference, typename _Src::reference),
+                "mdspan_copy requires the elements of the source to be assignable to the destination.");
+  _LIBCUDACXX_ASSERT(__src.extents() == __dst.extents(), "mdspan_copy requires mdspans of the same extents.");
+  (void)__src;
+  (void)__dst;
+}
+
+template <class _Src, class _Dst>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __mdspan_check_transpose(const _Src& __src, const _Dst& __dst)
+{
+  static_assert(_Src::rank() == 2 && _Dst::rank() == 2, "mdspan_transpose requires mdspans of rank 2.");
+  static_assert(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_assignable, typename _Dst::reference, typename _Src::reference),
+                "mdspan_transpose requires the elements of the source to be assignable to the destination.");
+  _LIBCUDACXX_ASSERT(__src.extent(0) == __dst.extent(1) && __src.extent(1) == __dst.extent(0),
+                     "mdspan_transpose requires the extents of the destination to be those of the source swapped.");
+  (void)__src;
+  (void)__dst;
+}
+
+// The dimension of the destination along which the source is contiguous.
+template <class _Src, class _Dst>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+typename _Dst::rank_type __mdspan_src_inner(const _Src& __src, const _Dst&, bool __transpose)
+{
+  const auto __r = __mdspan_innermost(__mdspan_memory_order(__src.mapping()));
+  return static_cast<typename _Dst::rank_type>(__transpose ? 1 - __r : __r);
+}
+
+template <class _Src, class _Dst>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+__mdspan_traversal<typename _Dst::extents_type> __mdspan_copy_traversal(const _Src& __src, const _Dst& __dst,
+                                                                        bool __transpose)
+{
+  return __mdspan_make_traversal(__dst.extents(), __mdspan_memory_order(__dst.mapping()),
+                                              __mdspan_src_inner(__src, __dst, __transpose));
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Executor, class _Src, class _Dst>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __mdspan_copy(const _Executor& __ex, const _Src& __src, const _Dst& __dst)
+{
+  __mdspan_check_copy(__src, __dst);
+  if (__dst.empty()) {
+    return;
+  }
+  if (__mdspan_same_contiguous_span(__src, __dst, __mdspan_is_memcpyable<_Src, _Dst>{})) {
+    __mdspan_for_span(__ex, static_cast<size_t>(__dst.mapping().required_span_size()),
+                      __mdspan_copy_span_part<typename _Dst::element_type>{__src.data_handle(), __dst.data_handle()});
+    return;
+  }
+  const __mdspan_copy_element<_Src, _Dst, _CUDA_VSTD::make_index_sequence<_Dst::rank()>> __copy{__src, __dst};
+  __mdspan_traverse(__ex, __dst.extents(), __mdspan_copy_traversal(__src, __dst, false), __copy);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Executor, class _Src, class _Dst>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __mdspan_transpose(const _Executor& __ex, const _Src& __src, const _Dst& __dst)
+{
+  __mdspan_check_transpose(__src, __dst);
+  if (__dst.empty()) {
+    return;
+  }
+  const __mdspan_copy_element<_Src, _Dst, _CUDA_VSTD::index_sequence<1, 0>> __copy{__src, __dst};
+  __mdspan_traverse(__ex, __dst.extents(), __mdspan_copy_traversal(__src, __dst, true), __copy);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Executor, class _Dst, class _Tp>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __mdspan_fill(const _Executor& __ex, const _Dst& __dst, const _Tp& __value)
+{
+  if (__dst.empty()) {
+    return;
+  }
+  if (__mdspan_has_default_accessor<_Dst>::value && __dst.is_exhaustive()) {
+    __mdspan_for_span(__ex, static_cast<size_t>(__dst.mapping().required_span_size()),
+                      __mdspan_fill_span_part<typename _Dst::element_type, _Tp>{__dst.data_handle(), __value});
+    return;
+  }
+  const auto __order = __mdspan_memory_order(__dst.mapping());
+  const __mdspan_fill_element<_Dst, _Tp> __fill{__dst, __value};
+  __mdspan_traverse(__ex, __dst.extents(), __mdspan_make_traversal(__dst.extents(), __order, __mdspan_innermost(__order)),
+                    __fill);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Executor, class _Extents, class _Fn>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __mdspan_for_each_index(const _Executor& __ex, const _Extents& __exts, const __mdspan_order<_Extents>& __order,
+                             _Fn& __fn)
+{
+  __mdspan_traverse(__ex, __exts, __mdspan_make_traversal(__exts, __order, __mdspan_innermost(__order)),
+                    __mdspan_call_with_indices<_Fn, _Extents>{__fn});
+}
+
+// mdspan_copy copies the elements of an mdspan into another one of the same
+// extents, whatever the layouts of the two. Spans laid out the same way
+// without gaps are copied as a whole. Otherwise, the destination is written in
+// memory order, and where the source is contiguous along another dimension,
+// the two dimensions are traversed in tiles. The spans must not overlap.
+template <class _SrcType, class _SrcExtents, class _SrcLayout, class _SrcAccessor,
+          class _DstType, class _DstExtents, class _DstLayout, class _DstAccessor>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void mdspan_copy(_CUDA_VSTD::mdspan<_SrcType, _SrcExtents, _SrcLayout, _SrcAccessor> __src,
+                 _CUDA_VSTD::mdspan<_DstType, _DstExtents, _DstLayout, _DstAccessor> __dst)
+{
+  __mdspan_copy(__mdspan_sequential{}, __src, __dst);
+}
+
+// mdspan_transpose copies the elements of an mdspan of rank 2 into another one
+// of the extents swapped, so that __dst(__j, __i) is __src(__i, __j). The
+// destination is written in memory order; unless the source is contiguous along
+// the same dimension, which happens when the two have opposite layouts, the
+// dimensions are traversed in tiles. The spans must not overlap.
+template <class _SrcType, class _SrcExtents, class _SrcLayout, class _SrcAccessor,
+          class _DstType, class _DstExtents, class _DstLayout, class _DstAccessor>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void mdspan_transpose(_CUDA_VSTD::mdspan<_SrcType, _SrcExtents, _SrcLayout, _SrcAccessor> __src,
+                      _CUDA_VSTD::mdspan<_DstType, _DstExtents, _DstLayout, _DstAccessor> __dst)
+{
+  __mdspan_transpose(__mdspan_sequential{}, __src, __dst);
+}
+
+// mdspan_fill assigns __value to every element of an mdspan, in memory order.
+// Spans without gaps are filled as a whole.
+template <class _Type, class _Extents, class _Layout, class _Accessor, class _Tp>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void mdspan_fill(_CUDA_VSTD::mdspan<_Type, _Extents, _Layout, _Accessor> __dst, const _Tp& __value)
+{
+  __mdspan_fill(__mdspan_sequential{}, __dst, __value);
+}
+
+// mdspan_for_each_index calls __fn with every multidimensional index of
+// __exts, the last index varying fastest.
+template <class _IndexType, size_t... _Extents, class _Fn>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void mdspan_for_each_index(const _CUDA_VSTD::extents<_IndexType, _Extents...>& __exts, _Fn&& __fn)
+{
+  using _Exts = _CUDA_VSTD::extents<_IndexType, _Extents...>;
+  __mdspan_for_each_index(__mdspan_sequential{}, __exts, __mdspan_right_order<_Exts>(), __fn);
+}
+
+// mdspan_for_each_index calls __fn with every multidimensional index of an
+// mdspan, in the order in which the elements are laid out in memory.
+template <class _Type, class _Extents, class _Layout, class _Accessor, class _Fn>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void mdspan_for_each_index(_CUDA_VSTD::mdspan<_Type, _Extents, _Layout, _Accessor> __m, _Fn&& __fn)
+{
+  __mdspan_for_each_index(__mdspan_sequential{}, __m.extents(), __mdspan_memory_order(__m.mapping()), __fn);
+}
+
+#if !defined(_CCCL_COMPILER_NVRTC)
+
+// The overloads taking host_threads split the traversal among the threads.
+// __fn is called concurrently, and neither it nor the copies of the elements
+// may throw.
+template <class _SrcType, class _SrcExtents, class _SrcLayout, class _SrcAccessor,
+          class _DstType, class _DstExtents, class _DstLayout, class _DstAccessor>
+_LIBCUDACXX_HOST void mdspan_copy(const host_threads& __threads,
+                                  _CUDA_VSTD::mdspan<_SrcType, _SrcExtents, _SrcLayout, _SrcAccessor> __src,
+                                  _CUDA_VSTD::mdspan<_DstType, _DstExtents, _DstLayout, _DstAccessor> __dst)
+{
+  __mdspan_copy(__threads, __src, __dst);
+}
+
+template <class _SrcType, class _SrcExtents, class _SrcLayout, class _SrcAccessor,
+          class _DstType, class _DstExtents, class _DstLayout, class _DstAccessor>
+_LIBCUDACXX_HOST void mdspan_transpose(const host_threads& __threads,
+                                       _CUDA_VSTD::mdspan<_SrcType, _SrcExtents, _SrcLayout, _SrcAccessor> __src,
+                                       _CUDA_VSTD::mdspan<_DstType, _DstExtents, _DstLayout, _DstAccessor> __dst)
+{
+  __mdspan_transpose(__threads, __src, __dst);
+}
+
+template <class _Type, class _Extents, class _Layout, class _Accessor, class _Tp>
+_LIBCUDACXX_HOST void mdspan_fill(const host_threads& __threads,
+                                  _CUDA_VSTD::mdspan<_Type, _Extents, _Layout, _Accessor> __dst, const _Tp& __value)
+{
+  __mdspan_fill(__threads, __dst, __value);
+}
+
+template <class _IndexType, size_t... _Extents, class _Fn>
+_LIBCUDACXX_HOST void mdspan_for_each_index(const host_threads& __threads,
+                                            const _CUDA_VSTD::extents<_IndexType, _Extents...>& __exts, _Fn&& __fn)
+{
+  using _Exts = _CUDA_VSTD::extents<_IndexType, _Extents...>;
+  __mdspan_for_each_index(__threads, __exts, __mdspan_right_order<_Exts>(), __fn);
+}
+
+template <class _Type, class _Extents, class _Layout, class _Accessor, class _Fn>
+_LIBCUDACXX_HOST void mdspan_for_each_index(const host_threads& __threads,
+                                            _CUDA_VSTD::mdspan<_Type, _Extents, _Layout, _Accessor> __m, _Fn&& __fn)
+{
+  __mdspan_for_each_index(__threads, __m.extents(), __mdspan_memory_order(__m.mapping()), __fn);
+}
+
+#endif // _CCCL_COMPILER_NVRTC
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _LIBCUDACXX___CUDA_MDSPAN_ALGORITHM_H
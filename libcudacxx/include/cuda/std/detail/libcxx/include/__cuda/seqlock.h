@@ -0,0 +1,161 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_SEQLOCK_H
+#define _LIBCUDACXX___CUDA_SEQLOCK_H
+
+#ifndef __cuda_std__
+#error "<__cuda/seqlock> should only be included in from <cuda/seqlock>"
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../__cuda/futex.h"
+#include "../__type_traits/conditional.h"
+#include "../__type_traits/is_trivially_copyable.h"
+#include "../atomic"
+#include "../cstdint"
+#include "../cstring"
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// A value which one writer at a time replaces, and which readers copy out
+// without writing to shared memory at all.
+//
+// __sequence is odd while a write is in progress. A reader copies the value
+// between two loads of __sequence, and tries again unless they saw the same
+// even number. The value is kept as words which are read and written with
+// relaxed atomic_refs, so that a reader racing with a writer only reads a
+// torn copy, which it then throws away, rather than having a data race.
+//
+// Writers take the lock by making __sequence odd. Readers and writers which
+// find a write in progress sleep on __sequence, an int, with a futex on the
+// Linux host, see __futex_sleepers.
+template <class _Tp, thread_scope _Sco = thread_scope_system>
+class seqlock {
+    static_assert(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_trivially_copyable, _Tp),
+                  "seqlock needs a trivially copyable value type.");
+
+    using __word = _CUDA_VSTD::__conditional_t<sizeof(_Tp) % 8 == 0, _CUDA_VSTD::uint64_t, _CUDA_VSTD::uint32_t>;
+    static constexpr size_t __word_count = (sizeof(_Tp) + sizeof(__word) - 1) / sizeof(__word);
+
+    atomic<int, _Sco> __sequence{0};
+    __futex_sleepers<_Sco> __sleepers;
+    // atomic_ref needs words aligned to their size, which 64-bit integers
+    // are not on every 32-bit ABI
+    alignas(sizeof(__word)) __word __words[__word_count];
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    static int __next(int __s) noexcept { return static_cast<int>(static_cast<unsigned>(__s) + 1u); }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    int __lock() noexcept {
+        int __s = __sequence.load(_CUDA_VSTD::memory_order_relaxed);
+        for (;;) {
+            if (__s & 1) {
+                __sleepers.__wait(__sequence, __s);
+                __s = __sequence.load(_CUDA_VSTD::memory_order_relaxed);
+            }
+            else if (__sequence.compare_exchange_weak(__s, __next(__s), _CUDA_VSTD::memory_order_acquire,
+                                                      _CUDA_VSTD::memory_order_relaxed)) {
+                // the words must not be written before __sequence is odd
+                atomic_thread_fence(_CUDA_VSTD::memory_order_release, _Sco);
+                return __s;
+            }
+        }
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __unlock(int __s) noexcept {
+        __sequence.store(__next(__next(__s)), _CUDA_VSTD::memory_order_release);
+        __sleepers.__wake_all(__sequence);
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __write(const _Tp& __value) noexcept {
+        __word __copy[__word_count] = {};
+        _CUDA_VSTD::memcpy(__copy, &__value, sizeof(_Tp));
+        for (size_t __i = 0; __i < __word_count; ++__i)
+            atomic_ref<__word, _Sco>(__words[__i]).store(__copy[__i], _CUDA_VSTD::memory_order_relaxed);
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    _Tp __read() const noexcept {
+        __word __copy[__word_count];
+        for (size_t __i = 0; __i < __word_count; ++__i)
+            __copy[__i] = atomic_ref<__word, _Sco>(const_cast<__word&>(__words[__i])).load(_CUDA_VSTD::memory_order_relaxed);
+        // _Tp need not be default constructible; copying its bytes into
+        // storage makes a trivially copyable object
+        alignas(_Tp) unsigned char __value[sizeof(_Tp)];
+        _CUDA_VSTD::memcpy(__value, __copy, sizeof(_Tp));
+        return *reinterpret_cast<_Tp*>(__value);
+    }
+
+public:
+    using value_type = _Tp;
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    seqlock() noexcept : seqlock(_Tp()) {}
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    explicit seqlock(const _Tp& __value) noexcept : __words() {
+        _CUDA_VSTD::memcpy(__words, &__value, sizeof(_Tp));
+    }
+
+    seqlock(const seqlock&) = delete;
+    seqlock& operator=(const seqlock&) = delete;
+
+    // Returns a copy of the value, which no write was in progress during.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    _Tp load() const noexcept {
+        for (;;) {
+            const int __before = __sequence.load(_CUDA_VSTD::memory_order_acquire);
+            if (__before & 1) {
+                __sleepers.__wait(__sequence, __before);
+                continue;
+            }
+            const _Tp __value = __read();
+            // the words must be read before __sequence is read again
+            atomic_thread_fence(_CUDA_VSTD::memory_order_acquire, _Sco);
+            if (__sequence.load(_CUDA_VSTD::memory_order_relaxed) == __before)
+                return __value;
+        }
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void store(const _Tp& __value) noexcept {
+        const int __s = __lock();
+        __write(__value);
+        __unlock(__s);
+    }
+
+    // Replaces the value by __fn applied to it, with no other write in
+    // between, and returns the new value. __fn must not throw, nor touch the
+    // seqlock.
+    template <class _Fn>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    _Tp update(_Fn __fn) {
+        const int __s = __lock();
+        const _Tp __value = __fn(__read());
+        __write(__value);
+        __unlock(__s);
+        return __value;
+    }
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _LIBCUDACXX___CUDA_SEQLOCK_H
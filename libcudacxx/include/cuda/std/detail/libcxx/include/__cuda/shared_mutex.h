@@ -0,0 +1,131 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_SHARED_MUTEX_H
+#define _LIBCUDACXX___CUDA_SHARED_MUTEX_H
+
+#ifndef __cuda_std__
+#error "<__cuda/shared_mutex> should only be included in from <cuda/shared_mutex>"
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../__cuda/futex.h"
+#include "../atomic"
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// A writer preferring reader-writer lock.
+//
+// __state holds __writer_bit while a writer owns the lock and the number of
+// readers otherwise. __writers counts the writers which own or wait for the
+// lock. A reader only enters while __writers is zero, so that a waiting
+// writer keeps new readers out and only waits for the readers already in.
+//
+// Readers sleep on __writers and writers sleep on __state, so every wake up
+// goes to the kind of thread which can make progress. Both are ints, which
+// threads sleep on with a futex on the Linux host, see __futex_sleepers.
+template <thread_scope _Sco = thread_scope_system>
+class shared_mutex {
+    static constexpr int __writer_bit = 1 << 30;
+
+    atomic<int, _Sco> __state{0};
+    atomic<int, _Sco> __writers{0};
+    __futex_sleepers<_Sco> __sleepers;
+
+public:
+    shared_mutex() = default;
+    shared_mutex(const shared_mutex&) = delete;
+    shared_mutex& operator=(const shared_mutex&) = delete;
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void lock() noexcept {
+        __writers.fetch_add(1, _CUDA_VSTD::memory_order_seq_cst);
+        for (;;) {
+            int __s = __state.load(_CUDA_VSTD::memory_order_seq_cst);
+            if (__s == 0) {
+                if (__state.compare_exchange_weak(__s, __writer_bit, _CUDA_VSTD::memory_order_acquire,
+                                                  _CUDA_VSTD::memory_order_relaxed))
+                    return;
+            }
+            else {
+                __sleepers.__wait(__state, __s);
+            }
+        }
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_lock() noexcept {
+        __writers.fetch_add(1, _CUDA_VSTD::memory_order_seq_cst);
+        int __s = 0;
+        if (__state.compare_exchange_strong(__s, __writer_bit, _CUDA_VSTD::memory_order_acquire,
+                                            _CUDA_VSTD::memory_order_relaxed))
+            return true;
+        // the readers may have gone to sleep on the count of this writer
+        if (__writers.fetch_sub(1, _CUDA_VSTD::memory_order_relaxed) == 1)
+            __sleepers.__wake_all(__writers);
+        return false;
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void unlock() noexcept {
+        __state.store(0, _CUDA_VSTD::memory_order_release);
+        if (__writers.fetch_sub(1, _CUDA_VSTD::memory_order_relaxed) == 1)
+            __sleepers.__wake_all(__writers);
+        else
+            __sleepers.__wake_one(__state);
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void lock_shared() noexcept {
+        for (;;) {
+            const int __w = __writers.load(_CUDA_VSTD::memory_order_relaxed);
+            if (__w != 0) {
+                __sleepers.__wait(__writers, __w);
+                continue;
+            }
+            if (try_lock_shared())
+                return;
+        }
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_lock_shared() noexcept {
+        if (__writers.load(_CUDA_VSTD::memory_order_relaxed) != 0)
+            return false;
+        int __s = __state.load(_CUDA_VSTD::memory_order_relaxed);
+        while (__s != __writer_bit) {
+            if (__state.compare_exchange_weak(__s, __s + 1, _CUDA_VSTD::memory_order_acquire,
+                                              _CUDA_VSTD::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+
+    // The last reader out wakes a writer, if there is one. The writer counts
+    // itself before it looks at the readers, and the reader leaves before it
+    // looks at the writers, so that one of them sees the other.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void unlock_shared() noexcept {
+        if (__state.fetch_sub(1, _CUDA_VSTD::memory_order_seq_cst) == 1 &&
+            __writers.load(_CUDA_VSTD::memory_order_seq_cst) != 0)
+            __sleepers.__wake_one(__state);
+    }
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _LIBCUDACXX___CUDA_SHARED_MUTEX_H
@@ -0,0 +1,101 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_ACCESS_H
+#define _LIBCUDACXX___LINALG_ACCESS_H
+
+#ifndef __cuda_std__
+#include <__config>
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../__mdspan/mdspan.h"
+#include "../__type_traits/integral_constant.h"
+
+#if _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg {
+
+// The algorithms reach the elements through the accessor and the mapping, so
+// that they do not depend on which of the call and the subscript operators
+// mdspan provides.
+template <class _Mdspan, class... _Indices>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+typename _Mdspan::reference __element(const _Mdspan& __m, _Indices... __idx)
+{
+  return __m.accessor().access(__m.data_handle(), __m.mapping()(__idx...));
+}
+
+// Whether the elements of a matrix are closer to each other down a column
+// than along a row, so that the algorithms should walk down the columns.
+template <class _Mdspan>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+bool __is_column_major(const _Mdspan& __m)
+{
+  static_assert(_Mdspan::rank() == 2, "");
+  return __m.is_strided() && __m.stride(0) < __m.stride(1);
+}
+
+// Calls __fn(__i) for every index of a vector, or __fn(__i, __j) for every
+// index of a matrix, in memory order.
+template <class _Mdspan, class _Fn>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __for_each_index(const _Mdspan& __m, _Fn& __fn, integral_constant<size_t, 1>)
+{
+  for (typename _Mdspan::index_type __i = 0; __i < __m.extent(0); ++__i) {
+    __fn(__i);
+  }
+}
+
+template <class _Mdspan, class _Fn>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __for_each_index(const _Mdspan& __m, _Fn& __fn, integral_constant<size_t, 2>)
+{
+  using _Index = typename _Mdspan::index_type;
+  if (_CUDA_VSTD::linalg::__is_column_major(__m)) {
+    for (_Index __j = 0; __j < __m.extent(1); ++__j) {
+      for (_Index __i = 0; __i < __m.extent(0); ++__i) {
+        __fn(__i, __j);
+      }
+    }
+  }
+  else {
+    for (_Index __i = 0; __i < __m.extent(0); ++__i) {
+      for (_Index __j = 0; __j < __m.extent(1); ++__j) {
+        __fn(__i, __j);
+      }
+    }
+  }
+}
+
+template <class _Mdspan, class _Fn>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __for_each_index(const _Mdspan& __m, _Fn&& __fn)
+{
+  static_assert(_Mdspan::rank() == 1 || _Mdspan::rank() == 2, "linalg algorithms take vectors or matrices.");
+  _CUDA_VSTD::linalg::__for_each_index(__m, __fn, integral_constant<size_t, _Mdspan::rank()>{});
+}
+
+} // namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _LIBCUDACXX___LINALG_ACCESS_H
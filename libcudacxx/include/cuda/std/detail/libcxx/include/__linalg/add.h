@@ -0,0 +1,61 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_ADD_H
+#define _LIBCUDACXX___LINALG_ADD_H
+
+#ifndef __cuda_std__
+#include <__config>
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../__linalg/access.h"
+
+#if _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg {
+
+// [linalg.algs.blas1.add]
+// Assigns the sum of the vectors or matrices __x and __y to __z. __z is
+// traversed in memory order.
+template <class _ElementType1, class _Extents1, class _Layout1, class _Accessor1,
+          class _ElementType2, class _Extents2, class _Layout2, class _Accessor2,
+          class _ElementType3, class _Extents3, class _Layout3, class _Accessor3>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void add(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __x,
+         mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __y,
+         mdspan<_ElementType3, _Extents3, _Layout3, _Accessor3> __z)
+{
+  static_assert(_Extents1::rank() == _Extents3::rank() && _Extents2::rank() == _Extents3::rank(),
+                "add requires operands of the same rank.");
+  _LIBCUDACXX_ASSERT(__x.extents() == __z.extents() && __y.extents() == __z.extents(),
+                     "add requires operands of the same extents.");
+  _CUDA_VSTD::linalg::__for_each_index(__z, [&](auto... __idx) {
+    _CUDA_VSTD::linalg::__element(__z, __idx...) =
+      _CUDA_VSTD::linalg::__element(__x, __idx...) + _CUDA_VSTD::linalg::__element(__y, __idx...);
+  });
+}
+
+} // namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _LIBCUDACXX___LINALG_ADD_H
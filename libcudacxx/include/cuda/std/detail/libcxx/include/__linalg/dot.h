@@ -0,0 +1,88 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_DOT_H
+#define _LIBCUDACXX___LINALG_DOT_H
+
+#ifndef __cuda_std__
+#include <__config>
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../__linalg/access.h"
+#include "../__utility/declval.h"
+
+#if _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg {
+
+// The sum runs over four partial sums, which breaks the dependency of every
+// addition on the previous one.
+template <class _Scalar, class _InVec1, class _InVec2>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+_Scalar __dot(const _InVec1& __v1, const _InVec2& __v2, _Scalar __init)
+{
+  using _Index = typename _InVec1::index_type;
+  const _Index __n = __v1.extent(0);
+  _Scalar __s0{}, __s1{}, __s2{}, __s3{};
+  _Index __i = 0;
+  for (; __i + 4 <= __n; __i += 4) {
+    __s0 += _CUDA_VSTD::linalg::__element(__v1, __i) * _CUDA_VSTD::linalg::__element(__v2, __i);
+    __s1 += _CUDA_VSTD::linalg::__element(__v1, __i + 1) * _CUDA_VSTD::linalg::__element(__v2, __i + 1);
+    __s2 += _CUDA_VSTD::linalg::__element(__v1, __i + 2) * _CUDA_VSTD::linalg::__element(__v2, __i + 2);
+    __s3 += _CUDA_VSTD::linalg::__element(__v1, __i + 3) * _CUDA_VSTD::linalg::__element(__v2, __i + 3);
+  }
+  for (; __i < __n; ++__i) {
+    __s0 += _CUDA_VSTD::linalg::__element(__v1, __i) * _CUDA_VSTD::linalg::__element(__v2, __i);
+  }
+  return __init + ((__s0 + __s1) + (__s2 + __s3));
+}
+
+// [linalg.algs.blas1.dot]
+// Returns __init plus the sum of the products of the elements of __v1 and
+// __v2. The elements are not conjugated.
+template <class _ElementType1, class _Extents1, class _Layout1, class _Accessor1,
+          class _ElementType2, class _Extents2, class _Layout2, class _Accessor2, class _Scalar>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+_Scalar dot(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __v1,
+            mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __v2, _Scalar __init)
+{
+  static_assert(_Extents1::rank() == 1 && _Extents2::rank() == 1, "dot requires vectors.");
+  _LIBCUDACXX_ASSERT(__v1.extent(0) == __v2.extent(0), "dot requires vectors of the same extent.");
+  return _CUDA_VSTD::linalg::__dot(__v1, __v2, __init);
+}
+
+template <class _ElementType1, class _Extents1, class _Layout1, class _Accessor1,
+          class _ElementType2, class _Extents2, class _Layout2, class _Accessor2>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+auto dot(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __v1,
+         mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __v2)
+  -> decltype(_CUDA_VSTD::declval<typename _Accessor1::element_type>() * _CUDA_VSTD::declval<typename _Accessor2::element_type>())
+{
+  using _Scalar = decltype(_CUDA_VSTD::declval<typename _Accessor1::element_type>() * _CUDA_VSTD::declval<typename _Accessor2::element_type>());
+  return _CUDA_VSTD::linalg::dot(__v1, __v2, _Scalar{});
+}
+
+} // namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _LIBCUDACXX___LINALG_DOT_H
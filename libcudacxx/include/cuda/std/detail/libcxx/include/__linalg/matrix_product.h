@@ -0,0 +1,238 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_MATRIX_PRODUCT_H
+#define _LIBCUDACXX___LINALG_MATRIX_PRODUCT_H
+
+#ifndef __cuda_std__
+#include <__config>
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../__linalg/access.h"
+#include "../__type_traits/remove_cv.h"
+
+#include <nv/target>
+
+#if _CCCL_STD_VER > 2011
+
+// Unrolls the loops of the micro-kernel, which not every optimization level
+// does by itself, so that the sums stay in registers.
+#if defined(_CCCL_COMPILER_GCC) && !defined(_CCCL_CUDA_COMPILER)
+#  define _LIBCUDACXX_LINALG_UNROLL(_N) _Pragma(_LIBCUDACXX_TOSTRING(GCC unroll _N))
+#elif defined(_CCCL_COMPILER_CLANG) && !defined(_CCCL_CUDA_COMPILER)
+#  define _LIBCUDACXX_LINALG_UNROLL(_N) _Pragma(_LIBCUDACXX_TOSTRING(unroll _N))
+#else
+#  define _LIBCUDACXX_LINALG_UNROLL(_N)
+#endif
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg {
+
+// The blocking of the product on the host. A block of __mc rows and __kc
+// columns of A is packed into panels of __mr rows, which stay in the L1 or L2
+// cache while panels of __nr columns of B go by. A micro-kernel multiplies a
+// panel of A with a panel of B into __mr x __nr sums, which the compiler keeps
+// in vector registers. The packed blocks take 40 KiB on the stack.
+template <class _Tp>
+struct __matrix_product_blocking
+{
+  static constexpr size_t __mr = 4;
+  static constexpr size_t __nr = 8;
+  static constexpr size_t __mc = 32;
+  static constexpr size_t __kc = 1024 / sizeof(_Tp) < 8 ? 8 : 1024 / sizeof(_Tp);
+};
+
+// Products with fewer multiplications than this are not worth the packing.
+static constexpr size_t __matrix_product_min_blocked = 16 * 16 * 16;
+
+template <class _Tp, class _OutMat>
+_LIBCUDACXX_HOST void __matrix_product_micro_kernel(const _Tp* __a, const _Tp* __b, size_t __kb, const _OutMat& __c,
+                                                    size_t __i0, size_t __j0, size_t __rows, size_t __cols)
+{
+  using _Blocking = __matrix_product_blocking<_Tp>;
+  using _Index    = typename _OutMat::index_type;
+  _Tp __acc[_Blocking::__mr][_Blocking::__nr];
+  for (size_t __i = 0; __i < _Blocking::__mr; ++__i) {
+    for (size_t __j = 0; __j < _Blocking::__nr; ++__j) {
+      __acc[__i][__j] = _Tp{};
+    }
+  }
+  for (size_t __p = 0; __p < __kb; ++__p) {
+    const _Tp* __ap = __a + __p * _Blocking::__mr;
+    const _Tp* __bp = __b + __p * _Blocking::__nr;
+    _LIBCUDACXX_LINALG_UNROLL(4)
+    for (size_t __i = 0; __i < _Blocking::__mr; ++__i) {
+      _LIBCUDACXX_LINALG_UNROLL(8)
+      for (size_t __j = 0; __j < _Blocking::__nr; ++__j) {
+        __acc[__i][__j] += __ap[__i] * __bp[__j];
+      }
+    }
+  }
+  for (size_t __i = 0; __i < __rows; ++__i) {
+    for (size_t __j = 0; __j < __cols; ++__j) {
+      _CUDA_VSTD::linalg::__element(__c, static_cast<_Index>(__i0 + __i), static_cast<_Index>(__j0 + __j)) +=
+        __acc[__i][__j];
+    }
+  }
+}
+
+template <class _InMat1, class _InMat2, class _OutMat>
+_LIBCUDACXX_HOST void __matrix_product_add_blocked(const _InMat1& __a, const _InMat2& __b, const _OutMat& __c)
+{
+  using _Tp       = __remove_cv_t<typename _OutMat::element_type>;
+  using _Blocking = __matrix_product_blocking<_Tp>;
+  using _Index1   = typename _InMat1::index_type;
+  using _Index2   = typename _InMat2::index_type;
+  constexpr size_t __mr = _Blocking::__mr;
+  constexpr size_t __nr = _Blocking::__nr;
+  constexpr size_t __mc = _Blocking::__mc;
+  constexpr size_t __kc = _Blocking::__kc;
+  const size_t __m = static_cast<size_t>(__a.extent(0));
+  const size_t __k = static_cast<size_t>(__a.extent(1));
+  const size_t __n = static_cast<size_t>(__b.extent(1));
+
+  _Tp __a_pack[__mc * __kc];
+  _Tp __b_pack[__kc * __nr];
+  for (size_t __k0 = 0; __k0 < __k; __k0 += __kc) {
+    const size_t __kb = __k - __k0 < __kc ? __k - __k0 : __kc;
+    for (size_t __i0 = 0; __i0 < __m; __i0 += __mc) {
+      const size_t __mb = __m - __i0 < __mc ? __m - __i0 : __mc;
+      // panels of __mr rows, one column of the panel after the other, padded
+      // with zeros past the last row
+      for (size_t __ip = 0; __ip < __mb; __ip += __mr) {
+        _Tp* __panel = __a_pack + __ip * __kb;
+        for (size_t __p = 0; __p < __kb; ++__p) {
+          for (size_t __i = 0; __i < __mr; ++__i) {
+            __panel[__p * __mr + __i] = __ip + __i < __mb
+              ? static_cast<_Tp>(_CUDA_VSTD::linalg::__element(__a, static_cast<_Index1>(__i0 + __ip + __i), static_cast<_Index1>(__k0 + __p)))
+              : _Tp{};
+          }
+        }
+      }
+      for (size_t __j0 = 0; __j0 < __n; __j0 += __nr) {
+        const size_t __nb = __n - __j0 < __nr ? __n - __j0 : __nr;
+        for (size_t __p = 0; __p < __kb; ++__p) {
+          for (size_t __j = 0; __j < __nr; ++__j) {
+            __b_pack[__p * __nr + __j] = __j < __nb
+              ? static_cast<_Tp>(_CUDA_VSTD::linalg::__element(__b, static_cast<_Index2>(__k0 + __p), static_cast<_Index2>(__j0 + __j)))
+              : _Tp{};
+          }
+        }
+        for (size_t __ip = 0; __ip < __mb; __ip += __mr) {
+          _CUDA_VSTD::linalg::__matrix_product_micro_kernel(__a_pack + __ip * __kb, __b_pack, __kb, __c, __i0 + __ip, __j0,
+                                                            __mb - __ip < __mr ? __mb - __ip : __mr, __nb);
+        }
+      }
+    }
+  }
+}
+
+template <class _InMat1, class _InMat2, class _OutMat>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __matrix_product_add_naive(const _InMat1& __a, const _InMat2& __b, const _OutMat& __c)
+{
+  using _Tp    = __remove_cv_t<typename _OutMat::element_type>;
+  using _Index = typename _OutMat::index_type;
+  for (_Index __i = 0; __i < __c.extent(0); ++__i) {
+    for (_Index __j = 0; __j < __c.extent(1); ++__j) {
+      _Tp __sum{};
+      for (typename _InMat1::index_type __p = 0; __p < __a.extent(1); ++__p) {
+        __sum += _CUDA_VSTD::linalg::__element(__a, __i, __p) * _CUDA_VSTD::linalg::__element(__b, __p, __j);
+      }
+      _CUDA_VSTD::linalg::__element(__c, __i, __j) += __sum;
+    }
+  }
+}
+
+// Adds the product of __a and __b to __c.
+template <class _InMat1, class _InMat2, class _OutMat>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __matrix_product_add(const _InMat1& __a, const _InMat2& __b, const _OutMat& __c)
+{
+  const size_t __multiplications = static_cast<size_t>(__a.extent(0)) * static_cast<size_t>(__a.extent(1))
+                                 * static_cast<size_t>(__b.extent(1));
+  if (__multiplications < __matrix_product_min_blocked) {
+    _CUDA_VSTD::linalg::__matrix_product_add_naive(__a, __b, __c);
+    return;
+  }
+  NV_IF_ELSE_TARGET(NV_IS_HOST, (
+    _CUDA_VSTD::linalg::__matrix_product_add_blocked(__a, __b, __c);
+  ), (
+    _CUDA_VSTD::linalg::__matrix_product_add_naive(__a, __b, __c);
+  ))
+}
+
+template <class _InMat1, class _InMat2, class _OutMat>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __check_matrix_product(const _InMat1& __a, const _InMat2& __b, const _OutMat& __c)
+{
+  static_assert(_InMat1::rank() == 2 && _InMat2::rank() == 2 && _OutMat::rank() == 2,
+                "matrix_product requires matrices.");
+  _LIBCUDACXX_ASSERT(__a.extent(1) == __b.extent(0) && __a.extent(0) == __c.extent(0) && __b.extent(1) == __c.extent(1),
+                     "matrix_product requires extents which match.");
+  (void)__a;
+  (void)__b;
+  (void)__c;
+}
+
+// [linalg.algs.blas3.gemm]
+// Assigns the product of the matrices __a and __b to __c.
+template <class _ElementType1, class _Extents1, class _Layout1, class _Accessor1,
+          class _ElementType2, class _Extents2, class _Layout2, class _Accessor2,
+          class _ElementType3, class _Extents3, class _Layout3, class _Accessor3>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void matrix_product(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __a,
+                    mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __b,
+                    mdspan<_ElementType3, _Extents3, _Layout3, _Accessor3> __c)
+{
+  _CUDA_VSTD::linalg::__check_matrix_product(__a, __b, __c);
+  using _Tp = __remove_cv_t<_ElementType3>;
+  _CUDA_VSTD::linalg::__for_each_index(__c, [&](typename _Extents3::index_type __i, typename _Extents3::index_type __j) {
+    _CUDA_VSTD::linalg::__element(__c, __i, __j) = _Tp{};
+  });
+  _CUDA_VSTD::linalg::__matrix_product_add(__a, __b, __c);
+}
+
+// Assigns the sum of the matrix __e and the product of the matrices __a and
+// __b to __c. __e and __c may be the same matrix.
+template <class _ElementType1, class _Extents1, class _Layout1, class _Accessor1,
+          class _ElementType2, class _Extents2, class _Layout2, class _Accessor2,
+          class _ElementType3, class _Extents3, class _Layout3, class _Accessor3,
+          class _ElementType4, class _Extents4, class _Layout4, class _Accessor4>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void matrix_product(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __a,
+                    mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __b,
+                    mdspan<_ElementType3, _Extents3, _Layout3, _Accessor3> __e,
+                    mdspan<_ElementType4, _Extents4, _Layout4, _Accessor4> __c)
+{
+  _CUDA_VSTD::linalg::__check_matrix_product(__a, __b, __c);
+  _LIBCUDACXX_ASSERT(__e.extents() == __c.extents(), "matrix_product requires extents which match.");
+  _CUDA_VSTD::linalg::__for_each_index(__c, [&](typename _Extents4::index_type __i, typename _Extents4::index_type __j) {
+    _CUDA_VSTD::linalg::__element(__c, __i, __j) = _CUDA_VSTD::linalg::__element(__e, __i, __j);
+  });
+  _CUDA_VSTD::linalg::__matrix_product_add(__a, __b, __c);
+}
+
+} // namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _LIBCUDACXX___LINALG_MATRIX_PRODUCT_H
@@ -0,0 +1,140 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_MATRIX_VECTOR_PRODUCT_H
+#define _LIBCUDACXX___LINALG_MATRIX_VECTOR_PRODUCT_H
+
+#ifndef __cuda_std__
+#include <__config>
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../__linalg/access.h"
+#include "../__type_traits/remove_cv.h"
+
+#if _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg {
+
+// Adds __a times __x to __y. A matrix laid out by rows is multiplied row after
+// row with four partial sums; one laid out by columns is accumulated four
+// columns at a time, so that every pass over __y does four columns of work.
+template <class _InMat, class _InVec, class _InOutVec>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __matrix_vector_product_add(const _InMat& __a, const _InVec& __x, const _InOutVec& __y)
+{
+  using _Index = typename _InMat::index_type;
+  using _Tp    = __remove_cv_t<typename _InOutVec::element_type>;
+  const _Index __m = __a.extent(0);
+  const _Index __n = __a.extent(1);
+  if (_CUDA_VSTD::linalg::__is_column_major(__a)) {
+    _Index __j = 0;
+    for (; __j + 4 <= __n; __j += 4) {
+      const _Tp __x0 = _CUDA_VSTD::linalg::__element(__x, __j);
+      const _Tp __x1 = _CUDA_VSTD::linalg::__element(__x, __j + 1);
+      const _Tp __x2 = _CUDA_VSTD::linalg::__element(__x, __j + 2);
+      const _Tp __x3 = _CUDA_VSTD::linalg::__element(__x, __j + 3);
+      for (_Index __i = 0; __i < __m; ++__i) {
+        _CUDA_VSTD::linalg::__element(__y, __i) +=
+            (_CUDA_VSTD::linalg::__element(__a, __i, __j) * __x0 + _CUDA_VSTD::linalg::__element(__a, __i, __j + 1) * __x1)
+          + (_CUDA_VSTD::linalg::__element(__a, __i, __j + 2) * __x2 + _CUDA_VSTD::linalg::__element(__a, __i, __j + 3) * __x3);
+      }
+    }
+    for (; __j < __n; ++__j) {
+      const _Tp __xj = _CUDA_VSTD::linalg::__element(__x, __j);
+      for (_Index __i = 0; __i < __m; ++__i) {
+        _CUDA_VSTD::linalg::__element(__y, __i) += _CUDA_VSTD::linalg::__element(__a, __i, __j) * __xj;
+      }
+    }
+  }
+  else {
+    for (_Index __i = 0; __i < __m; ++__i) {
+      _Tp __s0{}, __s1{}, __s2{}, __s3{};
+      _Index __j = 0;
+      for (; __j + 4 <= __n; __j += 4) {
+        __s0 += _CUDA_VSTD::linalg::__element(__a, __i, __j) * _CUDA_VSTD::linalg::__element(__x, __j);
+        __s1 += _CUDA_VSTD::linalg::__element(__a, __i, __j + 1) * _CUDA_VSTD::linalg::__element(__x, __j + 1);
+        __s2 += _CUDA_VSTD::linalg::__element(__a, __i, __j + 2) * _CUDA_VSTD::linalg::__element(__x, __j + 2);
+        __s3 += _CUDA_VSTD::linalg::__element(__a, __i, __j + 3) * _CUDA_VSTD::linalg::__element(__x, __j + 3);
+      }
+      for (; __j < __n; ++__j) {
+        __s0 += _CUDA_VSTD::linalg::__element(__a, __i, __j) * _CUDA_VSTD::linalg::__element(__x, __j);
+      }
+      _CUDA_VSTD::linalg::__element(__y, __i) += (__s0 + __s1) + (__s2 + __s3);
+    }
+  }
+}
+
+template <class _InMat, class _InVec, class _OutVec>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __check_matrix_vector_product(const _InMat& __a, const _InVec& __x, const _OutVec& __y)
+{
+  static_assert(_InMat::rank() == 2 && _InVec::rank() == 1 && _OutVec::rank() == 1,
+                "matrix_vector_product requires a matrix and vectors.");
+  _LIBCUDACXX_ASSERT(__a.extent(1) == __x.extent(0) && __a.extent(0) == __y.extent(0),
+                     "matrix_vector_product requires extents which match.");
+  (void)__a;
+  (void)__x;
+  (void)__y;
+}
+
+// [linalg.algs.blas2.gemv]
+// Assigns the product of the matrix __a and the vector __x to __y.
+template <class _ElementType1, class _Extents1, class _Layout1, class _Accessor1,
+          class _ElementType2, class _Extents2, class _Layout2, class _Accessor2,
+          class _ElementType3, class _Extents3, class _Layout3, class _Accessor3>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void matrix_vector_product(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __a,
+                           mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __x,
+                           mdspan<_ElementType3, _Extents3, _Layout3, _Accessor3> __y)
+{
+  _CUDA_VSTD::linalg::__check_matrix_vector_product(__a, __x, __y);
+  for (typename _Extents3::index_type __i = 0; __i < __y.extent(0); ++__i) {
+    _CUDA_VSTD::linalg::__element(__y, __i) = __remove_cv_t<_ElementType3>{};
+  }
+  _CUDA_VSTD::linalg::__matrix_vector_product_add(__a, __x, __y);
+}
+
+// Assigns the sum of the vector __y and the product of the matrix __a and the
+// vector __x to __z. __y and __z may be the same vector.
+template <class _ElementType1, class _Extents1, class _Layout1, class _Accessor1,
+          class _ElementType2, class _Extents2, class _Layout2, class _Accessor2,
+          class _ElementType3, class _Extents3, class _Layout3, class _Accessor3,
+          class _ElementType4, class _Extents4, class _Layout4, class _Accessor4>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void matrix_vector_product(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __a,
+                           mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __x,
+                           mdspan<_ElementType3, _Extents3, _Layout3, _Accessor3> __y,
+                           mdspan<_ElementType4, _Extents4, _Layout4, _Accessor4> __z)
+{
+  _CUDA_VSTD::linalg::__check_matrix_vector_product(__a, __x, __z);
+  _LIBCUDACXX_ASSERT(__y.extent(0) == __z.extent(0), "matrix_vector_product requires extents which match.");
+  for (typename _Extents4::index_type __i = 0; __i < __z.extent(0); ++__i) {
+    _CUDA_VSTD::linalg::__element(__z, __i) = _CUDA_VSTD::linalg::__element(__y, __i);
+  }
+  _CUDA_VSTD::linalg::__matrix_vector_product_add(__a, __x, __z);
+}
+
+} // namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _LIBCUDACXX___LINALG_MATRIX_VECTOR_PRODUCT_H
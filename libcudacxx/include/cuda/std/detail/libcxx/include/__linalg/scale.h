@@ -0,0 +1,51 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_SCALE_H
+#define _LIBCUDACXX___LINALG_SCALE_H
+
+#ifndef __cuda_std__
+#include <__config>
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../__linalg/access.h"
+
+#if _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg {
+
+// [linalg.algs.blas1.scal]
+// Multiplies every element of the vector or matrix __x by __alpha.
+template <class _Scalar, class _ElementType, class _Extents, class _Layout, class _Accessor>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void scale(_Scalar __alpha, mdspan<_ElementType, _Extents, _Layout, _Accessor> __x)
+{
+  _CUDA_VSTD::linalg::__for_each_index(__x, [&](auto... __idx) {
+    _CUDA_VSTD::linalg::__element(__x, __idx...) = __alpha * _CUDA_VSTD::linalg::__element(__x, __idx...);
+  });
+}
+
+} // namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _LIBCUDACXX___LINALG_SCALE_H
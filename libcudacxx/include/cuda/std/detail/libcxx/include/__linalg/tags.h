@@ -0,0 +1,50 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_TAGS_H
+#define _LIBCUDACXX___LINALG_TAGS_H
+
+#ifndef __cuda_std__
+#include <__config>
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg {
+
+struct upper_triangle_t { explicit upper_triangle_t() = default; };
+_LIBCUDACXX_INLINE_VAR constexpr auto upper_triangle = upper_triangle_t{ };
+
+struct lower_triangle_t { explicit lower_triangle_t() = default; };
+_LIBCUDACXX_INLINE_VAR constexpr auto lower_triangle = lower_triangle_t{ };
+
+struct implicit_unit_diagonal_t { explicit implicit_unit_diagonal_t() = default; };
+_LIBCUDACXX_INLINE_VAR constexpr auto implicit_unit_diagonal = implicit_unit_diagonal_t{ };
+
+struct explicit_diagonal_t { explicit explicit_diagonal_t() = default; };
+_LIBCUDACXX_INLINE_VAR constexpr auto explicit_diagonal = explicit_diagonal_t{ };
+
+} // namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _LIBCUDACXX___LINALG_TAGS_H
@@ -0,0 +1,239 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_TRIANGULAR_SOLVE_H
+#define _LIBCUDACXX___LINALG_TRIANGULAR_SOLVE_H
+
+#ifndef __cuda_std__
+#include <__config>
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../__linalg/access.h"
+#include "../__linalg/tags.h"
+#include "../__type_traits/is_same.h"
+#include "../__type_traits/remove_cv.h"
+
+#if _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg {
+
+template <class _InMat, class _Index, class _Tp>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+_Tp __apply_diagonal(const _InMat&, _Index, _Tp __x, implicit_unit_diagonal_t)
+{
+  return __x;
+}
+
+template <class _InMat, class _Index, class _Tp>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+_Tp __apply_diagonal(const _InMat& __a, _Index __i, _Tp __x, explicit_diagonal_t)
+{
+  return __x / _CUDA_VSTD::linalg::__element(__a, __i, __i);
+}
+
+// Solves A x = b in place for the vector __x(__i), which holds b on entry.
+// The substitution visits the rows first to last for a lower triangle, and
+// last to first for an upper one. A matrix laid out by columns is used a
+// column at a time, and one laid out by rows a row at a time.
+template <class _Tp, class _InMat, class _Triangle, class _Diagonal, class _Vec>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __triangular_solve_in_place(const _InMat& __a, _Triangle, _Diagonal __d, const _Vec& __x)
+{
+  using _Index = typename _InMat::index_type;
+  constexpr bool __lower = _LIBCUDACXX_TRAIT(is_same, _Triangle, lower_triangle_t);
+  const _Index __n = __a.extent(0);
+  if (_CUDA_VSTD::linalg::__is_column_major(__a)) {
+    for (_Index __p = 0; __p < __n; ++__p) {
+      const _Index __k = __lower ? __p : __n - 1 - __p;
+      const _Tp __xk = _CUDA_VSTD::linalg::__apply_diagonal(__a, __k, static_cast<_Tp>(__x(__k)), __d);
+      __x(__k) = __xk;
+      for (_Index __q = __p + 1; __q < __n; ++__q) {
+        const _Index __i = __lower ? __q : __n - 1 - __q;
+        __x(__i) = __x(__i) - _CUDA_VSTD::linalg::__element(__a, __i, __k) * __xk;
+      }
+    }
+  }
+  else {
+    for (_Index __p = 0; __p < __n; ++__p) {
+      const _Index __i = __lower ? __p : __n - 1 - __p;
+      _Tp __s = __x(__i);
+      for (_Index __q = 0; __q < __p; ++__q) {
+        const _Index __k = __lower ? __q : __n - 1 - __q;
+        __s -= _CUDA_VSTD::linalg::__element(__a, __i, __k) * __x(__k);
+      }
+      __x(__i) = _CUDA_VSTD::linalg::__apply_diagonal(__a, __i, __s, __d);
+    }
+  }
+}
+
+// [linalg.algs.blas2.trsv]
+// Solves A x = b for __x, where A is the lower or upper triangle of __a.
+template <class _ElementType1, class _Extents1, class _Layout1, class _Accessor1, class _Triangle, class _Diagonal,
+          class _ElementType2, class _Extents2, class _Layout2, class _Accessor2>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void triangular_matrix_vector_solve(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __a, _Triangle __t,
+                                    _Diagonal __d, mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __b)
+{
+  static_assert(_Extents1::rank() == 2 && _Extents2::rank() == 1,
+                "triangular_matrix_vector_solve requires a matrix and a vector.");
+  _LIBCUDACXX_ASSERT(__a.extent(0) == __a.extent(1) && __a.extent(1) == __b.extent(0),
+                     "triangular_matrix_vector_solve requires a square matrix and extents which match.");
+  using _Index = typename _Extents2::index_type;
+  _CUDA_VSTD::linalg::__triangular_solve_in_place<__remove_cv_t<_ElementType2>>(__a, __t, __d,
+    [&](_Index __i) -> typename _Accessor2::reference { return _CUDA_VSTD::linalg::__element(__b, __i); });
+}
+
+template <class _ElementType1, class _Extents1, class _Layout1, class _Accessor1, class _Triangle, class _Diagonal,
+          class _ElementType2, class _Extents2, class _Layout2, class _Accessor2,
+          class _ElementType3, class _Extents3, class _Layout3, class _Accessor3>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void triangular_matrix_vector_solve(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __a, _Triangle __t,
+                                    _Diagonal __d, mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __b,
+                                    mdspan<_ElementType3, _Extents3, _Layout3, _Accessor3> __x)
+{
+  _LIBCUDACXX_ASSERT(__b.extent(0) == __x.extent(0), "triangular_matrix_vector_solve requires extents which match.");
+  for (typename _Extents3::index_type __i = 0; __i < __x.extent(0); ++__i) {
+    _CUDA_VSTD::linalg::__element(__x, __i) = _CUDA_VSTD::linalg::__element(__b, __i);
+  }
+  _CUDA_VSTD::linalg::triangular_matrix_vector_solve(__a, __t, __d, __x);
+}
+
+// [linalg.algs.blas3.trsm]
+// Solves A X = B for __x in place, where A is the lower or upper triangle of
+// __a. If __x is laid out by columns, the columns are solved one after the
+// other; otherwise, whole rows are updated at once.
+template <class _ElementType1, class _Extents1, class _Layout1, class _Accessor1, class _Triangle, class _Diagonal,
+          class _ElementType2, class _Extents2, class _Layout2, class _Accessor2>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void triangular_matrix_matrix_left_solve(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __a, _Triangle __t,
+                                         _Diagonal __d, mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __x)
+{
+  static_assert(_Extents1::rank() == 2 && _Extents2::rank() == 2,
+                "triangular_matrix_matrix_left_solve requires matrices.");
+  _LIBCUDACXX_ASSERT(__a.extent(0) == __a.extent(1) && __a.extent(1) == __x.extent(0),
+                     "triangular_matrix_matrix_left_solve requires a square matrix and extents which match.");
+  using _Tp    = __remove_cv_t<_ElementType2>;
+  using _Index = typename _Extents2::index_type;
+  constexpr bool __lower = _LIBCUDACXX_TRAIT(is_same, _Triangle, lower_triangle_t);
+  const _Index __n = __x.extent(0);
+  const _Index __m = __x.extent(1);
+  if (_CUDA_VSTD::linalg::__is_column_major(__x)) {
+    for (_Index __j = 0; __j < __m; ++__j) {
+      _CUDA_VSTD::linalg::__triangular_solve_in_place<_Tp>(__a, __t, __d,
+        [&](_Index __i) -> typename _Accessor2::reference { return _CUDA_VSTD::linalg::__element(__x, __i, __j); });
+    }
+    return;
+  }
+  for (_Index __p = 0; __p < __n; ++__p) {
+    const _Index __i = __lower ? __p : __n - 1 - __p;
+    for (_Index __q = 0; __q < __p; ++__q) {
+      const _Index __k = __lower ? __q : __n - 1 - __q;
+      const _Tp __aik = _CUDA_VSTD::linalg::__element(__a, __i, __k);
+      for (_Index __j = 0; __j < __m; ++__j) {
+        _CUDA_VSTD::linalg::__element(__x, __i, __j) =
+          _CUDA_VSTD::linalg::__element(__x, __i, __j) - __aik * _CUDA_VSTD::linalg::__element(__x, __k, __j);
+      }
+    }
+    for (_Index __j = 0; __j < __m; ++__j) {
+      _CUDA_VSTD::linalg::__element(__x, __i, __j) =
+        _CUDA_VSTD::linalg::__apply_diagonal(__a, __i, static_cast<_Tp>(_CUDA_VSTD::linalg::__element(__x, __i, __j)), __d);
+    }
+  }
+}
+
+template <class _ElementType1, class _Extents1, class _Layout1, class _Accessor1, class _Triangle, class _Diagonal,
+          class _ElementType2, class _Extents2, class _Layout2, class _Accessor2,
+          class _ElementType3, class _Extents3, class _Layout3, class _Accessor3>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void triangular_matrix_matrix_left_solve(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __a, _Triangle __t,
+                                         _Diagonal __d, mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __b,
+                                         mdspan<_ElementType3, _Extents3, _Layout3, _Accessor3> __x)
+{
+  _LIBCUDACXX_ASSERT(__b.extents() == __x.extents(), "triangular_matrix_matrix_left_solve requires extents which match.");
+  _CUDA_VSTD::linalg::__for_each_index(__x, [&](typename _Extents3::index_type __i, typename _Extents3::index_type __j) {
+    _CUDA_VSTD::linalg::__element(__x, __i, __j) = _CUDA_VSTD::linalg::__element(__b, __i, __j);
+  });
+  _CUDA_VSTD::linalg::triangular_matrix_matrix_left_solve(__a, __t, __d, __x);
+}
+
+// Solves X A = B for __x in place, where A is the lower or upper triangle of
+// __a. The columns of __x are visited first to last for an upper triangle,
+// and last to first for a lower one. If __x is laid out by columns, whole
+// columns are updated at once; otherwise, the rows are solved one after the
+// other.
+template <class _ElementType1, class _Extents1, class _Layout1, class _Accessor1, class _Triangle, class _Diagonal,
+          class _ElementType2, class _Extents2, class _Layout2, class _Accessor2>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void triangular_matrix_matrix_right_solve(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __a, _Triangle,
+                                          _Diagonal __d, mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __x)
+{
+  static_assert(_Extents1::rank() == 2 && _Extents2::rank() == 2,
+                "triangular_matrix_matrix_right_solve requires matrices.");
+  _LIBCUDACXX_ASSERT(__a.extent(0) == __a.extent(1) && __a.extent(0) == __x.extent(1),
+                     "triangular_matrix_matrix_right_solve requires a square matrix and extents which match.");
+  using _Tp    = __remove_cv_t<_ElementType2>;
+  using _Index = typename _Extents2::index_type;
+  constexpr bool __upper = _LIBCUDACXX_TRAIT(is_same, _Triangle, upper_triangle_t);
+  const _Index __m = __x.extent(0);
+  const _Index __n = __x.extent(1);
+  const bool __by_columns = _CUDA_VSTD::linalg::__is_column_major(__x);
+  for (_Index __r = 0; __r < (__by_columns ? 1 : __m); ++__r) {
+    const _Index __r_first = __by_columns ? 0 : __r;
+    const _Index __r_last  = __by_columns ? __m : __r + 1;
+    for (_Index __p = 0; __p < __n; ++__p) {
+      const _Index __j = __upper ? __p : __n - 1 - __p;
+      for (_Index __q = 0; __q < __p; ++__q) {
+        const _Index __k = __upper ? __q : __n - 1 - __q;
+        const _Tp __akj = _CUDA_VSTD::linalg::__element(__a, __k, __j);
+        for (_Index __i = __r_first; __i < __r_last; ++__i) {
+          _CUDA_VSTD::linalg::__element(__x, __i, __j) =
+            _CUDA_VSTD::linalg::__element(__x, __i, __j) - _CUDA_VSTD::linalg::__element(__x, __i, __k) * __akj;
+        }
+      }
+      for (_Index __i = __r_first; __i < __r_last; ++__i) {
+        _CUDA_VSTD::linalg::__element(__x, __i, __j) =
+          _CUDA_VSTD::linalg::__apply_diagonal(__a, __j, static_cast<_Tp>(_CUDA_VSTD::linalg::__element(__x, __i, __j)), __d);
+      }
+    }
+  }
+}
+
+template <class _ElementType1, class _Extents1, class _Layout1, class _Accessor1, class _Triangle, class _Diagonal,
+          class _ElementType2, class _Extents2, class _Layout2, class _Accessor2,
+          class _ElementType3, class _Extents3, class _Layout3, class _Accessor3>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void triangular_matrix_matrix_right_solve(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __a, _Triangle __t,
+                                          _Diagonal __d, mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __b,
+                                          mdspan<_ElementType3, _Extents3, _Layout3, _Accessor3> __x)
+{
+  _LIBCUDACXX_ASSERT(__b.extents() == __x.extents(), "triangular_matrix_matrix_right_solve requires extents which match.");
+  _CUDA_VSTD::linalg::__for_each_index(__x, [&](typename _Extents3::index_type __i, typename _Extents3::index_type __j) {
+    _CUDA_VSTD::linalg::__element(__x, __i, __j) = _CUDA_VSTD::linalg::__element(__b, __i, __j);
+  });
+  _CUDA_VSTD::linalg::triangular_matrix_matrix_right_solve(__a, __t, __d, __x);
+}
+
+} // namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _LIBCUDACXX___LINALG_TRIANGULAR_SOLVE_H
@@ -0,0 +1,110 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_VECTOR_NORM2_H
+#define _LIBCUDACXX___LINALG_VECTOR_NORM2_H
+
+#ifndef __cuda_std__
+#include <__config>
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../__linalg/access.h"
+#include "../__type_traits/enable_if.h"
+#include "../__type_traits/is_arithmetic.h"
+#include "../__utility/declval.h"
+#include "../cmath"
+
+#if _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg {
+
+// The magnitude of an element: the element itself if it is unsigned, its
+// absolute value otherwise, found by ADL for complex numbers.
+template <class _Tp, __enable_if_t<is_arithmetic<_Tp>::value, int> = 0>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+_Tp __abs_if_needed(_Tp __x)
+{
+  return __x < _Tp{} ? static_cast<_Tp>(-__x) : __x;
+}
+
+template <class _Tp, __enable_if_t<!is_arithmetic<_Tp>::value, int> = 0>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+auto __abs_if_needed(const _Tp& __x) -> decltype(abs(__x))
+{
+  return abs(__x);
+}
+
+// Accumulates the square of __a into the scaled sum of squares
+// __scale * __scale * __ssq, with __scale the largest magnitude so far.
+template <class _Scalar>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+void __add_scaled_square(_Scalar& __scale, _Scalar& __ssq, _Scalar __a)
+{
+  if (__a == _Scalar{}) {
+    return;
+  }
+  if (__scale < __a) {
+    const _Scalar __r = __scale / __a;
+    __ssq = _Scalar(1) + __ssq * __r * __r;
+    __scale = __a;
+  } else {
+    const _Scalar __r = __a / __scale;
+    __ssq += __r * __r;
+  }
+}
+
+// [linalg.algs.blas1.nrm2]
+// Returns the square root of the sum of the square of __init and the squares
+// of the magnitudes of the elements of __v. As in dnrm2, the squares are
+// summed relative to the largest magnitude, so the sum neither overflows nor
+// underflows where the norm itself would not.
+template <class _ElementType, class _Extents, class _Layout, class _Accessor, class _Scalar>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+_Scalar vector_norm2(mdspan<_ElementType, _Extents, _Layout, _Accessor> __v, _Scalar __init)
+{
+  static_assert(_Extents::rank() == 1, "vector_norm2 requires a vector.");
+  using _Index = typename _Extents::index_type;
+  _Scalar __scale{};
+  _Scalar __ssq(1);
+  _CUDA_VSTD::linalg::__add_scaled_square(__scale, __ssq, static_cast<_Scalar>(_CUDA_VSTD::linalg::__abs_if_needed(__init)));
+  for (_Index __i = 0; __i < __v.extent(0); ++__i) {
+    _CUDA_VSTD::linalg::__add_scaled_square(
+      __scale, __ssq, static_cast<_Scalar>(_CUDA_VSTD::linalg::__abs_if_needed(_CUDA_VSTD::linalg::__element(__v, __i))));
+  }
+  using _CUDA_VSTD::sqrt;
+  return __scale * sqrt(__ssq);
+}
+
+template <class _ElementType, class _Extents, class _Layout, class _Accessor>
+inline _LIBCUDACXX_INLINE_VISIBILITY
+auto vector_norm2(mdspan<_ElementType, _Extents, _Layout, _Accessor> __v)
+  -> decltype(_CUDA_VSTD::linalg::__abs_if_needed(_CUDA_VSTD::declval<typename _Accessor::element_type>()))
+{
+  using _Scalar = decltype(_CUDA_VSTD::linalg::__abs_if_needed(_CUDA_VSTD::declval<typename _Accessor::element_type>()));
+  return _CUDA_VSTD::linalg::vector_norm2(__v, _Scalar{});
+}
+
+} // namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _LIBCUDACXX___LINALG_VECTOR_NORM2_H
@@ -0,0 +1,625 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___MDSPAN_LAYOUT_PADDED_HPP
+#define _LIBCUDACXX___MDSPAN_LAYOUT_PADDED_HPP
+
+#ifndef __cuda_std__
+#include <__config>
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include "../__assert"
+#include "../__mdspan/dynamic_extent.h"
+#include "../__mdspan/extents.h"
+#include "../__mdspan/layout_left.h"
+#include "../__mdspan/layout_right.h"
+#include "../__mdspan/layout_stride.h"
+#include "../__mdspan/macros.h"
+#include "../__type_traits/integral_constant.h"
+#include "../__type_traits/is_constructible.h"
+#include "../__type_traits/is_convertible.h"
+#include "../__type_traits/is_nothrow_constructible.h"
+#include "../__type_traits/void_t.h"
+#include "../cstddef"
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+#if _CCCL_STD_VER > 2011
+
+// The layouts of P2642, which pad the contiguous extent up to a multiple of
+// the padding value, so that every row of a layout_right_padded mapping, or
+// every column of a layout_left_padded mapping, starts at an aligned offset.
+template <size_t _PaddingValue = dynamic_extent>
+struct layout_left_padded {
+  template <class _Extents>
+    class mapping;
+};
+template <size_t _PaddingValue = dynamic_extent>
+struct layout_right_padded {
+  template <class _Extents>
+    class mapping;
+};
+
+namespace __detail {
+
+template <class _Layout>
+struct __is_layout_left_padded : false_type {};
+template <size_t _PaddingValue>
+struct __is_layout_left_padded<layout_left_padded<_PaddingValue>> : true_type {};
+
+template <class _Layout>
+struct __is_layout_right_padded : false_type {};
+template <size_t _PaddingValue>
+struct __is_layout_right_padded<layout_right_padded<_PaddingValue>> : true_type {};
+
+template <class _Mapping, class = void>
+struct __is_layout_left_padded_mapping : false_type {};
+template <class _Mapping>
+struct __is_layout_left_padded_mapping<_Mapping, __void_t<typename _Mapping::layout_type>>
+  : __is_layout_left_padded<typename _Mapping::layout_type> {};
+
+template <class _Mapping, class = void>
+struct __is_layout_right_padded_mapping : false_type {};
+template <class _Mapping>
+struct __is_layout_right_padded_mapping<_Mapping, __void_t<typename _Mapping::layout_type>>
+  : __is_layout_right_padded<typename _Mapping::layout_type> {};
+
+// the least multiple of __x which is at least __y
+__MDSPAN_INLINE_FUNCTION
+constexpr size_t __least_multiple_at_least(size_t __x, size_t __y) noexcept {
+  return __x == 0 ? __y : ((__y + __x - 1) / __x) * __x;
+}
+
+// The stride of the padded dimension, if both the padding value and the
+// extent it pads are known at compile time
+__MDSPAN_INLINE_FUNCTION
+constexpr size_t __static_padding_stride(size_t __padding_value, size_t __static_extent) noexcept {
+  return (__padding_value == dynamic_extent || __static_extent == dynamic_extent)
+       ? dynamic_extent
+       : __least_multiple_at_least(__padding_value, __static_extent);
+}
+
+} // namespace __detail
+
+//==============================================================================
+
+template <size_t _PaddingValue>
+template <class _Extents>
+class layout_left_padded<_PaddingValue>::mapping {
+  public:
+    static constexpr size_t padding_value = _PaddingValue;
+
+    using extents_type = _Extents;
+    using index_type = typename extents_type::index_type;
+    using size_type = typename extents_type::size_type;
+    using rank_type = typename extents_type::rank_type;
+    using layout_type = layout_left_padded<_PaddingValue>;
+  private:
+
+    static_assert(__detail::__is_extents_v<extents_type>, "layout_left_padded::mapping must be instantiated with a specialization of _CUDA_VSTD::extents.");
+    static_assert(padding_value != 0, "layout_left_padded requires a padding value other than zero.");
+
+    template <class>
+    friend class mapping;
+
+    static constexpr rank_type __rank = extents_type::rank();
+
+    static constexpr size_t __static_stride_1 = __rank == 0 ? dynamic_extent :
+      __detail::__static_padding_stride(padding_value, extents_type::static_extent(0));
+
+    __MDSPAN_INLINE_FUNCTION
+    static constexpr index_type __padded_stride(extents_type const& __exts, index_type __padding) noexcept {
+      return __rank <= 1
+        ? (__rank == 0 ? 0 : __exts.extent(0))
+        : static_cast<index_type>(__detail::__least_multiple_at_least(
+            static_cast<size_t>(__padding), static_cast<size_t>(__exts.extent(0))));
+    }
+
+    // i0 + S*(i1 + E(1)*(i2 + E(2)*i3)), where S is the padded stride of the first dimension
+    template <size_t _r>
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __compute_tail(index_type __i) const noexcept {
+      return __i;
+    }
+
+    template <size_t _r, class... _Indices>
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __compute_tail(index_type __i, index_type __j, _Indices... __idx) const noexcept {
+      return __i + __extents.template __extent<_r>() * __compute_tail<_r+1>(__j, __idx...);
+    }
+
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __compute_offset() const noexcept { return 0; }
+
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __compute_offset(index_type __i) const noexcept { return __i; }
+
+    template <class... _Indices>
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __compute_offset(index_type __i, index_type __j, _Indices... __idx) const noexcept {
+      return __i + __stride_1() * __compute_tail<1>(__j, __idx...);
+    }
+
+    __MDSPAN_INLINE_FUNCTION
+    constexpr index_type __stride(rank_type __i) const noexcept {
+      index_type __value = __i == 0 ? 1 : __stride_1();
+      for(rank_type __r=1; __r<__i; __r++) __value*=__extents.extent(__r);
+      return __value;
+    }
+
+  public:
+
+    //--------------------------------------------------------------------------------
+
+    __MDSPAN_INLINE_FUNCTION constexpr mapping() noexcept : mapping(extents_type{}) {}
+    __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(mapping const&) noexcept = default;
+
+    // Pads the first extent up to a multiple of padding_value, or does not pad
+    // it at all if the padding value is only known at run time.
+    _LIBCUDACXX_HOST_DEVICE
+    constexpr mapping(extents_type const& __exts) noexcept
+      : __extents(__exts)
+      , __padded_stride_1(__padded_stride(__exts, padding_value == dynamic_extent ? 0 : static_cast<index_type>(padding_value)))
+    { }
+
+    // Pads the first extent up to a multiple of __padding, which must equal
+    // padding_value unless that is dynamic_extent.
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _OtherIndexType,
+      /* requires */ (
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _OtherIndexType, index_type) &&
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _OtherIndexType)
+      )
+    )
+    __MDSPAN_INLINE_FUNCTION constexpr
+    mapping(extents_type const& __exts, _OtherIndexType __padding) noexcept
+      : __extents(__exts)
+      , __padded_stride_1(__padded_stride(__exts, static_cast<index_type>(__padding)))
+    { }
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _OtherExtents,
+      /* requires */ (
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents)
+      )
+    )
+    __MDSPAN_CONDITIONAL_EXPLICIT((!_CUDA_VSTD::is_convertible<_OtherExtents, extents_type>::value)) // needs two () due to comma
+    __MDSPAN_INLINE_FUNCTION constexpr
+    mapping(layout_left::mapping<_OtherExtents> const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : mapping(extents_type(__other.extents()))
+    {
+       /*
+        * TODO: check precondition
+        * __other.stride(1) is a multiple of padding_value if extents_type::rank() > 1
+        */
+    }
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _OtherExtents,
+      /* requires */ (
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents)
+      )
+    )
+    __MDSPAN_CONDITIONAL_EXPLICIT((extents_type::rank() > 0))
+    __MDSPAN_INLINE_FUNCTION constexpr
+    mapping(layout_stride::mapping<_OtherExtents> const& __other) // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __padded_stride_1(__rank <= 1 ? __padded_stride(__extents, 0) : static_cast<index_type>(__other.stride(1)))
+    {
+      NV_IF_TARGET(NV_IS_HOST,(
+        size_t __stride = 1;
+        for(rank_type __r=0; __r<__extents.rank(); __r++) {
+          _LIBCUDACXX_THROW_RUNTIME_ERROR(__stride == static_cast<size_t>(__other.stride(__r)),
+                                          "Assigning layout_stride to layout_left_padded with invalid strides.");
+          __stride *= (__r == 0 ? static_cast<size_t>(__padded_stride_1) : static_cast<size_t>(__extents.extent(__r)));
+        }
+      ))
+    }
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _OtherMapping,
+      /* requires */ (
+        __detail::__is_layout_left_padded_mapping<_OtherMapping>::value &&
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, extents_type, typename _OtherMapping::extents_type)
+      )
+    )
+    __MDSPAN_CONDITIONAL_EXPLICIT((extents_type::rank() > 1 &&
+      (padding_value != dynamic_extent || _OtherMapping::padding_value == dynamic_extent)))
+    __MDSPAN_INLINE_FUNCTION constexpr
+    mapping(_OtherMapping const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __padded_stride_1(static_cast<index_type>(__other.__stride_1()))
+    {
+       /*
+        * TODO: check precondition
+        * __other.stride(1) is a multiple of padding_value if extents_type::rank() > 1
+        */
+    }
+
+    __MDSPAN_INLINE_FUNCTION_DEFAULTED __MDSPAN_CONSTEXPR_14_DEFAULTED mapping& operator=(mapping const&) noexcept = default;
+
+    __MDSPAN_INLINE_FUNCTION
+    constexpr const extents_type& extents() const noexcept {
+      return __extents;
+    }
+
+    __MDSPAN_INLINE_FUNCTION
+    constexpr index_type required_span_size() const noexcept {
+      if (__rank == 0) {
+        return 1;
+      }
+      index_type __value = 1;
+      for(rank_type __r=0; __r<__rank; __r++) {
+        if (__extents.extent(__r) == 0) {
+          return 0;
+        }
+        __value += (__extents.extent(__r) - 1) * __stride(__r);
+      }
+      return __value;
+    }
+
+    //--------------------------------------------------------------------------------
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class... _Indices,
+      /* requires */ (
+        (sizeof...(_Indices) == extents_type::rank()) &&
+        __MDSPAN_FOLD_AND(
+           (_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _Indices, index_type) &&
+            _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _Indices))
+        )
+      )
+    )
+    _LIBCUDACXX_HOST_DEVICE
+    constexpr index_type operator()(_Indices... __idxs) const noexcept {
+      return __compute_offset(static_cast<index_type>(__idxs)...);
+    }
+
+    __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept { return true; }
+    __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept {
+      return __rank <= 1 ||
+        (__static_stride_1 != dynamic_extent && __static_stride_1 == extents_type::static_extent(0));
+    }
+    __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept { return true; }
+
+    __MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept { return true; }
+    __MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept {
+      return __rank <= 1 || __extents.extent(0) == __stride_1();
+    }
+    __MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept { return true; }
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _Ext = _Extents,
+      /* requires */ (
+        _Ext::rank() > 0
+      )
+    )
+    __MDSPAN_INLINE_FUNCTION
+    constexpr index_type stride(rank_type __i) const noexcept {
+      return __stride(__i);
+    }
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _OtherMapping,
+      /* requires */ (
+        __detail::__is_layout_left_padded_mapping<_OtherMapping>::value &&
+        (_OtherMapping::extents_type::rank() == extents_type::rank())
+      )
+    )
+    __MDSPAN_INLINE_FUNCTION
+    friend constexpr bool operator==(mapping const& __lhs, _OtherMapping const& __rhs) noexcept {
+      return __lhs.extents() == __rhs.extents() && (__rank < 2 || __lhs.stride(1) == __rhs.stride(1));
+    }
+
+    // In C++ 20 the not equal exists if equal is found
+#if !(__MDSPAN_HAS_CXX_20)
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _OtherMapping,
+      /* requires */ (
+        __detail::__is_layout_left_padded_mapping<_OtherMapping>::value &&
+        (_OtherMapping::extents_type::rank() == extents_type::rank())
+      )
+    )
+    __MDSPAN_INLINE_FUNCTION
+    friend constexpr bool operator!=(mapping const& __lhs, _OtherMapping const& __rhs) noexcept {
+      return !(__lhs == __rhs);
+    }
+#endif
+
+    // Not really public, but the padded stride of the first dimension, which is a
+    // compile time constant if both the padding value and the first extent are.
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __stride_1() const noexcept {
+      return __static_stride_1 != dynamic_extent ? static_cast<index_type>(__static_stride_1) : __padded_stride_1;
+    }
+
+private:
+   _LIBCUDACXX_NO_UNIQUE_ADDRESS extents_type __extents{};
+   index_type __padded_stride_1{};
+
+};
+
+//==============================================================================
+
+template <size_t _PaddingValue>
+template <class _Extents>
+class layout_right_padded<_PaddingValue>::mapping {
+  public:
+    static constexpr size_t padding_value = _PaddingValue;
+
+    using extents_type = _Extents;
+    using index_type = typename extents_type::index_type;
+    using size_type = typename extents_type::size_type;
+    using rank_type = typename extents_type::rank_type;
+    using layout_type = layout_right_padded<_PaddingValue>;
+  private:
+
+    static_assert(__detail::__is_extents_v<extents_type>, "layout_right_padded::mapping must be instantiated with a specialization of _CUDA_VSTD::extents.");
+    static_assert(padding_value != 0, "layout_right_padded requires a padding value other than zero.");
+
+    template <class>
+    friend class mapping;
+
+    static constexpr rank_type __rank = extents_type::rank();
+
+    static constexpr size_t __static_stride_n = __rank == 0 ? dynamic_extent :
+      __detail::__static_padding_stride(padding_value, extents_type::static_extent(__rank == 0 ? 0 : __rank - 1));
+
+    __MDSPAN_INLINE_FUNCTION
+    static constexpr index_type __padded_stride(extents_type const& __exts, index_type __padding) noexcept {
+      return __rank <= 1
+        ? (__rank == 0 ? 0 : __exts.extent(__rank - 1))
+        : static_cast<index_type>(__detail::__least_multiple_at_least(
+            static_cast<size_t>(__padding), static_cast<size_t>(__exts.extent(__rank - 1))));
+    }
+
+    // ((i0*E(1) + i1)*E(2) + i2)*S + i3, where S is the padded stride of the second to last dimension
+    template <size_t _r>
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __compute_offset(index_type __offset, index_type __i) const noexcept {
+      return __offset * __stride_n() + __i;
+    }
+
+    template <size_t _r, class... _Indices>
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __compute_offset(index_type __offset, index_type __i, index_type __j, _Indices... __idx) const noexcept {
+      return __compute_offset<_r+1>(__offset * __extents.template __extent<_r>() + __i, __j, __idx...);
+    }
+
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __compute_offset() const noexcept { return 0; }
+
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __compute_offset(index_type __i) const noexcept { return __i; }
+
+    template <class... _Indices>
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __compute_offset(index_type __i, index_type __j, _Indices... __idx) const noexcept {
+      return __compute_offset<1>(__i, __j, __idx...);
+    }
+
+    __MDSPAN_INLINE_FUNCTION
+    constexpr index_type __stride(rank_type __i) const noexcept {
+      if (__i + 1 == __rank) {
+        return 1;
+      }
+      index_type __value = __stride_n();
+      for(rank_type __r=__rank-2; __r>__i; __r--) __value*=__extents.extent(__r);
+      return __value;
+    }
+
+  public:
+
+    //--------------------------------------------------------------------------------
+
+    __MDSPAN_INLINE_FUNCTION constexpr mapping() noexcept : mapping(extents_type{}) {}
+    __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(mapping const&) noexcept = default;
+
+    // Pads the last extent up to a multiple of padding_value, or does not pad
+    // it at all if the padding value is only known at run time.
+    _LIBCUDACXX_HOST_DEVICE
+    constexpr mapping(extents_type const& __exts) noexcept
+      : __extents(__exts)
+      , __padded_stride_n(__padded_stride(__exts, padding_value == dynamic_extent ? 0 : static_cast<index_type>(padding_value)))
+    { }
+
+    // Pads the last extent up to a multiple of __padding, which must equal
+    // padding_value unless that is dynamic_extent.
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _OtherIndexType,
+      /* requires */ (
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _OtherIndexType, index_type) &&
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _OtherIndexType)
+      )
+    )
+    __MDSPAN_INLINE_FUNCTION constexpr
+    mapping(extents_type const& __exts, _OtherIndexType __padding) noexcept
+      : __extents(__exts)
+      , __padded_stride_n(__padded_stride(__exts, static_cast<index_type>(__padding)))
+    { }
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _OtherExtents,
+      /* requires */ (
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents)
+      )
+    )
+    __MDSPAN_CONDITIONAL_EXPLICIT((!_CUDA_VSTD::is_convertible<_OtherExtents, extents_type>::value)) // needs two () due to comma
+    __MDSPAN_INLINE_FUNCTION constexpr
+    mapping(layout_right::mapping<_OtherExtents> const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : mapping(extents_type(__other.extents()))
+    {
+       /*
+        * TODO: check precondition
+        * __other.stride(rank() - 2) is a multiple of padding_value if extents_type::rank() > 1
+        */
+    }
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _OtherExtents,
+      /* requires */ (
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents)
+      )
+    )
+    __MDSPAN_CONDITIONAL_EXPLICIT((extents_type::rank() > 0))
+    __MDSPAN_INLINE_FUNCTION constexpr
+    mapping(layout_stride::mapping<_OtherExtents> const& __other) // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __padded_stride_n(__rank <= 1 ? __padded_stride(__extents, 0)
+                                      : static_cast<index_type>(__other.stride(__rank <= 1 ? 0 : __rank - 2)))
+    {
+      NV_IF_TARGET(NV_IS_HOST,(
+        size_t __stride = 1;
+        for(rank_type __r=__extents.rank(); __r>0; __r--) {
+          _LIBCUDACXX_THROW_RUNTIME_ERROR(__stride == static_cast<size_t>(__other.stride(__r-1)),
+                                          "Assigning layout_stride to layout_right_padded with invalid strides.");
+          __stride *= (__r == __rank ? static_cast<size_t>(__padded_stride_n) : static_cast<size_t>(__extents.extent(__r-1)));
+        }
+      ))
+    }
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _OtherMapping,
+      /* requires */ (
+        __detail::__is_layout_right_padded_mapping<_OtherMapping>::value &&
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, extents_type, typename _OtherMapping::extents_type)
+      )
+    )
+    __MDSPAN_CONDITIONAL_EXPLICIT((extents_type::rank() > 1 &&
+      (padding_value != dynamic_extent || _OtherMapping::padding_value == dynamic_extent)))
+    __MDSPAN_INLINE_FUNCTION constexpr
+    mapping(_OtherMapping const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __padded_stride_n(static_cast<index_type>(__other.__stride_n()))
+    {
+       /*
+        * TODO: check precondition
+        * __other.stride(rank() - 2) is a multiple of padding_value if extents_type::rank() > 1
+        */
+    }
+
+    __MDSPAN_INLINE_FUNCTION_DEFAULTED __MDSPAN_CONSTEXPR_14_DEFAULTED mapping& operator=(mapping const&) noexcept = default;
+
+    __MDSPAN_INLINE_FUNCTION
+    constexpr const extents_type& extents() const noexcept {
+      return __extents;
+    }
+
+    __MDSPAN_INLINE_FUNCTION
+    constexpr index_type required_span_size() const noexcept {
+      if (__rank == 0) {
+        return 1;
+      }
+      index_type __value = 1;
+      for(rank_type __r=0; __r<__rank; __r++) {
+        if (__extents.extent(__r) == 0) {
+          return 0;
+        }
+        __value += (__extents.extent(__r) - 1) * __stride(__r);
+      }
+      return __value;
+    }
+
+    //--------------------------------------------------------------------------------
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class... _Indices,
+      /* requires */ (
+        (sizeof...(_Indices) == extents_type::rank()) &&
+        __MDSPAN_FOLD_AND(
+           (_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _Indices, index_type) &&
+            _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _Indices))
+        )
+      )
+    )
+    _LIBCUDACXX_HOST_DEVICE
+    constexpr index_type operator()(_Indices... __idxs) const noexcept {
+      return __compute_offset(static_cast<index_type>(__idxs)...);
+    }
+
+    __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept { return true; }
+    __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept {
+      return __rank <= 1 ||
+        (__static_stride_n != dynamic_extent &&
+         __static_stride_n == extents_type::static_extent(__rank == 0 ? 0 : __rank - 1));
+    }
+    __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept { return true; }
+
+    __MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept { return true; }
+    __MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept {
+      return __rank <= 1 || __extents.extent(__rank - 1) == __stride_n();
+    }
+    __MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept { return true; }
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _Ext = _Extents,
+      /* requires */ (
+        _Ext::rank() > 0
+      )
+    )
+    __MDSPAN_INLINE_FUNCTION
+    constexpr index_type stride(rank_type __i) const noexcept {
+      return __stride(__i);
+    }
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _OtherMapping,
+      /* requires */ (
+        __detail::__is_layout_right_padded_mapping<_OtherMapping>::value &&
+        (_OtherMapping::extents_type::rank() == extents_type::rank())
+      )
+    )
+    __MDSPAN_INLINE_FUNCTION
+    friend constexpr bool operator==(mapping const& __lhs, _OtherMapping const& __rhs) noexcept {
+      return __lhs.extents() == __rhs.extents() &&
+        (__rank < 2 || __lhs.stride(__rank - 2) == __rhs.stride(__rank - 2));
+    }
+
+    // In C++ 20 the not equal exists if equal is found
+#if !(__MDSPAN_HAS_CXX_20)
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _OtherMapping,
+      /* requires */ (
+        __detail::__is_layout_right_padded_mapping<_OtherMapping>::value &&
+        (_OtherMapping::extents_type::rank() == extents_type::rank())
+      )
+    )
+    __MDSPAN_INLINE_FUNCTION
+    friend constexpr bool operator!=(mapping const& __lhs, _OtherMapping const& __rhs) noexcept {
+      return !(__lhs == __rhs);
+    }
+#endif
+
+    // Not really public, but the padded stride of the second to last dimension, which is
+    // a compile time constant if both the padding value and the last extent are.
+    __MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type __stride_n() const noexcept {
+      return __static_stride_n != dynamic_extent ? static_cast<index_type>(__static_stride_n) : __padded_stride_n;
+    }
+
+private:
+   _LIBCUDACXX_NO_UNIQUE_ADDRESS extents_type __extents{};
+   index_type __padded_stride_n{};
+
+};
+
+#endif // _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___MDSPAN_LAYOUT_PADDED_HPP
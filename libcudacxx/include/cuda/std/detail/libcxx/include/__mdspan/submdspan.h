@@ -60,6 +60,7 @@
 #include "../__mdspan/dynamic_extent.h"
 #include "../__mdspan/full_extent_t.h"
 #include "../__mdspan/layout_left.h"
+#include "../__mdspan/layout_padded.h"
 #include "../__mdspan/layout_right.h"
 #include "../__mdspan/layout_stride.h"
 #include "../__mdspan/macros.h"
@@ -201,6 +202,51 @@ struct preserve_layout_left_analysis : integral_constant<bool, _Result> {
   >;
 };
 
+// a layout left padded remains a layout left padded if its first slice is a pair or
+// all, and the slices after it would preserve a layout left
+template <
+  bool _FirstIsRange,
+  class _Rest=preserve_layout_left_analysis<>
+>
+struct preserve_layout_left_padded_analysis_rest : integral_constant<bool, _FirstIsRange && _Rest::value> {
+  using layout_type_if_preserved = layout_left_padded<dynamic_extent>;
+  using encounter_pair = preserve_layout_left_padded_analysis_rest<_FirstIsRange, typename _Rest::encounter_pair>;
+  using encounter_all = preserve_layout_left_padded_analysis_rest<_FirstIsRange, typename _Rest::encounter_all>;
+  using encounter_scalar = preserve_layout_left_padded_analysis_rest<_FirstIsRange, typename _Rest::encounter_scalar>;
+};
+
+struct preserve_layout_left_padded_analysis : integral_constant<bool, false> {
+  using layout_type_if_preserved = layout_left_padded<dynamic_extent>;
+  using encounter_pair = preserve_layout_left_padded_analysis_rest<true>;
+  using encounter_all = preserve_layout_left_padded_analysis_rest<true>;
+  using encounter_scalar = preserve_layout_left_padded_analysis_rest<false>;
+};
+
+// a layout right padded remains a layout right padded if its last slice is a pair or
+// all, and the slices before it would preserve a layout right. As the slices are
+// encountered first to last, the kind of the last one seen (void until there is one)
+// is only applied to the analysis of the slices before it once the next one is.
+template <class _Analysis, class _Slice>
+struct __encounter_slice { using type = _Analysis; };
+template <class _Analysis>
+struct __encounter_slice<_Analysis, size_t> { using type = typename _Analysis::encounter_scalar; };
+template <class _Analysis>
+struct __encounter_slice<_Analysis, tuple<size_t, size_t>> { using type = typename _Analysis::encounter_pair; };
+template <class _Analysis>
+struct __encounter_slice<_Analysis, full_extent_t> { using type = typename _Analysis::encounter_all; };
+
+template <
+  class _Init=preserve_layout_right_analysis<>,
+  class _Last=void
+>
+struct preserve_layout_right_padded_analysis
+  : integral_constant<bool, _Init::value && !_LIBCUDACXX_TRAIT(is_same, _Last, void) && !_LIBCUDACXX_TRAIT(is_same, _Last, size_t)> {
+  using layout_type_if_preserved = layout_right_padded<dynamic_extent>;
+  using encounter_pair = preserve_layout_right_padded_analysis<typename __encounter_slice<_Init, _Last>::type, tuple<size_t, size_t>>;
+  using encounter_all = preserve_layout_right_padded_analysis<typename __encounter_slice<_Init, _Last>::type, full_extent_t>;
+  using encounter_scalar = preserve_layout_right_padded_analysis<typename __encounter_slice<_Init, _Last>::type, size_t>;
+};
+
 struct ignore_layout_preservation : integral_constant<bool, false> {
   using layout_type_if_preserved = void;
   using encounter_pair = ignore_layout_preservation;
@@ -217,6 +263,12 @@ struct preserve_layout_analysis<layout_right>
 template <>
 struct preserve_layout_analysis<layout_left>
   : preserve_layout_left_analysis<> { };
+template <size_t _PaddingValue>
+struct preserve_layout_analysis<layout_left_padded<_PaddingValue>>
+  : preserve_layout_left_padded_analysis { };
+template <size_t _PaddingValue>
+struct preserve_layout_analysis<layout_right_padded<_PaddingValue>>
+  : preserve_layout_right_padded_analysis<> { };
 
 //--------------------------------------------------------------------------------
 
@@ -450,6 +502,49 @@ struct __assign_op_slice_handler<
     )
   )
 
+  // The stride of the kept dimension _Np, which a padded layout is padded to, if there are
+  // at least two kept dimensions. The padding does not matter otherwise.
+  template <size_t _Np>
+  __MDSPAN_INLINE_FUNCTION
+  constexpr size_t __padding_stride(true_type) const noexcept {
+    return __strides.template __get_n<_Np>();
+  }
+
+  template <size_t _Np>
+  __MDSPAN_INLINE_FUNCTION
+  constexpr size_t __padding_stride(false_type) const noexcept {
+    return 0;
+  }
+
+  __MDSPAN_INLINE_FUNCTION
+  __MDSPAN_DEDUCE_RETURN_TYPE_SINGLE_LINE(
+    (
+      constexpr /* auto */
+      _make_layout_mapping_impl(layout_left_padded<dynamic_extent>) noexcept
+    ),
+    (
+      /* return */ layout_left_padded<dynamic_extent>::template mapping<_CUDA_VSTD::extents<_IndexT, _Exts...>>(
+        extents<_IndexT, _Exts...>::__make_extents_impl(_CUDA_VSTD::move(__exts)),
+        this->template __padding_stride<1>(integral_constant<bool, (sizeof...(_Strides) > 1)>{})
+      ) /* ; */
+    )
+  )
+
+  __MDSPAN_INLINE_FUNCTION
+  __MDSPAN_DEDUCE_RETURN_TYPE_SINGLE_LINE(
+    (
+      constexpr /* auto */
+      _make_layout_mapping_impl(layout_right_padded<dynamic_extent>) noexcept
+    ),
+    (
+      /* return */ layout_right_padded<dynamic_extent>::template mapping<_CUDA_VSTD::extents<_IndexT, _Exts...>>(
+        extents<_IndexT, _Exts...>::__make_extents_impl(_CUDA_VSTD::move(__exts)),
+        this->template __padding_stride<(sizeof...(_Strides) > 1 ? sizeof...(_Strides) - 2 : 0)>(
+          integral_constant<bool, (sizeof...(_Strides) > 1)>{})
+      ) /* ; */
+    )
+  )
+
   template <class _OldLayoutMapping> // mostly for deferred instantiation, but maybe we'll use this in the future
   __MDSPAN_INLINE_FUNCTION
   __MDSPAN_DEDUCE_RETURN_TYPE_SINGLE_LINE(
@@ -578,6 +673,8 @@ __MDSPAN_TEMPLATE_REQUIRES(
     (
       _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_same, _LP, layout_left)
         || _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_same, _LP, layout_right)
+        || __detail::__is_layout_left_padded<_LP>::value
+        || __detail::__is_layout_right_padded<_LP>::value
         || __detail::_is_layout_stride<_LP>::value
     ) &&
     __MDSPAN_FOLD_AND((
@@ -8,16 +8,66 @@
 
 #ifndef _LIBCUDACXX_HAS_NO_THREADS
 #include "atomic"
+#include "cstdint"
+#include "new"
+#include "thread"
 
 _LIBCUDACXX_BEGIN_NAMESPACE_STD
 
 #if !defined(_LIBCUDACXX_HAS_NO_THREAD_CONTENTION_TABLE)
 
-__libcpp_contention_t __libcpp_contention_state_[ 256 /* < there's no magic in this number */ ];
+namespace {
+
+// Each slot is padded to a cache line. The table is allocated on first use, with
+// enough slots for the threads of the machine to rarely share one, and is never
+// freed, since threads may still wait while static objects are destroyed.
+struct __libcpp_contention_table_t {
+    __libcpp_contention_t * __slots;
+    size_t                  __mask;
+};
+
+constexpr size_t __libcpp_contention_min_slots = 256;
+constexpr size_t __libcpp_contention_max_slots = 1 << 16;
+constexpr size_t __libcpp_contention_slots_per_thread = 16;
+
+__libcpp_contention_t __libcpp_contention_fallback_[__libcpp_contention_min_slots];
+
+__libcpp_contention_table_t __libcpp_contention_make_table() noexcept {
+    size_t const __wanted = __libcpp_contention_slots_per_thread * thread::hardware_concurrency();
+    size_t __size = __libcpp_contention_min_slots;
+    while (__size < __wanted && __size < __libcpp_contention_max_slots)
+        __size <<= 1;
+    if (__size == __libcpp_contention_min_slots)
+        return {__libcpp_contention_fallback_, __size - 1};
+    size_t const __align = alignof(__libcpp_contention_t);
+    void * const __p = ::operator new(__size * sizeof(__libcpp_contention_t) + __align - 1, nothrow);
+    if (__p == nullptr)
+        return {__libcpp_contention_fallback_, __libcpp_contention_min_slots - 1};
+    auto * const __slots = reinterpret_cast<__libcpp_contention_t *>(
+        (reinterpret_cast<std::uintptr_t>(__p) + __align - 1) & ~std::uintptr_t(__align - 1));
+    for (size_t __i = 0; __i < __size; ++__i)
+        ::new (static_cast<void *>(__slots + __i)) __libcpp_contention_t;
+    return {__slots, __size - 1};
+}
+
+// Atomics are often laid out at a fixed stride, so the low bits of their
+// addresses alone would crowd them into a few slots.
+size_t __libcpp_contention_hash(void const volatile * p) noexcept {
+    unsigned long long __h = (std::uintptr_t)p;
+    __h ^= __h >> 33;
+    __h *= 0xff51afd7ed558ccdull;
+    __h ^= __h >> 33;
+    __h *= 0xc4ceb9fe1a85ec53ull;
+    __h ^= __h >> 33;
+    return static_cast<size_t>(__h);
+}
+
+} // namespace
 
 _LIBCUDACXX_FUNC_VIS
 __libcpp_contention_t * __libcpp_contention_state(void const volatile * p) noexcept {
-    return __libcpp_contention_state_ + ((std::uintptr_t)p & 255);
+    static __libcpp_contention_table_t const __table = __libcpp_contention_make_table();
+    return __table.__slots + (__libcpp_contention_hash(p) & __table.__mask);
 }
 
 #endif //_LIBCUDACXX_HAS_NO_THREAD_CONTENTION_TABLE
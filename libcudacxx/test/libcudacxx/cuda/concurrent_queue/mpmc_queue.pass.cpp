@@ -0,0 +1,167 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/concurrent_queue>
+
+// mpmc_queue
+
+#include <cuda/concurrent_queue>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template<typename Queue,
+    template<typename, typename> typename Selector,
+    typename Initializer = constructor_initializer>
+__host__ __device__
+void test()
+{
+  static_assert(Queue::capacity() == 4, "");
+
+  Selector<Queue, Initializer> sel;
+  SHARED Queue * q;
+  q = sel.construct();
+
+  Selector<cuda::std::atomic<int>, Initializer> sum_sel;
+  SHARED cuda::std::atomic<int> * sum;
+  sum = sum_sel.construct(0);
+
+  execute_on_main_thread([&]{
+    int v = 0;
+    assert(!q->try_pop(v));
+    for (int i = 0; i < 4; ++i) {
+      assert(q->try_push(i));
+    }
+    assert(!q->try_emplace(4));
+    for (int i = 0; i < 4; ++i) {
+      assert(q->try_pop(v));
+      assert(v == i);
+    }
+    assert(!q->try_pop(v));
+  });
+
+  // One producer and one consumer block on the queue, the others poll it,
+  // which both claim indices from the same counters.
+  auto blocking_producer = LAMBDA (){
+    for (int i = 1; i <= 32; ++i) {
+      q->push(i);
+    }
+  };
+  auto polling_producer = LAMBDA (){
+    for (int i = 1; i <= 32; ++i) {
+      while (!q->try_push(i)) {}
+    }
+  };
+  auto blocking_consumer = LAMBDA (){
+    for (int i = 0; i < 32; ++i) {
+      int v = 0;
+      q->pop(v);
+      sum->fetch_add(v);
+    }
+  };
+  auto polling_consumer = LAMBDA (){
+    for (int i = 0; i < 32; ++i) {
+      int v = 0;
+      while (!q->try_pop(v)) {}
+      sum->fetch_add(v);
+    }
+  };
+
+  concurrent_agents_launch(blocking_producer, polling_producer, blocking_consumer, polling_consumer);
+
+  execute_on_main_thread([&]{
+    assert(sum->load() == 2 * 32 * 33 / 2);
+    int v = 0;
+    assert(!q->try_pop(v));
+    q->push(1);
+  });
+}
+
+#ifndef TEST_HAS_NO_EXCEPTIONS
+// An element whose copy may throw, and whose move does not.
+struct throwing_copy
+{
+  int value;
+
+  throwing_copy(int v) : value(v) {}
+  throwing_copy(const throwing_copy& other) : value(other.value) {
+    if (value < 0) {
+      throw value;
+    }
+  }
+  throwing_copy(throwing_copy&&) noexcept = default;
+  throwing_copy& operator=(throwing_copy&&) noexcept = default;
+};
+
+// A copy which throws is made before an index is claimed, so that the queue
+// is left as it was.
+void test_throwing_copy()
+{
+  cuda::mpmc_queue<throwing_copy, 2> q;
+  const throwing_copy bad(-1);
+  throwing_copy v(0);
+
+  try {
+    q.push(bad);
+    assert(false);
+  }
+  catch (int) {}
+  try {
+    q.try_push(bad);
+    assert(false);
+  }
+  catch (int) {}
+
+  q.push(throwing_copy(1));
+  assert(q.try_push(throwing_copy(2)));
+  assert(!q.try_push(throwing_copy(3)));
+  q.pop(v);
+  assert(v.value == 1);
+  assert(q.try_pop(v));
+  assert(v.value == 2);
+  assert(!q.try_pop(v));
+}
+#endif // TEST_HAS_NO_EXCEPTIONS
+
+// The conditional cannot go inside the arguments of NV_IF_ELSE_TARGET.
+void test_exceptions()
+{
+#ifndef TEST_HAS_NO_EXCEPTIONS
+  test_throwing_copy();
+#endif // TEST_HAS_NO_EXCEPTIONS
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+        cuda_thread_count = 4;
+        test_exceptions();
+
+        test<cuda::mpmc_queue<int, 4>, local_memory_selector>();
+        test<cuda::mpmc_queue<int, 4, cuda::thread_scope_block>, local_memory_selector>();
+        test<cuda::mpmc_queue<int, 4, cuda::thread_scope_device>, local_memory_selector>();
+        test<cuda::mpmc_queue<int, 4, cuda::thread_scope_system>, local_memory_selector>();
+    ),(
+        test<cuda::mpmc_queue<int, 4>, shared_memory_selector>();
+        test<cuda::mpmc_queue<int, 4, cuda::thread_scope_block>, shared_memory_selector>();
+        test<cuda::mpmc_queue<int, 4, cuda::thread_scope_device>, shared_memory_selector>();
+        test<cuda::mpmc_queue<int, 4, cuda::thread_scope_system>, shared_memory_selector>();
+
+        test<cuda::mpmc_queue<int, 4>, global_memory_selector>();
+        test<cuda::mpmc_queue<int, 4, cuda::thread_scope_block>, global_memory_selector>();
+        test<cuda::mpmc_queue<int, 4, cuda::thread_scope_device>, global_memory_selector>();
+        test<cuda::mpmc_queue<int, 4, cuda::thread_scope_system>, global_memory_selector>();
+    ))
+
+    return 0;
+}
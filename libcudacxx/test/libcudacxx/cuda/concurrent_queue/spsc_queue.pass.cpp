@@ -0,0 +1,104 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/concurrent_queue>
+
+// spsc_queue
+
+#include <cuda/concurrent_queue>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+struct point {
+  int x;
+  int y;
+
+  __host__ __device__
+  point() : x(0), y(0) {}
+  __host__ __device__
+  point(int x_, int y_) : x(x_), y(y_) {}
+};
+
+template<typename Queue,
+    template<typename, typename> typename Selector,
+    typename Initializer = constructor_initializer>
+__host__ __device__
+void test()
+{
+  static_assert(Queue::capacity() == 4, "");
+
+  Selector<Queue, Initializer> sel;
+  SHARED Queue * q;
+  q = sel.construct();
+
+  execute_on_main_thread([&]{
+    point p;
+    assert(!q->try_pop(p));
+    for (int i = 0; i < 4; ++i) {
+      assert(q->try_emplace(i, -i));
+    }
+    assert(!q->try_push(point(4, -4)));
+    for (int i = 0; i < 4; ++i) {
+      assert(q->try_pop(p));
+      assert(p.x == i && p.y == -i);
+    }
+    assert(!q->try_pop(p));
+  });
+
+  // The queue wraps around many times, and both sides block on it.
+  auto producer = LAMBDA (){
+    for (int i = 0; i < 64; ++i) {
+      q->push(point(i, -i));
+    }
+  };
+  auto consumer = LAMBDA (){
+    for (int i = 0; i < 64; ++i) {
+      point p;
+      q->pop(p);
+      assert(p.x == i && p.y == -i);
+    }
+  };
+
+  concurrent_agents_launch(producer, consumer);
+
+  execute_on_main_thread([&]{
+    point p;
+    assert(!q->try_pop(p));
+    q->emplace(1, 2);
+  });
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+        cuda_thread_count = 2;
+
+        test<cuda::spsc_queue<point, 4>, local_memory_selector>();
+        test<cuda::spsc_queue<point, 4, cuda::thread_scope_block>, local_memory_selector>();
+        test<cuda::spsc_queue<point, 4, cuda::thread_scope_device>, local_memory_selector>();
+        test<cuda::spsc_queue<point, 4, cuda::thread_scope_system>, local_memory_selector>();
+    ),(
+        test<cuda::spsc_queue<point, 4>, shared_memory_selector>();
+        test<cuda::spsc_queue<point, 4, cuda::thread_scope_block>, shared_memory_selector>();
+        test<cuda::spsc_queue<point, 4, cuda::thread_scope_device>, shared_memory_selector>();
+        test<cuda::spsc_queue<point, 4, cuda::thread_scope_system>, shared_memory_selector>();
+
+        test<cuda::spsc_queue<point, 4>, global_memory_selector>();
+        test<cuda::spsc_queue<point, 4, cuda::thread_scope_block>, global_memory_selector>();
+        test<cuda::spsc_queue<point, 4, cuda::thread_scope_device>, global_memory_selector>();
+        test<cuda::spsc_queue<point, 4, cuda::thread_scope_system>, global_memory_selector>();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/mdspan>
+
+// aligned_accessor
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    using accessor_t = cuda::aligned_accessor<float, 16>;
+    static_assert(accessor_t::byte_alignment == 16, "");
+    ASSERT_SAME_TYPE(accessor_t::element_type, float);
+    ASSERT_SAME_TYPE(accessor_t::reference, float&);
+    ASSERT_SAME_TYPE(accessor_t::data_handle_type, float*);
+    // an offset data handle is no longer known to be aligned
+    ASSERT_SAME_TYPE(accessor_t::offset_policy, cuda::std::default_accessor<float>);
+
+    // more alignment converts to less, and the default_accessor only explicitly
+    static_assert(cuda::std::is_convertible<cuda::aligned_accessor<float, 32>, accessor_t>::value, "");
+    static_assert(cuda::std::is_convertible<accessor_t, cuda::aligned_accessor<const float, 16>>::value, "");
+    static_assert(!cuda::std::is_constructible<accessor_t, cuda::aligned_accessor<float, 8>>::value, "");
+    static_assert(!cuda::std::is_convertible<cuda::std::default_accessor<float>, accessor_t>::value, "");
+    static_assert(cuda::std::is_constructible<accessor_t, cuda::std::default_accessor<float>>::value, "");
+    static_assert(cuda::std::is_convertible<accessor_t, cuda::std::default_accessor<const float>>::value, "");
+
+    // composes with any layout
+    {
+        alignas(16) float data[4 * 6] = {};
+        using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+        cuda::std::mdspan<float, ext2d_t, cuda::std::layout_left, accessor_t> m{ data, cuda::std::layout_left::mapping<ext2d_t>{ ext2d_t{4, 6} }, accessor_t{} };
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 6; ++j) {
+                m.accessor().access(m.data_handle(), m.mapping()(i, j)) = static_cast<float>(i * 6 + j);
+            }
+        }
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 6; ++j) {
+                assert( data[j * 4 + i] == static_cast<float>(i * 6 + j) );
+            }
+        }
+        assert( m.accessor().offset(m.data_handle(), 5) == data + 5 );
+
+        cuda::std::mdspan<const float, ext2d_t, cuda::std::layout_left> c = m;
+        assert( c.data_handle() == data );
+    }
+
+    return 0;
+}
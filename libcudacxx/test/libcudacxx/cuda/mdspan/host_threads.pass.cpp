@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+// UNSUPPORTED: nvrtc
+
+// <cuda/mdspan>
+
+// mdspan_copy, mdspan_transpose, mdspan_fill and mdspan_for_each_index on host_threads
+
+#include <cuda/atomic>
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+
+#include <vector>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+void test(unsigned threads)
+{
+    using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+    constexpr int rows = 300;
+    constexpr int cols = 517;
+
+    const cuda::host_threads ex{ threads };
+    assert( ex.count() == threads );
+
+    std::vector<long> src(rows * cols);
+    for (int i = 0; i < rows * cols; ++i) {
+        src[i] = i;
+    }
+    cuda::std::mdspan<const long, ext2d_t> s{ src.data(), rows, cols };
+
+    std::vector<long> right(rows * cols);
+    std::vector<long> left(rows * cols);
+    std::vector<long> transposed(rows * cols);
+    cuda::std::mdspan<long, ext2d_t> r{ right.data(), rows, cols };
+    cuda::std::mdspan<long, ext2d_t, cuda::std::layout_left> l{ left.data(), rows, cols };
+    cuda::std::mdspan<long, ext2d_t> t{ transposed.data(), cols, rows };
+
+    cuda::mdspan_fill(ex, l, -1l);
+    for (long x : left) {
+        assert( x == -1 );
+    }
+
+    cuda::mdspan_copy(ex, s, r);
+    cuda::mdspan_copy(ex, s, l);
+    cuda::mdspan_transpose(ex, s, t);
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            assert( r(i, j) == s(i, j) );
+            assert( l(i, j) == s(i, j) );
+            assert( t(j, i) == s(i, j) );
+        }
+    }
+
+    cuda::std::atomic<long> sum{0};
+    cuda::mdspan_for_each_index(ex, l, [&](int i, int j) { sum += s(i, j); });
+    assert( sum == long(rows) * cols * (rows * cols - 1) / 2 );
+
+#ifndef TEST_HAS_NO_EXCEPTIONS
+    // the first part is run on the calling thread, whose exception
+    // propagates once the other threads are done
+    cuda::std::atomic<long> visited{0};
+    try {
+        cuda::mdspan_for_each_index(ex, r, [&](int i, int j) {
+            if (i == 0 && j == 0) {
+                throw 42;
+            }
+            ++visited;
+        });
+        assert( false );
+    }
+    catch (int x) {
+        assert( x == 42 );
+    }
+    assert( visited < long(rows) * cols );
+#endif // TEST_HAS_NO_EXCEPTIONS
+}
+
+int main(int, char**)
+{
+    NV_IF_TARGET(NV_IS_HOST, (
+        test(1);
+        test(3);
+        test(8);
+    ))
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/mdspan>
+
+// layout_blocked
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+
+    // 3 x 2 blocks of 2 x 4 elements, the last row of blocks half padding
+    {
+        cuda::layout_blocked<2,4>::mapping<ext2d_t> m{ ext2d_t{5, 6} };
+
+        assert( m.required_span_size() == 3 * 2 * 8 );
+        assert( m(0, 0) ==  0 );
+        assert( m(0, 3) ==  3 );
+        assert( m(1, 0) ==  4 );
+        assert( m(0, 4) ==  8 );
+        assert( m(2, 0) == 16 );
+        assert( m(4, 5) == 5 * 8 + 1 );
+        assert( !m.is_exhaustive() );
+        assert( !m.is_strided() );
+        assert( m.is_unique() );
+
+        bool seen[3 * 2 * 8] = {};
+        for (int i = 0; i < 5; ++i) {
+            for (int j = 0; j < 6; ++j) {
+                assert( !seen[m(i, j)] );
+                seen[m(i, j)] = true;
+            }
+        }
+    }
+
+    // blocks as wide as the extents are rows of a layout_right mapping
+    {
+        constexpr cuda::layout_blocked<4,8>::mapping<cuda::std::extents<int,16,8>> m{};
+
+        static_assert( decltype(m)::is_always_exhaustive(), "" );
+        static_assert( decltype(m)::is_always_strided(), "" );
+        static_assert( m(5, 3) == 5 * 8 + 3, "" );
+        static_assert( m.stride(0) == 8, "" );
+        static_assert( m.stride(1) == 1, "" );
+
+        static_assert( !cuda::layout_blocked<4,8>::mapping<cuda::std::extents<int,16,16>>::is_always_strided(), "" );
+        static_assert( !cuda::layout_blocked<4,8>::mapping<cuda::std::extents<int,15,16>>::is_always_exhaustive(), "" );
+    }
+
+    // conversions
+    {
+        cuda::layout_blocked<2,4>::mapping<cuda::std::extents<int,5,6>> m{};
+        cuda::layout_blocked<2,4>::mapping<ext2d_t> m2 = m;
+
+        assert( m2 == m );
+        assert( m2.extents().extent(0) == 5 );
+    }
+
+    // rank 0
+    {
+        cuda::layout_blocked<>::mapping<cuda::std::extents<int>> m;
+
+        assert( m() == 0 );
+        assert( m.required_span_size() == 1 );
+    }
+
+    // mdspan
+    {
+        float data[8 * 8];
+        cuda::std::mdspan<float, cuda::std::extents<int,8,8>, cuda::layout_blocked<4,4>> m(data);
+
+        for (int i = 0; i < 8; ++i) {
+            for (int j = 0; j < 8; ++j) {
+                m(i, j) = static_cast<float>(i * 8 + j);
+            }
+        }
+
+        assert( data[16] == 4.0f );
+        assert( data[20] == 12.0f );
+    }
+
+    return 0;
+}
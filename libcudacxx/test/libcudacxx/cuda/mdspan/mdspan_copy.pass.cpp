@@ -0,0 +1,103 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/mdspan>
+
+// mdspan_copy
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+
+    int src[40 * 37];
+    for (int i = 0; i < 40 * 37; ++i) {
+        src[i] = i;
+    }
+    cuda::std::mdspan<const int, ext2d_t> s{ src, 40, 37 };
+
+    // the same layout, copied as a whole
+    {
+        int dst[40 * 37] = {};
+        cuda::std::mdspan<int, cuda::std::extents<int,40,37>> d{ dst };
+        cuda::mdspan_copy(s, d);
+        for (int i = 0; i < 40 * 37; ++i) {
+            assert( dst[i] == i );
+        }
+    }
+
+    // layout_right to layout_left, traversed in tiles
+    {
+        int dst[40 * 37] = {};
+        cuda::std::mdspan<int, ext2d_t, cuda::std::layout_left> d{ dst, 40, 37 };
+        cuda::mdspan_copy(s, d);
+        for (int i = 0; i < 40; ++i) {
+            for (int j = 0; j < 37; ++j) {
+                assert( d(i, j) == s(i, j) );
+                assert( dst[j * 40 + i] == i * 37 + j );
+            }
+        }
+    }
+
+    // into every other element of a layout_stride mapping
+    {
+        int dst[2 * 40 * 37] = {};
+        cuda::std::layout_stride::mapping<ext2d_t> m{ ext2d_t{40, 37}, cuda::std::array<int,2>{2 * 37, 2} };
+        cuda::std::mdspan<int, ext2d_t, cuda::std::layout_stride> d{ dst, m };
+        cuda::mdspan_copy(s, d);
+        for (int i = 0; i < 40 * 37; ++i) {
+            assert( dst[2 * i] == i );
+            assert( dst[2 * i + 1] == 0 );
+        }
+    }
+
+    // rank 3 into a blocked layout and back
+    {
+        using ext3d_t = cuda::std::extents<int,dyn,8,dyn>;
+        int blocked[4 * 8 * 12] = {};
+        int dst[3 * 8 * 10] = {};
+        cuda::std::mdspan<const int, ext3d_t> s3{ src, 3, 10 };
+        cuda::std::mdspan<int, ext3d_t, cuda::layout_blocked<2,4,4>> b{ blocked, 3, 10 };
+        assert( b.mapping().required_span_size() == 4 * 8 * 12 );
+        cuda::std::mdspan<int, ext3d_t, cuda::std::layout_left> d{ dst, 3, 10 };
+        cuda::mdspan_copy(s3, b);
+        cuda::mdspan_copy(b, d);
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 8; ++j) {
+                for (int k = 0; k < 10; ++k) {
+                    assert( b(i, j, k) == s3(i, j, k) );
+                    assert( d(i, j, k) == s3(i, j, k) );
+                }
+            }
+        }
+    }
+
+    // rank 0 and empty mdspans
+    {
+        int dst = 0;
+        cuda::mdspan_copy(cuda::std::mdspan<const int, cuda::std::extents<int>>{ src + 5 },
+                          cuda::std::mdspan<int, cuda::std::extents<int>>{ &dst });
+        assert( dst == 5 );
+
+        cuda::mdspan_copy(cuda::std::mdspan<const int, ext2d_t>{ src, 0, 37 },
+                          cuda::std::mdspan<int, ext2d_t, cuda::std::layout_left>{ &dst, 0, 37 });
+        assert( dst == 5 );
+    }
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/mdspan>
+
+// mdspan_fill
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+
+    // a span without gaps
+    {
+        int dst[5 * 7] = {};
+        cuda::mdspan_fill(cuda::std::mdspan<int, ext2d_t, cuda::std::layout_left>{ dst, 5, 7 }, 3);
+        for (int i = 0; i < 5 * 7; ++i) {
+            assert( dst[i] == 3 );
+        }
+    }
+
+    // the gaps of a layout_stride mapping are left alone
+    {
+        int dst[3 * 5 * 7] = {};
+        cuda::std::layout_stride::mapping<ext2d_t> m{ ext2d_t{5, 7}, cuda::std::array<int,2>{1, 3 * 5} };
+        cuda::mdspan_fill(cuda::std::mdspan<int, ext2d_t, cuda::std::layout_stride>{ dst, m }, 3);
+        for (int i = 0; i < 3 * 5 * 7; ++i) {
+            assert( dst[i] == (i % 15 < 5 ? 3 : 0) );
+        }
+    }
+
+    // the padding of a blocked layout is left alone
+    {
+        int dst[2 * 2 * 16] = {};
+        cuda::std::mdspan<int, ext2d_t, cuda::layout_blocked<4,4>> d{ dst, 5, 7 };
+        cuda::mdspan_fill(d, 3);
+        int filled = 0;
+        for (int i = 0; i < 2 * 2 * 16; ++i) {
+            filled += dst[i] == 3;
+        }
+        assert( filled == 5 * 7 );
+        for (int i = 0; i < 5; ++i) {
+            for (int j = 0; j < 7; ++j) {
+                assert( d(i, j) == 3 );
+            }
+        }
+    }
+
+    // rank 0
+    {
+        int dst = 0;
+        cuda::mdspan_fill(cuda::std::mdspan<int, cuda::std::extents<int>>{ &dst }, 3);
+        assert( dst == 3 );
+    }
+
+    return 0;
+}
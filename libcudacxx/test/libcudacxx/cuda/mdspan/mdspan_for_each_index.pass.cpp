@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/mdspan>
+
+// mdspan_for_each_index
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    // the indices of extents, the last one varying fastest
+    {
+        int count = 0;
+        cuda::mdspan_for_each_index(cuda::std::extents<int,3,dyn,5>{4}, [&](int i, int j, int k) {
+            assert( i * 4 * 5 + j * 5 + k == count );
+            ++count;
+        });
+        assert( count == 3 * 4 * 5 );
+    }
+
+    // the indices of an mdspan, in memory order
+    {
+        int data[3 * 4 * 5];
+        cuda::std::mdspan<int, cuda::std::dextents<int,3>, cuda::std::layout_left> m{ data, 3, 4, 5 };
+        int count = 0;
+        cuda::mdspan_for_each_index(m, [&](int i, int j, int k) {
+            assert( &m(i, j, k) == data + count );
+            ++count;
+        });
+        assert( count == 3 * 4 * 5 );
+    }
+
+    // rank 0 has a single index, and empty extents none
+    {
+        int count = 0;
+        cuda::mdspan_for_each_index(cuda::std::extents<int>{}, [&]() { ++count; });
+        assert( count == 1 );
+        cuda::mdspan_for_each_index(cuda::std::extents<int,3,0>{}, [&](int, int) { ++count; });
+        assert( count == 1 );
+    }
+
+    return 0;
+}
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/mdspan>
+
+// mdspan_transpose
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+
+    int src[40 * 37];
+    for (int i = 0; i < 40 * 37; ++i) {
+        src[i] = i;
+    }
+    cuda::std::mdspan<const int, ext2d_t> s{ src, 40, 37 };
+
+    // layout_right to layout_right, traversed in tiles
+    {
+        int dst[37 * 40] = {};
+        cuda::std::mdspan<int, ext2d_t> d{ dst, 37, 40 };
+        cuda::mdspan_transpose(s, d);
+        for (int i = 0; i < 40; ++i) {
+            for (int j = 0; j < 37; ++j) {
+                assert( d(j, i) == s(i, j) );
+            }
+        }
+    }
+
+    // layout_right to layout_left, which keeps the order in memory
+    {
+        int dst[37 * 40] = {};
+        cuda::std::mdspan<int, cuda::std::extents<int,37,40>, cuda::std::layout_left> d{ dst };
+        cuda::mdspan_transpose(s, d);
+        for (int i = 0; i < 40 * 37; ++i) {
+            assert( dst[i] == i );
+        }
+    }
+
+    // a single row into a single column
+    {
+        int dst[37] = {};
+        cuda::std::mdspan<const int, ext2d_t> row{ src, 1, 37 };
+        cuda::std::mdspan<int, cuda::std::extents<int,37,1>> d{ dst };
+        cuda::mdspan_transpose(row, d);
+        for (int j = 0; j < 37; ++j) {
+            assert( dst[j] == j );
+        }
+    }
+
+    return 0;
+}
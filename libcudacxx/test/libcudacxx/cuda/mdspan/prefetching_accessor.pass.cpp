@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/mdspan>
+
+// prefetching_accessor
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    using accessor_t = cuda::prefetching_accessor<double, 16>;
+    static_assert(accessor_t::distance == 16, "");
+    static_assert(cuda::prefetching_accessor<double>::distance == 64, "");
+    ASSERT_SAME_TYPE(accessor_t::element_type, double);
+    ASSERT_SAME_TYPE(accessor_t::reference, double&);
+    ASSERT_SAME_TYPE(accessor_t::offset_policy, accessor_t);
+
+    static_assert(cuda::std::is_convertible<cuda::std::default_accessor<double>, accessor_t>::value, "");
+    static_assert(cuda::std::is_convertible<accessor_t, cuda::prefetching_accessor<const double, 16>>::value, "");
+    static_assert(!cuda::std::is_constructible<accessor_t, cuda::prefetching_accessor<double, 8>>::value, "");
+
+    // the prefetches run past the end of the elements without faulting
+    {
+        double data[3 * 5] = {};
+        using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+        cuda::std::mdspan<double, ext2d_t, cuda::std::layout_left, accessor_t> m{ data, 3, 5 };
+        for (int j = 0; j < 5; ++j) {
+            for (int i = 0; i < 3; ++i) {
+                m.accessor().access(m.data_handle(), m.mapping()(i, j)) = i + 10 * j;
+            }
+        }
+        double sum = 0;
+        for (int i = 0; i < 3 * 5; ++i) {
+            assert( data[i] == (i % 3) + 10 * (i / 3) );
+            sum += m.accessor().access(m.data_handle(), i);
+        }
+        assert( sum == 3 * 100 + 5 * 3 );
+    }
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/mdspan>
+
+// restrict_accessor
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+using ext1d_t = cuda::std::extents<int,dyn>;
+
+// A stencil over two arrays which must not overlap.
+__host__ __device__ void smooth(cuda::std::mdspan<int, ext1d_t, cuda::std::layout_right, cuda::restrict_accessor<int>> out,
+                                cuda::std::mdspan<const int, ext1d_t, cuda::std::layout_right, cuda::restrict_accessor<const int>> in)
+{
+    for (int i = 1; i + 1 < out.extent(0); ++i) {
+        out.accessor().access(out.data_handle(), i) = in.accessor().access(in.data_handle(), i - 1)
+                                                    + in.accessor().access(in.data_handle(), i)
+                                                    + in.accessor().access(in.data_handle(), i + 1);
+    }
+}
+
+int main(int, char**)
+{
+    using accessor_t = cuda::restrict_accessor<int>;
+    ASSERT_SAME_TYPE(accessor_t::element_type, int);
+    ASSERT_SAME_TYPE(accessor_t::reference, int&);
+    ASSERT_SAME_TYPE(accessor_t::offset_policy, accessor_t);
+
+    static_assert(!cuda::std::is_convertible<cuda::std::default_accessor<int>, accessor_t>::value, "");
+    static_assert(cuda::std::is_constructible<accessor_t, cuda::std::default_accessor<int>>::value, "");
+    static_assert(cuda::std::is_convertible<accessor_t, cuda::restrict_accessor<const int>>::value, "");
+    static_assert(!cuda::std::is_constructible<accessor_t, cuda::restrict_accessor<const int>>::value, "");
+
+    {
+        int in[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+        int out[8] = {};
+        smooth(cuda::std::mdspan<int, ext1d_t, cuda::std::layout_right, accessor_t>{ out, 8 },
+               cuda::std::mdspan<const int, ext1d_t, cuda::std::layout_right, cuda::restrict_accessor<const int>>{ in, 8 });
+        assert( out[0] == 0 && out[7] == 0 );
+        for (int i = 1; i < 7; ++i) {
+            assert( out[i] == 3 * (i + 1) );
+        }
+    }
+
+    // composes with any layout
+    {
+        int data[3 * 4] = {};
+        using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+        cuda::std::layout_stride::mapping<ext2d_t> map{ ext2d_t{2, 3}, cuda::std::array<int,2>{1, 4} };
+        cuda::std::mdspan<int, ext2d_t, cuda::std::layout_stride, accessor_t> m{ data, map };
+        m.accessor().access(m.data_handle(), m.mapping()(1, 2)) = 42;
+        assert( data[9] == 42 );
+        assert( m.accessor().offset(m.data_handle(), 9) == data + 9 );
+    }
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/mdspan>
+
+// streaming_accessor
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+struct triple {
+    short x, y, z;
+};
+
+// Every element size, including those which are stored plainly.
+template <class T>
+__host__ __device__ void test(T a, T b)
+{
+    T data[5] = {a, a, a, a, a};
+    using ext1d_t = cuda::std::extents<int,dyn>;
+    cuda::std::mdspan<T, ext1d_t, cuda::std::layout_right, cuda::streaming_accessor<T>> m{ data, 5 };
+    m.accessor().access(m.data_handle(), 1) = b;
+    m.accessor().access(m.data_handle(), 3) = m.accessor().access(m.data_handle(), 1);
+    const T read = m.accessor().access(m.data_handle(), 3);
+    assert( read == b );
+    assert( data[0] == a && data[1] == b && data[2] == a && data[3] == b && data[4] == a );
+}
+
+__host__ __device__ bool operator==(const triple& lhs, const triple& rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z;
+}
+
+int main(int, char**)
+{
+    using accessor_t = cuda::streaming_accessor<int>;
+    ASSERT_SAME_TYPE(accessor_t::element_type, int);
+    ASSERT_SAME_TYPE(accessor_t::data_handle_type, int*);
+    ASSERT_SAME_TYPE(accessor_t::offset_policy, accessor_t);
+    static_assert(cuda::std::is_convertible<accessor_t::reference, int>::value, "");
+    static_assert(cuda::std::is_assignable<accessor_t::reference, int>::value, "");
+    // there is nothing to store through a const element type
+    ASSERT_SAME_TYPE(cuda::streaming_accessor<const int>::reference, const int&);
+
+    static_assert(cuda::std::is_convertible<cuda::std::default_accessor<int>, accessor_t>::value, "");
+    static_assert(cuda::std::is_convertible<accessor_t, cuda::streaming_accessor<const int>>::value, "");
+
+    test<char>('a', 'b');
+    test<int>(1, 2);
+    test<float>(1.5f, -2.5f);
+    test<double>(1.5, -2.5);
+    test<cuda::std::uint64_t>(1, 1ull << 40);
+    test<triple>(triple{1, 2, 3}, triple{4, 5, 6});
+
+    return 0;
+}
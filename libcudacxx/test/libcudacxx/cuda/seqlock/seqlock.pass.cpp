@@ -0,0 +1,120 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/seqlock>
+
+#include <cuda/seqlock>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+// Writers keep all the members equal, so a torn copy would show.
+struct snapshot {
+  int a;
+  int b;
+  int c;
+};
+
+struct increment {
+  __host__ __device__
+  snapshot operator()(snapshot s) const {
+    return snapshot{s.a + 1, s.b + 1, s.c + 1};
+  }
+};
+
+template<typename Seqlock,
+    template<typename, typename> typename Selector,
+    typename Initializer = constructor_initializer>
+__host__ __device__
+void test()
+{
+  Selector<Seqlock, Initializer> sel;
+  SHARED Seqlock * s;
+  s = sel.construct(snapshot{1, 1, 1});
+
+  execute_on_main_thread([&]{
+    snapshot v = s->load();
+    assert(v.a == 1 && v.b == 1 && v.c == 1);
+    s->store(snapshot{0, 0, 0});
+    v = s->load();
+    assert(v.a == 0 && v.b == 0 && v.c == 0);
+  });
+
+  auto writer = LAMBDA (){
+    for (int i = 0; i < 64; ++i) {
+      s->update(increment());
+    }
+  };
+  auto reader = LAMBDA (){
+    int last = 0;
+    for (int i = 0; i < 64; ++i) {
+      snapshot const v = s->load();
+      assert(v.a == v.b && v.b == v.c);
+      assert(v.a >= last);
+      last = v.a;
+    }
+  };
+
+  concurrent_agents_launch(writer, writer, reader, reader);
+
+  execute_on_main_thread([&]{
+    snapshot const v = s->load();
+    assert(v.a == 128 && v.b == 128 && v.c == 128);
+  });
+}
+
+// A value which is not default constructible.
+struct point {
+  double x;
+  double y;
+
+  __host__ __device__
+  point(double x, double y) : x(x), y(y) {}
+};
+
+__host__ __device__
+void test_not_default_constructible()
+{
+  cuda::seqlock<point> s(point(1.0, 2.0));
+  point v = s.load();
+  assert(v.x == 1.0 && v.y == 2.0);
+  s.store(point(3.0, 4.0));
+  v = s.load();
+  assert(v.x == 3.0 && v.y == 4.0);
+}
+
+int main(int, char**)
+{
+    test_not_default_constructible();
+
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+        cuda_thread_count = 4;
+
+        test<cuda::seqlock<snapshot>, local_memory_selector>();
+        test<cuda::seqlock<snapshot, cuda::thread_scope_block>, local_memory_selector>();
+        test<cuda::seqlock<snapshot, cuda::thread_scope_device>, local_memory_selector>();
+        test<cuda::seqlock<snapshot, cuda::thread_scope_system>, local_memory_selector>();
+    ),(
+        test<cuda::seqlock<snapshot>, shared_memory_selector>();
+        test<cuda::seqlock<snapshot, cuda::thread_scope_block>, shared_memory_selector>();
+        test<cuda::seqlock<snapshot, cuda::thread_scope_device>, shared_memory_selector>();
+        test<cuda::seqlock<snapshot, cuda::thread_scope_system>, shared_memory_selector>();
+
+        test<cuda::seqlock<snapshot>, global_memory_selector>();
+        test<cuda::seqlock<snapshot, cuda::thread_scope_block>, global_memory_selector>();
+        test<cuda::seqlock<snapshot, cuda::thread_scope_device>, global_memory_selector>();
+        test<cuda::seqlock<snapshot, cuda::thread_scope_system>, global_memory_selector>();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/shared_mutex>
+
+#include <cuda/shared_mutex>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+// Guarded by the mutex: writers keep both halves equal, which readers check.
+struct guarded {
+  int a;
+  int b;
+};
+
+template<typename Mutex,
+    template<typename, typename> typename Selector,
+    typename Initializer = constructor_initializer>
+__host__ __device__
+void test()
+{
+  Selector<Mutex, Initializer> sel;
+  SHARED Mutex * m;
+  m = sel.construct();
+
+  Selector<guarded, Initializer> data_sel;
+  SHARED guarded * data;
+  data = data_sel.construct();
+
+  execute_on_main_thread([&]{
+    data->a = 0;
+    data->b = 0;
+
+    assert(m->try_lock());
+    assert(!m->try_lock());
+    assert(!m->try_lock_shared());
+    m->unlock();
+
+    assert(m->try_lock_shared());
+    assert(m->try_lock_shared());
+    assert(!m->try_lock());
+    m->unlock_shared();
+    assert(!m->try_lock());
+    m->unlock_shared();
+
+    m->lock();
+    m->unlock();
+    m->lock_shared();
+    m->unlock_shared();
+  });
+
+  auto writer = LAMBDA (){
+    for (int i = 0; i < 64; ++i) {
+      m->lock();
+      int const next = data->a + 1;
+      data->a = next;
+      data->b = next;
+      m->unlock();
+    }
+  };
+  auto reader = LAMBDA (){
+    for (int i = 0; i < 64; ++i) {
+      m->lock_shared();
+      assert(data->a == data->b);
+      m->unlock_shared();
+    }
+  };
+
+  concurrent_agents_launch(writer, writer, reader, reader);
+
+  execute_on_main_thread([&]{
+    assert(data->a == 128);
+    assert(data->b == 128);
+    assert(m->try_lock());
+    m->unlock();
+  });
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+        cuda_thread_count = 4;
+
+        test<cuda::shared_mutex<>, local_memory_selector>();
+        test<cuda::shared_mutex<cuda::thread_scope_block>, local_memory_selector>();
+        test<cuda::shared_mutex<cuda::thread_scope_device>, local_memory_selector>();
+        test<cuda::shared_mutex<cuda::thread_scope_system>, local_memory_selector>();
+    ),(
+        test<cuda::shared_mutex<>, shared_memory_selector>();
+        test<cuda::shared_mutex<cuda::thread_scope_block>, shared_memory_selector>();
+        test<cuda::shared_mutex<cuda::thread_scope_device>, shared_memory_selector>();
+        test<cuda::shared_mutex<cuda::thread_scope_system>, shared_memory_selector>();
+
+        test<cuda::shared_mutex<>, global_memory_selector>();
+        test<cuda::shared_mutex<cuda::thread_scope_block>, global_memory_selector>();
+        test<cuda::shared_mutex<cuda::thread_scope_device>, global_memory_selector>();
+        test<cuda::shared_mutex<cuda::thread_scope_system>, global_memory_selector>();
+    ))
+
+    return 0;
+}
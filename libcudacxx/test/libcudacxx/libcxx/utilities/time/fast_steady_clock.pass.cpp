@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/chrono>
+
+// __fast_steady_clock
+
+// static time_point now();
+
+#include <cuda/std/chrono>
+#include <cuda/std/cassert>
+
+int main(int, char**)
+{
+    typedef cuda::std::chrono::__fast_steady_clock C;
+    static_assert((cuda::std::is_same<C::rep, C::duration::rep>::value), "");
+    static_assert((cuda::std::is_same<C::duration, C::time_point::duration>::value), "");
+    static_assert(C::is_steady, "");
+
+    C::time_point t1 = C::now();
+    assert(C::time_point::min() < t1);
+    assert(C::time_point::max() > t1);
+
+    // the clock never goes back
+    for (int i = 0; i < 10000; ++i)
+    {
+        C::time_point const t2 = C::now();
+        assert(t1 <= t2);
+        t1 = t2;
+    }
+
+    // not even once the counter is calibrated, which happens without waiting
+    typedef cuda::std::chrono::system_clock S;
+    S::time_point const s1 = S::now();
+    while (S::now() - s1 < cuda::std::chrono::milliseconds(5))
+    {
+        C::time_point const t2 = C::now();
+        assert(t1 <= t2);
+        t1 = t2;
+    }
+
+    // and it keeps time with the system clock
+    S::time_point const s0 = S::now();
+    C::time_point const c0 = C::now();
+    while (S::now() - s0 < cuda::std::chrono::milliseconds(20)) {}
+    C::duration const elapsed = C::now() - c0;
+    assert(elapsed >= cuda::std::chrono::milliseconds(10));
+    assert(elapsed < cuda::std::chrono::seconds(10));
+
+  return 0;
+}
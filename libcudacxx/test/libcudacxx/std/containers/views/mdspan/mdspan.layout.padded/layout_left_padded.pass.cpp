@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/std/mdspan>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    using ext2d_t = cuda::std::extents<size_t,dyn,dyn>;
+    using ext3d_t = cuda::std::extents<int,3,5,2>;
+
+    // the first extent is padded up to a multiple of the padding value
+    {
+        cuda::std::layout_left_padded<4>::mapping<ext3d_t> m;
+
+        static_assert( decltype(m)::padding_value == 4, "" );
+        static_assert( decltype(m)::is_always_exhaustive() == false, "" );
+        static_assert( decltype(m)::is_always_strided() == true, "" );
+
+        assert( m.stride(0) ==  1 );
+        assert( m.stride(1) ==  4 );
+        assert( m.stride(2) == 20 );
+        assert( m(1, 2, 1) == 1 + 2 * 4 + 20 );
+        assert( m.required_span_size() == 1 + 2 + 4 * 4 + 20 );
+        assert( !m.is_exhaustive() );
+    }
+
+    // an extent which is a multiple of the padding value is not padded
+    {
+        constexpr cuda::std::layout_left_padded<4>::mapping<cuda::std::extents<int,8,3>> m{};
+
+        static_assert( decltype(m)::is_always_exhaustive() == true, "" );
+        static_assert( m.stride(1) == 8, "" );
+        static_assert( m(7, 2) == 23, "" );
+    }
+
+    // a padding value only known at run time
+    {
+        cuda::std::layout_left_padded<>::mapping<ext2d_t> m{ ext2d_t{3, 5}, 8 };
+
+        assert( m.stride(1) == 8 );
+        assert( m(2, 4) == 34 );
+        assert( m.required_span_size() == 35 );
+
+        cuda::std::layout_left_padded<>::mapping<ext2d_t> unpadded{ ext2d_t{3, 5} };
+
+        assert( unpadded.stride(1) == 3 );
+        assert( unpadded.is_exhaustive() );
+        assert( unpadded != m );
+    }
+
+    // conversions
+    {
+        cuda::std::layout_left::mapping<ext2d_t> left{ ext2d_t{3, 5} };
+        cuda::std::layout_left_padded<>::mapping<ext2d_t> m( left );
+
+        assert( m.stride(1) == 3 );
+
+        cuda::std::layout_stride::mapping<ext2d_t> strided{ ext2d_t{3, 5}, cuda::std::array<size_t,2>{1, 8} };
+        cuda::std::layout_left_padded<>::mapping<ext2d_t> m2( strided );
+
+        assert( m2.stride(1) == 8 );
+
+        cuda::std::layout_left_padded<>::mapping<ext2d_t> m3 = cuda::std::layout_left_padded<8>::mapping<ext2d_t>{ ext2d_t{3, 5} };
+
+        assert( m3 == m2 );
+    }
+
+    // ranks 0 and 1
+    {
+        cuda::std::layout_left_padded<4>::mapping<cuda::std::extents<size_t>> m0;
+
+        assert( m0() == 0 );
+        assert( m0.required_span_size() == 1 );
+
+        cuda::std::layout_left_padded<4>::mapping<cuda::std::extents<size_t,dyn>> m1{ cuda::std::extents<size_t,dyn>{7} };
+
+        assert( m1(6) == 6 );
+        assert( m1.stride(0) == 1 );
+        assert( m1.required_span_size() == 7 );
+        assert( m1.is_exhaustive() );
+    }
+
+    // mdspan
+    {
+        int data[4 * 5];
+        cuda::std::mdspan<int, cuda::std::extents<size_t,3,5>, cuda::std::layout_left_padded<4>> m(data);
+
+        m(2, 3) = 42;
+
+        assert( data[2 + 3 * 4] == 42 );
+        assert( m.mapping().required_span_size() == 19 );
+    }
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/std/mdspan>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    // rows of a layout_right_padded mdspan, and the whole of some of its columns
+    {
+        cuda::std::array<int,4*8> d;
+        cuda::std::mdspan<int, cuda::std::dextents<size_t,2>, cuda::std::layout_right_padded<8>> m(d.data(), 4, 6);
+        m(2, 3) = 42;
+
+        auto sub0 = cuda::std::submdspan(m, cuda::std::tuple<size_t,size_t>{1, 3}, cuda::std::full_extent);
+
+        static_assert(cuda::std::is_same<decltype(sub0)::layout_type, cuda::std::layout_right_padded<dyn>>::value, "");
+        assert(sub0.extent(0) == 2);
+        assert(sub0.stride(0) == 8);
+        assert(sub0(1, 3) == 42);
+
+        auto sub1 = cuda::std::submdspan(m, cuda::std::full_extent, cuda::std::tuple<size_t,size_t>{2, 4});
+
+        static_assert(cuda::std::is_same<decltype(sub1)::layout_type, cuda::std::layout_right_padded<dyn>>::value, "");
+        assert(sub1.stride(0) == 8);
+        assert(sub1(2, 1) == 42);
+
+        auto sub2 = cuda::std::submdspan(m, 2, cuda::std::full_extent);
+
+        static_assert(cuda::std::is_same<decltype(sub2)::layout_type, cuda::std::layout_right_padded<dyn>>::value, "");
+        assert(sub2(3) == 42);
+
+        // a column is not contiguous
+        auto sub3 = cuda::std::submdspan(m, cuda::std::full_extent, 3);
+
+        static_assert(cuda::std::is_same<decltype(sub3)::layout_type, cuda::std::layout_stride>::value, "");
+        assert(sub3.stride(0) == 8);
+        assert(sub3(2) == 42);
+    }
+
+    // columns of a layout_left_padded mdspan
+    {
+        cuda::std::array<int,4*4*5> d;
+        cuda::std::mdspan<int, cuda::std::extents<size_t,3,4,5>, cuda::std::layout_left_padded<4>> m(d.data());
+        m(2, 2, 1) = 42;
+
+        auto sub0 = cuda::std::submdspan(m, cuda::std::tuple<size_t,size_t>{1, 3}, cuda::std::full_extent, 1);
+
+        static_assert(cuda::std::is_same<decltype(sub0)::layout_type, cuda::std::layout_left_padded<dyn>>::value, "");
+        assert(sub0.stride(1) == 4);
+        assert(sub0(1, 2) == 42);
+
+        auto sub1 = cuda::std::submdspan(m, cuda::std::full_extent, cuda::std::full_extent, cuda::std::full_extent);
+
+        static_assert(cuda::std::is_same<decltype(sub1)::layout_type, cuda::std::layout_left_padded<dyn>>::value, "");
+        assert(sub1.stride(2) == 16);
+        assert(sub1(2, 2, 1) == 42);
+
+        auto sub2 = cuda::std::submdspan(m, 2, cuda::std::full_extent, cuda::std::full_extent);
+
+        static_assert(cuda::std::is_same<decltype(sub2)::layout_type, cuda::std::layout_stride>::value, "");
+        assert(sub2(2, 1) == 42);
+    }
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/std/linalg>
+
+// template<in-object InObj1, in-object InObj2, out-object OutObj>
+//   void add(InObj1 x, InObj2 y, OutObj z);
+
+#include <cuda/std/linalg>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    // vectors
+    {
+        int x[5] = {1, 2, 3, 4, 5};
+        int y[5] = {10, 20, 30, 40, 50};
+        int z[5] = {};
+        using vec_t = cuda::std::mdspan<int, cuda::std::extents<int,dyn>>;
+        cuda::std::linalg::add(vec_t{ x, 5 }, vec_t{ y, 5 }, vec_t{ z, 5 });
+        for (int i = 0; i < 5; ++i) {
+            assert( z[i] == 11 * (i + 1) );
+        }
+    }
+
+    // matrices of different layouts
+    {
+        using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+        int x[2 * 3] = {0, 1, 2, 3, 4, 5};
+        int y[2 * 3] = {0, 1, 2, 3, 4, 5};
+        int z[2 * 3] = {};
+        cuda::std::mdspan<int, ext2d_t> xs{ x, 2, 3 };
+        cuda::std::mdspan<int, ext2d_t, cuda::std::layout_left> ys{ y, 2, 3 };
+        cuda::std::mdspan<int, ext2d_t> zs{ z, 2, 3 };
+        cuda::std::linalg::add(xs, ys, zs);
+        for (int i = 0; i < 2; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                assert( z[i * 3 + j] == (i * 3 + j) + (j * 2 + i) );
+            }
+        }
+    }
+
+    // the output may alias an input
+    {
+        int x[4] = {1, 2, 3, 4};
+        using vec_t = cuda::std::mdspan<int, cuda::std::extents<int,4>>;
+        cuda::std::linalg::add(vec_t{ x }, vec_t{ x }, vec_t{ x });
+        for (int i = 0; i < 4; ++i) {
+            assert( x[i] == 2 * (i + 1) );
+        }
+    }
+
+    return 0;
+}
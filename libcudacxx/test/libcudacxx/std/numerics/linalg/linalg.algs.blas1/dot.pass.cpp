@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/std/linalg>
+
+// template<in-vector InVec1, in-vector InVec2, class Scalar>
+//   Scalar dot(InVec1 v1, InVec2 v2, Scalar init);
+// template<in-vector InVec1, in-vector InVec2>
+//   auto dot(InVec1 v1, InVec2 v2);
+
+#include <cuda/std/linalg>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    using vec_t = cuda::std::mdspan<int, cuda::std::extents<int,dyn>>;
+
+    // lengths around the number of partial sums
+    for (int n = 0; n < 11; ++n) {
+        int x[11] = {};
+        int y[11] = {};
+        int expected = 0;
+        for (int i = 0; i < n; ++i) {
+            x[i] = i + 1;
+            y[i] = 2 * i - 3;
+            expected += x[i] * y[i];
+        }
+        assert( cuda::std::linalg::dot(vec_t{ x, n }, vec_t{ y, n }) == expected );
+        assert( cuda::std::linalg::dot(vec_t{ x, n }, vec_t{ y, n }, 7) == expected + 7 );
+    }
+
+    // the type of init is the type of the result
+    {
+        int x[3] = {1, 2, 3};
+        ASSERT_SAME_TYPE(decltype(cuda::std::linalg::dot(vec_t{ x, 3 }, vec_t{ x, 3 }, 0L)), long);
+        ASSERT_SAME_TYPE(decltype(cuda::std::linalg::dot(vec_t{ x, 3 }, vec_t{ x, 3 })), int);
+        assert( cuda::std::linalg::dot(vec_t{ x, 3 }, vec_t{ x, 3 }, 0.5) == 14.5 );
+    }
+
+    // a strided vector
+    {
+        int x[6] = {1, 0, 2, 0, 3, 0};
+        int y[3] = {4, 5, 6};
+        using ext1d_t = cuda::std::extents<int,dyn>;
+        cuda::std::layout_stride::mapping<ext1d_t> m{ ext1d_t{3}, cuda::std::array<int,1>{2} };
+        cuda::std::mdspan<int, ext1d_t, cuda::std::layout_stride> xs{ x, m };
+        assert( cuda::std::linalg::dot(xs, vec_t{ y, 3 }) == 32 );
+    }
+
+    return 0;
+}
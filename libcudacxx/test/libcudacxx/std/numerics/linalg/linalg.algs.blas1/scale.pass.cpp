@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/std/linalg>
+
+// template<class Scalar, inout-object InOutObj>
+//   void scale(Scalar alpha, InOutObj x);
+
+#include <cuda/std/linalg>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    // a vector
+    {
+        int x[5] = {1, 2, 3, 4, 5};
+        cuda::std::linalg::scale(3, cuda::std::mdspan<int, cuda::std::extents<int,dyn>>{ x, 5 });
+        for (int i = 0; i < 5; ++i) {
+            assert( x[i] == 3 * (i + 1) );
+        }
+    }
+
+    // a matrix with gaps, which are left alone
+    {
+        using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+        int x[4 * 3] = {};
+        for (int i = 0; i < 4 * 3; ++i) {
+            x[i] = i;
+        }
+        cuda::std::layout_stride::mapping<ext2d_t> m{ ext2d_t{3, 3}, cuda::std::array<int,2>{1, 4} };
+        cuda::std::linalg::scale(2, cuda::std::mdspan<int, ext2d_t, cuda::std::layout_stride>{ x, m });
+        for (int i = 0; i < 4 * 3; ++i) {
+            assert( x[i] == (i % 4 < 3 ? 2 * i : i) );
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/std/linalg>
+
+// template<in-vector InVec, class Scalar>
+//   Scalar vector_norm2(InVec v, Scalar init);
+// template<in-vector InVec>
+//   auto vector_norm2(InVec v);
+
+#include <cuda/std/linalg>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/complex>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    using vec_t = cuda::std::mdspan<double, cuda::std::extents<int,dyn>>;
+
+    {
+        double x[2] = {3.0, 4.0};
+        assert( cuda::std::linalg::vector_norm2(vec_t{ x, 2 }) == 5.0 );
+        // init is the norm of the elements that came before
+        assert( cuda::std::linalg::vector_norm2(vec_t{ x, 1 }, 4.0) == 5.0 );
+    }
+
+    {
+        double x[9] = {2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0};
+        assert( cuda::std::linalg::vector_norm2(vec_t{ x, 9 }) == 6.0 );
+    }
+
+    {
+        float x[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+        auto norm = cuda::std::linalg::vector_norm2(cuda::std::mdspan<float, cuda::std::extents<int,4>>{ x });
+        ASSERT_SAME_TYPE(decltype(norm), float);
+        assert( norm == 2.0f );
+    }
+
+    {
+        double x[1] = {};
+        assert( cuda::std::linalg::vector_norm2(vec_t{ x, 0 }) == 0.0 );
+    }
+
+    {
+        // the norm of complex elements is real and sums their squared magnitudes
+        using complex_t = cuda::std::complex<double>;
+        complex_t x[2] = {complex_t(0.0, 1.0), complex_t(0.0, 1.0)};
+        auto norm = cuda::std::linalg::vector_norm2(cuda::std::mdspan<complex_t, cuda::std::extents<int,dyn>>{ x, 2 });
+        ASSERT_SAME_TYPE(decltype(norm), double);
+        assert( cuda::std::fabs(norm - cuda::std::sqrt(2.0)) < 1e-15 );
+
+        complex_t y[1] = {complex_t(3.0, -4.0)};
+        assert( cuda::std::fabs(cuda::std::linalg::vector_norm2(cuda::std::mdspan<complex_t, cuda::std::extents<int,1>>{ y }) - 5.0) < 1e-15 );
+    }
+
+    {
+        // the squares of the elements overflow, but the norm does not
+        double x[2] = {1e200, 1e200};
+        const double norm = cuda::std::linalg::vector_norm2(vec_t{ x, 2 });
+        assert( cuda::std::fabs(norm / (cuda::std::sqrt(2.0) * 1e200) - 1.0) < 1e-15 );
+        assert( cuda::std::fabs(cuda::std::linalg::vector_norm2(vec_t{ x, 1 }, -1e200) / norm - 1.0) < 1e-15 );
+
+        // the squares of the elements underflow, but the norm does not
+        double y[2] = {3e-200, -4e-200};
+        assert( cuda::std::fabs(cuda::std::linalg::vector_norm2(vec_t{ y, 2 }) / 5e-200 - 1.0) < 1e-15 );
+    }
+
+    return 0;
+}
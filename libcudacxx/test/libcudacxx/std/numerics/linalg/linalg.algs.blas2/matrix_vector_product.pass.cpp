@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/std/linalg>
+
+// template<in-matrix InMat, in-vector InVec, out-vector OutVec>
+//   void matrix_vector_product(InMat A, InVec x, OutVec y);
+// template<in-matrix InMat, in-vector InVec1, in-vector InVec2, out-vector OutVec>
+//   void matrix_vector_product(InMat A, InVec1 x, InVec2 y, OutVec z);
+
+#include <cuda/std/linalg>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+template <class Layout>
+__host__ __device__ void test()
+{
+    using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+    using vec_t = cuda::std::mdspan<int, cuda::std::extents<int,dyn>>;
+
+    // shapes around the number of columns or sums handled at once
+    for (int rows = 1; rows < 7; ++rows) {
+        for (int cols = 1; cols < 7; ++cols) {
+            int a[6 * 6] = {};
+            cuda::std::mdspan<int, ext2d_t, Layout> as{ a, rows, cols };
+            int x[6] = {};
+            int e[6] = {};
+            for (int j = 0; j < cols; ++j) {
+                x[j] = j - 2;
+            }
+            for (int i = 0; i < rows; ++i) {
+                e[i] = 100 * i;
+                for (int j = 0; j < cols; ++j) {
+                    as.accessor().access(as.data_handle(), as.mapping()(i, j)) = i * 7 + j;
+                }
+            }
+
+            int y[6] = {};
+            cuda::std::linalg::matrix_vector_product(as, vec_t{ x, cols }, vec_t{ y, rows });
+            for (int i = 0; i < rows; ++i) {
+                int expected = 0;
+                for (int j = 0; j < cols; ++j) {
+                    expected += (i * 7 + j) * x[j];
+                }
+                assert( y[i] == expected );
+            }
+
+            int z[6] = {};
+            cuda::std::linalg::matrix_vector_product(as, vec_t{ x, cols }, vec_t{ e, rows }, vec_t{ z, rows });
+            for (int i = 0; i < rows; ++i) {
+                assert( z[i] == y[i] + 100 * i );
+            }
+
+            // the updated vector may be the output
+            cuda::std::linalg::matrix_vector_product(as, vec_t{ x, cols }, vec_t{ e, rows }, vec_t{ e, rows });
+            for (int i = 0; i < rows; ++i) {
+                assert( e[i] == z[i] );
+            }
+        }
+    }
+}
+
+int main(int, char**)
+{
+    test<cuda::std::layout_right>();
+    test<cuda::std::layout_left>();
+    return 0;
+}
@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/std/linalg>
+
+// template<in-matrix InMat, class Triangle, class DiagonalStorage, in-vector InVec, out-vector OutVec>
+//   void triangular_matrix_vector_solve(InMat A, Triangle t, DiagonalStorage d, InVec b, OutVec x);
+// template<in-matrix InMat, class Triangle, class DiagonalStorage, inout-vector InOutVec>
+//   void triangular_matrix_vector_solve(InMat A, Triangle t, DiagonalStorage d, InOutVec b);
+
+#include <cuda/std/linalg>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+constexpr int n = 5;
+
+// Fills both triangles of A, so that reading the wrong one shows. The
+// diagonal is 2, which keeps the solutions exact.
+template <class Matrix>
+__host__ __device__ void fill(Matrix a)
+{
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            a.accessor().access(a.data_handle(), a.mapping()(i, j)) = i == j ? 2.0 : (i < j ? i - j : i + j + 1);
+        }
+    }
+}
+
+template <class Matrix>
+__host__ __device__ double element(Matrix a, int i, int j)
+{
+    return a.accessor().access(a.data_handle(), a.mapping()(i, j));
+}
+
+template <class Layout, class Triangle, class Diagonal>
+__host__ __device__ void test(Triangle t, Diagonal d)
+{
+    using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+    using vec_t = cuda::std::mdspan<double, cuda::std::extents<int,dyn>>;
+
+    double a[n * n] = {};
+    cuda::std::mdspan<double, ext2d_t, Layout> as{ a, n, n };
+    fill(as);
+
+    constexpr bool upper = cuda::std::is_same<Triangle, cuda::std::linalg::upper_triangle_t>::value;
+    constexpr bool unit = cuda::std::is_same<Diagonal, cuda::std::linalg::implicit_unit_diagonal_t>::value;
+
+    // b = A x for a known x
+    double expected[n] = {1.0, -2.0, 3.0, -4.0, 5.0};
+    double b[n] = {};
+    for (int i = 0; i < n; ++i) {
+        b[i] = (unit ? 1.0 : 2.0) * expected[i];
+        for (int j = 0; j < n; ++j) {
+            if (upper ? j > i : j < i) {
+                b[i] += element(as, i, j) * expected[j];
+            }
+        }
+    }
+
+    double x[n] = {};
+    cuda::std::linalg::triangular_matrix_vector_solve(as, t, d, vec_t{ b, n }, vec_t{ x, n });
+    for (int i = 0; i < n; ++i) {
+        assert( x[i] == expected[i] );
+    }
+
+    cuda::std::linalg::triangular_matrix_vector_solve(as, t, d, vec_t{ b, n });
+    for (int i = 0; i < n; ++i) {
+        assert( b[i] == expected[i] );
+    }
+}
+
+template <class Layout>
+__host__ __device__ void test()
+{
+    test<Layout>(cuda::std::linalg::lower_triangle, cuda::std::linalg::explicit_diagonal);
+    test<Layout>(cuda::std::linalg::lower_triangle, cuda::std::linalg::implicit_unit_diagonal);
+    test<Layout>(cuda::std::linalg::upper_triangle, cuda::std::linalg::explicit_diagonal);
+    test<Layout>(cuda::std::linalg::upper_triangle, cuda::std::linalg::implicit_unit_diagonal);
+}
+
+int main(int, char**)
+{
+    test<cuda::std::layout_right>();
+    test<cuda::std::layout_left>();
+    return 0;
+}
@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/std/linalg>
+
+// template<in-matrix InMat1, in-matrix InMat2, out-matrix OutMat>
+//   void matrix_product(InMat1 A, InMat2 B, OutMat C);
+// template<in-matrix InMat1, in-matrix InMat2, in-matrix InMat3, out-matrix OutMat>
+//   void matrix_product(InMat1 A, InMat2 B, InMat3 E, OutMat C);
+
+#include <cuda/std/linalg>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+template <class Matrix>
+__host__ __device__ int& element(Matrix a, int i, int j)
+{
+    return a.accessor().access(a.data_handle(), a.mapping()(i, j));
+}
+
+// The larger shapes take the blocked path on the host, and leave partial
+// tiles in every dimension.
+template <class LayoutA, class LayoutB, class LayoutC>
+__host__ __device__ void test(int m, int k, int n)
+{
+    using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+
+    int a[21 * 19] = {};
+    int b[19 * 23] = {};
+    int e[21 * 23] = {};
+    int c[21 * 23] = {};
+    cuda::std::mdspan<int, ext2d_t, LayoutA> as{ a, m, k };
+    cuda::std::mdspan<int, ext2d_t, LayoutB> bs{ b, k, n };
+    cuda::std::mdspan<int, ext2d_t, LayoutC> es{ e, m, n };
+    cuda::std::mdspan<int, ext2d_t, LayoutC> cs{ c, m, n };
+    for (int i = 0; i < m; ++i) {
+        for (int l = 0; l < k; ++l) {
+            element(as, i, l) = (i * 3 + l) % 7 - 3;
+        }
+    }
+    for (int l = 0; l < k; ++l) {
+        for (int j = 0; j < n; ++j) {
+            element(bs, l, j) = (l * 5 + j) % 11 - 5;
+        }
+    }
+    for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < n; ++j) {
+            element(es, i, j) = i - j;
+        }
+    }
+
+    cuda::std::linalg::matrix_product(as, bs, cs);
+    for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < n; ++j) {
+            int expected = 0;
+            for (int l = 0; l < k; ++l) {
+                expected += element(as, i, l) * element(bs, l, j);
+            }
+            assert( element(cs, i, j) == expected );
+        }
+    }
+
+    // the updated matrix may be the output
+    cuda::std::linalg::matrix_product(as, bs, es, es);
+    for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < n; ++j) {
+            assert( element(es, i, j) == element(cs, i, j) + i - j );
+        }
+    }
+}
+
+template <class LayoutA, class LayoutB, class LayoutC>
+__host__ __device__ void test()
+{
+    test<LayoutA, LayoutB, LayoutC>(1, 1, 1);
+    test<LayoutA, LayoutB, LayoutC>(3, 5, 2);
+    test<LayoutA, LayoutB, LayoutC>(21, 19, 23);
+    test<LayoutA, LayoutB, LayoutC>(16, 16, 16);
+}
+
+int main(int, char**)
+{
+    using cuda::std::layout_left;
+    using cuda::std::layout_right;
+    test<layout_right, layout_right, layout_right>();
+    test<layout_left, layout_left, layout_left>();
+    test<layout_right, layout_left, layout_right>();
+    test<layout_left, layout_right, layout_left>();
+    return 0;
+}
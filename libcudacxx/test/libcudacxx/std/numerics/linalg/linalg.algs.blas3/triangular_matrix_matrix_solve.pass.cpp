@@ -0,0 +1,144 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/std/linalg>
+
+// template<in-matrix InMat1, class Triangle, class DiagonalStorage, in-matrix InMat2, out-matrix OutMat>
+//   void triangular_matrix_matrix_left_solve(InMat1 A, Triangle t, DiagonalStorage d, InMat2 B, OutMat X);
+// template<in-matrix InMat, class Triangle, class DiagonalStorage, inout-matrix InOutMat>
+//   void triangular_matrix_matrix_left_solve(InMat A, Triangle t, DiagonalStorage d, InOutMat B);
+// template<in-matrix InMat1, class Triangle, class DiagonalStorage, in-matrix InMat2, out-matrix OutMat>
+//   void triangular_matrix_matrix_right_solve(InMat1 A, Triangle t, DiagonalStorage d, InMat2 B, OutMat X);
+// template<in-matrix InMat, class Triangle, class DiagonalStorage, inout-matrix InOutMat>
+//   void triangular_matrix_matrix_right_solve(InMat A, Triangle t, DiagonalStorage d, InOutMat B);
+
+#include <cuda/std/linalg>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+constexpr int n = 4;
+constexpr int r = 3;
+
+template <class Matrix>
+__host__ __device__ double& element(Matrix a, int i, int j)
+{
+    return a.accessor().access(a.data_handle(), a.mapping()(i, j));
+}
+
+// Both triangles of A are filled, so that reading the wrong one shows. The
+// diagonal is 2, which keeps the solutions exact.
+template <class Layout, class Triangle, class Diagonal>
+__host__ __device__ void test(Triangle t, Diagonal d)
+{
+    using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+
+    constexpr bool upper = cuda::std::is_same<Triangle, cuda::std::linalg::upper_triangle_t>::value;
+    constexpr bool unit = cuda::std::is_same<Diagonal, cuda::std::linalg::implicit_unit_diagonal_t>::value;
+
+    double a[n * n] = {};
+    cuda::std::mdspan<double, ext2d_t, Layout> as{ a, n, n };
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            element(as, i, j) = i == j ? 2.0 : (i < j ? i - j : i + j + 1);
+        }
+    }
+    auto triangle = [&](int i, int j) -> double {
+        if (i == j) {
+            return unit ? 1.0 : 2.0;
+        }
+        return (upper ? j > i : j < i) ? element(as, i, j) : 0.0;
+    };
+
+    // A X = B
+    {
+        double expected[n * r] = {};
+        cuda::std::mdspan<double, ext2d_t, Layout> es{ expected, n, r };
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < r; ++j) {
+                element(es, i, j) = (i * r + j) % 5 - 2;
+            }
+        }
+        double b[n * r] = {};
+        cuda::std::mdspan<double, ext2d_t, Layout> bs{ b, n, r };
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < r; ++j) {
+                for (int l = 0; l < n; ++l) {
+                    element(bs, i, j) += triangle(i, l) * element(es, l, j);
+                }
+            }
+        }
+
+        double x[n * r] = {};
+        cuda::std::mdspan<double, ext2d_t, Layout> xs{ x, n, r };
+        cuda::std::linalg::triangular_matrix_matrix_left_solve(as, t, d, bs, xs);
+        for (int i = 0; i < n * r; ++i) {
+            assert( x[i] == expected[i] );
+        }
+
+        cuda::std::linalg::triangular_matrix_matrix_left_solve(as, t, d, bs);
+        for (int i = 0; i < n * r; ++i) {
+            assert( b[i] == expected[i] );
+        }
+    }
+
+    // X A = B
+    {
+        double expected[r * n] = {};
+        cuda::std::mdspan<double, ext2d_t, Layout> es{ expected, r, n };
+        for (int i = 0; i < r; ++i) {
+            for (int j = 0; j < n; ++j) {
+                element(es, i, j) = (i * n + j) % 5 - 2;
+            }
+        }
+        double b[r * n] = {};
+        cuda::std::mdspan<double, ext2d_t, Layout> bs{ b, r, n };
+        for (int i = 0; i < r; ++i) {
+            for (int j = 0; j < n; ++j) {
+                for (int l = 0; l < n; ++l) {
+                    element(bs, i, j) += element(es, i, l) * triangle(l, j);
+                }
+            }
+        }
+
+        double x[r * n] = {};
+        cuda::std::mdspan<double, ext2d_t, Layout> xs{ x, r, n };
+        cuda::std::linalg::triangular_matrix_matrix_right_solve(as, t, d, bs, xs);
+        for (int i = 0; i < r * n; ++i) {
+            assert( x[i] == expected[i] );
+        }
+
+        cuda::std::linalg::triangular_matrix_matrix_right_solve(as, t, d, bs);
+        for (int i = 0; i < r * n; ++i) {
+            assert( b[i] == expected[i] );
+        }
+    }
+}
+
+template <class Layout>
+__host__ __device__ void test()
+{
+    test<Layout>(cuda::std::linalg::lower_triangle, cuda::std::linalg::explicit_diagonal);
+    test<Layout>(cuda::std::linalg::lower_triangle, cuda::std::linalg::implicit_unit_diagonal);
+    test<Layout>(cuda::std::linalg::upper_triangle, cuda::std::linalg::explicit_diagonal);
+    test<Layout>(cuda::std::linalg::upper_triangle, cuda::std::linalg::implicit_unit_diagonal);
+}
+
+int main(int, char**)
+{
+    test<cuda::std::layout_right>();
+    test<cuda::std::layout_left>();
+    return 0;
+}
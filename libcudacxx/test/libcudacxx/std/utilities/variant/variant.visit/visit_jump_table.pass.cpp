@@ -0,0 +1,235 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+// UNSUPPORTED: msvc-19.16
+
+// <cuda/std/variant>
+// template <class Visitor, class... Variants>
+// constexpr see below visit(Visitor&& vis, Variants&&... vars);
+
+// On the host, visit dispatches on the combination of alternatives through a
+// switch of 4, 16, 64 or 256 cases, or through a table of function pointers
+// for more than 256 combinations. Visit every combination on either side of
+// each of those boundaries.
+
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+#include <cuda/std/variant>
+
+#include "test_macros.h"
+#include "variant_test_helpers.h"
+
+template <size_t I>
+struct Alt {
+  int value;
+
+  __host__ __device__
+  constexpr Alt(int v = 0) : value(v) {}
+};
+
+template <class Seq>
+struct make_variant;
+
+template <size_t... Is>
+struct make_variant<cuda::std::index_sequence<Is...>> {
+  using type = cuda::std::variant<Alt<Is>...>;
+};
+
+// a variant of N distinct alternatives
+template <size_t N>
+using variant_of = typename make_variant<cuda::std::make_index_sequence<N>>::type;
+
+// the variant holding its alternative i, chosen at run time
+template <class V, size_t I = 0, cuda::std::enable_if_t<(I + 1 == cuda::std::variant_size<V>::value), int> = 0>
+__host__ __device__
+constexpr V make(size_t, int value) {
+  return V(cuda::std::in_place_index<I>, value);
+}
+
+template <class V, size_t I = 0, cuda::std::enable_if_t<(I + 1 < cuda::std::variant_size<V>::value), int> = 0>
+__host__ __device__
+constexpr V make(size_t i, int value) {
+  return i == I ? V(cuda::std::in_place_index<I>, value) : make<V, I + 1>(i, value);
+}
+
+// returns the flat index of the combination of alternatives it is called with,
+// with the first operand most significant, if every operand holds the value 1
+template <size_t... Sizes>
+struct FlatIndex {
+  template <size_t... Is>
+  __host__ __device__
+  constexpr size_t operator()(const Alt<Is>&... alts) const {
+    return sum(alts.value...) == static_cast<int>(sizeof...(Is))
+             ? flat(cuda::std::index_sequence<Sizes...>{}, cuda::std::index_sequence<Is...>{})
+             : size_t(-1);
+  }
+
+  // any other alternative, such as MakeEmptyT
+  template <class... Args>
+  __host__ __device__
+  constexpr size_t operator()(const Args&...) const {
+    return size_t(-1);
+  }
+
+  __host__ __device__
+  static constexpr int sum() {
+    return 0;
+  }
+
+  template <class... Ints>
+  __host__ __device__
+  static constexpr int sum(int first, Ints... rest) {
+    return first + sum(rest...);
+  }
+
+  __host__ __device__
+  static constexpr size_t flat(cuda::std::index_sequence<>, cuda::std::index_sequence<>) {
+    return 0;
+  }
+
+  template <size_t S, size_t... Ss, size_t I, size_t... Is>
+  __host__ __device__
+  static constexpr size_t flat(cuda::std::index_sequence<S, Ss...>, cuda::std::index_sequence<I, Is...>) {
+    return I * product(Ss...) + flat(cuda::std::index_sequence<Ss...>{}, cuda::std::index_sequence<Is...>{});
+  }
+
+  __host__ __device__
+  static constexpr size_t product() {
+    return 1;
+  }
+
+  template <class... Rest>
+  __host__ __device__
+  static constexpr size_t product(size_t first, Rest... rest) {
+    return first * product(rest...);
+  }
+};
+
+template <size_t N1, size_t N2>
+__host__ __device__
+void test_two() {
+  using V1 = variant_of<N1>;
+  using V2 = variant_of<N2>;
+  for (size_t i = 0; i < N1; ++i) {
+    for (size_t j = 0; j < N2; ++j) {
+      V1 v1 = make<V1>(i, 1);
+      V2 v2 = make<V2>(j, 1);
+      assert(cuda::std::visit(FlatIndex<N1, N2>{}, v1, cuda::std::as_const(v2)) == i * N2 + j);
+    }
+  }
+}
+
+template <size_t N1, size_t N2, size_t N3>
+__host__ __device__
+void test_three() {
+  using V1 = variant_of<N1>;
+  using V2 = variant_of<N2>;
+  using V3 = variant_of<N3>;
+  for (size_t i = 0; i < N1; ++i) {
+    for (size_t j = 0; j < N2; ++j) {
+      for (size_t k = 0; k < N3; ++k) {
+        const V1 v1 = make<V1>(i, 1);
+        V2 v2 = make<V2>(j, 1);
+        V3 v3 = make<V3>(k, 1);
+        assert(cuda::std::visit(FlatIndex<N1, N2, N3>{}, v1, v2, v3) == (i * N2 + j) * N3 + k);
+      }
+    }
+  }
+}
+
+__host__ __device__
+void test_switch_boundaries() {
+  test_two<2, 2>();   // 4 combinations
+  test_two<5, 1>();   // 5
+  test_two<4, 4>();   // 16
+  test_two<17, 1>();  // 17
+  test_two<8, 8>();   // 64
+  test_two<13, 5>();  // 65
+  test_two<16, 16>(); // 256
+}
+
+__host__ __device__
+void test_table() {
+  test_three<2, 11, 12>(); // 264 combinations
+  test_three<8, 8, 8>();   // 512
+
+  // with an explicit return type
+  using V = variant_of<8>;
+  const V v1 = make<V>(2, 1);
+  V v2 = make<V>(4, 1);
+  V v3 = make<V>(6, 1);
+  assert(cuda::std::visit<long long>(FlatIndex<8, 8, 8>{}, v1, cuda::std::move(v2), v3) == (2 * 8 + 4) * 8 + 6);
+}
+
+__host__ __device__
+void test_constexpr() {
+#if TEST_STD_VER > 14
+  {
+    using V = variant_of<16>;
+    constexpr V v1 = make<V>(15, 1);
+    constexpr V v2 = make<V>(7, 1);
+    static_assert(cuda::std::visit(FlatIndex<16, 16>{}, v1, v2) == 15 * 16 + 7, "");
+  }
+  {
+    using V = variant_of<8>;
+    constexpr V v1 = make<V>(3, 1);
+    constexpr V v2 = make<V>(0, 1);
+    constexpr V v3 = make<V>(7, 1);
+    static_assert(cuda::std::visit(FlatIndex<8, 8, 8>{}, v1, v2, v3) == (3 * 8 + 0) * 8 + 7, "");
+  }
+#endif // TEST_STD_VER > 14
+}
+
+// cuda::std::visit terminates on a valueless operand before it dispatches, as
+// cuda::std has no bad_variant_access. Visit operands which were valueless, and
+// so held variant_npos as their index, once they hold an alternative again.
+void test_valueless() {
+#ifndef TEST_HAS_NO_EXCEPTIONS
+  {
+    // 256 combinations
+    using V = cuda::std::variant<Alt<0>, Alt<1>, Alt<2>, Alt<3>, Alt<4>, Alt<5>, Alt<6>, Alt<7>,
+                                 Alt<8>, Alt<9>, Alt<10>, Alt<11>, Alt<12>, Alt<13>, Alt<14>, MakeEmptyT>;
+    V v1(cuda::std::in_place_index<14>, 1);
+    V v2;
+    makeEmpty(v2);
+    assert(v2.valueless_by_exception());
+    assert(v2.index() == cuda::std::variant_npos);
+    v2.emplace<3>(1);
+    assert(cuda::std::visit(FlatIndex<16, 16>{}, v1, v2) == 14 * 16 + 3);
+    makeEmpty(v1);
+    v1.emplace<0>(1);
+    assert(cuda::std::visit(FlatIndex<16, 16>{}, v2, v1) == 3 * 16 + 0);
+  }
+  {
+    // 512 combinations
+    using V = cuda::std::variant<Alt<0>, Alt<1>, Alt<2>, Alt<3>, Alt<4>, Alt<5>, Alt<6>, MakeEmptyT>;
+    V v1(cuda::std::in_place_index<6>, 1), v2(cuda::std::in_place_index<1>, 1), v3;
+    makeEmpty(v1);
+    makeEmpty(v3);
+    assert(v1.valueless_by_exception() && v3.valueless_by_exception());
+    v1.emplace<5>(1);
+    v3.emplace<6>(1);
+    assert(cuda::std::visit(FlatIndex<8, 8, 8>{}, v1, v2, v3) == (5 * 8 + 1) * 8 + 6);
+    assert(cuda::std::visit(FlatIndex<8, 8, 8>{}, v3, v1, v2) == (6 * 8 + 5) * 8 + 1);
+  }
+#endif // TEST_HAS_NO_EXCEPTIONS
+}
+
+int main(int, char**) {
+  test_switch_boundaries();
+  test_table();
+  test_constexpr();
+  NV_IF_TARGET(NV_IS_HOST, (test_valueless();))
+
+  return 0;
+}
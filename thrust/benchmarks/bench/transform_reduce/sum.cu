@@ -28,6 +28,7 @@
 #include <thrust/device_vector.h>
 #include <thrust/execution_policy.h>
 #include <thrust/reduce.h>
+#include <thrust/transform_reduce.h>
 
 #include "nvbench_helper.cuh"
 
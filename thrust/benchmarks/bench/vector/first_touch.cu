@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Copyright (c) 2011-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
+#include "nvbench_helper.cuh"
+
+template <typename T>
+static thrust::device_vector<T> make_vector(std::size_t elements, T value, bool serial)
+{
+  if (!serial)
+  {
+    return thrust::device_vector<T>(elements, value);
+  }
+
+  thrust::device_vector<T> result(elements, thrust::no_init);
+
+  T *raw = thrust::raw_pointer_cast(result.data());
+  std::fill(raw, raw + elements, value);
+
+  return result;
+}
+
+// Measures the bandwidth of a streaming transform over vectors whose pages
+// were first touched either by the vector's own construction, which the host
+// backends partition across threads the same way as their algorithms, or by a
+// single thread. On a multi-socket machine, the latter places every page on a
+// single NUMA node, and the transform is then bound by that node's bandwidth.
+template <typename T>
+static void first_touch(nvbench::state &state, nvbench::type_list<T>)
+{
+  const auto elements    = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto first_touch = state.get_string("FirstTouch");
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+  if (first_touch == "serial")
+  {
+    state.skip("Device memory has no NUMA placement to compare");
+    return;
+  }
+#endif
+
+  const bool serial = first_touch == "serial";
+
+  thrust::device_vector<T> input  = make_vector(elements, T{1}, serial);
+  thrust::device_vector<T> output = make_vector(elements, T{}, serial);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  caching_allocator_t alloc;
+  thrust::transform(policy(alloc), input.cbegin(), input.cend(), output.begin(), thrust::negate<T>{});
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync,
+             [&](nvbench::launch &launch) {
+               thrust::transform(policy(alloc, launch), input.cbegin(), input.cend(),
+                                 output.begin(), thrust::negate<T>{});
+             });
+}
+
+using types = nvbench::type_list<nvbench::uint32_t, nvbench::uint64_t>;
+
+NVBENCH_BENCH_TYPES(first_touch, NVBENCH_TYPE_AXES(types))
+  .set_name("first_touch")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(20, 28, 4))
+  .add_string_axis("FirstTouch", {"parallel", "serial"});
@@ -0,0 +1,966 @@
+/******************************************************************************
+ * Copyright (c) 2011-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+// The driver of the host benchmarks. It accepts the subset of the NVBench
+// command line which benchmarks/scripts relies on, and writes results in the
+// same JSON format, so that runs on the CPP, OMP and TBB systems can be
+// collected and compared with the existing scripts.
+
+#include <thrust/detail/config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nvbench/nvbench.cuh>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <tbb/global_control.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <sys/stat.h>
+#endif
+
+namespace
+{
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+constexpr const char *system_name = "OMP";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+constexpr const char *system_name = "TBB";
+#else
+constexpr const char *system_name = "CPP";
+#endif
+
+// Limits the parallelism of the device system while it is alive.
+class thread_limit
+{
+public:
+  explicit thread_limit(int num_threads)
+  {
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+    m_previous = omp_get_max_threads();
+    omp_set_num_threads(num_threads);
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+    m_control.emplace(tbb::global_control::max_allowed_parallelism,
+                      static_cast<std::size_t>(num_threads));
+#else
+    (void)num_threads;
+#endif
+  }
+
+  ~thread_limit()
+  {
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+    omp_set_num_threads(m_previous);
+#endif
+  }
+
+  thread_limit(const thread_limit &)            = delete;
+  thread_limit &operator=(const thread_limit &) = delete;
+
+private:
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  int m_previous;
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  std::optional<tbb::global_control> m_control;
+#endif
+};
+
+std::vector<std::string> split(const std::string &str, char delimiter)
+{
+  std::vector<std::string> result;
+  std::stringstream stream(str);
+  std::string item;
+  while (std::getline(stream, item, delimiter))
+  {
+    result.push_back(item);
+  }
+  return result;
+}
+
+std::string trim(const std::string &str)
+{
+  const auto begin = str.find_first_not_of(" \t");
+  const auto end   = str.find_last_not_of(" \t");
+  return begin == std::string::npos ? std::string{} : str.substr(begin, end - begin + 1);
+}
+
+// An axis override from the command line, e.g. "Elements{io}[pow2]=[16,20]",
+// "Elements{io}[pow2]=[16:28:4]", "T{ct}=I32" or "Entropy=[0.201,1.000]".
+// The values are kept as written until the type of the axis is known, since
+// only int64 axes take ranges.
+struct axis_option
+{
+  std::string name;
+  std::vector<std::string> values;
+};
+
+axis_option parse_axis_option(const std::string &arg)
+{
+  const auto eq = arg.find('=');
+  if (eq == std::string::npos)
+  {
+    throw std::runtime_error("Invalid axis option: " + arg);
+  }
+
+  axis_option result;
+  result.name = trim(arg.substr(0, eq));
+
+  // the flags of an axis are part of its definition, not of its name
+  const auto flags = result.name.find('[');
+  if (flags != std::string::npos)
+  {
+    result.name = result.name.substr(0, flags);
+  }
+
+  std::string values = trim(arg.substr(eq + 1));
+  if (!values.empty() && values.front() == '[' && values.back() == ']')
+  {
+    values = values.substr(1, values.size() - 2);
+  }
+
+  for (const std::string &value : split(values, ','))
+  {
+    result.values.push_back(trim(value));
+  }
+
+  return result;
+}
+
+nvbench::int64_t parse_int64(const std::string &axis, const std::string &value)
+{
+  std::size_t end = 0;
+  nvbench::int64_t result{};
+  try
+  {
+    result = std::stoll(value, &end);
+  }
+  catch (const std::exception &)
+  {
+    end = 0;
+  }
+  if (end == 0 || end != value.size())
+  {
+    throw std::runtime_error("Invalid value '" + value + "' of the int64 axis " + axis);
+  }
+  return result;
+}
+
+// The values of an int64 axis, in which ranges are written as
+// start:end[:stride] and include their end.
+std::vector<nvbench::int64_t> int64_axis_values(const axis_option &option)
+{
+  std::vector<nvbench::int64_t> result;
+  for (const std::string &value : option.values)
+  {
+    const std::vector<std::string> range = split(value, ':');
+    if (range.size() == 1)
+    {
+      result.push_back(parse_int64(option.name, value));
+    }
+    else if (range.size() == 2 || range.size() == 3)
+    {
+      const auto start  = parse_int64(option.name, trim(range[0]));
+      const auto end    = parse_int64(option.name, trim(range[1]));
+      const auto stride = range.size() == 3 ? parse_int64(option.name, trim(range[2])) : 1;
+      if (stride <= 0)
+      {
+        throw std::runtime_error("Invalid stride of the range '" + value + "' of the int64 axis " + option.name);
+      }
+      for (nvbench::int64_t v : nvbench::range(start, end, stride))
+      {
+        result.push_back(v);
+      }
+    }
+    else
+    {
+      throw std::runtime_error("Invalid range '" + value + "' of the int64 axis " + option.name);
+    }
+  }
+  return result;
+}
+
+struct options
+{
+  nvbench::run_settings settings;
+  std::vector<int> threads;
+  std::string json_path;
+  bool write_samples = false;
+  bool list          = false;
+  bool list_benches  = false;
+  bool list_devices  = false;
+
+  std::vector<axis_option> global_axes;
+  // the benchmarks selected with -b and the axis overrides which follow them
+  std::vector<std::pair<std::string, std::vector<axis_option>>> benches;
+};
+
+void print_help()
+{
+  std::cout
+    << "Usage: <benchmark> [options]\n"
+       "  -b, --benchmark <name|index>  run only the given benchmark; may be repeated\n"
+       "  -a, --axis <name=values>      override the values of an axis; applies to the\n"
+       "                                preceding -b, or to all benchmarks before any -b\n"
+       "  --threads <n[,n...]>          sweep the number of threads of the device system\n"
+       "  --min-samples <n>             the minimum number of samples of each state\n"
+       "  --min-time <seconds>          the minimum total time of the samples of each state\n"
+       "  --timeout <seconds>           stop sampling a state after this long\n"
+       "  --json <file>                 write the results as NVBench JSON\n"
+       "  --jsonbin <file>              as --json, and write the samples to <file>-bin/\n"
+       "  --jsonlist-benches            print the benchmarks and their axes as JSON\n"
+       "  --jsonlist-devices            print the device as JSON\n"
+       "  -l, --list                    print the benchmarks and their axes\n";
+}
+
+options parse_options(int argc, char **argv)
+{
+  options result;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+
+    auto next = [&]() -> std::string {
+      if (i + 1 >= argc)
+      {
+        throw std::runtime_error("Missing value for " + arg);
+      }
+      return argv[++i];
+    };
+
+    if (arg == "-b" || arg == "--benchmark")
+    {
+      result.benches.emplace_back(next(), std::vector<axis_option>{});
+    }
+    else if (arg == "-a" || arg == "--axis")
+    {
+      axis_option axis = parse_axis_option(next());
+      if (result.benches.empty())
+      {
+        result.global_axes.push_back(std::move(axis));
+      }
+      else
+      {
+        result.benches.back().second.push_back(std::move(axis));
+      }
+    }
+    else if (arg == "--threads")
+    {
+      for (const std::string &n : split(next(), ','))
+      {
+        result.threads.push_back(std::stoi(n));
+      }
+    }
+    else if (arg == "--min-samples")
+    {
+      result.settings.min_samples = std::stoul(next());
+    }
+    else if (arg == "--min-time")
+    {
+      result.settings.min_time = std::stod(next());
+    }
+    else if (arg == "--timeout")
+    {
+      result.settings.timeout = std::stod(next());
+    }
+    else if (arg == "--json")
+    {
+      result.json_path = next();
+    }
+    else if (arg == "--jsonbin")
+    {
+      result.json_path     = next();
+      result.write_samples = true;
+    }
+    else if (arg == "--jsonlist-benches")
+    {
+      result.list_benches = true;
+    }
+    else if (arg == "--jsonlist-devices")
+    {
+      result.list_devices = true;
+    }
+    else if (arg == "-l" || arg == "--list")
+    {
+      result.list = true;
+    }
+    else if (arg == "--stopping-criterion" || arg == "-d" || arg == "--device" || arg == "--devices")
+    {
+      // there is only one device, and sampling always stops on time
+      next();
+    }
+    else if (arg == "-h" || arg == "--help")
+    {
+      print_help();
+      std::exit(0);
+    }
+    else
+    {
+      throw std::runtime_error("Unknown option: " + arg);
+    }
+  }
+
+  return result;
+}
+
+// the benchmark currently being configured, and the type axis values selected
+// for it
+struct selection
+{
+  nvbench::benchmark *bench;
+  std::vector<std::vector<bool>> type_mask;
+};
+
+void apply_axis_option(selection &sel, const axis_option &option)
+{
+  auto &axes = sel.bench->get_axes();
+
+  for (std::size_t i = 0; i < axes.size(); ++i)
+  {
+    nvbench::axis &a = axes[i];
+    if (a.name != option.name)
+    {
+      continue;
+    }
+
+    switch (a.type)
+    {
+      case nvbench::axis_type::type:
+        for (std::size_t v = 0; v < a.size(); ++v)
+        {
+          sel.type_mask[i][v] = std::find(option.values.begin(), option.values.end(), a.input_strings[v])
+                             != option.values.end();
+        }
+        return;
+
+      case nvbench::axis_type::int64: {
+        nvbench::axis replacement{a.name, a.type, a.flags, {}, {}, {}};
+        for (const nvbench::int64_t v : int64_axis_values(option))
+        {
+          const std::string value = std::to_string(v);
+          replacement.input_strings.push_back(value);
+          if (a.flags == "pow2")
+          {
+            replacement.values.push_back(nvbench::int64_t{1} << v);
+            replacement.descriptions.push_back("2^" + value + " = " + std::to_string(replacement.values.back()));
+          }
+          else
+          {
+            replacement.values.push_back(v);
+            replacement.descriptions.emplace_back();
+          }
+        }
+        a = std::move(replacement);
+        return;
+      }
+
+      case nvbench::axis_type::string:
+        a.input_strings = option.values;
+        a.descriptions.assign(option.values.size(), {});
+        return;
+    }
+  }
+
+  throw std::runtime_error("Benchmark " + sel.bench->get_name() + " has no axis " + option.name);
+}
+
+selection select(nvbench::benchmark &bench)
+{
+  selection result{&bench, {}};
+  for (std::size_t i = 0; i < bench.get_num_type_axes(); ++i)
+  {
+    result.type_mask.emplace_back(bench.get_axes()[i].size(), true);
+  }
+  return result;
+}
+
+nvbench::benchmark &find_benchmark(const std::string &name)
+{
+  const auto &benches = nvbench::benchmark_manager::get().get_benchmarks();
+
+  for (const auto &bench : benches)
+  {
+    if (bench->get_name() == name)
+    {
+      return *bench;
+    }
+  }
+
+  if (!name.empty() && name.find_first_not_of("0123456789") == std::string::npos)
+  {
+    const auto index = std::stoul(name);
+    if (index < benches.size())
+    {
+      return *benches[index];
+    }
+  }
+
+  throw std::runtime_error("No such benchmark: " + name);
+}
+
+std::vector<selection> select_benchmarks(const options &opts)
+{
+  std::vector<selection> result;
+
+  if (opts.benches.empty())
+  {
+    for (const auto &bench : nvbench::benchmark_manager::get().get_benchmarks())
+    {
+      result.push_back(select(*bench));
+    }
+  }
+  else
+  {
+    for (const auto &choice : opts.benches)
+    {
+      result.push_back(select(find_benchmark(choice.first)));
+    }
+  }
+
+  for (std::size_t i = 0; i < result.size(); ++i)
+  {
+    for (const axis_option &option : opts.global_axes)
+    {
+      apply_axis_option(result[i], option);
+    }
+    if (!opts.benches.empty())
+    {
+      for (const axis_option &option : opts.benches[i].second)
+      {
+        apply_axis_option(result[i], option);
+      }
+    }
+  }
+
+  return result;
+}
+
+std::string json_escape(const std::string &str)
+{
+  std::string result;
+  for (char c : str)
+  {
+    switch (c)
+    {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\b':
+        result += "\\b";
+        break;
+      case '\f':
+        result += "\\f";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      case '\r':
+        result += "\\r";
+        break;
+      case '\t':
+        result += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          char escaped[7];
+          std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+          result += escaped;
+        }
+        else
+        {
+          result += c;
+        }
+    }
+  }
+  return result;
+}
+
+std::string json_string(const std::string &str)
+{
+  return '"' + json_escape(str) + '"';
+}
+
+const char *json_axis_type(nvbench::axis_type type)
+{
+  switch (type)
+  {
+    case nvbench::axis_type::type:
+      return "type";
+    case nvbench::axis_type::int64:
+      return "int64";
+    default:
+      return "string";
+  }
+}
+
+// NVBench writes 64-bit integers as strings
+std::string json_axis(const nvbench::axis &a)
+{
+  std::ostringstream out;
+  out << "{\"name\": " << json_string(a.name) << ", \"type\": \"" << json_axis_type(a.type)
+      << "\", \"flags\": " << json_string(a.flags) << ", \"values\": [";
+  for (std::size_t v = 0; v < a.size(); ++v)
+  {
+    out << (v ? ", " : "") << "{\"input_string\": " << json_string(a.input_strings[v])
+        << ", \"description\": " << json_string(a.descriptions[v]);
+    if (a.type == nvbench::axis_type::int64)
+    {
+      out << ", \"value\": \"" << a.values[v] << '"';
+    }
+    out << '}';
+  }
+  out << "]}";
+  return out.str();
+}
+
+std::string json_device()
+{
+  std::ostringstream out;
+  out << "{\"id\": 0, \"name\": " << json_string(std::string("Host (") + system_name + ")")
+      << ", \"number_of_sms\": " << std::thread::hardware_concurrency()
+      << ", \"global_memory_bus_width\": 0, \"ecc_state\": false}";
+  return out.str();
+}
+
+struct state_result
+{
+  std::vector<std::size_t> point;
+  bool skipped;
+  std::string skip_reason;
+  std::vector<double> samples;
+  std::size_t element_count;
+  std::size_t bytes;
+};
+
+struct statistics
+{
+  double mean;
+  double noise;
+};
+
+statistics compute_statistics(const std::vector<double> &samples)
+{
+  if (samples.empty())
+  {
+    return {0.0, 0.0};
+  }
+
+  double sum = 0.0;
+  for (double s : samples)
+  {
+    sum += s;
+  }
+  const double mean = sum / samples.size();
+
+  double squares = 0.0;
+  for (double s : samples)
+  {
+    squares += (s - mean) * (s - mean);
+  }
+  const double stdev = samples.size() > 1 ? std::sqrt(squares / (samples.size() - 1)) : 0.0;
+
+  return {mean, mean > 0.0 ? stdev / mean : 0.0};
+}
+
+std::string format_time(double seconds)
+{
+  char buffer[32];
+  if (seconds >= 1.0)
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3f s", seconds);
+  }
+  else if (seconds >= 1e-3)
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3f ms", seconds * 1e3);
+  }
+  else
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3f us", seconds * 1e6);
+  }
+  return buffer;
+}
+
+std::string format_rate(double rate)
+{
+  char buffer[32];
+  if (rate >= 1e9)
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3fG", rate * 1e-9);
+  }
+  else if (rate >= 1e6)
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3fM", rate * 1e-6);
+  }
+  else
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3fK", rate * 1e-3);
+  }
+  return buffer;
+}
+
+// runs every selected state of a benchmark, printing a markdown table as it goes
+std::vector<state_result> run(const selection &sel, const options &opts)
+{
+  const nvbench::benchmark &bench = *sel.bench;
+  const auto &axes                = bench.get_axes();
+  const std::size_t num_type_axes = bench.get_num_type_axes();
+
+  std::cout << "\n## " << bench.get_name() << " (" << system_name << ")\n\n|";
+  for (const nvbench::axis &a : axes)
+  {
+    std::cout << ' ' << a.name << " |";
+  }
+  std::cout << " Samples | CPU Time | Noise | Elem/s | GB/s |\n|";
+  for (std::size_t i = 0; i < axes.size() + 5; ++i)
+  {
+    std::cout << "---|";
+  }
+  std::cout << '\n';
+
+  std::vector<state_result> results;
+
+  for (const auto &config : bench.get_type_configs())
+  {
+    bool selected = true;
+    for (std::size_t i = 0; i < num_type_axes; ++i)
+    {
+      selected = selected && sel.type_mask[i][config.first[i]];
+    }
+    if (!selected)
+    {
+      continue;
+    }
+
+    // odometer over the value axes, the last one varying fastest
+    std::vector<std::size_t> point = config.first;
+    point.resize(axes.size(), 0);
+
+    bool empty = false;
+    for (std::size_t i = num_type_axes; i < axes.size(); ++i)
+    {
+      empty = empty || axes[i].size() == 0;
+    }
+
+    while (!empty)
+    {
+      std::optional<thread_limit> limit;
+      const auto threads = std::find_if(axes.begin(), axes.end(), [](const nvbench::axis &a) {
+        return a.name == "Threads";
+      });
+      if (!opts.threads.empty() && threads != axes.end())
+      {
+        limit.emplace(static_cast<int>(threads->values[point[threads - axes.begin()]]));
+      }
+
+      nvbench::state state(axes, point, opts.settings);
+      try
+      {
+        config.second(state);
+      }
+      catch (const std::exception &e)
+      {
+        state.skip(e.what());
+      }
+
+      results.push_back({point,
+                         state.is_skipped(),
+                         state.get_skip_reason(),
+                         state.get_samples(),
+                         state.get_element_count(),
+                         state.get_global_memory_bytes()});
+
+      std::cout << '|';
+      for (std::size_t i = 0; i < axes.size(); ++i)
+      {
+        std::cout << ' ' << axes[i].input_strings[point[i]] << " |";
+      }
+      if (state.is_skipped())
+      {
+        std::cout << " skipped: " << state.get_skip_reason() << " |||||\n";
+      }
+      else
+      {
+        const statistics stats = compute_statistics(state.get_samples());
+        std::printf(" %zu | %s | %.2f%% | %s | %.3f |\n",
+                    state.get_samples().size(),
+                    format_time(stats.mean).c_str(),
+                    stats.noise * 100.0,
+                    format_rate(state.get_element_count() / stats.mean).c_str(),
+                    state.get_global_memory_bytes() / stats.mean * 1e-9);
+      }
+      std::cout.flush();
+
+      std::size_t i = axes.size();
+      while (i > num_type_axes && ++point[i - 1] == axes[i - 1].size())
+      {
+        point[--i] = 0;
+      }
+      empty = i == num_type_axes;
+    }
+  }
+
+  return results;
+}
+
+void make_directory(const std::string &path)
+{
+#if defined(__unix__) || defined(__APPLE__)
+  mkdir(path.c_str(), 0755);
+#else
+  std::system(("mkdir \"" + path + "\"").c_str());
+#endif
+}
+
+std::string json_summary(const std::string &tag, const std::string &data)
+{
+  return "{\"tag\": " + json_string(tag) + ", \"name\": " + json_string(tag) + ", \"data\": [" + data
+       + "]}";
+}
+
+std::string json_float64(const std::string &name, double value)
+{
+  std::ostringstream out;
+  out.precision(17);
+  out << "{\"name\": " << json_string(name) << ", \"type\": \"float64\", \"value\": " << value << '}';
+  return out.str();
+}
+
+std::string json_int64(const std::string &name, std::size_t value)
+{
+  return "{\"name\": " + json_string(name) + ", \"type\": \"int64\", \"value\": \"" + std::to_string(value)
+       + "\"}";
+}
+
+void write_json(const options &opts,
+                const std::vector<selection> &selections,
+                const std::vector<std::vector<state_result>> &results)
+{
+  const std::string bin_dir = opts.json_path + "-bin";
+  if (opts.write_samples)
+  {
+    make_directory(bin_dir);
+  }
+
+  std::ofstream out(opts.json_path);
+  out << "{\"devices\": [" << json_device() << "],\n \"benchmarks\": [";
+
+  std::size_t sample_file = 0;
+  for (std::size_t b = 0; b < selections.size(); ++b)
+  {
+    const nvbench::benchmark &bench = *selections[b].bench;
+    const auto &axes                = bench.get_axes();
+
+    out << (b ? ",\n" : "\n") << "  {\"name\": " << json_string(bench.get_name()) << ", \"index\": " << b
+        << ", \"devices\": [0],\n   \"axes\": [";
+    for (std::size_t i = 0; i < axes.size(); ++i)
+    {
+      out << (i ? ", " : "") << json_axis(axes[i]);
+    }
+    out << "],\n   \"states\": [";
+
+    for (std::size_t s = 0; s < results[b].size(); ++s)
+    {
+      const state_result &state = results[b][s];
+
+      out << (s ? ",\n    " : "\n    ") << "{\"device\": 0, \"axis_values\": [";
+      for (std::size_t i = 0; i < axes.size(); ++i)
+      {
+        const nvbench::axis &a = axes[i];
+        const std::size_t v    = state.point[i];
+        out << (i ? ", " : "") << "{\"name\": " << json_string(a.name) << ", \"type\": \""
+            << json_axis_type(a.type) << "\", \"value\": "
+            << json_string(a.type == nvbench::axis_type::int64 ? std::to_string(a.values[v])
+                                                               : a.input_strings[v])
+            << '}';
+      }
+      out << "], \"is_skipped\": " << (state.skipped ? "true" : "false");
+
+      if (state.skipped)
+      {
+        out << ", \"skip_reason\": " << json_string(state.skip_reason) << ", \"summaries\": []}";
+        continue;
+      }
+
+      const statistics stats = compute_statistics(state.samples);
+
+      std::vector<std::string> summaries;
+      summaries.push_back(json_summary("nv/cold/sample_size", json_int64("value", state.samples.size())));
+      summaries.push_back(json_summary("nv/cold/time/cpu/mean", json_float64("value", stats.mean)));
+      summaries.push_back(
+        json_summary("nv/cold/time/cpu/stdev/relative", json_float64("value", stats.noise)));
+      if (state.element_count)
+      {
+        summaries.push_back(
+          json_summary("nv/cold/bw/item_rate", json_float64("value", state.element_count / stats.mean)));
+      }
+      if (state.bytes)
+      {
+        summaries.push_back(json_summary("nv/cold/bw/global/bytes_per_second",
+                                         json_float64("value", state.bytes / stats.mean)));
+      }
+
+      if (opts.write_samples)
+      {
+        const std::string filename = bin_dir + "/" + std::to_string(sample_file++) + ".bin";
+
+        // little endian float32, as NVBench writes them
+        std::vector<float> samples(state.samples.begin(), state.samples.end());
+        std::ofstream bin(filename, std::ios::binary);
+        bin.write(reinterpret_cast<const char *>(samples.data()), samples.size() * sizeof(float));
+
+        summaries.push_back(
+          json_summary("nv/json/bin:nv/cold/sample_times",
+                       "{\"name\": \"filename\", \"type\": \"string\", \"value\": " + json_string(filename)
+                         + "}, " + json_int64("size", samples.size())));
+      }
+
+      out << ", \"summaries\": [";
+      for (std::size_t i = 0; i < summaries.size(); ++i)
+      {
+        out << (i ? ",\n      " : "\n      ") << summaries[i];
+      }
+      out << "]}";
+    }
+    out << "]}";
+  }
+  out << "]}\n";
+}
+
+void list_benchmarks(const std::vector<selection> &selections)
+{
+  for (std::size_t b = 0; b < selections.size(); ++b)
+  {
+    const nvbench::benchmark &bench = *selections[b].bench;
+    std::cout << '[' << b << "] " << bench.get_name() << '\n';
+    for (const nvbench::axis &a : bench.get_axes())
+    {
+      std::cout << "  * " << a.full_name() << ':';
+      for (const std::string &value : a.input_strings)
+      {
+        std::cout << ' ' << value;
+      }
+      std::cout << '\n';
+    }
+  }
+}
+
+void list_benchmarks_json(const std::vector<selection> &selections)
+{
+  std::cout << "{\"benchmarks\": [";
+  for (std::size_t b = 0; b < selections.size(); ++b)
+  {
+    const nvbench::benchmark &bench = *selections[b].bench;
+    std::cout << (b ? ",\n" : "\n") << "  {\"name\": " << json_string(bench.get_name()) << ", \"index\": " << b
+              << ", \"axes\": [";
+    const auto &axes = bench.get_axes();
+    for (std::size_t i = 0; i < axes.size(); ++i)
+    {
+      std::cout << (i ? ", " : "") << json_axis(axes[i]);
+    }
+    std::cout << "]}";
+  }
+  std::cout << "]}\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  try
+  {
+    const options opts = parse_options(argc, argv);
+
+    if (opts.list_devices)
+    {
+      std::cout << "{\"devices\": [" << json_device() << "]}\n";
+      return 0;
+    }
+
+    // the thread count sweep is an axis of every benchmark
+    if (!opts.threads.empty())
+    {
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CPP
+      std::cerr << "--threads has no effect on the CPP system, which is sequential\n";
+#else
+      std::vector<nvbench::int64_t> threads(opts.threads.begin(), opts.threads.end());
+      for (const auto &bench : nvbench::benchmark_manager::get().get_benchmarks())
+      {
+        bench->add_int64_axis("Threads", threads);
+      }
+#endif
+    }
+
+    const std::vector<selection> selections = select_benchmarks(opts);
+
+    if (opts.list_benches)
+    {
+      list_benchmarks_json(selections);
+      return 0;
+    }
+    if (opts.list)
+    {
+      list_benchmarks(selections);
+      return 0;
+    }
+
+    std::vector<std::vector<state_result>> results;
+    for (const selection &sel : selections)
+    {
+      results.push_back(run(sel, opts));
+    }
+
+    if (!opts.json_path.empty())
+    {
+      write_json(opts, selections, results);
+    }
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error: " << e.what() << '\n';
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,537 @@
+/******************************************************************************
+ * Copyright (c) 2011-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+// A host-only implementation of the subset of the NVBench API which the Thrust
+// benchmarks use. It lets the same benchmark sources, with the same axes, be
+// built for the CPP, OMP and TBB device systems without CUDA. The driver which
+// runs the registered benchmarks lives in ../main.cpp.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+// the benchmark sources spell out CUDA's execution space specifiers
+#if !defined(__CUDACC__)
+#  ifndef __host__
+#    define __host__
+#  endif
+#  ifndef __device__
+#    define __device__
+#  endif
+#  ifndef __forceinline__
+#    define __forceinline__ inline
+#  endif
+#endif
+
+namespace nvbench
+{
+
+using int8_t    = std::int8_t;
+using int16_t   = std::int16_t;
+using int32_t   = std::int32_t;
+using int64_t   = std::int64_t;
+using uint8_t   = std::uint8_t;
+using uint16_t  = std::uint16_t;
+using uint32_t  = std::uint32_t;
+using uint64_t  = std::uint64_t;
+using float32_t = float;
+using float64_t = double;
+
+template <typename... Ts>
+struct type_list
+{};
+
+template <typename T>
+struct type_strings
+{
+  static std::string input_string() { return typeid(T).name(); }
+  static std::string description() { return {}; }
+};
+
+} // namespace nvbench
+
+#define NVBENCH_DECLARE_TYPE_STRINGS(Type, InputString, Description)                               \
+  namespace nvbench                                                                                \
+  {                                                                                                \
+  template <>                                                                                      \
+  struct type_strings<Type>                                                                        \
+  {                                                                                                \
+    static std::string input_string() { return InputString; }                                      \
+    static std::string description() { return Description; }                                       \
+  };                                                                                               \
+  }
+
+NVBENCH_DECLARE_TYPE_STRINGS(bool, "Bool", "bool");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int8_t, "I8", "int8_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int16_t, "I16", "int16_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int32_t, "I32", "int32_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int64_t, "I64", "int64_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint8_t, "U8", "uint8_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint16_t, "U16", "uint16_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint32_t, "U32", "uint32_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint64_t, "U64", "uint64_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::float32_t, "F32", "float");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::float64_t, "F64", "double");
+
+namespace nvbench
+{
+
+// Returns the values in [start, end] in steps of stride.
+inline std::vector<int64_t> range(int64_t start, int64_t end, int64_t stride = 1)
+{
+  std::vector<int64_t> result;
+  for (int64_t i = start; i <= end; i += stride)
+  {
+    result.push_back(i);
+  }
+  return result;
+}
+
+namespace exec_tag
+{
+
+namespace detail
+{
+enum : unsigned
+{
+  sync_flag     = 1,
+  no_batch_flag = 2,
+  timer_flag    = 4
+};
+} // namespace detail
+
+template <unsigned Flags>
+struct tag
+{
+  static constexpr unsigned flags = Flags;
+};
+
+template <unsigned A, unsigned B>
+constexpr tag<A | B> operator|(tag<A>, tag<B>)
+{
+  return {};
+}
+
+constexpr tag<0> none{};
+constexpr tag<detail::sync_flag> sync{};
+constexpr tag<detail::no_batch_flag> no_batch{};
+constexpr tag<detail::timer_flag | detail::no_batch_flag> timer{};
+
+} // namespace exec_tag
+
+// Host backends have no streams; the benchmarks only ask for one when
+// building a CUDA execution policy.
+struct launch
+{
+  int get_stream() const { return 0; }
+};
+
+// Times a region of a benchmark which uses exec_tag::timer.
+class timer
+{
+public:
+  void start() { m_start = clock::now(); }
+
+  void stop() { m_elapsed += std::chrono::duration<double>(clock::now() - m_start).count(); }
+
+  double elapsed() const { return m_elapsed; }
+
+private:
+  using clock = std::chrono::steady_clock;
+
+  clock::time_point m_start{};
+  double m_elapsed{};
+};
+
+enum class axis_type
+{
+  type,
+  int64,
+  string
+};
+
+struct axis
+{
+  std::string name;
+  axis_type type;
+  // "pow2" for axes of powers of two, whose input strings are the exponents
+  std::string flags;
+  std::vector<std::string> input_strings;
+  std::vector<std::string> descriptions;
+  // the values of int64 axes
+  std::vector<int64_t> values;
+
+  std::size_t size() const { return input_strings.size(); }
+
+  std::string full_name() const { return flags.empty() ? name : name + "[" + flags + "]"; }
+};
+
+// The settings a state is run with, chosen on the command line.
+struct run_settings
+{
+  std::size_t min_samples = 10;
+  double min_time         = 0.5;
+  double timeout          = 15.0;
+};
+
+class state
+{
+public:
+  state(const std::vector<axis> &axes, std::vector<std::size_t> point, run_settings settings)
+      : m_axes(&axes)
+      , m_point(std::move(point))
+      , m_settings(settings)
+  {}
+
+  int64_t get_int64(const std::string &name) const
+  {
+    const std::size_t i = find_axis(name, axis_type::int64);
+    return (*m_axes)[i].values[m_point[i]];
+  }
+
+  const std::string &get_string(const std::string &name) const
+  {
+    const std::size_t i = find_axis(name, axis_type::string);
+    return (*m_axes)[i].input_strings[m_point[i]];
+  }
+
+  void add_element_count(std::size_t elements, const std::string & = {})
+  {
+    m_element_count += elements;
+  }
+
+  template <typename T>
+  void add_global_memory_reads(std::size_t count, const std::string & = {})
+  {
+    m_bytes += count * sizeof(T);
+  }
+
+  template <typename T>
+  void add_global_memory_writes(std::size_t count, const std::string & = {})
+  {
+    m_bytes += count * sizeof(T);
+  }
+
+  void skip(std::string reason)
+  {
+    m_skipped     = true;
+    m_skip_reason = std::move(reason);
+  }
+
+  template <typename KernelLauncher>
+  void exec(KernelLauncher &&kernel_launcher)
+  {
+    exec(exec_tag::none, std::forward<KernelLauncher>(kernel_launcher));
+  }
+
+  // Runs the kernel launcher once to warm up, and then collects samples until
+  // both min_samples and min_time are reached, or until the timeout.
+  template <unsigned Flags, typename KernelLauncher>
+  void exec(exec_tag::tag<Flags>, KernelLauncher &&kernel_launcher)
+  {
+    if (m_skipped)
+    {
+      return;
+    }
+
+    launch l;
+    auto sample = [&] {
+      if constexpr ((Flags & exec_tag::detail::timer_flag) != 0)
+      {
+        timer t;
+        kernel_launcher(l, t);
+        return t.elapsed();
+      }
+      else
+      {
+        const auto start = std::chrono::steady_clock::now();
+        kernel_launcher(l);
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      }
+    };
+
+    sample();
+
+    double total     = 0.0;
+    const auto start = std::chrono::steady_clock::now();
+    while (m_samples.size() < m_settings.min_samples || total < m_settings.min_time)
+    {
+      m_samples.push_back(sample());
+      total += m_samples.back();
+
+      if (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()
+          > m_settings.timeout)
+      {
+        break;
+      }
+    }
+  }
+
+  const std::vector<axis> &get_axes() const { return *m_axes; }
+  const std::vector<std::size_t> &get_point() const { return m_point; }
+  const std::vector<double> &get_samples() const { return m_samples; }
+  std::size_t get_element_count() const { return m_element_count; }
+  std::size_t get_global_memory_bytes() const { return m_bytes; }
+  bool is_skipped() const { return m_skipped; }
+  const std::string &get_skip_reason() const { return m_skip_reason; }
+
+private:
+  std::size_t find_axis(const std::string &name, axis_type type) const
+  {
+    for (std::size_t i = 0; i < m_axes->size(); ++i)
+    {
+      if ((*m_axes)[i].name == name && (*m_axes)[i].type == type)
+      {
+        return i;
+      }
+    }
+    throw std::runtime_error("No such axis: " + name);
+  }
+
+  const std::vector<axis> *m_axes;
+  std::vector<std::size_t> m_point;
+  run_settings m_settings;
+
+  std::vector<double> m_samples;
+  std::size_t m_element_count{};
+  std::size_t m_bytes{};
+  bool m_skipped{};
+  std::string m_skip_reason;
+};
+
+class benchmark
+{
+public:
+  using generator_t = std::function<void(state &)>;
+
+  explicit benchmark(std::string name)
+      : m_name(std::move(name))
+  {}
+
+  benchmark &set_name(std::string name)
+  {
+    m_name = std::move(name);
+    return *this;
+  }
+
+  benchmark &set_type_axes_names(std::vector<std::string> names)
+  {
+    for (std::size_t i = 0; i < names.size() && i < m_num_type_axes; ++i)
+    {
+      m_axes[i].name = std::move(names[i]);
+    }
+    return *this;
+  }
+
+  benchmark &add_int64_axis(std::string name, std::vector<int64_t> values)
+  {
+    axis a{std::move(name), axis_type::int64, {}, {}, {}, values};
+    for (int64_t v : values)
+    {
+      a.input_strings.push_back(std::to_string(v));
+      a.descriptions.emplace_back();
+    }
+    m_axes.push_back(std::move(a));
+    return *this;
+  }
+
+  benchmark &add_int64_power_of_two_axis(std::string name, std::vector<int64_t> exponents)
+  {
+    axis a{std::move(name), axis_type::int64, "pow2", {}, {}, {}};
+    for (int64_t e : exponents)
+    {
+      const int64_t v = int64_t{1} << e;
+      a.input_strings.push_back(std::to_string(e));
+      a.descriptions.push_back("2^" + std::to_string(e) + " = " + std::to_string(v));
+      a.values.push_back(v);
+    }
+    m_axes.push_back(std::move(a));
+    return *this;
+  }
+
+  benchmark &add_string_axis(std::string name, std::vector<std::string> values)
+  {
+    axis a{std::move(name), axis_type::string, {}, values, {}, {}};
+    a.descriptions.resize(values.size());
+    m_axes.push_back(std::move(a));
+    return *this;
+  }
+
+  // for the benchmark's registration: adds a type axis, and a generator for
+  // one combination of the type axes' values
+  void add_type_axis(axis a)
+  {
+    m_axes.push_back(std::move(a));
+    ++m_num_type_axes;
+  }
+
+  void add_type_config(std::vector<std::size_t> type_point, generator_t generator)
+  {
+    m_type_configs.emplace_back(std::move(type_point), std::move(generator));
+  }
+
+  const std::string &get_name() const { return m_name; }
+  std::vector<axis> &get_axes() { return m_axes; }
+  const std::vector<axis> &get_axes() const { return m_axes; }
+  std::size_t get_num_type_axes() const { return m_num_type_axes; }
+
+  const std::vector<std::pair<std::vector<std::size_t>, generator_t>> &get_type_configs() const
+  {
+    return m_type_configs;
+  }
+
+private:
+  std::string m_name;
+  std::vector<axis> m_axes;
+  std::size_t m_num_type_axes{};
+  std::vector<std::pair<std::vector<std::size_t>, generator_t>> m_type_configs;
+};
+
+class benchmark_manager
+{
+public:
+  static benchmark_manager &get()
+  {
+    static benchmark_manager instance;
+    return instance;
+  }
+
+  benchmark &add(std::unique_ptr<benchmark> bench)
+  {
+    m_benchmarks.push_back(std::move(bench));
+    return *m_benchmarks.back();
+  }
+
+  const std::vector<std::unique_ptr<benchmark>> &get_benchmarks() const { return m_benchmarks; }
+
+private:
+  std::vector<std::unique_ptr<benchmark>> m_benchmarks;
+};
+
+namespace detail
+{
+
+template <typename T>
+void append_type_value(axis &a)
+{
+  a.input_strings.push_back(type_strings<T>::input_string());
+  a.descriptions.push_back(type_strings<T>::description());
+}
+
+template <typename... Ts>
+axis make_type_axis(type_list<Ts...>, std::size_t index)
+{
+  axis a{"T" + std::to_string(index), axis_type::type, {}, {}, {}, {}};
+  (append_type_value<Ts>(a), ...);
+  return a;
+}
+
+// enumerates the cartesian product of the type axes
+template <typename Generator, typename Chosen, typename Rest>
+struct type_configs;
+
+template <typename Generator, typename... Chosen>
+struct type_configs<Generator, type_list<Chosen...>, type_list<>>
+{
+  static void add(benchmark &bench, std::vector<std::size_t> &point)
+  {
+    bench.add_type_config(point, [](state &s) { Generator::invoke(s, type_list<Chosen...>{}); });
+  }
+};
+
+template <typename Generator, typename... Chosen, typename... Ts, typename... Lists>
+struct type_configs<Generator, type_list<Chosen...>, type_list<type_list<Ts...>, Lists...>>
+{
+  static void add(benchmark &bench, std::vector<std::size_t> &point)
+  {
+    std::size_t i = 0;
+    ((point.push_back(i++),
+      type_configs<Generator, type_list<Chosen..., Ts>, type_list<Lists...>>::add(bench, point),
+      point.pop_back()),
+     ...);
+  }
+};
+
+template <typename Generator, typename... Lists>
+std::unique_ptr<benchmark> make_benchmark(std::string name, type_list<Lists...>)
+{
+  auto bench = std::make_unique<benchmark>(std::move(name));
+
+  std::size_t index = 0;
+  (bench->add_type_axis(make_type_axis(Lists{}, index++)), ...);
+
+  std::vector<std::size_t> point;
+  type_configs<Generator, type_list<>, type_list<Lists...>>::add(*bench, point);
+
+  return bench;
+}
+
+} // namespace detail
+
+} // namespace nvbench
+
+#define NVBENCH_TYPE_AXES(...) nvbench::type_list<__VA_ARGS__>
+
+#define NVBENCH_DETAIL_CONCAT_(a, b) a##b
+#define NVBENCH_DETAIL_CONCAT(a, b)  NVBENCH_DETAIL_CONCAT_(a, b)
+#define NVBENCH_DETAIL_UNIQUE(name)  NVBENCH_DETAIL_CONCAT(name, __LINE__)
+
+#define NVBENCH_BENCH_TYPES(KernelGenerator, TypeAxes)                                             \
+  struct NVBENCH_DETAIL_UNIQUE(nvbench_generator_)                                                 \
+  {                                                                                                \
+    template <typename... Ts>                                                                      \
+    static void invoke(nvbench::state &s, nvbench::type_list<Ts...> types)                         \
+    {                                                                                              \
+      KernelGenerator(s, types);                                                                   \
+    }                                                                                              \
+  };                                                                                               \
+  static nvbench::benchmark &NVBENCH_DETAIL_UNIQUE(nvbench_benchmark_) =                           \
+    nvbench::benchmark_manager::get().add(                                                         \
+      nvbench::detail::make_benchmark<NVBENCH_DETAIL_UNIQUE(nvbench_generator_)>(#KernelGenerator, \
+                                                                                 TypeAxes{}))
+
+#define NVBENCH_BENCH(KernelGenerator)                                                             \
+  struct NVBENCH_DETAIL_UNIQUE(nvbench_generator_)                                                 \
+  {                                                                                                \
+    static void invoke(nvbench::state &s, nvbench::type_list<>) { KernelGenerator(s); }            \
+  };                                                                                               \
+  static nvbench::benchmark &NVBENCH_DETAIL_UNIQUE(nvbench_benchmark_) =                           \
+    nvbench::benchmark_manager::get().add(                                                         \
+      nvbench::detail::make_benchmark<NVBENCH_DETAIL_UNIQUE(nvbench_generator_)>(                  \
+        #KernelGenerator,                                                                          \
+        nvbench::type_list<>{}))
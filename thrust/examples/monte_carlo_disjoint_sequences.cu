@@ -17,9 +17,10 @@
 // disjoint. To achieve this, we use a single common stream
 // of random numbers, but partition it among threads to ensure no overlap
 // of substreams. The substreams are generated procedurally using
-// default_random_engine's discard(n) member function, which skips
-// past n states of the RNG. This function is accelerated and executes
-// in O(lg n) time.
+// philox4x32's discard(n) member function, which skips past n numbers
+// of the RNG. Because philox4x32 is a counter-based RNG, whose numbers
+// only depend on their position in the stream, this function executes
+// in O(1) time.
 
 struct estimate_pi : public thrust::unary_function<unsigned int,float>
 {
@@ -29,16 +30,16 @@ struct estimate_pi : public thrust::unary_function<unsigned int,float>
     float sum = 0;
     unsigned int N = 5000; // samples per stream
 
-    // note that M * N <= default_random_engine::max,
-    // which is also the period of this particular RNG
+    // note that 2 * M * N is far less than the period of
+    // philox4x32, which is 2^130 numbers
     // this ensures the substreams are disjoint
 
     // create a random number generator
     // note that each thread uses an RNG with the same seed
-    thrust::default_random_engine rng;
+    thrust::philox4x32 rng;
 
     // jump past the numbers used by the subsequences before me
-    rng.discard(N * thread_id);
+    rng.discard(2ull * N * thread_id);
 
     // create a mapping from random numbers to [0,1)
     thrust::uniform_real_distribution<float> u01(0,1);
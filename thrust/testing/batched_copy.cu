@@ -0,0 +1,173 @@
+#include <unittest/unittest.h>
+#include <thrust/batched_copy.h>
+
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/iterator/retag.h>
+
+
+// convert xxx_vector<T1> to xxx_vector<T2>
+template <class ExampleVector, typename NewType>
+struct vector_like
+{
+    typedef typename ExampleVector::allocator_type alloc;
+    typedef typename thrust::detail::allocator_traits<alloc> alloc_traits;
+    typedef typename alloc_traits::template rebind_alloc<NewType> new_alloc;
+    typedef thrust::detail::vector_base<NewType, new_alloc> type;
+};
+
+
+template <class Vector>
+void TestBatchedCopySimple(void)
+{
+    typedef typename Vector::value_type T;
+    typedef typename Vector::pointer    Pointer;
+    typedef typename vector_like<Vector, Pointer>::type PointerVector;
+    typedef typename vector_like<Vector, int>::type     IntVector;
+
+    Vector src(6);
+    src[0] = 0; src[1] = 1; src[2] = 2; src[3] = 3; src[4] = 4; src[5] = 5;
+
+    Vector dst(8, T(-1));
+
+    // {0, 1} -> dst[6], {} -> dst[0], {2, 3, 4} -> dst[0], {5} -> dst[4]
+    PointerVector src_ptrs(4);
+    src_ptrs[0] = src.data();
+    src_ptrs[1] = src.data() + 2;
+    src_ptrs[2] = src.data() + 2;
+    src_ptrs[3] = src.data() + 5;
+
+    PointerVector dst_ptrs(4);
+    dst_ptrs[0] = dst.data() + 6;
+    dst_ptrs[1] = dst.data();
+    dst_ptrs[2] = dst.data();
+    dst_ptrs[3] = dst.data() + 4;
+
+    IntVector sizes(4);
+    sizes[0] = 2; sizes[1] = 0; sizes[2] = 3; sizes[3] = 1;
+
+    thrust::batched_copy(src_ptrs.begin(), dst_ptrs.begin(), sizes.begin(), 4);
+
+    ASSERT_EQUAL(dst[0], T(2));
+    ASSERT_EQUAL(dst[1], T(3));
+    ASSERT_EQUAL(dst[2], T(4));
+    ASSERT_EQUAL(dst[3], T(-1));
+    ASSERT_EQUAL(dst[4], T(5));
+    ASSERT_EQUAL(dst[5], T(-1));
+    ASSERT_EQUAL(dst[6], T(0));
+    ASSERT_EQUAL(dst[7], T(1));
+}
+DECLARE_VECTOR_UNITTEST(TestBatchedCopySimple);
+
+
+template <typename T>
+void TestBatchedCopy(const size_t num_buffers)
+{
+    // mostly small buffers, some empty ones and a few large ones
+    thrust::host_vector<unsigned int> h_random = unittest::random_integers<unsigned int>(num_buffers);
+    thrust::host_vector<size_t> h_sizes(num_buffers);
+    thrust::host_vector<size_t> h_offsets(num_buffers);
+
+    size_t n = 0;
+    for (size_t i = 0; i < num_buffers; i++)
+    {
+        h_sizes[i] = (i % 97 == 13) ? 20000 + h_random[i] % 1000 : h_random[i] % 40;
+        h_offsets[i] = n;
+        n += h_sizes[i];
+    }
+
+    thrust::host_vector<T> h_src = unittest::random_integers<T>(n);
+
+    // copy the buffers to the reverse of their order in the source
+    thrust::host_vector<T> h_expected(n);
+    thrust::host_vector<size_t> h_dst_offsets(num_buffers);
+    size_t m = 0;
+    for (size_t i = num_buffers; i-- > 0; )
+    {
+        h_dst_offsets[i] = m;
+        for (size_t j = 0; j < h_sizes[i]; j++)
+        {
+            h_expected[m + j] = h_src[h_offsets[i] + j];
+        }
+        m += h_sizes[i];
+    }
+
+    {
+        thrust::host_vector<T> h_dst(n);
+        thrust::host_vector<T*> h_src_ptrs(num_buffers);
+        thrust::host_vector<T*> h_dst_ptrs(num_buffers);
+        for (size_t i = 0; i < num_buffers; i++)
+        {
+            h_src_ptrs[i] = thrust::raw_pointer_cast(h_src.data()) + h_offsets[i];
+            h_dst_ptrs[i] = thrust::raw_pointer_cast(h_dst.data()) + h_dst_offsets[i];
+        }
+
+        thrust::batched_copy(thrust::host, h_src_ptrs.begin(), h_dst_ptrs.begin(), h_sizes.begin(), num_buffers);
+
+        ASSERT_EQUAL(h_expected, h_dst);
+    }
+
+    {
+        typedef typename thrust::device_vector<T>::pointer Pointer;
+
+        thrust::device_vector<T> d_src = h_src;
+        thrust::device_vector<T> d_dst(n);
+        thrust::host_vector<Pointer> h_src_ptrs(num_buffers);
+        thrust::host_vector<Pointer> h_dst_ptrs(num_buffers);
+        for (size_t i = 0; i < num_buffers; i++)
+        {
+            h_src_ptrs[i] = d_src.data() + h_offsets[i];
+            h_dst_ptrs[i] = d_dst.data() + h_dst_offsets[i];
+        }
+
+        thrust::device_vector<Pointer> d_src_ptrs = h_src_ptrs;
+        thrust::device_vector<Pointer> d_dst_ptrs = h_dst_ptrs;
+        thrust::device_vector<size_t> d_sizes = h_sizes;
+
+        thrust::batched_copy(d_src_ptrs.begin(), d_dst_ptrs.begin(), d_sizes.begin(), num_buffers);
+
+        ASSERT_EQUAL(h_expected, d_dst);
+    }
+}
+DECLARE_VARIABLE_UNITTEST(TestBatchedCopy);
+
+
+template<typename InputIterators, typename OutputIterators, typename SizeIterator, typename Size>
+void batched_copy(my_system &system, InputIterators, OutputIterators, SizeIterator, Size)
+{
+    system.validate_dispatch();
+}
+
+void TestBatchedCopyDispatchExplicit()
+{
+    thrust::device_vector<int> vec(1);
+
+    my_system sys(0);
+    thrust::batched_copy(sys,
+                         vec.begin(),
+                         vec.begin(),
+                         vec.begin(),
+                         0);
+
+    ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestBatchedCopyDispatchExplicit);
+
+
+template<typename InputIterators, typename OutputIterators, typename SizeIterator, typename Size>
+void batched_copy(my_tag, InputIterators, OutputIterators dst_ptrs, SizeIterator, Size)
+{
+    *dst_ptrs = 13;
+}
+
+void TestBatchedCopyDispatchImplicit()
+{
+    thrust::device_vector<int> vec(1);
+
+    thrust::batched_copy(thrust::retag<my_tag>(vec.begin()),
+                         thrust::retag<my_tag>(vec.begin()),
+                         thrust::retag<my_tag>(vec.begin()),
+                         0);
+
+    ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestBatchedCopyDispatchImplicit);
@@ -0,0 +1,267 @@
+#include <unittest/unittest.h>
+#include <thrust/deterministic.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/execution_policy.h>
+#include <thrust/system/detail/deterministic/exact_accumulator.h>
+
+#include <cmath>
+#include <memory>
+
+
+#if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+#define DETERMINISTIC_PAR thrust::device
+#else
+#define DETERMINISTIC_PAR thrust::host
+#endif
+
+
+// values of very different magnitudes, whose sum depends on the order in
+// which they are added
+thrust::host_vector<float> ill_conditioned_floats(size_t n)
+{
+  thrust::host_vector<float> data = unittest::random_samples<float>(n);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    data[i] = (i % 3 == 0) ? data[i] * 1e7f : (i % 3 == 1) ? -data[i] * 1e7f : data[i] / 7;
+  }
+
+  return data;
+}
+
+
+void TestDeterministicReduce()
+{
+  const size_t n = 100003;
+
+  thrust::host_vector<float> data = ill_conditioned_floats(n);
+
+  const float seq_sum = thrust::reduce(thrust::deterministic(thrust::seq), data.begin(), data.end(), 1.0f);
+
+  for(int i = 0; i < 3; ++i)
+  {
+    const float par_sum = thrust::reduce(thrust::deterministic(DETERMINISTIC_PAR), data.begin(), data.end(), 1.0f);
+
+    ASSERT_EQUAL(par_sum, seq_sum);
+  }
+
+  // integral sums are those of any other reduction
+  thrust::host_vector<int> integers = unittest::random_integers<int>(n);
+
+  ASSERT_EQUAL(thrust::reduce(thrust::deterministic(DETERMINISTIC_PAR), integers.begin(), integers.end()),
+               thrust::reduce(thrust::seq, integers.begin(), integers.end()));
+  ASSERT_EQUAL(thrust::reduce(thrust::deterministic(DETERMINISTIC_PAR), integers.begin(), integers.end(), 0, thrust::maximum<int>()),
+               thrust::reduce(thrust::seq, integers.begin(), integers.end(), 0, thrust::maximum<int>()));
+
+  ASSERT_EQUAL(thrust::reduce(thrust::deterministic(DETERMINISTIC_PAR), integers.begin(), integers.begin(), 13), 13);
+}
+DECLARE_UNITTEST(TestDeterministicReduce);
+
+
+void TestDeterministicTransformReduce()
+{
+  thrust::host_vector<double> data = unittest::random_samples<double>(50001);
+
+  const double seq_sum = thrust::transform_reduce(thrust::deterministic(thrust::seq),
+                                                  data.begin(), data.end(),
+                                                  thrust::negate<double>(), 0.0, thrust::plus<double>());
+
+  const double par_sum = thrust::transform_reduce(thrust::deterministic(DETERMINISTIC_PAR),
+                                                  data.begin(), data.end(),
+                                                  thrust::negate<double>(), 0.0, thrust::plus<double>());
+
+  ASSERT_EQUAL(par_sum, seq_sum);
+}
+DECLARE_UNITTEST(TestDeterministicTransformReduce);
+
+
+void TestDeterministicExactSummation()
+{
+  float data[6] = {1e8f, 1.0f, -1e8f, 1.0f, 0.5f, 0.25f};
+
+  ASSERT_EQUAL(thrust::reduce(thrust::deterministic(DETERMINISTIC_PAR, thrust::exact_summation), data, data + 6), 2.75f);
+
+  // the exact sum does not depend on the order of the input
+  thrust::host_vector<double> values = unittest::random_samples<double>(40000);
+
+  for(size_t i = 0; i < values.size(); ++i)
+  {
+    values[i] = (i % 2) ? values[i] * 1e300 : -values[i] * 1e-300;
+  }
+
+  const double sum = thrust::reduce(thrust::deterministic(DETERMINISTIC_PAR, thrust::exact_summation), values.begin(), values.end());
+
+  thrust::host_vector<double> reversed(values.rbegin(), values.rend());
+
+  ASSERT_EQUAL(thrust::reduce(thrust::deterministic(DETERMINISTIC_PAR, thrust::exact_summation), reversed.begin(), reversed.end()), sum);
+
+  // a sum which cancels exactly
+  thrust::host_vector<double> cancelling(30000);
+
+  for(size_t i = 0; i < cancelling.size(); i += 2)
+  {
+    cancelling[i]     = values[i + 1];
+    cancelling[i + 1] = -values[i + 1];
+  }
+
+  ASSERT_EQUAL(thrust::reduce(thrust::deterministic(DETERMINISTIC_PAR, thrust::exact_summation), cancelling.begin(), cancelling.end(), 0.5), 0.5);
+}
+DECLARE_UNITTEST(TestDeterministicExactSummation);
+
+
+void TestDeterministicReduceByKey()
+{
+  const size_t n = 70001;
+
+  thrust::host_vector<int> keys = unittest::random_integers<int>(n);
+
+  // runs of up to 20000 equal keys, which span several blocks
+  for(size_t i = 0; i < n; ++i)
+  {
+    keys[i] = static_cast<int>(i / 20000 + (i % 5 == 0 && i > 60000 ? i : 0));
+  }
+
+  thrust::host_vector<float> values = ill_conditioned_floats(n);
+
+  thrust::host_vector<int>   seq_keys(n),   par_keys(n);
+  thrust::host_vector<float> seq_values(n), par_values(n);
+
+  typedef thrust::host_vector<int>::iterator   KeyIterator;
+  typedef thrust::host_vector<float>::iterator ValueIterator;
+
+  thrust::pair<KeyIterator, ValueIterator> seq_end =
+    thrust::reduce_by_key(thrust::seq, keys.begin(), keys.end(), values.begin(), seq_keys.begin(), seq_values.begin());
+
+  thrust::pair<KeyIterator, ValueIterator> par_end =
+    thrust::reduce_by_key(thrust::deterministic(DETERMINISTIC_PAR), keys.begin(), keys.end(), values.begin(), par_keys.begin(), par_values.begin());
+
+  // each run is reduced in order
+  ASSERT_EQUAL(par_end.first - par_keys.begin(), seq_end.first - seq_keys.begin());
+  ASSERT_EQUAL(par_end.second - par_values.begin(), seq_end.second - seq_values.begin());
+  ASSERT_EQUAL(par_keys, seq_keys);
+  ASSERT_EQUAL(par_values, seq_values);
+}
+DECLARE_UNITTEST(TestDeterministicReduceByKey);
+
+
+void TestDeterministicScan()
+{
+  const size_t n = 50001;
+
+  thrust::host_vector<float> data = ill_conditioned_floats(n);
+
+  thrust::host_vector<float> seq_result(n), par_result(n);
+
+  thrust::inclusive_scan(thrust::deterministic(thrust::seq), data.begin(), data.end(), seq_result.begin());
+  thrust::inclusive_scan(thrust::deterministic(DETERMINISTIC_PAR), data.begin(), data.end(), par_result.begin());
+  ASSERT_EQUAL(par_result, seq_result);
+
+  thrust::exclusive_scan(thrust::deterministic(thrust::seq), data.begin(), data.end(), seq_result.begin(), 3.0f);
+  thrust::exclusive_scan(thrust::deterministic(DETERMINISTIC_PAR), data.begin(), data.end(), par_result.begin(), 3.0f);
+  ASSERT_EQUAL(par_result, seq_result);
+
+  // in place
+  thrust::exclusive_scan(thrust::deterministic(DETERMINISTIC_PAR), data.begin(), data.end(), data.begin(), 3.0f);
+  ASSERT_EQUAL(data, seq_result);
+
+  // integral scans are those of any other scan
+  thrust::host_vector<int> integers = unittest::random_integers<int>(n);
+  thrust::host_vector<int> expected(n), result(n);
+
+  thrust::inclusive_scan(thrust::seq, integers.begin(), integers.end(), expected.begin(), thrust::maximum<int>());
+  thrust::inclusive_scan(thrust::deterministic(DETERMINISTIC_PAR), integers.begin(), integers.end(), result.begin(), thrust::maximum<int>());
+  ASSERT_EQUAL(result, expected);
+
+  thrust::exclusive_scan(thrust::seq, integers.begin(), integers.end(), expected.begin(), 7);
+  thrust::exclusive_scan(thrust::deterministic(DETERMINISTIC_PAR), integers.begin(), integers.end(), result.begin(), 7);
+  ASSERT_EQUAL(result, expected);
+
+  // partial sums of a different type than the output
+  thrust::host_vector<double> mixed_expected(n), mixed_result(n);
+
+  thrust::exclusive_scan(thrust::seq, integers.begin(), integers.end(), mixed_expected.begin(), 0.5, thrust::plus<double>());
+  thrust::exclusive_scan(thrust::deterministic(DETERMINISTIC_PAR), integers.begin(), integers.end(), mixed_result.begin(), 0.5, thrust::plus<double>());
+  ASSERT_EQUAL(mixed_result, mixed_expected);
+
+  thrust::inclusive_scan(thrust::seq, integers.begin(), integers.end(), expected.begin());
+  thrust::inclusive_scan(thrust::deterministic(DETERMINISTIC_PAR), integers.begin(), integers.end(), integers.begin());
+  ASSERT_EQUAL(integers, expected);
+}
+DECLARE_UNITTEST(TestDeterministicScan);
+
+
+// a host allocator which counts the temporary allocations made through it
+struct counting_allocator
+{
+  typedef char value_type;
+
+  size_t *allocations;
+
+  char *allocate(std::ptrdiff_t n)
+  {
+    ++*allocations;
+    return std::allocator<char>().allocate(n);
+  }
+
+  void deallocate(char *p, size_t n)
+  {
+    std::allocator<char>().deallocate(p, n);
+  }
+};
+
+
+void TestDeterministicAllocator()
+{
+  thrust::host_vector<float> data = ill_conditioned_floats(100000);
+
+  size_t allocations = 0;
+  counting_allocator alloc = {&allocations};
+
+  const float expected = thrust::reduce(thrust::deterministic(thrust::host), data.begin(), data.end());
+
+  // the temporary storage of the deterministic policy comes from the allocator of par(alloc)
+  ASSERT_EQUAL(thrust::reduce(thrust::deterministic(thrust::host(alloc)), data.begin(), data.end()), expected);
+  ASSERT_EQUAL(true, allocations > 0);
+
+  allocations = 0;
+  thrust::reduce(thrust::deterministic(thrust::host(alloc), thrust::exact_summation), data.begin(), data.end());
+  ASSERT_EQUAL(true, allocations > 0);
+}
+DECLARE_UNITTEST(TestDeterministicAllocator);
+
+
+void TestDeterministicExactSubnormalRounding()
+{
+  // 2^-150 + 2^-179 is just above half of the smallest subnormal float, so it
+  // rounds up to it; rounding to 24 bits first would give exactly half, which
+  // would then round to zero
+  thrust::system::detail::deterministic::exact_accumulator sum;
+  sum.add(std::ldexp(1.0, -150));
+  sum.add(std::ldexp(1.0, -179));
+
+  ASSERT_EQUAL(sum.sum<float>(), std::ldexp(1.0f, -149));
+  ASSERT_EQUAL(sum.sum<double>(), std::ldexp(1.0, -150) + std::ldexp(1.0, -179));
+
+  // exactly half of the smallest subnormal rounds to even, i.e. to zero
+  thrust::system::detail::deterministic::exact_accumulator half;
+  half.add(std::ldexp(1.0, -150));
+
+  ASSERT_EQUAL(half.sum<float>(), 0.0f);
+
+  // three halves round to even, i.e. to two
+  half.add(std::ldexp(1.0, -149));
+
+  ASSERT_EQUAL(half.sum<float>(), std::ldexp(1.0f, -148));
+
+  // normal results are still rounded to nearest
+  thrust::system::detail::deterministic::exact_accumulator normal;
+  normal.add(1.0);
+  normal.add(std::ldexp(1.0, -24));
+  normal.add(std::ldexp(1.0, -60));
+
+  ASSERT_EQUAL(normal.sum<float>(), 1.0f + std::ldexp(1.0f, -23));
+}
+DECLARE_UNITTEST(TestDeterministicExactSubnormalRounding);
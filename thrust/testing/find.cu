@@ -340,6 +340,25 @@ void TestFindWithBigIndexes()
 }
 DECLARE_UNITTEST(TestFindWithBigIndexes);
 
+void TestFindIfLeftmostMatch()
+{
+    // long enough to be split among several threads
+    const int n = 1 << 18;
+    thrust::device_vector<int> data(n, 0);
+
+    const int positions[] = {n - 1, n / 2 + 3, 70000, 5000, 4096, 4095, 1, 0};
+
+    for (int i = 0; i < 8; i++)
+    {
+        // every match so far lies past the new one
+        data[positions[i]] = 1;
+
+        ASSERT_EQUAL(thrust::find(data.begin(), data.end(), 1) - data.begin(), positions[i]);
+        ASSERT_EQUAL(thrust::find_if_not(data.begin(), data.end(), equal_to_value_pred<int>(0)) - data.begin(), positions[i]);
+    }
+}
+DECLARE_UNITTEST(TestFindIfLeftmostMatch);
+
 namespace
 {
 
@@ -105,6 +105,69 @@ void TestGather(const size_t n)
 DECLARE_VARIABLE_UNITTEST(TestGather);
 
 
+void TestGatherLargeSource(void)
+{
+    // a source much larger than the caches, and enough indices to partition them
+    const size_t source_size = size_t(1) << 23;
+    const size_t n = (size_t(1) << 20) + 7;
+
+    thrust::host_vector<int> h_source(source_size);
+    thrust::sequence(h_source.begin(), h_source.end());
+    thrust::device_vector<int> d_source = h_source;
+
+    thrust::host_vector<unsigned int> h_map = unittest::random_integers<unsigned int>(n);
+
+    for(size_t i = 0; i < n; i++)
+        h_map[i] = h_map[i] % source_size;
+
+    thrust::device_vector<unsigned int> d_map = h_map;
+
+    thrust::host_vector<int>   h_output(n);
+    thrust::device_vector<int> d_output(n);
+
+    for(size_t i = 0; i < n; i++)
+        h_output[i] = h_source[h_map[i]];
+
+    thrust::device_vector<int>::iterator d_end = thrust::gather(d_map.begin(), d_map.end(), d_source.begin(), d_output.begin());
+
+    ASSERT_EQUAL(h_output, d_output);
+    ASSERT_EQUAL_QUIET(d_output.end(), d_end);
+}
+DECLARE_UNITTEST(TestGatherLargeSource);
+
+
+void TestGatherLargeSourceOutliers(void)
+{
+    // a few indices far beyond the others, which the partitioned gather may not
+    // sample when it estimates the range of the map
+    const size_t source_size = size_t(1) << 23;
+    const size_t n = (size_t(1) << 20) + 7;
+
+    thrust::host_vector<int> h_source(source_size);
+    thrust::sequence(h_source.begin(), h_source.end());
+    thrust::device_vector<int> d_source = h_source;
+
+    thrust::host_vector<unsigned int> h_map = unittest::random_integers<unsigned int>(n);
+
+    for(size_t i = 0; i < n; i++)
+        h_map[i] = (i % 1001 == 1) ? static_cast<unsigned int>(source_size - 1 - i % 1000)
+                                   : h_map[i] % (source_size - (size_t(1) << 20));
+
+    thrust::device_vector<unsigned int> d_map = h_map;
+
+    thrust::host_vector<int>   h_output(n);
+    thrust::device_vector<int> d_output(n);
+
+    for(size_t i = 0; i < n; i++)
+        h_output[i] = h_source[h_map[i]];
+
+    thrust::gather(d_map.begin(), d_map.end(), d_source.begin(), d_output.begin());
+
+    ASSERT_EQUAL(h_output, d_output);
+}
+DECLARE_UNITTEST(TestGatherLargeSourceOutliers);
+
+
 template <typename T>
 void TestGatherToDiscardIterator(const size_t n)
 {
@@ -0,0 +1,201 @@
+#include <unittest/unittest.h>
+#include <thrust/generate_random.h>
+#include <thrust/random.h>
+#include <thrust/reduce.h>
+#include <thrust/extrema.h>
+#include <thrust/equal.h>
+#include <thrust/iterator/retag.h>
+#include <cmath>
+
+
+template<typename ForwardIterator, typename Distribution>
+void generate_random(my_system &system, ForwardIterator, ForwardIterator, unsigned long long, const Distribution &)
+{
+  system.validate_dispatch();
+}
+
+void TestGenerateRandomDispatchExplicit()
+{
+  thrust::device_vector<float> vec(1);
+
+  my_system sys(0);
+  thrust::generate_random(sys, vec.begin(), vec.end(), 13, thrust::random::uniform_real_distribution<float>());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestGenerateRandomDispatchExplicit);
+
+
+template<typename ForwardIterator, typename Distribution>
+void generate_random(my_tag, ForwardIterator first, ForwardIterator, unsigned long long, const Distribution &)
+{
+  *first = 13;
+}
+
+void TestGenerateRandomDispatchImplicit()
+{
+  thrust::device_vector<float> vec(1);
+
+  thrust::generate_random(thrust::retag<my_tag>(vec.begin()),
+                          thrust::retag<my_tag>(vec.end()),
+                          13,
+                          thrust::random::uniform_real_distribution<float>());
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestGenerateRandomDispatchImplicit);
+
+
+template<typename T, typename Distribution>
+void TestGenerateRandomHostDeviceIdentical(const Distribution &dist)
+{
+  const size_t n = 10000;
+
+  thrust::host_vector<T>   h(n);
+  thrust::device_vector<T> d(n);
+
+  thrust::generate_random(h.begin(), h.end(), 13, dist);
+  thrust::generate_random(d.begin(), d.end(), 13, dist);
+
+  ASSERT_EQUAL(h, d);
+
+  // a subrange draws the same numbers as the prefix of the whole range
+  thrust::device_vector<T> prefix(n / 2);
+  thrust::generate_random(prefix.begin(), prefix.end(), 13, dist);
+
+  ASSERT_EQUAL(true, thrust::equal(prefix.begin(), prefix.end(), d.begin()));
+}
+
+
+void TestGenerateRandomDeterministic()
+{
+  TestGenerateRandomHostDeviceIdentical<float>(thrust::random::uniform_real_distribution<float>(-7, 13));
+  TestGenerateRandomHostDeviceIdentical<double>(thrust::random::normal_distribution<double>(2, 3.5));
+  TestGenerateRandomHostDeviceIdentical<float>(thrust::random::exponential_distribution<float>(0.5f));
+  TestGenerateRandomHostDeviceIdentical<int>(thrust::random::poisson_distribution<int>(4.5));
+  TestGenerateRandomHostDeviceIdentical<int>(thrust::random::poisson_distribution<int>(1000));
+  TestGenerateRandomHostDeviceIdentical<int>(thrust::random::uniform_int_distribution<int>(1, 6));
+}
+DECLARE_UNITTEST(TestGenerateRandomDeterministic);
+
+
+void TestGenerateRandomMatchesEngine()
+{
+  // not a multiple of the number of elements whose Philox blocks are computed together
+  const size_t n = 1003;
+
+  const unsigned long long seed = 13 + (5ull << 32);
+
+  thrust::device_vector<float> d(n);
+  thrust::generate_random(d.begin(), d.end(), seed, thrust::random::uniform_real_distribution<float>(-7, 13));
+
+  thrust::host_vector<float> h = d;
+
+  // element i is drawn from the first word of philox4x32 with counter {0, i, 0, seed_hi}
+  for(size_t i = 0; i < n; ++i)
+  {
+    const unsigned int counter[4] = {0u, static_cast<unsigned int>(i), 0u, static_cast<unsigned int>(seed >> 32)};
+
+    thrust::philox4x32 rng(static_cast<unsigned int>(seed));
+    rng.set_counter(counter);
+
+    const float expected = -7.0f + 20.0f * (static_cast<float>(rng() >> 8) * (1.0f / 16777216.0f));
+
+    ASSERT_EQUAL(expected, h[i]);
+  }
+}
+DECLARE_UNITTEST(TestGenerateRandomMatchesEngine);
+
+
+void TestGenerateRandomSeeds()
+{
+  const size_t n = 1000;
+
+  thrust::device_vector<unsigned int> a(n), b(n), c(n);
+
+  thrust::uniform_int_distribution<unsigned int> dist(0, 1000000);
+
+  thrust::generate_random(a.begin(), a.end(), 13, dist);
+  thrust::generate_random(b.begin(), b.end(), 14, dist);
+
+  // seeds which only differ in their upper half
+  thrust::generate_random(c.begin(), c.end(), 13 + (1ull << 32), dist);
+
+  ASSERT_EQUAL(false, a == b);
+  ASSERT_EQUAL(false, a == c);
+}
+DECLARE_UNITTEST(TestGenerateRandomSeeds);
+
+
+template<typename T, typename Distribution>
+void TestGenerateRandomMoments(const Distribution &dist, double expected_mean, double expected_variance)
+{
+  const size_t n = 1 << 18;
+
+  thrust::device_vector<T> v(n);
+
+  thrust::generate_random(v.begin(), v.end(), 7, dist);
+
+  thrust::host_vector<T> h = v;
+
+  double sum = 0, sum_squares = 0;
+  for(size_t i = 0; i < n; ++i)
+  {
+    sum         += static_cast<double>(h[i]);
+    sum_squares += static_cast<double>(h[i]) * static_cast<double>(h[i]);
+  }
+
+  const double mean     = sum / n;
+  const double variance = sum_squares / n - mean * mean;
+
+  // well within 10 standard errors of the mean
+  ASSERT_LESS(std::abs(mean - expected_mean), 10 * std::sqrt(expected_variance / n));
+  ASSERT_LESS(std::abs(variance - expected_variance), 0.05 * expected_variance);
+}
+
+
+void TestGenerateRandomUniformReal()
+{
+  thrust::device_vector<float> v(1 << 16);
+
+  thrust::generate_random(v.begin(), v.end(), 7, thrust::random::uniform_real_distribution<float>(-7, 13));
+
+  ASSERT_GEQUAL(*thrust::min_element(v.begin(), v.end()), -7.0f);
+  ASSERT_LESS(*thrust::max_element(v.begin(), v.end()), 13.0f);
+
+  TestGenerateRandomMoments<double>(thrust::random::uniform_real_distribution<double>(-7, 13), 3.0, 400.0 / 12);
+}
+DECLARE_UNITTEST(TestGenerateRandomUniformReal);
+
+
+void TestGenerateRandomNormal()
+{
+  TestGenerateRandomMoments<float>(thrust::random::normal_distribution<float>(2, 3.5f), 2.0, 3.5 * 3.5);
+  TestGenerateRandomMoments<double>(thrust::random::normal_distribution<double>(-1, 0.5), -1.0, 0.25);
+}
+DECLARE_UNITTEST(TestGenerateRandomNormal);
+
+
+void TestGenerateRandomExponential()
+{
+  thrust::device_vector<float> v(1 << 16);
+
+  thrust::generate_random(v.begin(), v.end(), 7, thrust::random::exponential_distribution<float>(0.5f));
+
+  ASSERT_GEQUAL(*thrust::min_element(v.begin(), v.end()), 0.0f);
+
+  TestGenerateRandomMoments<double>(thrust::random::exponential_distribution<double>(0.5), 2.0, 4.0);
+}
+DECLARE_UNITTEST(TestGenerateRandomExponential);
+
+
+void TestGenerateRandomPoisson()
+{
+  // inversion
+  TestGenerateRandomMoments<int>(thrust::random::poisson_distribution<int>(4.5), 4.5, 4.5);
+
+  // transformed rejection
+  TestGenerateRandomMoments<int>(thrust::random::poisson_distribution<int>(50), 50.0, 50.0);
+  TestGenerateRandomMoments<long long>(thrust::random::poisson_distribution<long long>(1e6), 1e6, 1e6);
+}
+DECLARE_UNITTEST(TestGenerateRandomPoisson);
@@ -73,6 +73,48 @@ void TestMinMaxElement(const size_t n)
 DECLARE_VARIABLE_UNITTEST(TestMinMaxElement);
 
 
+template<typename T>
+void TestMinMaxElementTies(void)
+{
+    // long enough to be split among several threads
+    const size_t n = (1 << 18) + 5;
+    thrust::device_vector<T> data(n, T(1));
+
+    // the first of several equal extrema is returned, wherever they are
+    data[n - 3] = T(0);
+    data[70000] = T(0);
+    data[n / 2] = T(0);
+    data[n - 1] = T(2);
+    data[n / 2 + 1] = T(2);
+    data[100000] = T(2);
+
+    thrust::pair<typename thrust::device_vector<T>::iterator,
+                 typename thrust::device_vector<T>::iterator> result =
+        thrust::minmax_element(data.begin(), data.end());
+
+    ASSERT_EQUAL(result.first - data.begin(), 70000);
+    ASSERT_EQUAL(result.second - data.begin(), 100000);
+
+    ASSERT_EQUAL(thrust::min_element(data.begin(), data.end()) - data.begin(), 70000);
+    ASSERT_EQUAL(thrust::max_element(data.begin(), data.end()) - data.begin(), 100000);
+
+    result = thrust::minmax_element(data.begin(), data.end(), thrust::greater<T>());
+
+    ASSERT_EQUAL(result.first - data.begin(), 100000);
+    ASSERT_EQUAL(result.second - data.begin(), 70000);
+}
+void TestMinMaxElementTiesInt(void)
+{
+    TestMinMaxElementTies<int>();
+}
+DECLARE_UNITTEST(TestMinMaxElementTiesInt);
+void TestMinMaxElementTiesFloat(void)
+{
+    TestMinMaxElementTies<float>();
+}
+DECLARE_UNITTEST(TestMinMaxElementTiesFloat);
+
+
 template<typename ForwardIterator>
 thrust::pair<ForwardIterator,ForwardIterator> minmax_element(my_system &system, ForwardIterator first, ForwardIterator)
 {
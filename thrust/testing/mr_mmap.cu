@@ -0,0 +1,158 @@
+#include <unittest/unittest.h>
+#include <thrust/mr/mmap.h>
+#include <thrust/mr/pool.h>
+#include <thrust/fill.h>
+
+#include <new>
+#include <stdexcept>
+
+#if defined(THRUST_MR_HAS_MMAP)
+
+void TestMmapResourceAlignment(thrust::mr::mmap_resource &memres, std::size_t size, std::size_t alignment)
+{
+    void * ptr = memres.do_allocate(size, alignment);
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % alignment, 0u);
+
+    char * char_ptr = reinterpret_cast<char *>(ptr);
+    thrust::fill(char_ptr, char_ptr + size, char{});
+
+    memres.do_deallocate(ptr, size, alignment);
+}
+
+void TestMmapResourceAlignedAllocation(thrust::mr::mmap_options options)
+{
+    thrust::mr::mmap_resource memres(options);
+
+    for (std::size_t size = 1; size <= 1024 * 1024; size = size * 3 + 1)
+    {
+        for (std::size_t alignment = 16; alignment <= 4 * 1024 * 1024; alignment <<= 2)
+        {
+            TestMmapResourceAlignment(memres, size, alignment);
+        }
+    }
+}
+
+void TestMmapResourceDefault()
+{
+    TestMmapResourceAlignedAllocation(thrust::mr::mmap_resource::get_default_options());
+}
+DECLARE_UNITTEST(TestMmapResourceDefault);
+
+void TestMmapResourceTransparentHugePages()
+{
+    thrust::mr::mmap_options options = thrust::mr::mmap_resource::get_default_options();
+    options.transparent_huge_pages = true;
+
+    TestMmapResourceAlignedAllocation(options);
+
+    // every mapping is aligned to a huge page
+    thrust::mr::mmap_resource memres(options);
+    void * ptr = memres.do_allocate(100, 16);
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % options.transparent_huge_page_size, 0u);
+    memres.do_deallocate(ptr, 100, 16);
+}
+DECLARE_UNITTEST(TestMmapResourceTransparentHugePages);
+
+void TestMmapResourcePopulate()
+{
+    thrust::mr::mmap_options options = thrust::mr::mmap_resource::get_default_options();
+    options.populate = true;
+
+    TestMmapResourceAlignedAllocation(options);
+}
+DECLARE_UNITTEST(TestMmapResourcePopulate);
+
+void TestMmapResourceExplicitHugePages()
+{
+    const std::size_t huge_page_size = thrust::mr::mmap_resource::default_huge_page_size();
+    ASSERT_EQUAL(huge_page_size != 0 && (huge_page_size & (huge_page_size - 1)) == 0, true);
+    ASSERT_EQUAL(huge_page_size % static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)), 0u);
+
+    thrust::mr::mmap_options options = thrust::mr::mmap_resource::get_default_options();
+    options.explicit_huge_pages = true;
+    thrust::mr::mmap_resource memres(options);
+
+    // the pool of explicit huge pages is usually empty, in which case there is nothing else to test
+    void * ptr = nullptr;
+    try
+    {
+        ptr = memres.do_allocate(100, 16);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return;
+    }
+
+    // the mapping is a whole default huge page, which deallocation unmaps in full
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % huge_page_size, 0u);
+    static_cast<char *>(ptr)[huge_page_size - 1] = 1;
+    memres.do_deallocate(ptr, 100, 16);
+}
+DECLARE_UNITTEST(TestMmapResourceExplicitHugePages);
+
+#if defined(__linux__)
+void TestMmapResourceNumaPolicy()
+{
+    // node 0 exists on every Linux machine, NUMA or not
+    thrust::mr::mmap_options options = thrust::mr::mmap_resource::get_default_options();
+    options.node_mask = 1;
+
+    options.policy = thrust::mr::numa_policy::interleave;
+    TestMmapResourceAlignedAllocation(options);
+
+    options.policy = thrust::mr::numa_policy::bind;
+    TestMmapResourceAlignedAllocation(options);
+}
+DECLARE_UNITTEST(TestMmapResourceNumaPolicy);
+#endif
+
+void TestMmapResourceOptionsValidation()
+{
+    thrust::mr::mmap_options options = thrust::mr::mmap_resource::get_default_options();
+    ASSERT_EQUAL(options.validate(), true);
+
+    options.policy = thrust::mr::numa_policy::bind;
+    ASSERT_EQUAL(options.validate(), false);
+
+    options.node_mask = 1;
+    ASSERT_EQUAL(options.validate(), true);
+
+    options.transparent_huge_pages = true;
+    options.explicit_huge_pages = true;
+    ASSERT_EQUAL(options.validate(), false);
+
+    options.explicit_huge_pages = false;
+    options.transparent_huge_page_size = 3 * 1024 * 1024;
+    ASSERT_EQUAL(options.validate(), false);
+
+    ASSERT_THROWS(thrust::mr::mmap_resource memres(options), std::invalid_argument);
+}
+DECLARE_UNITTEST(TestMmapResourceOptionsValidation);
+
+void TestMmapResourceAsPoolUpstream()
+{
+    thrust::mr::mmap_options options = thrust::mr::mmap_resource::get_default_options();
+    options.transparent_huge_pages = true;
+
+    thrust::mr::mmap_resource upstream(options);
+    thrust::mr::unsynchronized_pool_resource<thrust::mr::mmap_resource> pool(&upstream);
+
+    void * a = pool.do_allocate(1024, 16);
+    void * b = pool.do_allocate(1 << 20, 64);
+
+    char * char_a = static_cast<char *>(a);
+    char * char_b = static_cast<char *>(b);
+    thrust::fill(char_a, char_a + 1024, char{1});
+    thrust::fill(char_b, char_b + (1 << 20), char{2});
+
+    ASSERT_EQUAL(char_a[1023], 1);
+    ASSERT_EQUAL(char_b[0], 2);
+
+    pool.do_deallocate(b, 1 << 20, 64);
+    pool.do_deallocate(a, 1024, 16);
+
+    pool.release();
+}
+DECLARE_UNITTEST(TestMmapResourceAsPoolUpstream);
+
+#endif // THRUST_MR_HAS_MMAP
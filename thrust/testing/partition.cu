@@ -5,6 +5,13 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/iterator/retag.h>
 #include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
 
 #if defined(THRUST_GCC_VERSION) && \
   THRUST_GCC_VERSION >= 110000 && \
@@ -1659,3 +1666,334 @@ void TestStablePartitionCopyStencilDispatchImplicit()
 }
 DECLARE_UNITTEST(TestStablePartitionCopyStencilDispatchImplicit);
 
+
+
+template<typename T>
+struct is_multiple_of_three
+{
+    __host__ __device__
+    bool operator()(T x) const { return ((int) x % 3) == 0; }
+};
+
+template<typename T>
+struct mod_three
+{
+    __host__ __device__
+    int operator()(T x) const { return ((int) x % 3 + 3) % 3; }
+};
+
+template<typename Vector>
+void TestPartition3Simple(void)
+{
+    typedef typename Vector::value_type T;
+    typedef typename Vector::iterator   Iterator;
+
+    Vector data(10);
+    data[0] = 1;
+    data[1] = 2;
+    data[2] = 3;
+    data[3] = 4;
+    data[4] = 5;
+    data[5] = 6;
+    data[6] = 7;
+    data[7] = 8;
+    data[8] = 9;
+    data[9] = 10;
+
+    thrust::pair<Iterator, Iterator> ends =
+      thrust::partition3(data.begin(), data.end(), is_multiple_of_three<T>(), is_even<T>());
+
+    Vector ref(10);
+    ref[0] = 3;
+    ref[1] = 6;
+    ref[2] = 9;
+    ref[3] = 2;
+    ref[4] = 4;
+    ref[5] = 8;
+    ref[6] = 10;
+    ref[7] = 1;
+    ref[8] = 5;
+    ref[9] = 7;
+
+    ASSERT_EQUAL(3, ends.first - data.begin());
+    ASSERT_EQUAL(7, ends.second - data.begin());
+    ASSERT_EQUAL(ref, data);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestPartition3Simple);
+
+
+template <typename T>
+struct TestPartition3
+{
+    void operator()(const size_t n)
+    {
+        thrust::host_vector<T>   h_data = unittest::random_integers<T>(n);
+        thrust::device_vector<T> d_data = h_data;
+
+        // partition3 is equivalent to two consecutive stable partitions
+        thrust::host_vector<T> ref = h_data;
+        typename thrust::host_vector<T>::iterator ref_middle1 = thrust::stable_partition(ref.begin(), ref.end(), is_multiple_of_three<T>());
+        typename thrust::host_vector<T>::iterator ref_middle2 = thrust::stable_partition(ref_middle1, ref.end(), is_even<T>());
+
+        thrust::pair<typename thrust::host_vector<T>::iterator, typename thrust::host_vector<T>::iterator> h_ends =
+          thrust::partition3(h_data.begin(), h_data.end(), is_multiple_of_three<T>(), is_even<T>());
+        thrust::pair<typename thrust::device_vector<T>::iterator, typename thrust::device_vector<T>::iterator> d_ends =
+          thrust::partition3(d_data.begin(), d_data.end(), is_multiple_of_three<T>(), is_even<T>());
+
+        ASSERT_EQUAL(ref, h_data);
+        ASSERT_EQUAL(ref, d_data);
+        ASSERT_EQUAL(ref_middle1 - ref.begin(), h_ends.first  - h_data.begin());
+        ASSERT_EQUAL(ref_middle2 - ref.begin(), h_ends.second - h_data.begin());
+        ASSERT_EQUAL(ref_middle1 - ref.begin(), d_ends.first  - d_data.begin());
+        ASSERT_EQUAL(ref_middle2 - ref.begin(), d_ends.second - d_data.begin());
+    }
+};
+VariableUnitTest<TestPartition3, PartitionTypes> TestPartition3Instance;
+
+
+template<typename Vector>
+void TestBucketPartitionSimple(void)
+{
+    typedef typename Vector::value_type T;
+
+    Vector data(10);
+    data[0] = 1;
+    data[1] = 2;
+    data[2] = 3;
+    data[3] = 4;
+    data[4] = 5;
+    data[5] = 6;
+    data[6] = 7;
+    data[7] = 8;
+    data[8] = 9;
+    data[9] = 10;
+
+    thrust::device_vector<int> offsets(4);
+
+    thrust::device_vector<int>::iterator end =
+      thrust::bucket_partition(data.begin(), data.end(), mod_three<T>(), 3, offsets.begin());
+
+    Vector ref(10);
+    ref[0] = 3;
+    ref[1] = 6;
+    ref[2] = 9;
+    ref[3] = 1;
+    ref[4] = 4;
+    ref[5] = 7;
+    ref[6] = 10;
+    ref[7] = 2;
+    ref[8] = 5;
+    ref[9] = 8;
+
+    thrust::device_vector<int> offsets_ref(4);
+    offsets_ref[0] = 0;
+    offsets_ref[1] = 3;
+    offsets_ref[2] = 7;
+    offsets_ref[3] = 10;
+
+    ASSERT_EQUAL(4, end - offsets.begin());
+    ASSERT_EQUAL(ref, data);
+    ASSERT_EQUAL(offsets_ref, offsets);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestBucketPartitionSimple);
+
+
+template<typename T>
+struct mod_buckets
+{
+    int num_buckets;
+
+    mod_buckets(int num_buckets) : num_buckets(num_buckets) {}
+
+    __host__ __device__
+    int operator()(T x) const { return ((int) x % num_buckets + num_buckets) % num_buckets; }
+};
+
+template <typename T>
+struct TestBucketPartition
+{
+    void operator()(const size_t n)
+    {
+        const int num_buckets = 17;
+
+        thrust::host_vector<T>   h_data = unittest::random_integers<T>(n);
+        thrust::device_vector<T> d_data = h_data;
+
+        // bucket_partition is equivalent to a stable sort by bucket
+        thrust::host_vector<int> ref_buckets(n);
+        thrust::transform(h_data.begin(), h_data.end(), ref_buckets.begin(), mod_buckets<T>(num_buckets));
+
+        thrust::host_vector<T> ref = h_data;
+        thrust::stable_sort_by_key(ref_buckets.begin(), ref_buckets.end(), ref.begin());
+
+        thrust::host_vector<int> ref_offsets(num_buckets + 1);
+        thrust::lower_bound(ref_buckets.begin(), ref_buckets.end(),
+                            thrust::counting_iterator<int>(0),
+                            thrust::counting_iterator<int>(num_buckets + 1),
+                            ref_offsets.begin());
+
+        thrust::host_vector<int>   h_offsets(num_buckets + 1);
+        thrust::device_vector<int> d_offsets(num_buckets + 1);
+
+        thrust::bucket_partition(h_data.begin(), h_data.end(), mod_buckets<T>(num_buckets), num_buckets, h_offsets.begin());
+        thrust::bucket_partition(d_data.begin(), d_data.end(), mod_buckets<T>(num_buckets), num_buckets, d_offsets.begin());
+
+        ASSERT_EQUAL(ref, h_data);
+        ASSERT_EQUAL(ref, d_data);
+        ASSERT_EQUAL(ref_offsets, h_offsets);
+        ASSERT_EQUAL(ref_offsets, d_offsets);
+    }
+};
+VariableUnitTest<TestBucketPartition, PartitionTypes> TestBucketPartitionInstance;
+
+
+#if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+void TestBucketPartitionForwardIterator(void)
+{
+    // a forward-only range is partitioned in place by the device system's host memory
+    std::list<int> data;
+    for(int i = 1; i <= 10; ++i)
+    {
+        data.push_back(i);
+    }
+
+    int offsets[4];
+
+    thrust::bucket_partition(thrust::device, data.begin(), data.end(), mod_three<int>(), 3, offsets);
+
+    const int ref[10] = {3, 6, 9, 1, 4, 7, 10, 2, 5, 8};
+
+    ASSERT_EQUAL(true, std::equal(data.begin(), data.end(), ref));
+    ASSERT_EQUAL(0,  offsets[0]);
+    ASSERT_EQUAL(3,  offsets[1]);
+    ASSERT_EQUAL(7,  offsets[2]);
+    ASSERT_EQUAL(10, offsets[3]);
+
+    thrust::pair<std::list<int>::iterator, std::list<int>::iterator> ends =
+      thrust::partition3(thrust::device, data.begin(), data.end(), is_multiple_of_three<int>(), is_even<int>());
+
+    ASSERT_EQUAL(3, std::distance(data.begin(), ends.first));
+    ASSERT_EQUAL(7, std::distance(data.begin(), ends.second));
+}
+DECLARE_UNITTEST(TestBucketPartitionForwardIterator);
+#endif
+
+
+template<typename ForwardIterator,
+         typename Predicate1,
+         typename Predicate2>
+thrust::pair<ForwardIterator,ForwardIterator>
+  partition3(my_system &system,
+             ForwardIterator first,
+             ForwardIterator,
+             Predicate1,
+             Predicate2)
+{
+    system.validate_dispatch();
+    return thrust::make_pair(first,first);
+}
+
+void TestPartition3DispatchExplicit()
+{
+    thrust::device_vector<int> vec(1);
+
+    my_system sys(0);
+    thrust::partition3(sys,
+                       vec.begin(),
+                       vec.begin(),
+                       0,
+                       0);
+
+    ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestPartition3DispatchExplicit);
+
+
+template<typename ForwardIterator,
+         typename Predicate1,
+         typename Predicate2>
+thrust::pair<ForwardIterator,ForwardIterator>
+  partition3(my_tag,
+             ForwardIterator first,
+             ForwardIterator,
+             Predicate1,
+             Predicate2)
+{
+    *first = 13;
+    return thrust::make_pair(first,first);
+}
+
+void TestPartition3DispatchImplicit()
+{
+    thrust::device_vector<int> vec(1);
+
+    thrust::partition3(thrust::retag<my_tag>(vec.begin()),
+                       thrust::retag<my_tag>(vec.begin()),
+                       0,
+                       0);
+
+    ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestPartition3DispatchImplicit);
+
+
+template<typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+OutputIterator bucket_partition(my_system &system,
+                                ForwardIterator,
+                                ForwardIterator,
+                                BucketFunction,
+                                Size,
+                                OutputIterator offsets)
+{
+    system.validate_dispatch();
+    return offsets;
+}
+
+void TestBucketPartitionDispatchExplicit()
+{
+    thrust::device_vector<int> vec(1);
+
+    my_system sys(0);
+    thrust::bucket_partition(sys,
+                             vec.begin(),
+                             vec.begin(),
+                             0,
+                             0,
+                             vec.begin());
+
+    ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestBucketPartitionDispatchExplicit);
+
+
+template<typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+OutputIterator bucket_partition(my_tag,
+                                ForwardIterator first,
+                                ForwardIterator,
+                                BucketFunction,
+                                Size,
+                                OutputIterator offsets)
+{
+    *first = 13;
+    return offsets;
+}
+
+void TestBucketPartitionDispatchImplicit()
+{
+    thrust::device_vector<int> vec(1);
+
+    thrust::bucket_partition(thrust::retag<my_tag>(vec.begin()),
+                             thrust::retag<my_tag>(vec.begin()),
+                             0,
+                             0,
+                             thrust::retag<my_tag>(vec.begin()));
+
+    ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestBucketPartitionDispatchImplicit);
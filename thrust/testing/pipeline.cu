@@ -0,0 +1,219 @@
+#include <unittest/unittest.h>
+#include <thrust/pipeline.h>
+#include <thrust/copy.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/execution_policy.h>
+
+
+template <typename T>
+struct is_odd_pipeline
+{
+  __host__ __device__
+  bool operator()(const T &x) const
+  {
+    return x % 2 != 0;
+  }
+};
+
+
+template <typename T>
+struct mod_7_pipeline
+{
+  __host__ __device__
+  T operator()(const T &x) const
+  {
+    return static_cast<T>(x % 7);
+  }
+};
+
+
+template <typename T>
+struct not_multiple_of_3_pipeline
+{
+  __host__ __device__
+  bool operator()(const T &x) const
+  {
+    return x % 3 != 0;
+  }
+};
+
+
+template <class Vector>
+void TestPipelineSimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector input(6);
+  input[0] = 1; input[1] = 2; input[2] = 3; input[3] = 4; input[4] = 5; input[5] = 6;
+
+  Vector output(6, T(-1));
+
+  typename Vector::iterator end =
+    thrust::pipeline(input.begin(), input.end())
+    | thrust::pipes::filter(is_odd_pipeline<T>())
+    | thrust::pipes::transform(thrust::square<T>())
+    | thrust::pipes::inclusive_scan()
+    | thrust::pipes::into(output.begin());
+
+  ASSERT_EQUAL(end - output.begin(), 3);
+  ASSERT_EQUAL(output[0], T(1));
+  ASSERT_EQUAL(output[1], T(10));
+  ASSERT_EQUAL(output[2], T(35));
+  ASSERT_EQUAL(output[3], T(-1));
+
+  T sum = thrust::pipeline(input.begin(), input.end())
+        | thrust::pipes::filter(is_odd_pipeline<T>())
+        | thrust::pipes::reduce(T(0));
+
+  ASSERT_EQUAL(sum, T(9));
+
+  end = thrust::pipeline(input.begin(), input.end())
+      | thrust::pipes::exclusive_scan(T(10), thrust::plus<T>())
+      | thrust::pipes::into(output.begin());
+
+  ASSERT_EQUAL(end - output.begin(), 6);
+  ASSERT_EQUAL(output[0], T(10));
+  ASSERT_EQUAL(output[1], T(11));
+  ASSERT_EQUAL(output[5], T(25));
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestPipelineSimple);
+
+
+void TestPipelineEmpty(void)
+{
+  thrust::device_vector<int> input;
+  thrust::device_vector<int> output(1, 13);
+
+  thrust::device_vector<int>::iterator end =
+    thrust::pipeline(input.begin(), input.end())
+    | thrust::pipes::inclusive_scan()
+    | thrust::pipes::into(output.begin());
+
+  ASSERT_EQUAL(true, end == output.begin());
+  ASSERT_EQUAL(13, output[0]);
+
+  int sum = thrust::pipeline(input.begin(), input.end())
+          | thrust::pipes::reduce(7);
+
+  ASSERT_EQUAL(7, sum);
+}
+DECLARE_UNITTEST(TestPipelineEmpty);
+
+
+template <typename T>
+void TestPipelineTransformFilter(const size_t n)
+{
+  thrust::host_vector<T>   h_input = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_input = h_input;
+
+  // transform, then filter, with no scan
+  thrust::host_vector<T> h_mapped(n);
+  thrust::transform(h_input.begin(), h_input.end(), h_mapped.begin(), mod_7_pipeline<T>());
+
+  thrust::host_vector<T> h_expected(n);
+  h_expected.resize(thrust::copy_if(h_mapped.begin(), h_mapped.end(), h_expected.begin(), is_odd_pipeline<T>()) - h_expected.begin());
+
+  thrust::device_vector<T> d_output(n);
+  typename thrust::device_vector<T>::iterator end =
+    thrust::pipeline(d_input.begin(), d_input.end())
+    | thrust::pipes::transform(mod_7_pipeline<T>())
+    | thrust::pipes::filter(is_odd_pipeline<T>())
+    | thrust::pipes::into(d_output.begin());
+
+  d_output.resize(end - d_output.begin());
+  ASSERT_EQUAL(h_expected, d_output);
+
+  // transform only
+  d_output.resize(n);
+  end = thrust::pipeline(d_input.begin(), d_input.end())
+      | thrust::pipes::transform(mod_7_pipeline<T>())
+      | thrust::pipes::into(d_output.begin());
+
+  ASSERT_EQUAL(true, end == d_output.end());
+  ASSERT_EQUAL(h_mapped, d_output);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestPipelineTransformFilter);
+
+
+template <typename T>
+void TestPipelineScans(const size_t n)
+{
+  thrust::host_vector<T>   h_input = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_input = h_input;
+
+  // transform, filter, scan, filter, scan: each intermediate is materialized
+  // for the reference
+  thrust::host_vector<T> h_mapped(n);
+  thrust::transform(h_input.begin(), h_input.end(), h_mapped.begin(), mod_7_pipeline<T>());
+
+  thrust::host_vector<T> h_filtered(n);
+  h_filtered.resize(thrust::copy_if(h_mapped.begin(), h_mapped.end(), h_filtered.begin(), is_odd_pipeline<T>()) - h_filtered.begin());
+
+  thrust::host_vector<T> h_scanned(h_filtered.size());
+  thrust::inclusive_scan(h_filtered.begin(), h_filtered.end(), h_scanned.begin());
+
+  thrust::host_vector<T> h_refiltered(h_scanned.size());
+  h_refiltered.resize(thrust::copy_if(h_scanned.begin(), h_scanned.end(), h_refiltered.begin(), not_multiple_of_3_pipeline<T>()) - h_refiltered.begin());
+
+  thrust::host_vector<T> h_expected(h_refiltered.size());
+  thrust::exclusive_scan(h_refiltered.begin(), h_refiltered.end(), h_expected.begin(), T(5), thrust::maximum<T>());
+
+  thrust::device_vector<T> d_output(n);
+  typename thrust::device_vector<T>::iterator end =
+    thrust::pipeline(d_input.begin(), d_input.end())
+    | thrust::pipes::transform(mod_7_pipeline<T>())
+    | thrust::pipes::filter(is_odd_pipeline<T>())
+    | thrust::pipes::inclusive_scan(thrust::plus<T>())
+    | thrust::pipes::filter(not_multiple_of_3_pipeline<T>())
+    | thrust::pipes::exclusive_scan(T(5), thrust::maximum<T>())
+    | thrust::pipes::into(d_output.begin());
+
+  d_output.resize(end - d_output.begin());
+  ASSERT_EQUAL(h_expected, d_output);
+
+  // the same stages, reduced rather than stored
+  const T h_sum = thrust::reduce(h_expected.begin(), h_expected.end(), T(1), thrust::plus<T>());
+  const T d_sum =
+    thrust::pipeline(d_input.begin(), d_input.end())
+    | thrust::pipes::transform(mod_7_pipeline<T>())
+    | thrust::pipes::filter(is_odd_pipeline<T>())
+    | thrust::pipes::inclusive_scan(thrust::plus<T>())
+    | thrust::pipes::filter(not_multiple_of_3_pipeline<T>())
+    | thrust::pipes::exclusive_scan(T(5), thrust::maximum<T>())
+    | thrust::pipes::reduce(T(1), thrust::plus<T>());
+
+  ASSERT_EQUAL(h_sum, d_sum);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestPipelineScans);
+
+
+void TestPipelineExecutionPolicies(void)
+{
+  const size_t n = 100000;
+
+  thrust::host_vector<int> input = unittest::random_integers<int>(n);
+  thrust::host_vector<int> expected(n);
+  thrust::host_vector<int> output(n);
+
+  int *end = thrust::pipeline(thrust::seq, input.data(), input.data() + n)
+           | thrust::pipes::transform(mod_7_pipeline<int>())
+           | thrust::pipes::filter(is_odd_pipeline<int>())
+           | thrust::pipes::inclusive_scan()
+           | thrust::pipes::into(thrust::raw_pointer_cast(expected.data()));
+
+  expected.resize(end - thrust::raw_pointer_cast(expected.data()));
+
+  end = thrust::pipeline(thrust::host, input.data(), input.data() + n)
+      | thrust::pipes::transform(mod_7_pipeline<int>())
+      | thrust::pipes::filter(is_odd_pipeline<int>())
+      | thrust::pipes::inclusive_scan()
+      | thrust::pipes::into(thrust::raw_pointer_cast(output.data()));
+
+  output.resize(end - thrust::raw_pointer_cast(output.data()));
+
+  ASSERT_EQUAL(expected, output);
+}
+DECLARE_UNITTEST(TestPipelineExecutionPolicies);
@@ -1,6 +1,8 @@
 #include <unittest/unittest.h>
 #include <thrust/random.h>
 #include <thrust/generate.h>
+#include <thrust/transform.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <sstream>
 
 template<typename Engine>
@@ -153,6 +155,7 @@ template<typename Engine>
 template<typename Distribution, typename Engine>
   struct ValidateDistributionMin
 {
+  typedef Distribution distribution_type;
   typedef Engine random_engine;
 
   __host__ __device__
@@ -182,6 +185,7 @@ template<typename Distribution, typename Engine>
 template<typename Distribution, typename Engine>
   struct ValidateDistributionMax
 {
+  typedef Distribution distribution_type;
   typedef Engine random_engine;
 
   __host__ __device__
@@ -739,6 +743,437 @@ void TestRanlux48Unequal(void)
 DECLARE_UNITTEST(TestRanlux48Unequal);
 
 
+void TestPhilox4x32Validation(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineValidation<Engine,1955073260u>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Validation);
+
+
+void TestPhilox4x32Min(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Min);
+
+
+void TestPhilox4x32Max(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Max);
+
+
+void TestPhilox4x32SaveRestore(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32SaveRestore);
+
+
+void TestPhilox4x32Equal(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Equal);
+
+
+void TestPhilox4x32Unequal(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Unequal);
+
+
+void TestPhilox4x64Validation(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineValidation<Engine,3409172418970261260ull>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Validation);
+
+
+void TestPhilox4x64Min(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Min);
+
+
+void TestPhilox4x64Max(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Max);
+
+
+void TestPhilox4x64SaveRestore(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64SaveRestore);
+
+
+void TestPhilox4x64Equal(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Equal);
+
+
+void TestPhilox4x64Unequal(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Unequal);
+
+
+void TestThreefry2x32Validation(void)
+{
+  typedef thrust::random::threefry2x32 Engine;
+
+  TestEngineValidation<Engine,1363243192u>();
+}
+DECLARE_UNITTEST(TestThreefry2x32Validation);
+
+
+void TestThreefry2x32Min(void)
+{
+  typedef thrust::random::threefry2x32 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x32Min);
+
+
+void TestThreefry2x32Max(void)
+{
+  typedef thrust::random::threefry2x32 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x32Max);
+
+
+void TestThreefry2x32SaveRestore(void)
+{
+  typedef thrust::random::threefry2x32 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x32SaveRestore);
+
+
+void TestThreefry2x32Equal(void)
+{
+  typedef thrust::random::threefry2x32 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x32Equal);
+
+
+void TestThreefry2x32Unequal(void)
+{
+  typedef thrust::random::threefry2x32 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x32Unequal);
+
+
+void TestThreefry4x32Validation(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineValidation<Engine,112810865u>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Validation);
+
+
+void TestThreefry4x32Min(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Min);
+
+
+void TestThreefry4x32Max(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Max);
+
+
+void TestThreefry4x32SaveRestore(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32SaveRestore);
+
+
+void TestThreefry4x32Equal(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Equal);
+
+
+void TestThreefry4x32Unequal(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Unequal);
+
+
+void TestThreefry2x64Validation(void)
+{
+  typedef thrust::random::threefry2x64 Engine;
+
+  TestEngineValidation<Engine,10067442004315573443ull>();
+}
+DECLARE_UNITTEST(TestThreefry2x64Validation);
+
+
+void TestThreefry2x64Min(void)
+{
+  typedef thrust::random::threefry2x64 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x64Min);
+
+
+void TestThreefry2x64Max(void)
+{
+  typedef thrust::random::threefry2x64 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x64Max);
+
+
+void TestThreefry2x64SaveRestore(void)
+{
+  typedef thrust::random::threefry2x64 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x64SaveRestore);
+
+
+void TestThreefry2x64Equal(void)
+{
+  typedef thrust::random::threefry2x64 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x64Equal);
+
+
+void TestThreefry2x64Unequal(void)
+{
+  typedef thrust::random::threefry2x64 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry2x64Unequal);
+
+
+void TestThreefry4x64Validation(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineValidation<Engine,9253438642465275567ull>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Validation);
+
+
+void TestThreefry4x64Min(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Min);
+
+
+void TestThreefry4x64Max(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Max);
+
+
+void TestThreefry4x64SaveRestore(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64SaveRestore);
+
+
+void TestThreefry4x64Equal(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Equal);
+
+
+void TestThreefry4x64Unequal(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Unequal);
+
+
+void TestCounterBasedEngineKnownAnswers(void)
+{
+  // Random123's known answers for a zero key and a zero counter
+  thrust::random::philox4x32 philox(0);
+
+  ASSERT_EQUAL(0x6627e8d5u, philox());
+  ASSERT_EQUAL(0xe169c58du, philox());
+  ASSERT_EQUAL(0xbc57ac4cu, philox());
+  ASSERT_EQUAL(0x9b00dbd8u, philox());
+
+  thrust::random::threefry2x32 threefry(0);
+
+  ASSERT_EQUAL(0x6b200159u, threefry());
+  ASSERT_EQUAL(0x99ba4efeu, threefry());
+}
+DECLARE_UNITTEST(TestCounterBasedEngineKnownAnswers);
+
+
+void TestCounterBasedEngineDiscardCarry(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  const Engine::result_type c0[4] = {0xFFFFFFFFu, 0xFFFFFFFFu, 0u, 0u};
+  const Engine::result_type c1[4] = {1u, 0u, 1u, 0u};
+
+  Engine e0, e1;
+  e0.set_counter(c0);
+  e1.set_counter(c1);
+
+  // 2 blocks of 4 results carry into the third word of the counter
+  e0.discard(8);
+
+  ASSERT_EQUAL(true, e0 == e1);
+
+  // discard within and across blocks agrees with invoking the engine
+  Engine e2(13), e3(13);
+
+  for(int i = 0; i < 4097; ++i)
+  {
+    e2();
+  }
+
+  e3.discard(3);
+  e3.discard(4094);
+
+  ASSERT_EQUAL(true, e2 == e3);
+  ASSERT_EQUAL(e2(), e3());
+}
+DECLARE_UNITTEST(TestCounterBasedEngineDiscardCarry);
+
+
+template<typename Engine>
+  struct draw_from_disjoint_sequence
+{
+  __host__ __device__
+  typename Engine::result_type operator()(unsigned long long i) const
+  {
+    Engine e;
+
+    // each element draws the third number of its own sequence of 3
+    e.discard(3 * i + 2);
+
+    return e();
+  }
+};
+
+
+template<typename Engine>
+void TestCounterBasedEngineDisjointSequences(void)
+{
+  typedef typename Engine::result_type T;
+
+  const size_t n = 1000;
+
+  thrust::host_vector<T> h_expected(n);
+
+  Engine e;
+  for(size_t i = 0; i < n; ++i)
+  {
+    e.discard(2);
+    h_expected[i] = e();
+  }
+
+  thrust::device_vector<T> d_result(n);
+  thrust::transform(thrust::counting_iterator<unsigned long long>(0),
+                    thrust::counting_iterator<unsigned long long>(n),
+                    d_result.begin(),
+                    draw_from_disjoint_sequence<Engine>());
+
+  ASSERT_EQUAL(h_expected, d_result);
+}
+
+
+void TestPhilox4x64DisjointSequences(void)
+{
+  TestCounterBasedEngineDisjointSequences<thrust::random::philox4x64>();
+}
+DECLARE_UNITTEST(TestPhilox4x64DisjointSequences);
+
+
+void TestThreefry4x32DisjointSequences(void)
+{
+  TestCounterBasedEngineDisjointSequences<thrust::random::threefry4x32>();
+}
+DECLARE_UNITTEST(TestThreefry4x32DisjointSequences);
+
+
 THRUST_DISABLE_MSVC_WARNING_BEGIN(4305) // truncation warning
 template<typename Distribution, typename Validator>
   void ValidateDistributionCharacteristic(void)
@@ -926,3 +1361,74 @@ void TestNormalDistributionSaveRestore(void)
 }
 DECLARE_UNITTEST(TestNormalDistributionSaveRestore);
 
+
+
+template<typename Validator>
+  void ValidateOneParameterDistributionCharacteristic(const typename Validator::distribution_type &dist)
+{
+  // test host
+  thrust::host_vector<bool> h(1);
+  thrust::generate(h.begin(), h.end(), Validator(dist));
+
+  ASSERT_EQUAL(true, h[0]);
+
+  // test device
+  thrust::device_vector<bool> d(1);
+  thrust::generate(d.begin(), d.end(), Validator(dist));
+
+  ASSERT_EQUAL(true, d[0]);
+}
+
+
+template<typename Distribution>
+  void TestOneParameterDistributionSaveRestore(const Distribution &d0)
+{
+  // save it
+  std::stringstream ss;
+  ss << d0;
+
+  // restore old state
+  Distribution d1;
+  ss >> d1;
+
+  ASSERT_EQUAL(d0, d1);
+}
+
+
+void TestExponentialDistributionMinMax(void)
+{
+  typedef thrust::random::exponential_distribution<float> dist;
+
+  ValidateOneParameterDistributionCharacteristic<ValidateDistributionMin<dist, thrust::minstd_rand> >(dist(0.5f));
+  ValidateOneParameterDistributionCharacteristic<ValidateDistributionMax<dist, thrust::minstd_rand> >(dist(0.5f));
+}
+DECLARE_UNITTEST(TestExponentialDistributionMinMax);
+
+
+void TestExponentialDistributionSaveRestore(void)
+{
+  TestOneParameterDistributionSaveRestore(thrust::random::exponential_distribution<float>(0.5f));
+  TestOneParameterDistributionSaveRestore(thrust::random::exponential_distribution<double>(3));
+}
+DECLARE_UNITTEST(TestExponentialDistributionSaveRestore);
+
+
+void TestPoissonDistributionMinMax(void)
+{
+  typedef thrust::random::poisson_distribution<int> dist;
+
+  // small means are sampled by inversion, large ones by rejection
+  ValidateOneParameterDistributionCharacteristic<ValidateDistributionMin<dist, thrust::minstd_rand> >(dist(4.5));
+  ValidateOneParameterDistributionCharacteristic<ValidateDistributionMin<dist, thrust::minstd_rand> >(dist(100));
+  ValidateOneParameterDistributionCharacteristic<ValidateDistributionMax<dist, thrust::minstd_rand> >(dist(4.5));
+  ValidateOneParameterDistributionCharacteristic<ValidateDistributionMax<dist, thrust::minstd_rand> >(dist(100));
+}
+DECLARE_UNITTEST(TestPoissonDistributionMinMax);
+
+
+void TestPoissonDistributionSaveRestore(void)
+{
+  TestOneParameterDistributionSaveRestore(thrust::random::poisson_distribution<int>(4.5));
+  TestOneParameterDistributionSaveRestore(thrust::random::poisson_distribution<long long>(1000));
+}
+DECLARE_UNITTEST(TestPoissonDistributionSaveRestore);
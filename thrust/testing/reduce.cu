@@ -3,6 +3,9 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/retag.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
 #include <limits>
 
 template<typename T>
@@ -148,6 +151,69 @@ struct TestReduceWithOperator
 VariableUnitTest<TestReduceWithOperator, UnsignedIntegralTypes> TestReduceWithOperatorInstance;
 
 
+template <typename T, typename Operator>
+T reduce_in_order(const thrust::host_vector<T> &data, T init, Operator op)
+{
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        init = op(init, data[i]);
+    }
+
+    return init;
+}
+
+
+template <typename T>
+struct TestReduceVectorizedOperators
+{
+    void operator()(const size_t n)
+    {
+        // the host reductions of arithmetic types with these operators
+        // accumulate into several lanes, which must not change integral results
+        thrust::host_vector<T> data = unittest::random_integers<T>(n);
+
+        T init = 7;
+
+        ASSERT_EQUAL(reduce_in_order(data, init, thrust::plus<T>()),
+                     thrust::reduce(thrust::host, data.begin(), data.end(), init, thrust::plus<T>()));
+        ASSERT_EQUAL(reduce_in_order(data, init, thrust::maximum<T>()),
+                     thrust::reduce(thrust::host, data.begin(), data.end(), init, thrust::maximum<T>()));
+        ASSERT_EQUAL(reduce_in_order(data, init, thrust::minimum<T>()),
+                     thrust::reduce(thrust::host, data.begin(), data.end(), init, thrust::minimum<T>()));
+
+        // a range which is not contiguous
+        ASSERT_EQUAL(reduce_in_order(data, init, thrust::plus<T>()),
+                     thrust::reduce(thrust::host,
+                                    thrust::make_transform_iterator(data.begin(), thrust::identity<T>()),
+                                    thrust::make_transform_iterator(data.end(), thrust::identity<T>()),
+                                    init));
+    }
+};
+VariableUnitTest<TestReduceVectorizedOperators, IntegralTypes> TestReduceVectorizedOperatorsInstance;
+
+
+template <typename T>
+struct TestReduceVectorizedFloatingPoint
+{
+    void operator()(const size_t n)
+    {
+        thrust::host_vector<T> data = unittest::random_samples<T>(n);
+
+        // the sums are reassociated, so they are compared with a more precise one
+        double sum = 0;
+        for(size_t i = 0; i < n; ++i)
+        {
+            sum += data[i];
+        }
+
+        ASSERT_ALMOST_EQUAL(sum, thrust::reduce(thrust::host, data.begin(), data.end(), T(0)));
+        ASSERT_EQUAL(reduce_in_order(data, T(0), thrust::maximum<T>()),
+                     thrust::reduce(thrust::host, data.begin(), data.end(), T(0), thrust::maximum<T>()));
+    }
+};
+VariableUnitTest<TestReduceVectorizedFloatingPoint, FloatingPointTypes> TestReduceVectorizedFloatingPointInstance;
+
+
 template <typename T>
 struct plus_mod3
 {
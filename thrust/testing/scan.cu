@@ -3,6 +3,7 @@
 #include <thrust/detail/config.h>
 
 #include <thrust/scan.h>
+#include <thrust/execution_policy.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/constant_iterator.h>
@@ -246,6 +247,57 @@ void TestExclusiveScan32(void)
 DECLARE_UNITTEST(TestExclusiveScan32);
 
 
+template <typename T>
+struct TestScanVectorizedOperators
+{
+    template <typename Operator>
+    void check(const thrust::host_vector<T> &input, T init, Operator op)
+    {
+        // the host scans of arithmetic types with these operators scan
+        // several elements at once, which must not change integral results
+        const size_t n = input.size();
+
+        thrust::host_vector<T> inclusive(n);
+        thrust::host_vector<T> exclusive(n);
+
+        T sum = init;
+        for(size_t i = 0; i < n; ++i)
+        {
+            exclusive[i] = sum;
+            sum = op(sum, input[i]);
+            inclusive[i] = i == 0 ? input[0] : op(inclusive[i - 1], input[i]);
+        }
+
+        thrust::host_vector<T> output(n);
+
+        thrust::inclusive_scan(thrust::host, input.begin(), input.end(), output.begin(), op);
+        ASSERT_EQUAL(inclusive, output);
+
+        thrust::exclusive_scan(thrust::host, input.begin(), input.end(), output.begin(), init, op);
+        ASSERT_EQUAL(exclusive, output);
+
+        // in-place
+        output = input;
+        thrust::inclusive_scan(thrust::host, output.begin(), output.end(), output.begin(), op);
+        ASSERT_EQUAL(inclusive, output);
+
+        output = input;
+        thrust::exclusive_scan(thrust::host, output.begin(), output.end(), output.begin(), init, op);
+        ASSERT_EQUAL(exclusive, output);
+    }
+
+    void operator()(const size_t n)
+    {
+        thrust::host_vector<T> input = unittest::random_integers<T>(n);
+
+        check(input, T(13), thrust::plus<T>());
+        check(input, T(13), thrust::maximum<T>());
+        check(input, T(13), thrust::minimum<T>());
+    }
+};
+VariableUnitTest<TestScanVectorizedOperators, IntegralTypes> TestScanVectorizedOperatorsInstance;
+
+
 template <class IntVector, class FloatVector>
 void TestScanMixedTypes(void)
 {
@@ -256,6 +256,49 @@ void TestScatterIf(const size_t n)
 DECLARE_VARIABLE_UNITTEST(TestScatterIf);
 
 
+void TestScatterLargeOutput(void)
+{
+    // an output much larger than the caches, and enough elements to partition them
+    const size_t output_size = size_t(1) << 23;
+    const size_t n = (size_t(1) << 20) + 7;
+
+    thrust::host_vector<int> h_input(n);
+    thrust::sequence(h_input.begin(), h_input.end());
+    thrust::device_vector<int> d_input = h_input;
+
+    // distinct destinations spread over the whole output
+    thrust::host_vector<unsigned int> h_map(n);
+
+    for(size_t i = 0; i < n; i++)
+        h_map[i] = static_cast<unsigned int>((i * 2654435761u) % output_size);
+
+    thrust::device_vector<unsigned int> d_map = h_map;
+
+    thrust::host_vector<int>   h_output(output_size, -1);
+    thrust::device_vector<int> d_output(output_size, -1);
+
+    for(size_t i = 0; i < n; i++)
+        h_output[h_map[i]] = h_input[i];
+
+    thrust::scatter(d_input.begin(), d_input.end(), d_map.begin(), d_output.begin());
+
+    ASSERT_EQUAL(h_output, d_output);
+
+    // only scatter the elements with an even destination
+    thrust::fill(h_output.begin(), h_output.end(), -1);
+    thrust::fill(d_output.begin(), d_output.end(), -1);
+
+    for(size_t i = 0; i < n; i++)
+        if(h_map[i] % 2 == 0)
+            h_output[h_map[i]] = h_input[i];
+
+    thrust::scatter_if(d_input.begin(), d_input.end(), d_map.begin(), d_map.begin(), d_output.begin(), is_even_scatter_if<unsigned int>());
+
+    ASSERT_EQUAL(h_output, d_output);
+}
+DECLARE_UNITTEST(TestScatterLargeOutput);
+
+
 template <typename T>
 void TestScatterIfToDiscardIterator(const size_t n)
 {
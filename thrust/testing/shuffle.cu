@@ -373,7 +373,87 @@ void TestHostDeviceIdentical(size_t m) {
 
   ASSERT_EQUAL(device_result, host_result);
 }
+// the OpenMP and TBB backends implement their own parallel shuffle, whose
+// result depends on the number of threads, on either side
+#if (THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CPP) && \
+    THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_CPP
 DECLARE_VARIABLE_UNITTEST(TestHostDeviceIdentical);
+#endif
+
+template <typename T>
+void TestShuffleIsReproducible(size_t m) {
+  thrust::device_vector<T> result1(m);
+  thrust::device_vector<T> result2(m);
+  thrust::sequence(result1.begin(), result1.end(), T{});
+  thrust::sequence(result2.begin(), result2.end(), T{});
+
+  thrust::default_random_engine g1(183);
+  thrust::default_random_engine g2(183);
+
+  thrust::shuffle(result1.begin(), result1.end(), g1);
+  thrust::shuffle(result2.begin(), result2.end(), g2);
+
+  ASSERT_EQUAL(result1, result2);
+}
+DECLARE_VARIABLE_UNITTEST(TestShuffleIsReproducible);
+
+void TestShuffleLarge() {
+  // large enough to be split into several tiles by the parallel host backends
+  const size_t n = (size_t(1) << 17) + 3;
+
+  thrust::device_vector<unsigned int> data(n);
+  thrust::sequence(data.begin(), data.end());
+
+  thrust::device_vector<unsigned int> shuffled(data);
+  thrust::default_random_engine g(7);
+  thrust::shuffle(shuffled.begin(), shuffled.end(), g);
+
+  // the first elements are very unlikely to stay in place
+  ASSERT_EQUAL(false, thrust::equal(shuffled.begin(), shuffled.begin() + 64, data.begin()));
+
+  thrust::sort(shuffled.begin(), shuffled.end());
+  ASSERT_EQUAL(shuffled, data);
+
+  thrust::device_vector<unsigned int> copied(n);
+  g.seed(7);
+  thrust::shuffle_copy(data.begin(), data.end(), copied.begin(), g);
+  g.seed(7);
+  thrust::shuffle(data.begin(), data.end(), g);
+  ASSERT_EQUAL(copied, data);
+}
+DECLARE_UNITTEST(TestShuffleLarge);
+
+void TestShuffleLargeEvenDistribution() {
+  // large enough that the parallel host backends split the merges of tiles
+  const uint64_t n = (uint64_t(1) << 17) + 3;
+  const uint64_t num_buckets = 16;
+  const uint64_t num_samples = 20;
+
+  thrust::default_random_engine g(0x5EED);
+  std::vector<uint64_t> counts(num_buckets * num_buckets, 0);
+  thrust::device_vector<unsigned int> sequence(n);
+
+  for (uint64_t i = 0; i < num_samples; i++) {
+    thrust::sequence(sequence.begin(), sequence.end());
+    thrust::shuffle(sequence.begin(), sequence.end(), g);
+    thrust::host_vector<unsigned int> tmp(sequence);
+    for (uint64_t j = 0; j < n; j++) {
+      counts[(j * num_buckets / n) * num_buckets + tmp[j] * num_buckets / n]++;
+    }
+  }
+
+  // the bucket of the position against the bucket of the original position
+  const double expected_occurances = (double)(num_samples * n) / (num_buckets * num_buckets);
+  double chi_squared = 0.0;
+  for (auto count : counts) {
+    chi_squared += pow((double)count - expected_occurances, 2) / expected_occurances;
+  }
+
+  const double dof = (double)((num_buckets - 1) * (num_buckets - 1));
+  double p_score = CephesFunctions::cephes_igamc(dof / 2.0, chi_squared / 2.0);
+  ASSERT_GREATER(p_score, 0.001);
+}
+DECLARE_UNITTEST(TestShuffleLargeEvenDistribution);
 
 template <typename T>
 void TestFunctionIsBijection(size_t m) {
@@ -0,0 +1,288 @@
+#define THRUST_TRACE
+
+#include <unittest/unittest.h>
+#include <thrust/trace.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/functional.h>
+#include <thrust/execution_policy.h>
+#include <thrust/detail/temporary_array.h>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+struct recorded_events
+{
+  std::vector<thrust::trace::event> events;
+
+  static void record(const thrust::trace::event &e, void *self)
+  {
+    static_cast<recorded_events*>(self)->events.push_back(e);
+  }
+};
+
+
+// installs a recorded_events as the callback for as long as it is alive
+class scoped_recording
+{
+  public:
+    // the previous callback is saved and restored along with its user data,
+    // so that recordings nest
+    scoped_recording()
+      : m_previous(thrust::trace::detail::exchange_binding(
+          thrust::trace::detail::callback_binding{&recorded_events::record, &m_recorded}))
+    {}
+
+    ~scoped_recording()
+    {
+      thrust::trace::detail::exchange_binding(m_previous);
+    }
+
+    const std::vector<thrust::trace::event> &events() const
+    {
+      return m_recorded.events;
+    }
+
+  private:
+    recorded_events                         m_recorded;
+    thrust::trace::detail::callback_binding m_previous;
+};
+
+
+const char *expected_device_backend()
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+  return "cuda";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  return "omp";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  return "tbb";
+#else
+  return "cpp";
+#endif
+}
+
+
+void TestTraceAlgorithmEvents()
+{
+  thrust::device_vector<int> v(1000);
+  thrust::sequence(v.begin(), v.end());
+
+  scoped_recording recording;
+
+  int result = thrust::transform_reduce(v.begin(), v.end(), thrust::negate<int>(), 0, thrust::plus<int>());
+  ASSERT_EQUAL(-499500, result);
+
+  const std::vector<thrust::trace::event> &events = recording.events();
+
+  ASSERT_EQUAL(true, events.size() >= 2);
+
+  const thrust::trace::event &first = events.front();
+  const thrust::trace::event &last  = events.back();
+
+  ASSERT_EQUAL(true, first.kind == thrust::trace::event_kind::algorithm_begin);
+  ASSERT_EQUAL(true, last.kind == thrust::trace::event_kind::algorithm_end);
+  ASSERT_EQUAL(std::string("transform_reduce"), first.algorithm);
+  ASSERT_EQUAL(std::string("transform_reduce"), last.algorithm);
+  ASSERT_EQUAL(std::string(expected_device_backend()), first.backend);
+  ASSERT_EQUAL(1000, first.n);
+  ASSERT_EQUAL(0u, first.depth);
+  ASSERT_EQUAL(0u, last.depth);
+  ASSERT_EQUAL(true, last.time >= first.time);
+  ASSERT_EQUAL(true, last.duration == last.time - first.time);
+
+  // every begin is matched by an end, and the algorithms in between are nested
+  std::vector<const char *> stack;
+  for(size_t i = 0; i < events.size(); ++i)
+  {
+    const thrust::trace::event &e = events[i];
+
+    if(e.kind == thrust::trace::event_kind::algorithm_begin)
+    {
+      ASSERT_EQUAL(stack.size(), e.depth);
+      stack.push_back(e.algorithm);
+    }
+    else if(e.kind == thrust::trace::event_kind::algorithm_end)
+    {
+      ASSERT_EQUAL(false, stack.empty());
+      ASSERT_EQUAL(std::string(stack.back()), std::string(e.algorithm));
+      stack.pop_back();
+      ASSERT_EQUAL(stack.size(), e.depth);
+    }
+  }
+  ASSERT_EQUAL(true, stack.empty());
+}
+DECLARE_UNITTEST(TestTraceAlgorithmEvents);
+
+
+void TestTraceBackendNames()
+{
+  std::vector<int> v(10, 1);
+
+  scoped_recording recording;
+
+  thrust::reduce(thrust::host, v.begin(), v.end());
+  thrust::reduce(thrust::seq, v.begin(), v.end());
+
+  const std::vector<thrust::trace::event> &events = recording.events();
+
+  std::vector<std::string> outer_backends;
+  for(size_t i = 0; i < events.size(); ++i)
+  {
+    if(events[i].kind == thrust::trace::event_kind::algorithm_begin && events[i].depth == 0)
+    {
+      outer_backends.push_back(events[i].backend);
+    }
+  }
+
+  ASSERT_EQUAL(2u, outer_backends.size());
+  ASSERT_EQUAL(std::string("cpp"), outer_backends[0]);
+  ASSERT_EQUAL(std::string("seq"), outer_backends[1]);
+}
+DECLARE_UNITTEST(TestTraceBackendNames);
+
+
+void TestTraceTemporaryStorage()
+{
+  typedef thrust::device_system_tag System;
+  System system;
+
+  scoped_recording recording;
+
+  {
+    thrust::detail::temporary_array<int, System> temp(system, 100);
+  }
+
+  size_t allocations = 0, deallocations = 0;
+
+  const std::vector<thrust::trace::event> &events = recording.events();
+  for(size_t i = 0; i < events.size(); ++i)
+  {
+    const thrust::trace::event &e = events[i];
+
+    if(e.kind == thrust::trace::event_kind::temporary_allocation)
+    {
+      ++allocations;
+      ASSERT_EQUAL(100 * sizeof(int), e.bytes);
+      ASSERT_EQUAL(std::string(expected_device_backend()), e.backend);
+    }
+    else if(e.kind == thrust::trace::event_kind::temporary_deallocation)
+    {
+      ++deallocations;
+      ASSERT_EQUAL(100 * sizeof(int), e.bytes);
+    }
+  }
+
+  ASSERT_EQUAL(1u, allocations);
+  ASSERT_EQUAL(1u, deallocations);
+}
+DECLARE_UNITTEST(TestTraceTemporaryStorage);
+
+
+void TestTraceDisabled()
+{
+  ASSERT_EQUAL(true, thrust::trace::get_callback() == nullptr);
+
+  {
+    scoped_recording recording;
+    ASSERT_EQUAL(true, thrust::trace::get_callback() != nullptr);
+  }
+
+  ASSERT_EQUAL(true, thrust::trace::get_callback() == nullptr);
+
+  // nothing is recorded, and nothing breaks, without a callback
+  thrust::device_vector<int> v(10, 1);
+  ASSERT_EQUAL(10, thrust::reduce(v.begin(), v.end()));
+}
+DECLARE_UNITTEST(TestTraceDisabled);
+
+
+void TestTraceChromeTraceRecorder()
+{
+  thrust::device_vector<int> v(100, 1);
+
+  std::ostringstream trace;
+  {
+    thrust::trace::chrome_trace_recorder recorder;
+
+    thrust::reduce(v.begin(), v.end());
+
+    ASSERT_EQUAL(true, recorder.size() >= 2);
+
+    recorder.write(trace);
+  }
+
+  ASSERT_EQUAL(true, thrust::trace::get_callback() == nullptr);
+
+  const std::string json = trace.str();
+
+  ASSERT_EQUAL(0u, json.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+  ASSERT_EQUAL(true, json.find("\"name\":\"reduce\"") != std::string::npos);
+  ASSERT_EQUAL(true, json.find("\"ph\":\"X\"") != std::string::npos);
+  ASSERT_EQUAL(true, json.find("\"n\":100") != std::string::npos);
+}
+DECLARE_UNITTEST(TestTraceChromeTraceRecorder);
+
+
+void TestTraceChromeTraceRecorderRestoresUserData()
+{
+  thrust::device_vector<int> v(100, 1);
+
+  scoped_recording outer;
+  void *outer_user_data = thrust::trace::get_user_data();
+
+  {
+    thrust::trace::chrome_trace_recorder recorder;
+
+    ASSERT_EQUAL(true, thrust::trace::get_user_data() == &recorder);
+  }
+
+  // the outer callback is reinstalled along with its own user data
+  ASSERT_EQUAL(true, thrust::trace::get_callback() == &recorded_events::record);
+  ASSERT_EQUAL(true, thrust::trace::get_user_data() == outer_user_data);
+
+  thrust::reduce(v.begin(), v.end());
+
+  ASSERT_EQUAL(false, outer.events().empty());
+}
+DECLARE_UNITTEST(TestTraceChromeTraceRecorderRestoresUserData);
+
+
+void TestTraceNestedRecording()
+{
+  thrust::device_vector<int> v(100, 1);
+
+  scoped_recording outer;
+  void *outer_user_data = thrust::trace::get_user_data();
+
+  {
+    scoped_recording inner;
+
+    thrust::reduce(v.begin(), v.end());
+
+    ASSERT_EQUAL(false, inner.events().empty());
+  }
+
+  ASSERT_EQUAL(true, outer.events().empty());
+  ASSERT_EQUAL(true, thrust::trace::get_user_data() == outer_user_data);
+
+  // events reach the outer recording again once the inner one is gone
+  thrust::reduce(v.begin(), v.end());
+
+  ASSERT_EQUAL(false, outer.events().empty());
+}
+DECLARE_UNITTEST(TestTraceNestedRecording);
+
+
+void TestTraceNamespace()
+{
+  // the traced build of Thrust lives in its own inline namespace, so that its
+  // definitions are never merged with those of the plain build
+  ASSERT_EQUAL(true, (std::is_same<thrust::device_vector<int>, thrust::traced::device_vector<int>>::value));
+}
+DECLARE_UNITTEST(TestTraceNamespace);
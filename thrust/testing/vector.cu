@@ -639,6 +639,93 @@ void TestVectorResizing(void)
 DECLARE_VECTOR_UNITTEST(TestVectorResizing);
 
 
+template <class Vector>
+void TestVectorDefaultInit(void)
+{
+    typedef typename Vector::value_type T;
+
+    Vector v(3, thrust::default_init);
+
+    ASSERT_EQUAL(v.size(), 3lu);
+
+    thrust::sequence(v.begin(), v.end());
+
+    // grow within the current capacity
+    v.reserve(10);
+    v.resize(5, thrust::default_init);
+
+    ASSERT_EQUAL(v.size(), 5lu);
+    ASSERT_EQUAL(v[0], T(0));
+    ASSERT_EQUAL(v[1], T(1));
+    ASSERT_EQUAL(v[2], T(2));
+
+    // grow beyond the current capacity
+    v.resize(100, thrust::default_init);
+
+    ASSERT_EQUAL(v.size(), 100lu);
+    ASSERT_EQUAL(v[0], T(0));
+    ASSERT_EQUAL(v[1], T(1));
+    ASSERT_EQUAL(v[2], T(2));
+
+    v.resize(2, thrust::default_init);
+
+    ASSERT_EQUAL(v.size(), 2lu);
+    ASSERT_EQUAL(v[1], T(1));
+
+    Vector empty(0, thrust::default_init);
+
+    ASSERT_EQUAL(empty.size(), 0lu);
+}
+DECLARE_VECTOR_UNITTEST(TestVectorDefaultInit);
+
+
+template <class Vector>
+void TestVectorNoInitSimple(void)
+{
+    Vector v(4, thrust::no_init);
+
+    ASSERT_EQUAL(v.size(), 4lu);
+
+    thrust::sequence(v.begin(), v.end());
+
+    v.resize(1000, thrust::no_init);
+
+    ASSERT_EQUAL(v.size(), 1000lu);
+    ASSERT_EQUAL(v[0], 0);
+    ASSERT_EQUAL(v[3], 3);
+}
+
+void TestVectorNoInit(void)
+{
+    TestVectorNoInitSimple< thrust::host_vector<int> >();
+    TestVectorNoInitSimple< thrust::device_vector<int> >();
+}
+DECLARE_UNITTEST(TestVectorNoInit);
+
+
+struct default_init_sentinel
+{
+  int value;
+
+  __host__ __device__
+  default_init_sentinel() : value(13) {}
+};
+
+void TestVectorDefaultInitNontrivialType(void)
+{
+    // default initialization still runs constructors which do something
+    thrust::host_vector<default_init_sentinel> v(3, thrust::default_init);
+
+    ASSERT_EQUAL(v[0].value, 13);
+    ASSERT_EQUAL(v[2].value, 13);
+
+    v.resize(50, thrust::default_init);
+
+    ASSERT_EQUAL(v[49].value, 13);
+}
+DECLARE_UNITTEST(TestVectorDefaultInitNontrivialType);
+
+
 
 template <class Vector>
 void TestVectorReserving(void)
@@ -0,0 +1,165 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file batched_copy.h
+ *  \brief Copies many variable-sized buffers at once
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup algorithms
+ */
+
+/*! \addtogroup copying
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p batched_copy copies \p num_buffers buffers at once. For each \c i in
+ *  <tt>[0, num_buffers)</tt>, the range <tt>[src_ptrs[i], src_ptrs[i] + sizes[i])</tt>
+ *  is copied to the range <tt>[dst_ptrs[i], dst_ptrs[i] + sizes[i])</tt>.
+ *
+ *  This is equivalent to calling \p copy_n once per buffer, but the whole batch is
+ *  dispatched once, and the parallel backends balance the work by the number of
+ *  elements rather than by the number of buffers, so that a few large buffers and
+ *  many small ones are spread evenly over threads.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param src_ptrs The beginning of the sequence of source buffers.
+ *  \param dst_ptrs The beginning of the sequence of destination buffers.
+ *  \param sizes The beginning of the sequence of buffer sizes, in elements.
+ *  \param num_buffers The number of buffers to copy.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is a mutable <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre Each destination buffer shall not overlap any source buffer or any other destination buffer.
+ *
+ *  \note The parallel backends index \p src_ptrs, \p dst_ptrs and \p sizes in no particular
+ *        order, so all three must be random access iterators.
+ *
+ *  The following code snippet demonstrates how to use \p batched_copy to copy three
+ *  buffers using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/batched_copy.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int a[2] = {0, 1};
+ *  int b[3] = {2, 3, 4};
+ *  int c[1] = {5};
+ *  int x[2], y[3], z[1];
+ *
+ *  int *src_ptrs[3] = {a, b, c};
+ *  int *dst_ptrs[3] = {x, y, z};
+ *  int sizes[3] = {2, 3, 1};
+ *
+ *  thrust::batched_copy(thrust::host, src_ptrs, dst_ptrs, sizes, 3);
+ *
+ *  // x is now {0, 1}
+ *  // y is now {2, 3, 4}
+ *  // z is now {5}
+ *  \endcode
+ *
+ *  \see \p copy_n
+ *  \see https://nvidia.github.io/cccl/cub/api/structcub_1_1DeviceMemcpy.html
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3, typename Size>
+_CCCL_HOST_DEVICE
+  void batched_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    RandomAccessIterator1 src_ptrs,
+                    RandomAccessIterator2 dst_ptrs,
+                    RandomAccessIterator3 sizes,
+                    Size num_buffers);
+
+
+/*! \p batched_copy copies \p num_buffers buffers at once. For each \c i in
+ *  <tt>[0, num_buffers)</tt>, the range <tt>[src_ptrs[i], src_ptrs[i] + sizes[i])</tt>
+ *  is copied to the range <tt>[dst_ptrs[i], dst_ptrs[i] + sizes[i])</tt>.
+ *
+ *  \param src_ptrs The beginning of the sequence of source buffers.
+ *  \param dst_ptrs The beginning of the sequence of destination buffers.
+ *  \param sizes The beginning of the sequence of buffer sizes, in elements.
+ *  \param num_buffers The number of buffers to copy.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is a mutable <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre Each destination buffer shall not overlap any source buffer or any other destination buffer.
+ *
+ *  The following code snippet demonstrates how to use \p batched_copy to copy three buffers.
+ *
+ *  \code
+ *  #include <thrust/batched_copy.h>
+ *  ...
+ *  int a[2] = {0, 1};
+ *  int b[3] = {2, 3, 4};
+ *  int c[1] = {5};
+ *  int x[2], y[3], z[1];
+ *
+ *  int *src_ptrs[3] = {a, b, c};
+ *  int *dst_ptrs[3] = {x, y, z};
+ *  int sizes[3] = {2, 3, 1};
+ *
+ *  thrust::batched_copy(src_ptrs, dst_ptrs, sizes, 3);
+ *
+ *  // x is now {0, 1}
+ *  // y is now {2, 3, 4}
+ *  // z is now {5}
+ *  \endcode
+ *
+ *  \see \p copy_n
+ */
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3, typename Size>
+  void batched_copy(RandomAccessIterator1 src_ptrs,
+                    RandomAccessIterator2 dst_ptrs,
+                    RandomAccessIterator3 sizes,
+                    Size num_buffers);
+
+
+/*! \} // end copying
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/batched_copy.inl>
@@ -28,6 +28,7 @@
 #include <thrust/detail/allocator/temporary_allocator.h>
 #include <thrust/detail/temporary_buffer.h>
 #include <thrust/system/detail/bad_alloc.h>
+#include <thrust/detail/trace.h>
 #include <cassert>
 
 #include <nv/target>
@@ -51,6 +52,9 @@ _CCCL_HOST_DEVICE
 {
   pointer_and_size result = thrust::get_temporary_buffer<T>(system(), cnt);
 
+  // reported even on failure, to pair with the deallocation below
+  THRUST_TRACE_TEMPORARY_ALLOCATION(system(), cnt * sizeof(T));
+
   // handle failure
   if(result.second < cnt)
   {
@@ -78,6 +82,8 @@ _CCCL_HOST_DEVICE
   void temporary_allocator<T,System>
     ::deallocate(typename temporary_allocator<T,System>::pointer p, typename temporary_allocator<T,System>::size_type n)
 {
+  THRUST_TRACE_TEMPORARY_DEALLOCATION(system(), n * sizeof(T));
+
   return thrust::return_temporary_buffer(system(), p, n);
 } // end temporary_allocator
 
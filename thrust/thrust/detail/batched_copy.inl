@@ -0,0 +1,73 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/batched_copy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/batched_copy.h>
+#include <thrust/system/detail/adl/batched_copy.h>
+#include <thrust/detail/trace.h>
+
+THRUST_NAMESPACE_BEGIN
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3, typename Size>
+_CCCL_HOST_DEVICE
+  void batched_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    RandomAccessIterator1 src_ptrs,
+                    RandomAccessIterator2 dst_ptrs,
+                    RandomAccessIterator3 sizes,
+                    Size num_buffers)
+{
+  THRUST_TRACE_ALGORITHM(exec, "batched_copy", num_buffers);
+  using thrust::system::detail::generic::batched_copy;
+  return batched_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), src_ptrs, dst_ptrs, sizes, num_buffers);
+} // end batched_copy()
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3, typename Size>
+  void batched_copy(RandomAccessIterator1 src_ptrs,
+                    RandomAccessIterator2 dst_ptrs,
+                    RandomAccessIterator3 sizes,
+                    Size num_buffers)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System2;
+  typedef typename thrust::iterator_system<RandomAccessIterator3>::type System3;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::batched_copy(select_system(system1, system2, system3), src_ptrs, dst_ptrs, sizes, num_buffers);
+} // end batched_copy()
+
+
+THRUST_NAMESPACE_END
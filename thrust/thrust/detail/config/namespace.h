@@ -175,6 +175,18 @@
 #endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 // clang-format on
 
+// Translation units which define THRUST_TRACE instrument Thrust's algorithms,
+// so the definitions of the same templates differ from those of translation
+// units which don't. The traced build lives in a distinct inline namespace, so
+// that the linker never merges the two.
+#if defined(THRUST_TRACE)
+#  define THRUST_DETAIL_TRACE_NS_BEGIN inline namespace traced {
+#  define THRUST_DETAIL_TRACE_NS_END }
+#else // !defined(THRUST_TRACE)
+#  define THRUST_DETAIL_TRACE_NS_BEGIN
+#  define THRUST_DETAIL_TRACE_NS_END
+#endif // !defined(THRUST_TRACE)
+
 /**
  * \def THRUST_NAMESPACE_BEGIN
  * This macro is used to open a `thrust::` namespace block, along with any
@@ -185,7 +197,8 @@
   THRUST_NS_PREFIX                                                             \
   namespace thrust                                                             \
   {                                                                            \
-  THRUST_DETAIL_ABI_NS_BEGIN
+  THRUST_DETAIL_ABI_NS_BEGIN                                                   \
+  THRUST_DETAIL_TRACE_NS_BEGIN
 
 /**
  * \def THRUST_NAMESPACE_END
@@ -194,6 +207,7 @@
  * This macro is defined by Thrust and may not be overridden.
  */
 #define THRUST_NAMESPACE_END                                                   \
+  THRUST_DETAIL_TRACE_NS_END                                                   \
   THRUST_DETAIL_ABI_NS_END                                                     \
   } /* end namespace thrust */                                                 \
   THRUST_NS_POSTFIX
@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/count.h>
 #include <thrust/system/detail/adl/count.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -39,6 +40,7 @@ _CCCL_HOST_DEVICE
   typename thrust::iterator_traits<InputIterator>::difference_type
     count(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, InputIterator first, InputIterator last, const EqualityComparable& value)
 {
+  THRUST_TRACE_ALGORITHM(exec, "count", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::count;
   return count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end count()
@@ -50,6 +52,7 @@ _CCCL_HOST_DEVICE
   typename thrust::iterator_traits<InputIterator>::difference_type
     count_if(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, InputIterator first, InputIterator last, Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "count_if", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::count_if;
   return count_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end count_if()
@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/deterministic.h>
+#include <thrust/detail/execute_with_allocator.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/system/detail/deterministic/reduce.h>
+#include <thrust/system/detail/deterministic/reduce_by_key.h>
+#include <thrust/system/detail/deterministic/scan.h>
+
+THRUST_NAMESPACE_BEGIN
+
+
+template<template<typename> class BaseSystem, typename Summation>
+  thrust::system::detail::deterministic::execution_policy<BaseSystem, Summation>
+    deterministic(const thrust::detail::allocator_aware_execution_policy<BaseSystem> &,
+                  Summation)
+{
+  THRUST_STATIC_ASSERT_MSG(
+    thrust::system::detail::deterministic::is_supported_system<BaseSystem>::value,
+    "thrust::deterministic only supports the policies of the sequential, CPP, OpenMP and TBB systems"
+  );
+
+  return thrust::system::detail::deterministic::execution_policy<BaseSystem, Summation>();
+}
+
+
+template<template<typename> class BaseSystem>
+  thrust::system::detail::deterministic::execution_policy<BaseSystem>
+    deterministic(const thrust::detail::allocator_aware_execution_policy<BaseSystem> &exec)
+{
+  return thrust::deterministic(exec, thrust::ordered_summation);
+}
+
+
+template<typename Allocator, template<typename> class BaseSystem, typename Summation>
+  thrust::system::detail::deterministic::execution_policy<BaseSystem, Summation, Allocator>
+    deterministic(thrust::detail::execute_with_allocator<Allocator, BaseSystem> exec,
+                  Summation)
+{
+  THRUST_STATIC_ASSERT_MSG(
+    thrust::system::detail::deterministic::is_supported_system<BaseSystem>::value,
+    "thrust::deterministic only supports the policies of the sequential, CPP, OpenMP and TBB systems"
+  );
+
+  return thrust::system::detail::deterministic::execution_policy<BaseSystem, Summation, Allocator>(exec.get_allocator());
+}
+
+
+template<typename Allocator, template<typename> class BaseSystem>
+  thrust::system::detail::deterministic::execution_policy<BaseSystem, thrust::system::detail::deterministic::ordered_summation_t, Allocator>
+    deterministic(thrust::detail::execute_with_allocator<Allocator, BaseSystem> exec)
+{
+  return thrust::deterministic(exec, thrust::ordered_summation);
+}
+
+
+THRUST_NAMESPACE_END
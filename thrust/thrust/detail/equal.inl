@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/equal.h>
 #include <thrust/system/detail/adl/equal.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -38,6 +39,7 @@ template<typename System, typename InputIterator1, typename InputIterator2>
 _CCCL_HOST_DEVICE
 bool equal(const thrust::detail::execution_policy_base<System> &system, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
 {
+  THRUST_TRACE_ALGORITHM(system, "equal", THRUST_TRACE_EXTENT(first1, last1));
   using thrust::system::detail::generic::equal;
   return equal(thrust::detail::derived_cast(thrust::detail::strip_const(system)), first1, last1, first2);
 } // end equal()
@@ -48,6 +50,7 @@ template<typename System, typename InputIterator1, typename InputIterator2, type
 _CCCL_HOST_DEVICE
 bool equal(const thrust::detail::execution_policy_base<System> &system, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM(system, "equal", THRUST_TRACE_EXTENT(first1, last1));
   using thrust::system::detail::generic::equal;
   return equal(thrust::detail::derived_cast(thrust::detail::strip_const(system)), first1, last1, first2, binary_pred);
 } // end equal()
@@ -31,6 +31,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/fill.h>
 #include <thrust/system/detail/adl/fill.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE
             ForwardIterator last,
             const T &value)
 {
+  THRUST_TRACE_ALGORITHM(exec, "fill", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::fill;
   return fill(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end fill()
@@ -55,6 +57,7 @@ _CCCL_HOST_DEVICE
                         Size n,
                         const T &value)
 {
+  THRUST_TRACE_ALGORITHM(exec, "fill_n", n);
   using thrust::system::detail::generic::fill_n;
   return fill_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, value);
 } // end fill_n()
@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/for_each.h>
 #include <thrust/system/detail/adl/for_each.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE
                          InputIterator last,
                          UnaryFunction f)
 {
+  THRUST_TRACE_ALGORITHM(exec, "for_each", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::for_each;
 
   return for_each(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, f);
@@ -70,6 +72,7 @@ _CCCL_HOST_DEVICE
                            Size n,
                            UnaryFunction f)
 {
+  THRUST_TRACE_ALGORITHM(exec, "for_each_n", n);
   using thrust::system::detail::generic::for_each_n;
 
   return for_each_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, f);
@@ -31,6 +31,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/gather.h>
 #include <thrust/system/detail/adl/gather.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -46,6 +47,7 @@ _CCCL_HOST_DEVICE
                         RandomAccessIterator                                        input_first,
                         OutputIterator                                              result)
 {
+  THRUST_TRACE_ALGORITHM(exec, "gather", THRUST_TRACE_EXTENT(map_first, map_last));
   using thrust::system::detail::generic::gather;
   return gather(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, input_first, result);
 } // end gather()
@@ -65,6 +67,7 @@ _CCCL_HOST_DEVICE
                            RandomAccessIterator                                        input_first,
                            OutputIterator                                              result)
 {
+  THRUST_TRACE_ALGORITHM(exec, "gather_if", THRUST_TRACE_EXTENT(map_first, map_last));
   using thrust::system::detail::generic::gather_if;
   return gather_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, stencil, input_first, result);
 } // end gather_if()
@@ -86,6 +89,7 @@ _CCCL_HOST_DEVICE
                            OutputIterator                                              result,
                            Predicate                                                   pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "gather_if", THRUST_TRACE_EXTENT(map_first, map_last));
   using thrust::system::detail::generic::gather_if;
   return gather_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, stencil, input_first, result, pred);
 } // end gather_if()
@@ -31,6 +31,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/generate.h>
 #include <thrust/system/detail/adl/generate.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -44,6 +45,7 @@ _CCCL_HOST_DEVICE
                 ForwardIterator last,
                 Generator gen)
 {
+  THRUST_TRACE_ALGORITHM(exec, "generate", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::generate;
   return generate(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, gen);
 } // end generate()
@@ -60,6 +62,7 @@ _CCCL_HOST_DEVICE
                             Size n,
                             Generator gen)
 {
+  THRUST_TRACE_ALGORITHM(exec, "generate_n", n);
   using thrust::system::detail::generic::generate_n;
   return generate_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, gen);
 } // end generate_n()
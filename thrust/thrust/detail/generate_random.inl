@@ -0,0 +1,70 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/generate_random.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/generate_random.h>
+#include <thrust/system/detail/adl/generate_random.h>
+#include <thrust/detail/trace.h>
+
+THRUST_NAMESPACE_BEGIN
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy, typename ForwardIterator, typename Distribution>
+_CCCL_HOST_DEVICE
+  void generate_random(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                       ForwardIterator first,
+                       ForwardIterator last,
+                       unsigned long long seed,
+                       const Distribution &dist)
+{
+  THRUST_TRACE_ALGORITHM(exec, "generate_random", THRUST_TRACE_EXTENT(first, last));
+  using thrust::system::detail::generic::generate_random;
+  return generate_random(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, seed, dist);
+} // end generate_random()
+
+
+template<typename ForwardIterator, typename Distribution>
+  void generate_random(ForwardIterator first,
+                       ForwardIterator last,
+                       unsigned long long seed,
+                       const Distribution &dist)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<ForwardIterator>::type System;
+
+  System system;
+
+  return thrust::generate_random(select_system(system), first, last, seed, dist);
+} // end generate_random()
+
+
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,85 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file init_tags.h
+ *  \brief Tags which select how the elements of a new vector are initialized
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup container_classes
+ *  \{
+ */
+
+/*! \p default_init_t is the type of \p default_init.
+ */
+struct default_init_t
+{
+  explicit default_init_t() = default;
+};
+
+/*! \p default_init requests that the new elements of a vector be default-initialized
+ *  rather than value-initialized: elements of a trivially default-constructible type,
+ *  such as \c int, are left uninitialized, and other elements are default-constructed.
+ *
+ *  This saves a pass over memory when the elements are about to be overwritten, e.g.
+ *  by the output of an algorithm.
+ *
+ *  \code
+ *  #include <thrust/host_vector.h>
+ *  #include <thrust/sequence.h>
+ *  ...
+ *  // no write to v's memory before sequence
+ *  thrust::host_vector<int> v(1 << 30, thrust::default_init);
+ *  thrust::sequence(v.begin(), v.end());
+ *  \endcode
+ *
+ *  \see no_init
+ */
+THRUST_INLINE_CONSTANT default_init_t default_init{};
+
+/*! \p no_init_t is the type of \p no_init.
+ */
+struct no_init_t
+{
+  explicit no_init_t() = default;
+};
+
+/*! \p no_init requests that the new elements of a vector be left uninitialized. Unlike
+ *  \p default_init, it is only accepted for trivially default-constructible types, so
+ *  that it never silently skips a constructor.
+ *
+ *  \see default_init
+ */
+THRUST_INLINE_CONSTANT no_init_t no_init{};
+
+/*! \} // end container_classes
+ */
+
+THRUST_NAMESPACE_END
+
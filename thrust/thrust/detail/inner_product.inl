@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/inner_product.h>
 #include <thrust/system/detail/adl/inner_product.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -45,6 +46,7 @@ OutputType inner_product(const thrust::detail::execution_policy_base<DerivedPoli
                          InputIterator2 first2,
                          OutputType init)
 {
+  THRUST_TRACE_ALGORITHM(exec, "inner_product", THRUST_TRACE_EXTENT(first1, last1));
   using thrust::system::detail::generic::inner_product;
   return inner_product(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, init);
 } // end inner_product()
@@ -66,6 +68,7 @@ OutputType inner_product(const thrust::detail::execution_policy_base<DerivedPoli
                          BinaryFunction1 binary_op1,
                          BinaryFunction2 binary_op2)
 {
+  THRUST_TRACE_ALGORITHM(exec, "inner_product", THRUST_TRACE_EXTENT(first1, last1));
   using thrust::system::detail::generic::inner_product;
   return inner_product(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, init, binary_op1, binary_op2);
 } // end inner_product()
@@ -115,6 +115,26 @@ struct predicate_to_integral
 };
 
 
+// map an element to the group it belongs to in partition3:
+// 0 if it satisfies pred1, 1 if it satisfies pred2 only, and 2 otherwise
+template<typename Predicate1, typename Predicate2, typename IntegralType>
+struct partition3_bucket
+{
+  Predicate1 pred1;
+  Predicate2 pred2;
+
+  _CCCL_HOST_DEVICE
+  partition3_bucket(const Predicate1& pred1, const Predicate2& pred2) : pred1(pred1), pred2(pred2) {}
+
+  template <typename T>
+  _CCCL_HOST_DEVICE
+  IntegralType operator()(const T& x)
+  {
+    return pred1(x) ? IntegralType(0) : (pred2(x) ? IntegralType(1) : IntegralType(2));
+  }
+};
+
+
 // note that detail::equal_to does not force conversion from T2 -> T1 as equal_to does
 template<typename T1>
 struct equal_to
@@ -29,6 +29,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/logical.h>
 #include <thrust/system/detail/adl/logical.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -37,6 +38,7 @@ template<typename DerivedPolicy, typename InputIterator, typename Predicate>
 _CCCL_HOST_DEVICE
 bool all_of(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, InputIterator first, InputIterator last, Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "all_of", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::all_of;
   return all_of(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end all_of()
@@ -47,6 +49,7 @@ template<typename DerivedPolicy, typename InputIterator, typename Predicate>
 _CCCL_HOST_DEVICE
 bool any_of(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, InputIterator first, InputIterator last, Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "any_of", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::any_of;
   return any_of(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end any_of()
@@ -57,6 +60,7 @@ template<typename DerivedPolicy, typename InputIterator, typename Predicate>
 _CCCL_HOST_DEVICE
 bool none_of(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, InputIterator first, InputIterator last, Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "none_of", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::none_of;
   return none_of(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end none_of()
@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/partition.h>
 #include <thrust/system/detail/adl/partition.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE
                             ForwardIterator last,
                             Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "partition", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end partition()
@@ -60,6 +62,7 @@ _CCCL_HOST_DEVICE
                             InputIterator stencil,
                             Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "partition", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end partition()
@@ -80,6 +83,7 @@ _CCCL_HOST_DEVICE
                    OutputIterator2 out_false,
                    Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "partition_copy", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
 } // end partition_copy()
@@ -102,6 +106,7 @@ _CCCL_HOST_DEVICE
                    OutputIterator2 out_false,
                    Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "partition_copy", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
 } // end partition_copy()
@@ -117,6 +122,7 @@ _CCCL_HOST_DEVICE
                                    ForwardIterator last,
                                    Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "stable_partition", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end stable_partition()
@@ -134,6 +140,7 @@ _CCCL_HOST_DEVICE
                                    InputIterator stencil,
                                    Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "stable_partition", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end stable_partition()
@@ -154,6 +161,7 @@ _CCCL_HOST_DEVICE
                           OutputIterator2 out_false,
                           Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "stable_partition_copy", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
 } // end stable_partition_copy()
@@ -176,11 +184,51 @@ _CCCL_HOST_DEVICE
                           OutputIterator2 out_false,
                           Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "stable_partition_copy", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Predicate1,
+         typename Predicate2>
+_CCCL_HOST_DEVICE
+  thrust::pair<ForwardIterator,ForwardIterator>
+    partition3(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last,
+               Predicate1 pred1,
+               Predicate2 pred2)
+{
+  THRUST_TRACE_ALGORITHM(exec, "partition3", THRUST_TRACE_EXTENT(first, last));
+  using thrust::system::detail::generic::partition3;
+  return partition3(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred1, pred2);
+} // end partition3()
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+_CCCL_HOST_DEVICE
+  OutputIterator bucket_partition(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  ForwardIterator first,
+                                  ForwardIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets)
+{
+  THRUST_TRACE_ALGORITHM(exec, "bucket_partition", THRUST_TRACE_EXTENT(first, last));
+  using thrust::system::detail::generic::bucket_partition;
+  return bucket_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, bucket_op, num_buckets, offsets);
+} // end bucket_partition()
+
+
 _CCCL_EXEC_CHECK_DISABLE
 template<typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 _CCCL_HOST_DEVICE
@@ -189,6 +237,7 @@ _CCCL_HOST_DEVICE
                                   ForwardIterator last,
                                   Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "partition_point", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::partition_point;
   return partition_point(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end partition_point()
@@ -202,6 +251,7 @@ _CCCL_HOST_DEVICE
                       InputIterator last,
                       Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "is_partitioned", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::is_partitioned;
   return is_partitioned(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end is_partitioned()
@@ -387,6 +437,47 @@ template<typename InputIterator1,
 } // end stable_partition_copy()
 
 
+template<typename ForwardIterator,
+         typename Predicate1,
+         typename Predicate2>
+  thrust::pair<ForwardIterator,ForwardIterator>
+    partition3(ForwardIterator first,
+               ForwardIterator last,
+               Predicate1 pred1,
+               Predicate2 pred2)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<ForwardIterator>::type System;
+
+  System system;
+
+  return thrust::partition3(select_system(system), first, last, pred1, pred2);
+} // end partition3()
+
+
+template<typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator bucket_partition(ForwardIterator first,
+                                  ForwardIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<ForwardIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type  System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::bucket_partition(select_system(system1,system2), first, last, bucket_op, num_buckets, offsets);
+} // end bucket_partition()
+
+
 template<typename ForwardIterator, typename Predicate>
   ForwardIterator partition_point(ForwardIterator first,
                                   ForwardIterator last,
@@ -0,0 +1,186 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/pipeline.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/pipeline.h>
+#include <thrust/system/detail/adl/pipeline.h>
+#include <thrust/detail/trace.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy, typename InputIterator, typename Chain>
+_CCCL_HOST_DEVICE
+  typename Chain::result_type
+    evaluate_pipeline(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                      InputIterator first,
+                      InputIterator last,
+                      const Chain &chain)
+{
+  THRUST_TRACE_ALGORITHM(exec, "pipeline", THRUST_TRACE_EXTENT(first, last));
+  using thrust::system::detail::generic::evaluate_pipeline;
+  return evaluate_pipeline(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, chain);
+} // end evaluate_pipeline()
+
+
+template<typename DerivedPolicy, typename InputIterator, typename Stages>
+  template<typename Terminal>
+_CCCL_HOST_DEVICE
+  typename pipeline_expression<DerivedPolicy, InputIterator, Stages>::template chain<Terminal>::type::result_type
+    pipeline_expression<DerivedPolicy, InputIterator, Stages>
+      ::evaluate(const Terminal &terminal) const
+{
+  typedef typename chain<Terminal>::binder binder;
+
+  return thrust::detail::evaluate_pipeline(m_exec, m_first, m_last, binder::apply(m_stages, terminal));
+} // end pipeline_expression::evaluate()
+
+
+} // end detail
+
+
+template<typename DerivedPolicy, typename InputIterator>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_expression<DerivedPolicy, InputIterator>
+    pipeline(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+             InputIterator first,
+             InputIterator last)
+{
+  return thrust::detail::pipeline_expression<DerivedPolicy, InputIterator>(thrust::detail::derived_cast(exec), first, last);
+} // end pipeline()
+
+
+template<typename InputIterator>
+  thrust::detail::pipeline_expression<typename thrust::iterator_system<InputIterator>::type, InputIterator>
+    pipeline(InputIterator first,
+             InputIterator last)
+{
+  typedef typename thrust::iterator_system<InputIterator>::type System;
+
+  return thrust::detail::pipeline_expression<System, InputIterator>(System(), first, last);
+} // end pipeline()
+
+
+namespace pipes
+{
+
+
+template<typename UnaryFunction>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::transform_stage<UnaryFunction>
+    transform(UnaryFunction f)
+{
+  thrust::detail::pipeline_detail::transform_stage<UnaryFunction> result = {f};
+  return result;
+} // end transform()
+
+
+template<typename Predicate>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::filter_stage<Predicate>
+    filter(Predicate pred)
+{
+  thrust::detail::pipeline_detail::filter_stage<Predicate> result = {pred};
+  return result;
+} // end filter()
+
+
+_CCCL_HOST_DEVICE
+  inline thrust::detail::pipeline_detail::inclusive_scan_stage<thrust::plus<> >
+    inclusive_scan()
+{
+  return thrust::pipes::inclusive_scan(thrust::plus<>());
+} // end inclusive_scan()
+
+
+template<typename AssociativeOperator>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::inclusive_scan_stage<AssociativeOperator>
+    inclusive_scan(AssociativeOperator op)
+{
+  thrust::detail::pipeline_detail::inclusive_scan_stage<AssociativeOperator> result = {op};
+  return result;
+} // end inclusive_scan()
+
+
+template<typename T>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::exclusive_scan_stage<T, thrust::plus<> >
+    exclusive_scan(T init)
+{
+  return thrust::pipes::exclusive_scan(init, thrust::plus<>());
+} // end exclusive_scan()
+
+
+template<typename T, typename AssociativeOperator>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::exclusive_scan_stage<T, AssociativeOperator>
+    exclusive_scan(T init, AssociativeOperator op)
+{
+  thrust::detail::pipeline_detail::exclusive_scan_stage<T, AssociativeOperator> result = {init, op};
+  return result;
+} // end exclusive_scan()
+
+
+template<typename OutputIterator>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::into_stage<OutputIterator>
+    into(OutputIterator result)
+{
+  thrust::detail::pipeline_detail::into_stage<OutputIterator> stage = {result};
+  return stage;
+} // end into()
+
+
+template<typename T>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::reduce_stage<T, thrust::plus<> >
+    reduce(T init)
+{
+  return thrust::pipes::reduce(init, thrust::plus<>());
+} // end reduce()
+
+
+template<typename T, typename AssociativeOperator>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::reduce_stage<T, AssociativeOperator>
+    reduce(T init, AssociativeOperator op)
+{
+  thrust::detail::pipeline_detail::reduce_stage<T, AssociativeOperator> result = {init, op};
+  return result;
+} // end reduce()
+
+
+} // end pipes
+
+
+THRUST_NAMESPACE_END
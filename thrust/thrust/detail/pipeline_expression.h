@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/pipeline_stages.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+
+// A range and the stages applied to it so far. Nothing is evaluated until a
+// terminal stage is applied.
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Stages = pipeline_detail::stage_list_end>
+  class pipeline_expression
+{
+  public:
+    typedef typename thrust::iterator_value<InputIterator>::type input_type;
+
+    template<typename Stage>
+      struct with_stage
+    {
+      typedef pipeline_expression<
+        DerivedPolicy,
+        InputIterator,
+        typename pipeline_detail::append_stage<Stages, Stage>::type
+      > type;
+    };
+
+    template<typename Terminal>
+      struct chain
+    {
+      typedef pipeline_detail::bind_chain<Stages, Terminal, input_type> binder;
+      typedef typename binder::type                                     type;
+    };
+
+    _CCCL_HOST_DEVICE
+    pipeline_expression(const DerivedPolicy &exec, InputIterator first, InputIterator last, const Stages &stages = Stages())
+      : m_exec(exec), m_first(first), m_last(last), m_stages(stages)
+    {}
+
+    template<typename Stage>
+    _CCCL_HOST_DEVICE
+    typename with_stage<Stage>::type then(const Stage &stage) const
+    {
+      return typename with_stage<Stage>::type(
+        m_exec, m_first, m_last, pipeline_detail::append_stage<Stages, Stage>::apply(m_stages, stage));
+    }
+
+    template<typename Terminal>
+    _CCCL_HOST_DEVICE
+    typename chain<Terminal>::type::result_type evaluate(const Terminal &terminal) const;
+
+  private:
+    DerivedPolicy m_exec;
+    InputIterator m_first;
+    InputIterator m_last;
+    Stages        m_stages;
+};
+
+
+// the result of applying a stage to an expression: a longer expression for
+// intermediate stages, the result of the evaluation for terminal stages
+template<typename Expression, typename Stage, typename Category = typename Stage::stage_category>
+  struct pipe_result;
+
+template<typename Expression, typename Stage>
+  struct pipe_result<Expression, Stage, pipeline_detail::intermediate_stage_tag>
+{
+  typedef typename Expression::template with_stage<Stage>::type type;
+};
+
+template<typename Expression, typename Stage>
+  struct pipe_result<Expression, Stage, pipeline_detail::terminal_stage_tag>
+{
+  typedef typename Expression::template chain<Stage>::type::result_type type;
+};
+
+
+template<typename Expression, typename Stage>
+_CCCL_HOST_DEVICE
+  typename pipe_result<Expression, Stage>::type
+    apply_stage(const Expression &expression, const Stage &stage, pipeline_detail::intermediate_stage_tag)
+{
+  return expression.then(stage);
+}
+
+template<typename Expression, typename Terminal>
+_CCCL_HOST_DEVICE
+  typename pipe_result<Expression, Terminal>::type
+    apply_stage(const Expression &expression, const Terminal &terminal, pipeline_detail::terminal_stage_tag)
+{
+  return expression.evaluate(terminal);
+}
+
+
+template<typename DerivedPolicy, typename InputIterator, typename Stages, typename Stage>
+_CCCL_HOST_DEVICE
+  typename pipe_result<pipeline_expression<DerivedPolicy, InputIterator, Stages>, Stage>::type
+    operator|(const pipeline_expression<DerivedPolicy, InputIterator, Stages> &expression, const Stage &stage)
+{
+  return thrust::detail::apply_stage(expression, stage, typename Stage::stage_category());
+}
+
+
+} // end detail
+THRUST_NAMESPACE_END
@@ -0,0 +1,646 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// The stages of a pipeline, and the chains of stages a pipeline is evaluated
+// with.
+//
+// A pipeline is evaluated in passes over tiles of its input. Each scan stage,
+// and the terminal stage, is numbered in order. In pass P, the stages before
+// stage P run in full, from the carries the earlier passes computed for the
+// tile, while stage P only accumulates what reaches it in the tile. Between
+// passes, the accumulations of stage P are combined across tiles into the
+// carries of the next pass. A pipeline without scans or filters needs a
+// single pass.
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/type_traits.h>
+#include <thrust/type_traits/remove_cvref.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+namespace pipeline_detail
+{
+
+
+struct intermediate_stage_tag {};
+struct terminal_stage_tag {};
+
+
+template<typename UnaryFunction>
+  struct transform_stage
+{
+  typedef intermediate_stage_tag stage_category;
+
+  UnaryFunction f;
+};
+
+
+template<typename Predicate>
+  struct filter_stage
+{
+  typedef intermediate_stage_tag stage_category;
+
+  Predicate pred;
+};
+
+
+template<typename BinaryFunction>
+  struct inclusive_scan_stage
+{
+  typedef intermediate_stage_tag stage_category;
+
+  BinaryFunction op;
+};
+
+
+template<typename T, typename BinaryFunction>
+  struct exclusive_scan_stage
+{
+  typedef intermediate_stage_tag stage_category;
+
+  T init;
+  BinaryFunction op;
+};
+
+
+template<typename OutputIterator>
+  struct into_stage
+{
+  typedef terminal_stage_tag stage_category;
+
+  OutputIterator result;
+};
+
+
+template<typename T, typename BinaryFunction>
+  struct reduce_stage
+{
+  typedef terminal_stage_tag stage_category;
+
+  T init;
+  BinaryFunction op;
+};
+
+
+// the intermediate stages of a pipeline, first to last
+struct stage_list_end {};
+
+template<typename Stage, typename Next>
+  struct stage_list
+{
+  _CCCL_HOST_DEVICE
+  stage_list(const Stage &stage, const Next &next)
+    : stage(stage), next(next)
+  {}
+
+  Stage stage;
+  Next  next;
+};
+
+
+template<typename Stages, typename Stage>
+  struct append_stage;
+
+template<typename Stage>
+  struct append_stage<stage_list_end, Stage>
+{
+  typedef stage_list<Stage, stage_list_end> type;
+
+  _CCCL_HOST_DEVICE
+  static type apply(const stage_list_end &, const Stage &stage)
+  {
+    return type(stage, stage_list_end());
+  }
+};
+
+template<typename First, typename Next, typename Stage>
+  struct append_stage<stage_list<First, Next>, Stage>
+{
+  typedef stage_list<First, typename append_stage<Next, Stage>::type> type;
+
+  _CCCL_HOST_DEVICE
+  static type apply(const stage_list<First, Next> &stages, const Stage &stage)
+  {
+    return type(stages.stage, append_stage<Next, Stage>::apply(stages.next, stage));
+  }
+};
+
+
+// The nodes of a chain process one element at a time and pass on what they
+// produce to the next node. Index is the number of the next scan or
+// terminal node, counting this node. The function objects of the stages may
+// not be assignable, so assign_state copies only the evaluation state.
+
+template<typename Stage, typename InputType, int Index, typename Next>
+  class stage_node;
+
+
+template<typename UnaryFunction, typename InputType, int Index, typename Next>
+  class stage_node<transform_stage<UnaryFunction>, InputType, Index, Next>
+{
+  public:
+    typedef typename Next::sink_type   sink_type;
+    typedef typename Next::result_type result_type;
+
+    static const int  num_scans              = Next::num_scans;
+    static const bool has_filter             = Next::has_filter;
+    static const bool filter_after_last_scan = Next::filter_after_last_scan;
+
+    _CCCL_HOST_DEVICE
+    stage_node(const transform_stage<UnaryFunction> &stage, const Next &next)
+      : m_f(stage.f), m_next(next)
+    {}
+
+    _CCCL_HOST_DEVICE
+    void begin_tile()
+    {
+      m_next.begin_tile();
+    }
+
+    _CCCL_EXEC_CHECK_DISABLE
+    template<int Pass>
+    _CCCL_HOST_DEVICE
+    void push(const InputType &x, std::ptrdiff_t &reached)
+    {
+      m_next.template push<Pass>(m_f(x), reached);
+    }
+
+    template<int Pass>
+    _CCCL_HOST_DEVICE
+    void propagate(const stage_node &prev)
+    {
+      m_next.template propagate<Pass>(prev.m_next);
+    }
+
+    _CCCL_HOST_DEVICE
+    void assign_state(const stage_node &other)
+    {
+      m_next.assign_state(other.m_next);
+    }
+
+    _CCCL_HOST_DEVICE
+    sink_type &sink()
+    {
+      return m_next.sink();
+    }
+
+  private:
+    UnaryFunction m_f;
+    Next          m_next;
+};
+
+
+template<typename Predicate, typename InputType, int Index, typename Next>
+  class stage_node<filter_stage<Predicate>, InputType, Index, Next>
+{
+  public:
+    typedef typename Next::sink_type   sink_type;
+    typedef typename Next::result_type result_type;
+
+    static const int  num_scans              = Next::num_scans;
+    static const bool has_filter             = true;
+    static const bool filter_after_last_scan = Next::num_scans > 0 ? Next::filter_after_last_scan : true;
+
+    _CCCL_HOST_DEVICE
+    stage_node(const filter_stage<Predicate> &stage, const Next &next)
+      : m_pred(stage.pred), m_next(next)
+    {}
+
+    _CCCL_HOST_DEVICE
+    void begin_tile()
+    {
+      m_next.begin_tile();
+    }
+
+    _CCCL_EXEC_CHECK_DISABLE
+    template<int Pass>
+    _CCCL_HOST_DEVICE
+    void push(const InputType &x, std::ptrdiff_t &reached)
+    {
+      if(m_pred(x))
+      {
+        m_next.template push<Pass>(x, reached);
+      }
+    }
+
+    template<int Pass>
+    _CCCL_HOST_DEVICE
+    void propagate(const stage_node &prev)
+    {
+      m_next.template propagate<Pass>(prev.m_next);
+    }
+
+    _CCCL_HOST_DEVICE
+    void assign_state(const stage_node &other)
+    {
+      m_next.assign_state(other.m_next);
+    }
+
+    _CCCL_HOST_DEVICE
+    sink_type &sink()
+    {
+      return m_next.sink();
+    }
+
+  private:
+    Predicate m_pred;
+    Next      m_next;
+};
+
+
+// both kinds of scan: an inclusive scan without an initial value has no
+// carry into the first tile, an exclusive scan starts from its initial value
+template<typename T, typename BinaryFunction, bool Inclusive, typename InputType, int Index, typename Next>
+  class scan_node
+{
+  public:
+    typedef typename Next::sink_type   sink_type;
+    typedef typename Next::result_type result_type;
+
+    static const int  num_scans              = Next::num_scans + 1;
+    static const bool has_filter             = Next::has_filter;
+    static const bool filter_after_last_scan = Next::num_scans > 0 ? Next::filter_after_last_scan : Next::has_filter;
+
+    _CCCL_HOST_DEVICE
+    scan_node(const BinaryFunction &op, bool has_init, const T &init, const Next &next)
+      : m_op(op),
+        m_has_carry(has_init),
+        m_carry(init),
+        m_has_running(false),
+        m_running(),
+        m_has_aggregate(false),
+        m_aggregate(),
+        m_next(next)
+    {}
+
+    _CCCL_HOST_DEVICE
+    void begin_tile()
+    {
+      m_has_running = m_has_carry;
+      m_running     = m_carry;
+      m_has_aggregate = false;
+      m_next.begin_tile();
+    }
+
+    _CCCL_EXEC_CHECK_DISABLE
+    template<int Pass>
+    _CCCL_HOST_DEVICE
+    void push(const InputType &x, std::ptrdiff_t &reached)
+    {
+      if(Pass == Index)
+      {
+        // only accumulate the tile's contribution to the next tile's carry
+        m_aggregate     = m_has_aggregate ? T(m_op(m_aggregate, x)) : T(x);
+        m_has_aggregate = true;
+        ++reached;
+      }
+      else if(Inclusive)
+      {
+        m_running     = m_has_running ? T(m_op(m_running, x)) : T(x);
+        m_has_running = true;
+        m_next.template push<Pass>(m_running, reached);
+      }
+      else
+      {
+        const T result = m_running;
+        m_running      = m_op(m_running, x);
+        m_next.template push<Pass>(result, reached);
+      }
+    }
+
+    _CCCL_EXEC_CHECK_DISABLE
+    template<int Pass>
+    _CCCL_HOST_DEVICE
+    void propagate(const scan_node &prev)
+    {
+      if(Pass == Index)
+      {
+        if(prev.m_has_carry && prev.m_has_aggregate)
+        {
+          m_carry = m_op(prev.m_carry, prev.m_aggregate);
+        }
+        else
+        {
+          m_carry = prev.m_has_carry ? prev.m_carry : prev.m_aggregate;
+        }
+
+        m_has_carry = prev.m_has_carry || prev.m_has_aggregate;
+      }
+      else
+      {
+        m_next.template propagate<Pass>(prev.m_next);
+      }
+    }
+
+    _CCCL_HOST_DEVICE
+    void assign_state(const scan_node &other)
+    {
+      m_has_carry     = other.m_has_carry;
+      m_carry         = other.m_carry;
+      m_has_running   = other.m_has_running;
+      m_running       = other.m_running;
+      m_has_aggregate = other.m_has_aggregate;
+      m_aggregate     = other.m_aggregate;
+      m_next.assign_state(other.m_next);
+    }
+
+    _CCCL_HOST_DEVICE
+    sink_type &sink()
+    {
+      return m_next.sink();
+    }
+
+  private:
+    BinaryFunction m_op;
+    bool           m_has_carry;
+    T              m_carry;
+    bool           m_has_running;
+    T              m_running;
+    bool           m_has_aggregate;
+    T              m_aggregate;
+    Next           m_next;
+};
+
+
+// Terminal nodes. In pass Index, into_node counts the elements which reach
+// it, and writes them in pass Index + 1, once the position of its tile's
+// output is known. reduce_node reduces them in pass Index.
+
+template<typename OutputIterator, typename InputType, int Index>
+  class into_node
+{
+  public:
+    typedef into_node      sink_type;
+    typedef OutputIterator result_type;
+
+    static const int  num_scans              = 0;
+    static const bool has_filter             = false;
+    static const bool filter_after_last_scan = false;
+    static const int  final_pass             = Index + 1;
+
+    _CCCL_HOST_DEVICE
+    into_node(const into_stage<OutputIterator> &stage)
+      : m_result(stage.result)
+    {}
+
+    _CCCL_HOST_DEVICE
+    void begin_tile() {}
+
+    _CCCL_EXEC_CHECK_DISABLE
+    template<int Pass>
+    _CCCL_HOST_DEVICE
+    void push(const InputType &x, std::ptrdiff_t &reached)
+    {
+      if(Pass == final_pass)
+      {
+        *m_result = x;
+        ++m_result;
+      }
+
+      ++reached;
+    }
+
+    template<int Pass>
+    _CCCL_HOST_DEVICE
+    void propagate(const into_node &) {}
+
+    _CCCL_HOST_DEVICE
+    void assign_state(const into_node &other)
+    {
+      m_result = other.m_result;
+    }
+
+    _CCCL_HOST_DEVICE
+    sink_type &sink()
+    {
+      return *this;
+    }
+
+    // places this tile's output after the output of the previous tile
+    _CCCL_HOST_DEVICE
+    void place(const into_node &prev, std::ptrdiff_t prev_count)
+    {
+      m_result = prev.m_result + prev_count;
+    }
+
+    // after the final pass, the result of the tiles up to the other one
+    _CCCL_HOST_DEVICE
+    void merge(const into_node &other)
+    {
+      m_result = other.m_result;
+    }
+
+    _CCCL_HOST_DEVICE
+    result_type result() const
+    {
+      return m_result;
+    }
+
+  private:
+    OutputIterator m_result;
+};
+
+
+template<typename T, typename BinaryFunction, typename InputType, int Index>
+  class reduce_node
+{
+  public:
+    typedef reduce_node sink_type;
+    typedef T           result_type;
+
+    static const int  num_scans              = 0;
+    static const bool has_filter             = false;
+    static const bool filter_after_last_scan = false;
+    static const int  final_pass             = Index;
+
+    _CCCL_HOST_DEVICE
+    reduce_node(const reduce_stage<T, BinaryFunction> &stage)
+      : m_init(stage.init),
+        m_op(stage.op),
+        m_has_partial(false),
+        m_partial()
+    {}
+
+    _CCCL_HOST_DEVICE
+    void begin_tile()
+    {
+      m_has_partial = false;
+    }
+
+    _CCCL_EXEC_CHECK_DISABLE
+    template<int Pass>
+    _CCCL_HOST_DEVICE
+    void push(const InputType &x, std::ptrdiff_t &reached)
+    {
+      m_partial     = m_has_partial ? T(m_op(m_partial, x)) : T(x);
+      m_has_partial = true;
+      ++reached;
+    }
+
+    template<int Pass>
+    _CCCL_HOST_DEVICE
+    void propagate(const reduce_node &) {}
+
+    _CCCL_HOST_DEVICE
+    void assign_state(const reduce_node &other)
+    {
+      m_has_partial = other.m_has_partial;
+      m_partial     = other.m_partial;
+    }
+
+    _CCCL_HOST_DEVICE
+    sink_type &sink()
+    {
+      return *this;
+    }
+
+    _CCCL_HOST_DEVICE
+    void place(const reduce_node &, std::ptrdiff_t) {}
+
+    _CCCL_EXEC_CHECK_DISABLE
+    _CCCL_HOST_DEVICE
+    void merge(const reduce_node &other)
+    {
+      if(other.m_has_partial)
+      {
+        m_partial     = m_has_partial ? T(m_op(m_partial, other.m_partial)) : other.m_partial;
+        m_has_partial = true;
+      }
+    }
+
+    _CCCL_EXEC_CHECK_DISABLE
+    _CCCL_HOST_DEVICE
+    result_type result() const
+    {
+      return m_has_partial ? T(m_op(m_init, m_partial)) : m_init;
+    }
+
+  private:
+    T              m_init;
+    BinaryFunction m_op;
+    bool           m_has_partial;
+    T              m_partial;
+};
+
+
+// binds the stages and the terminal stage of a pipeline into a chain of
+// nodes which processes elements of type InputType
+template<typename Stages, typename Terminal, typename InputType, int Index = 0>
+  struct bind_chain;
+
+template<typename OutputIterator, typename InputType, int Index>
+  struct bind_chain<stage_list_end, into_stage<OutputIterator>, InputType, Index>
+{
+  typedef into_node<OutputIterator, InputType, Index> type;
+
+  _CCCL_HOST_DEVICE
+  static type apply(const stage_list_end &, const into_stage<OutputIterator> &terminal)
+  {
+    return type(terminal);
+  }
+};
+
+template<typename T, typename BinaryFunction, typename InputType, int Index>
+  struct bind_chain<stage_list_end, reduce_stage<T, BinaryFunction>, InputType, Index>
+{
+  typedef reduce_node<T, BinaryFunction, InputType, Index> type;
+
+  _CCCL_HOST_DEVICE
+  static type apply(const stage_list_end &, const reduce_stage<T, BinaryFunction> &terminal)
+  {
+    return type(terminal);
+  }
+};
+
+template<typename UnaryFunction, typename Next, typename Terminal, typename InputType, int Index>
+  struct bind_chain<stage_list<transform_stage<UnaryFunction>, Next>, Terminal, InputType, Index>
+{
+  typedef thrust::remove_cvref_t<
+    thrust::detail::invoke_result_t<UnaryFunction, const InputType &>
+  > output_type;
+
+  typedef bind_chain<Next, Terminal, output_type, Index> next_chain;
+
+  typedef stage_node<transform_stage<UnaryFunction>, InputType, Index, typename next_chain::type> type;
+
+  _CCCL_HOST_DEVICE
+  static type apply(const stage_list<transform_stage<UnaryFunction>, Next> &stages, const Terminal &terminal)
+  {
+    return type(stages.stage, next_chain::apply(stages.next, terminal));
+  }
+};
+
+template<typename Predicate, typename Next, typename Terminal, typename InputType, int Index>
+  struct bind_chain<stage_list<filter_stage<Predicate>, Next>, Terminal, InputType, Index>
+{
+  typedef bind_chain<Next, Terminal, InputType, Index> next_chain;
+
+  typedef stage_node<filter_stage<Predicate>, InputType, Index, typename next_chain::type> type;
+
+  _CCCL_HOST_DEVICE
+  static type apply(const stage_list<filter_stage<Predicate>, Next> &stages, const Terminal &terminal)
+  {
+    return type(stages.stage, next_chain::apply(stages.next, terminal));
+  }
+};
+
+// like thrust::inclusive_scan, the partial sums have the input's value type
+template<typename BinaryFunction, typename Next, typename Terminal, typename InputType, int Index>
+  struct bind_chain<stage_list<inclusive_scan_stage<BinaryFunction>, Next>, Terminal, InputType, Index>
+{
+  typedef bind_chain<Next, Terminal, InputType, Index + 1> next_chain;
+
+  typedef scan_node<InputType, BinaryFunction, true, InputType, Index, typename next_chain::type> type;
+
+  _CCCL_HOST_DEVICE
+  static type apply(const stage_list<inclusive_scan_stage<BinaryFunction>, Next> &stages, const Terminal &terminal)
+  {
+    return type(stages.stage.op, false, InputType(), next_chain::apply(stages.next, terminal));
+  }
+};
+
+// like thrust::exclusive_scan, the partial sums have the initial value's type
+template<typename T, typename BinaryFunction, typename Next, typename Terminal, typename InputType, int Index>
+  struct bind_chain<stage_list<exclusive_scan_stage<T, BinaryFunction>, Next>, Terminal, InputType, Index>
+{
+  typedef bind_chain<Next, Terminal, T, Index + 1> next_chain;
+
+  typedef scan_node<T, BinaryFunction, false, InputType, Index, typename next_chain::type> type;
+
+  _CCCL_HOST_DEVICE
+  static type apply(const stage_list<exclusive_scan_stage<T, BinaryFunction>, Next> &stages, const Terminal &terminal)
+  {
+    return type(stages.stage.op, true, stages.stage.init, next_chain::apply(stages.next, terminal));
+  }
+};
+
+
+} // end pipeline_detail
+} // end detail
+THRUST_NAMESPACE_END
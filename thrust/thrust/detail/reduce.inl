@@ -33,6 +33,7 @@
 #include <thrust/system/detail/generic/reduce_by_key.h>
 #include <thrust/system/detail/adl/reduce.h>
 #include <thrust/system/detail/adl/reduce_by_key.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE
   typename thrust::iterator_traits<InputIterator>::value_type
     reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, InputIterator first, InputIterator last)
 {
+  THRUST_TRACE_ALGORITHM(exec, "reduce", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end reduce()
@@ -56,6 +58,7 @@ _CCCL_HOST_DEVICE
            InputIterator last,
            T init)
 {
+  THRUST_TRACE_ALGORITHM(exec, "reduce", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init);
 } // end reduce()
@@ -73,6 +76,7 @@ _CCCL_HOST_DEVICE
            T init,
            BinaryFunction binary_op)
 {
+  THRUST_TRACE_ALGORITHM(exec, "reduce", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init, binary_op);
 } // end reduce()
@@ -93,6 +97,7 @@ _CCCL_HOST_DEVICE
                 OutputIterator1 keys_output,
                 OutputIterator2 values_output)
 {
+  THRUST_TRACE_ALGORITHM(exec, "reduce_by_key", THRUST_TRACE_EXTENT(keys_first, keys_last));
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, keys_output, values_output);
 } // end reduce_by_key()
@@ -115,6 +120,7 @@ _CCCL_HOST_DEVICE
                 OutputIterator2 values_output,
                 BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "reduce_by_key", THRUST_TRACE_EXTENT(keys_first, keys_last));
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
 } // end reduce_by_key()
@@ -139,6 +145,7 @@ _CCCL_HOST_DEVICE
                 BinaryPredicate binary_pred,
                 BinaryFunction binary_op)
 {
+  THRUST_TRACE_ALGORITHM(exec, "reduce_by_key", THRUST_TRACE_EXTENT(keys_first, keys_last));
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
 } // end reduce_by_key()
@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/remove.h>
 #include <thrust/system/detail/adl/remove.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -44,6 +45,7 @@ _CCCL_HOST_DEVICE
                          ForwardIterator last,
                          const T &value)
 {
+  THRUST_TRACE_ALGORITHM(exec, "remove", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::remove;
   return remove(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end remove()
@@ -61,6 +63,7 @@ _CCCL_HOST_DEVICE
                              OutputIterator result,
                              const T &value)
 {
+  THRUST_TRACE_ALGORITHM(exec, "remove_copy", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::remove_copy;
   return remove_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, value);
 } // end remove_copy()
@@ -76,6 +79,7 @@ _CCCL_HOST_DEVICE
                             ForwardIterator last,
                             Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "remove_if", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::remove_if;
   return remove_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end remove_if()
@@ -93,6 +97,7 @@ _CCCL_HOST_DEVICE
                                 OutputIterator result,
                                 Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "remove_copy_if", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::remove_copy_if;
   return remove_copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred);
 } // end remove_copy_if()
@@ -110,6 +115,7 @@ _CCCL_HOST_DEVICE
                             InputIterator stencil,
                             Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "remove_if", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::remove_if;
   return remove_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end remove_if()
@@ -129,6 +135,7 @@ _CCCL_HOST_DEVICE
                                 OutputIterator result,
                                 Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "remove_copy_if", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::remove_copy_if;
   return remove_copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred);
 } // end remove_copy_if()
@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/sequence.h>
 #include <thrust/system/detail/adl/sequence.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -41,6 +42,7 @@ _CCCL_HOST_DEVICE
                 ForwardIterator first,
                 ForwardIterator last)
 {
+  THRUST_TRACE_ALGORITHM(exec, "sequence", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end sequence()
@@ -54,6 +56,7 @@ _CCCL_HOST_DEVICE
                 ForwardIterator last,
                 T init)
 {
+  THRUST_TRACE_ALGORITHM(exec, "sequence", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init);
 } // end sequence()
@@ -68,6 +71,7 @@ _CCCL_HOST_DEVICE
                 T init,
                 T step)
 {
+  THRUST_TRACE_ALGORITHM(exec, "sequence", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init, step);
 } // end sequence()
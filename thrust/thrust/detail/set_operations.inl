@@ -29,6 +29,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/set_operations.h>
 #include <thrust/system/detail/adl/set_operations.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -46,6 +47,7 @@ OutputIterator set_difference(const thrust::detail::execution_policy_base<Derive
                               InputIterator2                                              last2,
                               OutputIterator                                              result)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_difference", THRUST_TRACE_EXTENT(first1, last1));
   using thrust::system::detail::generic::set_difference;
   return set_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
 } // end set_difference()
@@ -66,6 +68,7 @@ OutputIterator set_difference(const thrust::detail::execution_policy_base<Derive
                               OutputIterator                                              result,
                               StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_difference", THRUST_TRACE_EXTENT(first1, last1));
   using thrust::system::detail::generic::set_difference;
   return set_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
 } // end set_difference()
@@ -91,6 +94,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                         OutputIterator1                                             keys_result,
                         OutputIterator2                                             values_result)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_difference_by_key", THRUST_TRACE_EXTENT(keys_first1, keys_last1));
   using thrust::system::detail::generic::set_difference_by_key;
   return set_difference_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result);
 } // end set_difference_by_key()
@@ -118,6 +122,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                         OutputIterator2                                             values_result,
                         StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_difference_by_key", THRUST_TRACE_EXTENT(keys_first1, keys_last1));
   using thrust::system::detail::generic::set_difference_by_key;
   return set_difference_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result, comp);
 } // end set_difference_by_key()
@@ -136,6 +141,7 @@ OutputIterator set_intersection(const thrust::detail::execution_policy_base<Deri
                                 InputIterator2                                              last2,
                                 OutputIterator                                              result)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_intersection", THRUST_TRACE_EXTENT(first1, last1));
   using thrust::system::detail::generic::set_intersection;
   return set_intersection(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
 } // end set_intersection()
@@ -156,6 +162,7 @@ OutputIterator set_intersection(const thrust::detail::execution_policy_base<Deri
                                 OutputIterator                                              result,
                                 StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_intersection", THRUST_TRACE_EXTENT(first1, last1));
   using thrust::system::detail::generic::set_intersection;
   return set_intersection(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
 } // end set_intersection()
@@ -179,6 +186,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                           OutputIterator1                                             keys_result,
                           OutputIterator2                                             values_result)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_intersection_by_key", THRUST_TRACE_EXTENT(keys_first1, keys_last1));
   using thrust::system::detail::generic::set_intersection_by_key;
   return set_intersection_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, keys_result, values_result);
 } // end set_intersection_by_key()
@@ -204,6 +212,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                           OutputIterator2                                             values_result,
                           StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_intersection_by_key", THRUST_TRACE_EXTENT(keys_first1, keys_last1));
   using thrust::system::detail::generic::set_intersection_by_key;
   return set_intersection_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, keys_result, values_result, comp);
 } // end set_intersection_by_key()
@@ -222,6 +231,7 @@ OutputIterator set_symmetric_difference(const thrust::detail::execution_policy_b
                                         InputIterator2                                              last2,
                                         OutputIterator                                              result)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_symmetric_difference", THRUST_TRACE_EXTENT(first1, last1));
   using thrust::system::detail::generic::set_symmetric_difference;
   return set_symmetric_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
 } // end set_symmetric_difference()
@@ -242,6 +252,7 @@ OutputIterator set_symmetric_difference(const thrust::detail::execution_policy_b
                                         OutputIterator                                              result,
                                         StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_symmetric_difference", THRUST_TRACE_EXTENT(first1, last1));
   using thrust::system::detail::generic::set_symmetric_difference;
   return set_symmetric_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
 } // end set_symmetric_difference()
@@ -267,6 +278,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                                   OutputIterator1                                             keys_result,
                                   OutputIterator2                                             values_result)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_symmetric_difference_by_key", THRUST_TRACE_EXTENT(keys_first1, keys_last1));
   using thrust::system::detail::generic::set_symmetric_difference_by_key;
   return set_symmetric_difference_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result);
 } // end set_symmetric_difference_by_key()
@@ -294,6 +306,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                                   OutputIterator2                                             values_result,
                                   StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_symmetric_difference_by_key", THRUST_TRACE_EXTENT(keys_first1, keys_last1));
   using thrust::system::detail::generic::set_symmetric_difference_by_key;
   return set_symmetric_difference_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result, comp);
 } // end set_symmetric_difference_by_key()
@@ -312,6 +325,7 @@ OutputIterator set_union(const thrust::detail::execution_policy_base<DerivedPoli
                          InputIterator2                                              last2,
                          OutputIterator                                              result)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_union", THRUST_TRACE_EXTENT(first1, last1));
   using thrust::system::detail::generic::set_union;
   return set_union(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
 } // end set_union()
@@ -332,6 +346,7 @@ OutputIterator set_union(const thrust::detail::execution_policy_base<DerivedPoli
                          OutputIterator                                              result,
                          StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_union", THRUST_TRACE_EXTENT(first1, last1));
   using thrust::system::detail::generic::set_union;
   return set_union(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
 } // end set_union()
@@ -357,6 +372,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                    OutputIterator1                                             keys_result,
                    OutputIterator2                                             values_result)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_union_by_key", THRUST_TRACE_EXTENT(keys_first1, keys_last1));
   using thrust::system::detail::generic::set_union_by_key;
   return set_union_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result);
 } // end set_union_by_key()
@@ -384,6 +400,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                    OutputIterator2                                             values_result,
                    StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "set_union_by_key", THRUST_TRACE_EXTENT(keys_first1, keys_last1));
   using thrust::system::detail::generic::set_union_by_key;
   return set_union_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result, comp);
 } // end set_union_by_key()
@@ -33,6 +33,8 @@
 #include <thrust/shuffle.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/adl/shuffle.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -41,6 +43,7 @@ template <typename DerivedPolicy, typename RandomIterator, typename URBG>
 _CCCL_HOST_DEVICE void shuffle(
     const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
     RandomIterator first, RandomIterator last, URBG&& g) {
+  THRUST_TRACE_ALGORITHM(exec, "shuffle", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::shuffle;
   return shuffle(
       thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -65,6 +68,7 @@ _CCCL_HOST_DEVICE void shuffle_copy(
     const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
     RandomIterator first, RandomIterator last, OutputIterator result,
     URBG&& g) {
+  THRUST_TRACE_ALGORITHM(exec, "shuffle_copy", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::shuffle_copy;
   return shuffle_copy(
       thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
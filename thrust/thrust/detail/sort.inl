@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/sort.h>
 #include <thrust/system/detail/adl/sort.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -41,6 +42,7 @@ _CCCL_HOST_DEVICE
             RandomAccessIterator first,
             RandomAccessIterator last)
 {
+  THRUST_TRACE_ALGORITHM(exec, "sort", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::sort;
   return sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end sort()
@@ -56,6 +58,7 @@ _CCCL_HOST_DEVICE
             RandomAccessIterator last,
             StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "sort", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::sort;
   return sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end sort()
@@ -68,6 +71,7 @@ _CCCL_HOST_DEVICE
                    RandomAccessIterator first,
                    RandomAccessIterator last)
 {
+  THRUST_TRACE_ALGORITHM(exec, "stable_sort", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::stable_sort;
   return stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end stable_sort()
@@ -83,6 +87,7 @@ _CCCL_HOST_DEVICE
                    RandomAccessIterator last,
                    StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "stable_sort", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::stable_sort;
   return stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end stable_sort()
@@ -98,6 +103,7 @@ _CCCL_HOST_DEVICE
                    RandomAccessIterator1 keys_last,
                    RandomAccessIterator2 values_first)
 {
+  THRUST_TRACE_ALGORITHM(exec, "sort_by_key", THRUST_TRACE_EXTENT(keys_first, keys_last));
   using thrust::system::detail::generic::sort_by_key;
   return sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
 } // end sort_by_key()
@@ -115,6 +121,7 @@ _CCCL_HOST_DEVICE
                    RandomAccessIterator2 values_first,
                    StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "sort_by_key", THRUST_TRACE_EXTENT(keys_first, keys_last));
   using thrust::system::detail::generic::sort_by_key;
   return sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, comp);
 } // end sort_by_key()
@@ -130,6 +137,7 @@ _CCCL_HOST_DEVICE
                           RandomAccessIterator1 keys_last,
                           RandomAccessIterator2 values_first)
 {
+  THRUST_TRACE_ALGORITHM(exec, "stable_sort_by_key", THRUST_TRACE_EXTENT(keys_first, keys_last));
   using thrust::system::detail::generic::stable_sort_by_key;
   return stable_sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
 } // end stable_sort_by_key()
@@ -147,6 +155,7 @@ _CCCL_HOST_DEVICE
                           RandomAccessIterator2 values_first,
                           StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "stable_sort_by_key", THRUST_TRACE_EXTENT(keys_first, keys_last));
   using thrust::system::detail::generic::stable_sort_by_key;
   return stable_sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, comp);
 } // end stable_sort_by_key()
@@ -159,6 +168,7 @@ _CCCL_HOST_DEVICE
                  ForwardIterator first,
                  ForwardIterator last)
 {
+  THRUST_TRACE_ALGORITHM(exec, "is_sorted", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::is_sorted;
   return is_sorted(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end is_sorted()
@@ -172,6 +182,7 @@ _CCCL_HOST_DEVICE
                  ForwardIterator last,
                  Compare comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "is_sorted", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::is_sorted;
   return is_sorted(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end is_sorted()
@@ -184,6 +195,7 @@ _CCCL_HOST_DEVICE
                                   ForwardIterator first,
                                   ForwardIterator last)
 {
+  THRUST_TRACE_ALGORITHM(exec, "is_sorted_until", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::is_sorted_until;
   return is_sorted_until(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end is_sorted_until()
@@ -197,6 +209,7 @@ _CCCL_HOST_DEVICE
                                   ForwardIterator last,
                                   Compare comp)
 {
+  THRUST_TRACE_ALGORITHM(exec, "is_sorted_until", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::is_sorted_until;
   return is_sorted_until(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end is_sorted_until()
@@ -0,0 +1,324 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// The instrumentation points of the algorithms' entry points and of temporary
+// storage. They expand to nothing unless THRUST_TRACE is defined; see
+// thrust/trace.h.
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if defined(THRUST_TRACE)
+
+#include <thrust/trace.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_categories.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <nv/target>
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+
+THRUST_NAMESPACE_BEGIN
+
+// the systems' policies are only needed to name them
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+template<typename> struct execution_policy;
+} // end sequential
+} // end detail
+namespace cpp
+{
+namespace detail
+{
+template<typename> struct execution_policy;
+} // end detail
+} // end cpp
+namespace omp
+{
+namespace detail
+{
+template<typename> struct execution_policy;
+} // end detail
+} // end omp
+namespace tbb
+{
+namespace detail
+{
+template<typename> struct execution_policy;
+} // end detail
+} // end tbb
+} // end system
+
+namespace cuda_cub
+{
+template<class> struct execution_policy;
+} // end cuda_cub
+
+namespace detail
+{
+namespace trace
+{
+
+using thrust::trace::detail::algorithm_frame;
+using thrust::trace::detail::algorithm_stack;
+using thrust::trace::detail::callback_binding;
+using thrust::trace::detail::load_binding;
+
+
+// overload resolution picks the most derived of the systems' policies
+template<typename DerivedPolicy>
+const char *backend_name(const thrust::detail::execution_policy_base<DerivedPolicy> &)
+{
+  return "unknown";
+}
+
+template<typename DerivedPolicy>
+const char *backend_name(const thrust::system::detail::sequential::execution_policy<DerivedPolicy> &)
+{
+  return "seq";
+}
+
+template<typename DerivedPolicy>
+const char *backend_name(const thrust::system::cpp::detail::execution_policy<DerivedPolicy> &)
+{
+  return "cpp";
+}
+
+template<typename DerivedPolicy>
+const char *backend_name(const thrust::system::omp::detail::execution_policy<DerivedPolicy> &)
+{
+  return "omp";
+}
+
+template<typename DerivedPolicy>
+const char *backend_name(const thrust::system::tbb::detail::execution_policy<DerivedPolicy> &)
+{
+  return "tbb";
+}
+
+template<typename DerivedPolicy>
+const char *backend_name(const thrust::cuda_cub::execution_policy<DerivedPolicy> &)
+{
+  return "cuda";
+}
+
+
+// the size of [first, last) if it can be computed in constant time, -1 otherwise
+template<typename Iterator>
+_CCCL_HOST_DEVICE
+std::ptrdiff_t extent(Iterator first, Iterator last, thrust::detail::true_type)
+{
+  return static_cast<std::ptrdiff_t>(last - first);
+}
+
+template<typename Iterator>
+_CCCL_HOST_DEVICE
+std::ptrdiff_t extent(Iterator, Iterator, thrust::detail::false_type)
+{
+  return -1;
+}
+
+template<typename Iterator>
+_CCCL_HOST_DEVICE
+std::ptrdiff_t extent(Iterator first, Iterator last)
+{
+  typedef typename thrust::detail::is_convertible<
+    typename thrust::iterator_traversal<Iterator>::type,
+    thrust::random_access_traversal_tag
+  >::type is_random_access;
+
+  return extent(first, last, is_random_access());
+}
+
+
+inline std::chrono::steady_clock::rep now()
+{
+  return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+
+inline void emit(thrust::trace::event_kind kind,
+                 const char *algorithm,
+                 const char *backend,
+                 std::ptrdiff_t n,
+                 std::size_t bytes,
+                 std::size_t depth,
+                 std::chrono::steady_clock::rep time,
+                 std::chrono::steady_clock::rep duration)
+{
+  // the callback and its user data are read together
+  const callback_binding binding = load_binding();
+
+  if(binding.cb)
+  {
+    const thrust::trace::event e = {
+      kind,
+      algorithm,
+      backend,
+      n,
+      bytes,
+      depth,
+      std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(time)),
+      std::chrono::steady_clock::duration(duration)
+    };
+
+    binding.cb(e, binding.user_data);
+  }
+}
+
+
+// Reports the entry into an algorithm on construction, and the exit from it
+// on destruction. The state is kept in plain integers so that the scope can
+// live in __host__ __device__ functions.
+class algorithm_scope
+{
+  public:
+    template<typename DerivedPolicy>
+    _CCCL_HOST_DEVICE
+    algorithm_scope(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    const char *name,
+                    std::ptrdiff_t n)
+      : m_name(name),
+        m_backend(nullptr),
+        m_n(n),
+        m_start(0)
+    {
+      NV_IF_TARGET(NV_IS_HOST, (
+        if(thrust::trace::get_callback())
+        {
+          begin(backend_name(thrust::detail::derived_cast(exec)));
+        }
+      ));
+    }
+
+    _CCCL_HOST_DEVICE
+    ~algorithm_scope()
+    {
+      NV_IF_TARGET(NV_IS_HOST, (
+        // the entry into the algorithm was reported
+        if(m_backend)
+        {
+          end();
+        }
+      ));
+    }
+
+  private:
+    algorithm_scope(const algorithm_scope &) = delete;
+    algorithm_scope &operator=(const algorithm_scope &) = delete;
+
+    void begin(const char *backend)
+    {
+      std::vector<algorithm_frame> &stack = algorithm_stack();
+
+      // the overloads which supply default arguments call each other through
+      // the entry points; report them as a single call
+      if(!stack.empty() &&
+         std::strcmp(stack.back().algorithm, m_name) == 0 &&
+         std::strcmp(stack.back().backend, backend) == 0)
+      {
+        return;
+      }
+
+      m_backend = backend;
+      m_start   = now();
+      emit(thrust::trace::event_kind::algorithm_begin, m_name, m_backend, m_n, 0, stack.size(), m_start, 0);
+
+      stack.push_back(algorithm_frame{m_name, m_backend});
+    }
+
+    void end()
+    {
+      std::vector<algorithm_frame> &stack = algorithm_stack();
+      stack.pop_back();
+
+      const std::chrono::steady_clock::rep finish = now();
+      emit(thrust::trace::event_kind::algorithm_end, m_name, m_backend, m_n, 0, stack.size(), finish, finish - m_start);
+    }
+
+    const char                     *m_name;
+    const char                     *m_backend;
+    std::ptrdiff_t                  m_n;
+    std::chrono::steady_clock::rep  m_start;
+};
+
+
+template<typename DerivedPolicy>
+void temporary_storage(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                       thrust::trace::event_kind kind,
+                       std::size_t bytes)
+{
+  if(thrust::trace::get_callback())
+  {
+    const std::vector<algorithm_frame> &stack = algorithm_stack();
+
+    emit(kind,
+         stack.empty() ? nullptr : stack.back().algorithm,
+         backend_name(thrust::detail::derived_cast(exec)),
+         0,
+         bytes,
+         stack.size(),
+         now(),
+         0);
+  }
+}
+
+
+} // end trace
+} // end detail
+THRUST_NAMESPACE_END
+
+#define THRUST_TRACE_ALGORITHM(exec, name, n) \
+  ::thrust::detail::trace::algorithm_scope thrust_trace_algorithm_scope(exec, name, n)
+
+#define THRUST_TRACE_EXTENT(first, last) \
+  ::thrust::detail::trace::extent(first, last)
+
+#define THRUST_TRACE_TEMPORARY_ALLOCATION(exec, bytes) \
+  NV_IF_TARGET(NV_IS_HOST, ( \
+    ::thrust::detail::trace::temporary_storage(exec, ::thrust::trace::event_kind::temporary_allocation, bytes); \
+  ))
+
+#define THRUST_TRACE_TEMPORARY_DEALLOCATION(exec, bytes) \
+  NV_IF_TARGET(NV_IS_HOST, ( \
+    ::thrust::detail::trace::temporary_storage(exec, ::thrust::trace::event_kind::temporary_deallocation, bytes); \
+  ))
+
+#else // THRUST_TRACE
+
+#define THRUST_TRACE_ALGORITHM(exec, name, n)
+#define THRUST_TRACE_EXTENT(first, last)
+#define THRUST_TRACE_TEMPORARY_ALLOCATION(exec, bytes)
+#define THRUST_TRACE_TEMPORARY_DEALLOCATION(exec, bytes)
+
+#endif // THRUST_TRACE
@@ -29,6 +29,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/transform_reduce.h>
 #include <thrust/system/detail/adl/transform_reduce.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -47,6 +48,7 @@ _CCCL_HOST_DEVICE
                               OutputType init,
                               BinaryFunction binary_op)
 {
+  THRUST_TRACE_ALGORITHM(exec, "transform_reduce", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::transform_reduce;
   return transform_reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, unary_op, init, binary_op);
 } // end transform_reduce()
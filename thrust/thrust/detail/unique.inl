@@ -32,6 +32,7 @@
 #include <thrust/system/detail/generic/unique_by_key.h>
 #include <thrust/system/detail/adl/unique.h>
 #include <thrust/system/detail/adl/unique_by_key.h>
+#include <thrust/detail/trace.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -44,6 +45,7 @@ ForwardIterator unique(const thrust::detail::execution_policy_base<DerivedPolicy
                        ForwardIterator first,
                        ForwardIterator last)
 {
+  THRUST_TRACE_ALGORITHM(exec, "unique", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::unique;
   return unique(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end unique()
@@ -59,6 +61,7 @@ ForwardIterator unique(const thrust::detail::execution_policy_base<DerivedPolicy
                        ForwardIterator last,
                        BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "unique", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::unique;
   return unique(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, binary_pred);
 } // end unique()
@@ -74,6 +77,7 @@ OutputIterator unique_copy(const thrust::detail::execution_policy_base<DerivedPo
                            InputIterator last,
                            OutputIterator output)
 {
+  THRUST_TRACE_ALGORITHM(exec, "unique_copy", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::unique_copy;
   return unique_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, output);
 } // end unique_copy()
@@ -91,6 +95,7 @@ OutputIterator unique_copy(const thrust::detail::execution_policy_base<DerivedPo
                            OutputIterator output,
                            BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "unique_copy", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::unique_copy;
   return unique_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, output, binary_pred);
 } // end unique_copy()
@@ -107,6 +112,7 @@ _CCCL_HOST_DEVICE
                 ForwardIterator1 keys_last,
                 ForwardIterator2 values_first)
 {
+  THRUST_TRACE_ALGORITHM(exec, "unique_by_key", THRUST_TRACE_EXTENT(keys_first, keys_last));
   using thrust::system::detail::generic::unique_by_key;
   return unique_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
 } // end unique_by_key()
@@ -125,6 +131,7 @@ _CCCL_HOST_DEVICE
                 ForwardIterator2 values_first,
                 BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "unique_by_key", THRUST_TRACE_EXTENT(keys_first, keys_last));
   using thrust::system::detail::generic::unique_by_key;
   return unique_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, binary_pred);
 } // end unique_by_key()
@@ -145,6 +152,7 @@ _CCCL_HOST_DEVICE
                      OutputIterator1 keys_output,
                      OutputIterator2 values_output)
 {
+  THRUST_TRACE_ALGORITHM(exec, "unique_by_key_copy", THRUST_TRACE_EXTENT(keys_first, keys_last));
   using thrust::system::detail::generic::unique_by_key_copy;
   return unique_by_key_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, keys_output, values_output);
 } // end unique_by_key_copy()
@@ -167,6 +175,7 @@ _CCCL_HOST_DEVICE
                      OutputIterator2 values_output,
                      BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "unique_by_key_copy", THRUST_TRACE_EXTENT(keys_first, keys_last));
   using thrust::system::detail::generic::unique_by_key_copy;
   return unique_by_key_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
 } // end unique_by_key_copy()
@@ -346,6 +355,7 @@ _CCCL_HOST_DEVICE
                  ForwardIterator last,
                  BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM(exec, "unique_count", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::unique_count;
   return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, binary_pred);
 } // end unique_count()
@@ -359,6 +369,7 @@ _CCCL_HOST_DEVICE
                  ForwardIterator first,
                  ForwardIterator last)
 {
+  THRUST_TRACE_ALGORITHM(exec, "unique_count", THRUST_TRACE_EXTENT(first, last));
   using thrust::system::detail::generic::unique_count;
   return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end unique_count()
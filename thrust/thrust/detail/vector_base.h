@@ -37,6 +37,7 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/contiguous_storage.h>
+#include <thrust/detail/init_tags.h>
 
 #include <initializer_list>
 #include <vector>
@@ -91,6 +92,34 @@ template<typename T, typename Alloc>
      */
     explicit vector_base(size_type n, const Alloc &alloc);
 
+    /*! This constructor creates a vector_base with default-initialized
+     *  elements: elements of a trivially default-constructible type are
+     *  left uninitialized.
+     *  \param n The number of elements to create.
+     */
+    vector_base(size_type n, default_init_t);
+
+    /*! This constructor creates a vector_base with default-initialized
+     *  elements: elements of a trivially default-constructible type are
+     *  left uninitialized.
+     *  \param n The number of elements to create.
+     *  \param alloc The allocator to use by this vector_base.
+     */
+    vector_base(size_type n, default_init_t, const Alloc &alloc);
+
+    /*! This constructor creates a vector_base with uninitialized elements.
+     *  \param n The number of elements to create.
+     *  \pre \c T is trivially default-constructible.
+     */
+    vector_base(size_type n, no_init_t);
+
+    /*! This constructor creates a vector_base with uninitialized elements.
+     *  \param n The number of elements to create.
+     *  \param alloc The allocator to use by this vector_base.
+     *  \pre \c T is trivially default-constructible.
+     */
+    vector_base(size_type n, no_init_t, const Alloc &alloc);
+
     /*! This constructor creates a vector_base with copies
      *  of an exemplar element.
      *  \param n The number of elements to initially create.
@@ -229,6 +258,31 @@ template<typename T, typename Alloc>
      */
     void resize(size_type new_size, const value_type &x);
 
+    /*! \brief Resizes this vector_base to the specified number of elements.
+     *  \param new_size Number of elements this vector_base should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  This method will resize this vector_base to the specified number of
+     *  elements. If the number is smaller than this vector_base's current
+     *  size this vector_base is truncated, otherwise this vector_base is
+     *  extended and new elements are default initialized: new elements of
+     *  a trivially default-constructible type are left uninitialized.
+     */
+    void resize(size_type new_size, default_init_t);
+
+    /*! \brief Resizes this vector_base to the specified number of elements.
+     *  \param new_size Number of elements this vector_base should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  This method will resize this vector_base to the specified number of
+     *  elements. If the number is smaller than this vector_base's current
+     *  size this vector_base is truncated, otherwise this vector_base is
+     *  extended and new elements are left uninitialized.
+     *
+     *  \pre \c T is trivially default-constructible.
+     */
+    void resize(size_type new_size, no_init_t);
+
     /*! Returns the number of elements in this vector_base.
      */
     _CCCL_HOST_DEVICE
@@ -521,7 +575,9 @@ template<typename T, typename Alloc>
     template<typename ForwardIterator>
       void range_init(ForwardIterator first, ForwardIterator last, thrust::random_access_traversal_tag);
 
-    void default_init(size_type n);
+    // when value_initialize is false, elements whose initialization would
+    // have no effect other than zeroing memory are left uninitialized
+    void default_init(size_type n, bool value_initialize = true);
 
     void fill_init(size_type n, const T &x);
 
@@ -534,7 +590,10 @@ template<typename T, typename Alloc>
       void insert_dispatch(iterator position, InputIteratorOrIntegralType n, InputIteratorOrIntegralType x, true_type);
 
     // this method appends n default-constructed elements at the end
-    void append(size_type n);
+    void append(size_type n, bool value_initialize = true);
+
+    // this method constructs the n new elements at first of the given storage
+    static void construct_new_elements(storage_type &storage, iterator first, size_type n, bool value_initialize);
 
     // this method performs insertion from a fill value
     void fill_insert(iterator position, size_type n, const T &x);
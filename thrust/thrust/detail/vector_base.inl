@@ -35,6 +35,8 @@
 #include <thrust/detail/minmax.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/allocator/default_construct_range.h>
 
 #include <stdexcept>
 
@@ -79,6 +81,46 @@ template<typename T, typename Alloc>
   default_init(n);
 } // end vector_base::vector_base()
 
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, default_init_t)
+      :m_storage(),
+       m_size(0)
+{
+  default_init(n, false);
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, default_init_t, const Alloc &alloc)
+      :m_storage(alloc),
+       m_size(0)
+{
+  default_init(n, false);
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, no_init_t)
+      :m_storage(),
+       m_size(0)
+{
+  THRUST_STATIC_ASSERT_MSG(thrust::detail::has_trivial_constructor<T>::value,
+                           "thrust::no_init requires a trivially default-constructible element type");
+  default_init(n, false);
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, no_init_t, const Alloc &alloc)
+      :m_storage(alloc),
+       m_size(0)
+{
+  THRUST_STATIC_ASSERT_MSG(thrust::detail::has_trivial_constructor<T>::value,
+                           "thrust::no_init requires a trivially default-constructible element type");
+  default_init(n, false);
+} // end vector_base::vector_base()
+
 template<typename T, typename Alloc>
   vector_base<T,Alloc>
     ::vector_base(size_type n, const value_type &value)
@@ -243,17 +285,31 @@ template<typename T, typename Alloc>
 
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
-    ::default_init(size_type n)
+    ::default_init(size_type n, bool value_initialize)
 {
   if(n > 0)
   {
     m_storage.allocate(n);
     m_size = n;
 
-    m_storage.default_construct_n(begin(), size());
+    construct_new_elements(m_storage, begin(), size(), value_initialize);
   } // end if
 } // end vector_base::default_init()
 
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::construct_new_elements(storage_type &storage, iterator first, size_type n, bool value_initialize)
+{
+  // default initialization of T is a no-op unless T's constructor or the
+  // allocator's construct does something interesting, in which case
+  // default_construct_n must run; otherwise it would only zero the memory
+  if(value_initialize ||
+     thrust::detail::allocator_traits_detail::needs_default_construct_via_allocator<Alloc,T>::value)
+  {
+    storage.default_construct_n(first, n);
+  } // end if
+} // end vector_base::construct_new_elements()
+
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::fill_init(size_type n, const T &x)
@@ -358,6 +414,31 @@ template<typename T, typename Alloc>
   } // end else
 } // end vector_base::resize()
 
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::resize(size_type new_size, default_init_t)
+{
+  if(new_size < size())
+  {
+    iterator new_end = begin();
+    thrust::advance(new_end, new_size);
+    erase(new_end, end());
+  } // end if
+  else
+  {
+    append(new_size - size(), false);
+  } // end else
+} // end vector_base::resize()
+
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::resize(size_type new_size, no_init_t)
+{
+  THRUST_STATIC_ASSERT_MSG(thrust::detail::has_trivial_constructor<T>::value,
+                           "thrust::no_init requires a trivially default-constructible element type");
+  resize(new_size, default_init_t());
+} // end vector_base::resize()
+
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::resize(size_type new_size, const value_type &x)
@@ -925,7 +1006,7 @@ template<typename T, typename Alloc>
 
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
-    ::append(size_type n)
+    ::append(size_type n, bool value_initialize)
 {
   if(n != 0)
   {
@@ -934,7 +1015,7 @@ template<typename T, typename Alloc>
       // we've got room for all of them
 
       // default construct new elements at the end of the vector
-      m_storage.default_construct_n(end(), n);
+      construct_new_elements(m_storage, end(), n, value_initialize);
 
       // extend the size
       m_size += n;
@@ -964,7 +1045,7 @@ template<typename T, typename Alloc>
         new_end = m_storage.uninitialized_copy(begin(), end(), new_storage.begin());
 
         // construct new elements to insert
-        new_storage.default_construct_n(new_end, n);
+        construct_new_elements(new_storage, new_end, n, value_initialize);
         new_end += n;
       } // end try
       catch(...)
@@ -0,0 +1,170 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file deterministic.h
+ *  \brief Execution policies whose reductions and scans give the same
+ *         results whatever the number of threads
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/execute_with_allocator_fwd.h>
+#include <thrust/system/detail/deterministic/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup execution_policies
+ *  \{
+ */
+
+
+/*! \p ordered_summation_t is the type of \p ordered_summation.
+ */
+typedef thrust::system::detail::deterministic::ordered_summation_t ordered_summation_t;
+
+/*! \p exact_summation_t is the type of \p exact_summation.
+ */
+typedef thrust::system::detail::deterministic::exact_summation_t exact_summation_t;
+
+
+/*! \p ordered_summation selects the default summation of \p deterministic:
+ *  the partial sums of the blocks of the input are combined in a fixed
+ *  order, so the result is reproducible, but it is rounded like that of any
+ *  other floating point reduction.
+ */
+THRUST_INLINE_CONSTANT ordered_summation_t ordered_summation;
+
+/*! \p exact_summation makes the \p reduce and \p transform_reduce of a
+ *  \p deterministic policy sum \c float and \c double values exactly, with
+ *  \p thrust::plus, and round the sum once. The result is the correctly
+ *  rounded sum of the input, whatever its order.
+ */
+THRUST_INLINE_CONSTANT exact_summation_t exact_summation;
+
+
+/*! \p deterministic returns an execution policy which executes algorithms like
+ *  \p exec, except that \p reduce, \p transform_reduce, \p reduce_by_key,
+ *  \p inclusive_scan, \p exclusive_scan and the algorithms built upon them give
+ *  bitwise identical results whatever the number of threads.
+ *
+ *  The OpenMP and TBB systems split reductions and scans depending on the
+ *  number of threads and on scheduling, so floating point results differ
+ *  between runs. Under a deterministic policy, the input is split into blocks
+ *  of a fixed number of elements, each block is reduced in order by a single
+ *  thread, and the partial results are combined by a tree whose shape only
+ *  depends on the number of blocks. \p reduce_by_key reduces each run of
+ *  equal keys in order.
+ *
+ *  \param exec The execution policy to execute algorithms with, which is
+ *         \p thrust::seq or the \p par policy of the CPP, OpenMP or TBB system.
+ *         Other systems are rejected at compile time.
+ *  \param summation \p ordered_summation or \p exact_summation.
+ *  \return A deterministic execution policy.
+ *
+ *  \tparam BaseSystem The execution policy template of \p exec.
+ *  \tparam Summation The type of \p summation.
+ *
+ *  The following code snippet demonstrates how to sum a sequence with the
+ *  same result whatever the number of OpenMP threads:
+ *
+ *  \code
+ *  #include <thrust/deterministic.h>
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  ...
+ *  float data[6] = {1e8f, 1.0f, -1e8f, 1.0f, 0.5f, 0.25f};
+ *
+ *  float sum = thrust::reduce(thrust::deterministic(thrust::omp::par), data, data + 6);
+ *
+ *  float exact = thrust::reduce(thrust::deterministic(thrust::omp::par, thrust::exact_summation), data, data + 6);
+ *
+ *  // exact is 2.75f
+ *  \endcode
+ *
+ *  \note The results depend on the size of the blocks, so they may differ
+ *        from those of \p exec. Reductions and scans over iterators without
+ *        random access are executed by a single thread.
+ */
+template<template<typename> class BaseSystem, typename Summation>
+  thrust::system::detail::deterministic::execution_policy<BaseSystem, Summation>
+    deterministic(const thrust::detail::allocator_aware_execution_policy<BaseSystem> &exec,
+                  Summation summation);
+
+
+/*! \p deterministic returns an execution policy which executes algorithms like
+ *  \p exec, except that reductions and scans give bitwise identical results
+ *  whatever the number of threads, with \p ordered_summation.
+ *
+ *  \param exec The execution policy to execute algorithms with.
+ *  \return A deterministic execution policy.
+ *
+ *  \tparam BaseSystem The execution policy template of \p exec.
+ */
+template<template<typename> class BaseSystem>
+  thrust::system::detail::deterministic::execution_policy<BaseSystem>
+    deterministic(const thrust::detail::allocator_aware_execution_policy<BaseSystem> &exec);
+
+
+/*! \p deterministic returns an execution policy which executes algorithms like
+ *  \p exec, which allocates temporary storage with an allocator, e.g.
+ *  <tt>thrust::omp::par(alloc)</tt>. The returned policy allocates its
+ *  temporary storage with the same allocator.
+ *
+ *  \param exec The execution policy to execute algorithms with.
+ *  \param summation \p ordered_summation or \p exact_summation.
+ *  \return A deterministic execution policy.
+ *
+ *  \tparam Allocator The type of the allocator of \p exec.
+ *  \tparam BaseSystem The execution policy template of \p exec.
+ *  \tparam Summation The type of \p summation.
+ */
+template<typename Allocator, template<typename> class BaseSystem, typename Summation>
+  thrust::system::detail::deterministic::execution_policy<BaseSystem, Summation, Allocator>
+    deterministic(thrust::detail::execute_with_allocator<Allocator, BaseSystem> exec,
+                  Summation summation);
+
+
+/*! \p deterministic returns an execution policy which executes algorithms like
+ *  \p exec, which allocates temporary storage with an allocator, with
+ *  \p ordered_summation.
+ *
+ *  \param exec The execution policy to execute algorithms with.
+ *  \return A deterministic execution policy.
+ *
+ *  \tparam Allocator The type of the allocator of \p exec.
+ *  \tparam BaseSystem The execution policy template of \p exec.
+ */
+template<typename Allocator, template<typename> class BaseSystem>
+  thrust::system::detail::deterministic::execution_policy<BaseSystem, thrust::system::detail::deterministic::ordered_summation_t, Allocator>
+    deterministic(thrust::detail::execute_with_allocator<Allocator, BaseSystem> exec);
+
+
+/*! \} // end execution_policies
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/deterministic.inl>
@@ -103,6 +103,47 @@ template<typename T, typename Alloc = thrust::device_allocator<T> >
     explicit device_vector(size_type n, const Alloc &alloc)
       :Parent(n,alloc) {}
 
+    /*! This constructor creates a \p device_vector with the given size
+     *  whose elements are default-initialized: elements of a trivially
+     *  default-constructible type, such as \c int, are left uninitialized.
+     *  \param n The number of elements to initially create.
+     *
+     *  \see default_init
+     */
+    device_vector(size_type n, default_init_t)
+      :Parent(n,default_init_t()) {}
+
+    /*! This constructor creates a \p device_vector with the given size
+     *  whose elements are default-initialized.
+     *  \param n The number of elements to initially create.
+     *  \param alloc The allocator to use by this device_vector.
+     *
+     *  \see default_init
+     */
+    device_vector(size_type n, default_init_t, const Alloc &alloc)
+      :Parent(n,default_init_t(),alloc) {}
+
+    /*! This constructor creates a \p device_vector with the given size
+     *  whose elements are left uninitialized.
+     *  \param n The number of elements to initially create.
+     *  \pre \c T is trivially default-constructible.
+     *
+     *  \see no_init
+     */
+    device_vector(size_type n, no_init_t)
+      :Parent(n,no_init_t()) {}
+
+    /*! This constructor creates a \p device_vector with the given size
+     *  whose elements are left uninitialized.
+     *  \param n The number of elements to initially create.
+     *  \param alloc The allocator to use by this device_vector.
+     *  \pre \c T is trivially default-constructible.
+     *
+     *  \see no_init
+     */
+    device_vector(size_type n, no_init_t, const Alloc &alloc)
+      :Parent(n,no_init_t(),alloc) {}
+
     /*! This constructor creates a \p device_vector with copies
      *  of an exemplar element.
      *  \param n The number of elements to initially create.
@@ -257,6 +298,34 @@ template<typename T, typename Alloc = thrust::device_allocator<T> >
      */
     void resize(size_type new_size, const value_type &x = value_type());
 
+    /*! \brief Resizes this vector to the specified number of elements.
+     *  \param new_size Number of elements this vector should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  This method will resize this vector to the specified number of
+     *  elements.  If the number is smaller than this vector's current
+     *  size this vector is truncated, otherwise this vector is
+     *  extended and new elements are default-initialized: new elements
+     *  of a trivially default-constructible type are left uninitialized.
+     *
+     *  \see default_init
+     */
+    void resize(size_type new_size, default_init_t);
+
+    /*! \brief Resizes this vector to the specified number of elements.
+     *  \param new_size Number of elements this vector should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  This method will resize this vector to the specified number of
+     *  elements.  If the number is smaller than this vector's current
+     *  size this vector is truncated, otherwise this vector is
+     *  extended and new elements are left uninitialized.
+     *
+     *  \pre \c T is trivially default-constructible.
+     *  \see no_init
+     */
+    void resize(size_type new_size, no_init_t);
+
     /*! Returns the number of elements in this vector.
      */
     size_type size(void) const;
@@ -0,0 +1,143 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file generate_random.h
+ *  \brief Fills a range with random numbers drawn from a distribution
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup transformations
+ *  \{
+ */
+
+
+/*! \p generate_random fills the range <tt>[first, last)</tt> with random numbers drawn from a
+ *  distribution.
+ *
+ *  Each element draws from its own stream of a \p philox4x32 engine keyed by \p seed, which starts
+ *  at a counter derived from the element's index. Hence, the result only depends on \p seed, on
+ *  \p dist and on the index of each element, and not on the execution policy nor on the number of
+ *  threads: the same call produces the same numbers on every backend.
+ *
+ *  \p uniform_real_distribution, \p normal_distribution and \p exponential_distribution are sampled
+ *  in closed form from the first block of the element's stream, without any rejection or cached state.
+ *  \p normal_distribution is sampled with the Box-Muller transform. On the host, the blocks of
+ *  consecutive elements of a random access range are then computed together, several at a time. Other
+ *  distributions, such as \p uniform_int_distribution and \p poisson_distribution, draw a fresh copy of
+ *  \p dist from the element's stream, one element at a time.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the range.
+ *  \param last The end of the range.
+ *  \param seed The seed of the random numbers.
+ *  \param dist The distribution to draw from.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward Iterator</a>,
+ *          and \p ForwardIterator is mutable,
+ *          and \c Distribution's \c result_type is convertible to \c ForwardIterator's \c value_type.
+ *  \tparam Distribution is a random number distribution, such as \p thrust::random::normal_distribution.
+ *
+ *  The following code snippet demonstrates how to use \p generate_random to draw normally distributed
+ *  numbers using the \p thrust::device execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/generate_random.h>
+ *  #include <thrust/random.h>
+ *  #include <thrust/device_vector.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  thrust::device_vector<float> v(1 << 20);
+ *
+ *  thrust::generate_random(thrust::device, v.begin(), v.end(), 2011, thrust::random::normal_distribution<float>(0.0f, 1.0f));
+ *
+ *  // v now holds normally distributed numbers, which only depend on the seed 2011
+ *  \endcode
+ *
+ *  \see thrust::tabulate
+ *  \see thrust::random::philox4x32
+ */
+template<typename DerivedPolicy, typename ForwardIterator, typename Distribution>
+_CCCL_HOST_DEVICE
+  void generate_random(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                       ForwardIterator first,
+                       ForwardIterator last,
+                       unsigned long long seed,
+                       const Distribution &dist);
+
+
+/*! \p generate_random fills the range <tt>[first, last)</tt> with random numbers drawn from a
+ *  distribution.
+ *
+ *  Each element draws from its own stream of a \p philox4x32 engine keyed by \p seed, so that the
+ *  result only depends on \p seed, on \p dist and on the index of each element.
+ *
+ *  \param first The beginning of the range.
+ *  \param last The end of the range.
+ *  \param seed The seed of the random numbers.
+ *  \param dist The distribution to draw from.
+ *
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward Iterator</a>,
+ *          and \p ForwardIterator is mutable,
+ *          and \c Distribution's \c result_type is convertible to \c ForwardIterator's \c value_type.
+ *  \tparam Distribution is a random number distribution, such as \p thrust::random::normal_distribution.
+ *
+ *  The following code snippet demonstrates how to use \p generate_random to simulate the number of
+ *  arrivals in each of many intervals:
+ *
+ *  \code
+ *  #include <thrust/generate_random.h>
+ *  #include <thrust/random.h>
+ *  #include <thrust/host_vector.h>
+ *  ...
+ *  thrust::host_vector<int> arrivals(1000);
+ *
+ *  thrust::generate_random(arrivals.begin(), arrivals.end(), 13, thrust::random::poisson_distribution<int>(4.5));
+ *  \endcode
+ *
+ *  \see thrust::tabulate
+ *  \see thrust::random::philox4x32
+ */
+template<typename ForwardIterator, typename Distribution>
+  void generate_random(ForwardIterator first,
+                       ForwardIterator last,
+                       unsigned long long seed,
+                       const Distribution &dist);
+
+
+/*! \} // end transformations
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/generate_random.inl>
+
@@ -0,0 +1,374 @@
+/*
+ *  Copyright 2018 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief Memory resource that maps memory directly from the operating
+ *  system, with control over huge pages and NUMA placement.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/detail/integer_math.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <new>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <sys/mman.h>
+#  include <unistd.h>
+#  if defined(__linux__)
+#    include <sys/syscall.h>
+#  endif
+#  define THRUST_MR_HAS_MMAP 1
+#endif
+
+#if defined(THRUST_MR_HAS_MMAP)
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The NUMA placement policies supported by \p mmap_resource.
+ */
+enum class numa_policy
+{
+    /*! The operating system's default placement, which is usually on the node of the thread which first touches a page.
+     */
+    local,
+    /*! Pages are interleaved round-robin over the nodes of \p mmap_options::node_mask.
+     */
+    interleave,
+    /*! Pages are only placed on the nodes of \p mmap_options::node_mask.
+     */
+    bind
+};
+
+/*! A type used for configuring \p mmap_resource.
+ */
+struct mmap_options
+{
+    /*! Asks the kernel to back the mappings with transparent huge pages, with <tt>madvise(MADV_HUGEPAGE)</tt>. Mappings
+     *      are then aligned to \p transparent_huge_page_size, so that they can be backed by huge pages throughout. This is
+     *      a hint, which is silently ignored where transparent huge pages are unsupported.
+     */
+    bool transparent_huge_pages;
+    /*! The size of a transparent huge page, which is used to align mappings when \p transparent_huge_pages is true.
+     */
+    std::size_t transparent_huge_page_size;
+
+    /*! Backs the mappings with pages from the kernel's pool of explicitly reserved huge pages, with \p MAP_HUGETLB.
+     *      Allocations fail with \p std::bad_alloc when the pool is exhausted.
+     */
+    bool explicit_huge_pages;
+    /*! The size of an explicit huge page, e.g. 2 MiB or 1 GiB, which must be a power of two supported by the kernel. Zero
+     *      selects the kernel's default huge page size, as returned by \p mmap_resource::default_huge_page_size.
+     */
+    std::size_t explicit_huge_page_size;
+
+    /*! Prefaults the pages of the mappings, so that the first touch of the memory doesn't fault. The pages are faulted in
+     *      after the huge page hint and the NUMA policy are applied, with <tt>madvise(MADV_POPULATE_WRITE)</tt> where the
+     *      kernel supports it and by writing to every page otherwise. Note that this faults every page from the allocating
+     *      thread, so with \p numa_policy::local it defeats first touch NUMA placement.
+     */
+    bool populate;
+
+    /*! The NUMA placement of the pages of the mappings, applied with \p mbind.
+     */
+    numa_policy policy;
+    /*! The set of NUMA nodes used by \p numa_policy::interleave and \p numa_policy::bind; bit \c i stands for node \c i.
+     */
+    unsigned long node_mask;
+
+    /*! Checks if the options are self-consistent.
+     *
+     *  \returns true if the options are self-consistent, false otherwise.
+     */
+    bool validate() const
+    {
+        if (transparent_huge_pages && !detail::is_power_of_2(transparent_huge_page_size)) return false;
+        if (explicit_huge_page_size != 0 && !detail::is_power_of_2(explicit_huge_page_size)) return false;
+        if (transparent_huge_pages && explicit_huge_pages) return false;
+        if (policy != numa_policy::local && node_mask == 0) return false;
+
+        return true;
+    }
+};
+
+/*! A memory resource which maps anonymous memory directly from the operating system with \p mmap, and returns it with
+ *      \p munmap. Every allocation is rounded up to whole pages, so this resource is intended for large, long-lived
+ *      buffers, or as the upstream of a pooling resource such as \p unsynchronized_pool_resource, which carves small
+ *      allocations out of large chunks.
+ *
+ *  Large buffers which are accessed randomly suffer from TLB misses when backed by regular pages; \p mmap_options can
+ *      request transparent or explicit huge pages for them, and select where on a NUMA machine their pages are placed.
+ */
+class mmap_resource final : public memory_resource<>
+{
+public:
+    /*! Returns the default options: regular pages, no prefaulting, and the default NUMA placement.
+     */
+    static mmap_options get_default_options()
+    {
+        mmap_options ret;
+
+        ret.transparent_huge_pages = false;
+        ret.transparent_huge_page_size = 2 * 1024 * 1024;
+        ret.explicit_huge_pages = false;
+        ret.explicit_huge_page_size = 0;
+        ret.populate = false;
+        ret.policy = numa_policy::local;
+        ret.node_mask = 0;
+
+        return ret;
+    }
+
+    /*! Constructor.
+     *
+     *  \param options the options to map memory with
+     *
+     *  \throws std::invalid_argument if the options are not self-consistent.
+     */
+    mmap_resource(mmap_options options = get_default_options())
+        : m_options(options)
+    {
+        if (!m_options.validate())
+        {
+            throw std::invalid_argument("thrust::mr::mmap_resource: inconsistent mmap_options");
+        }
+    }
+
+    /*! Returns the options this resource maps memory with.
+     */
+    const mmap_options & options() const
+    {
+        return m_options;
+    }
+
+    /*! Returns the size of the kernel's default huge page, which is read from the \p Hugepagesize field of
+     *      <tt>/proc/meminfo</tt> on first use. This is 2 MiB on most x86-64 systems, but e.g. 512 MiB on arm64 systems
+     *      with 64 KiB pages. Where it can't be read, 2 MiB is assumed.
+     */
+    static std::size_t default_huge_page_size()
+    {
+        static const std::size_t size = read_default_huge_page_size();
+        return size;
+    }
+
+    void * do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        const std::size_t granularity = mapping_granularity();
+        const std::size_t size = round_up(bytes ? bytes : 1, granularity);
+
+        // mmap only guarantees alignment to the size of the pages it maps; for larger alignments, map enough to align
+        //   the start of the allocation, and unmap the excess on either side of it
+        const std::size_t base_alignment = m_options.explicit_huge_pages ? granularity : page_size();
+        if (m_options.transparent_huge_pages && alignment < granularity)
+        {
+            alignment = granularity;
+        }
+        const std::size_t slack = alignment > base_alignment ? alignment - base_alignment : 0;
+
+        void * mapping = ::mmap(nullptr, size + slack, PROT_READ | PROT_WRITE, map_flags(), -1, 0);
+        if (mapping == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+
+        char * begin = static_cast<char *>(mapping);
+        char * ptr = reinterpret_cast<char *>(round_up(reinterpret_cast<std::size_t>(begin), alignment));
+
+        const std::size_t head = ptr - begin;
+        const std::size_t tail = slack - head;
+        if (head != 0)
+        {
+            ::munmap(begin, head);
+        }
+        if (tail != 0)
+        {
+            ::munmap(ptr + size, tail);
+        }
+
+        if (!advise(ptr, size) || (m_options.populate && !populate(ptr, size)))
+        {
+            ::munmap(ptr, size);
+            throw std::bad_alloc();
+        }
+
+        return ptr;
+    }
+
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        (void)alignment;
+        ::munmap(p, round_up(bytes ? bytes : 1, mapping_granularity()));
+    }
+
+private:
+    mmap_options m_options;
+
+    static std::size_t page_size()
+    {
+        return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    }
+
+    static std::size_t round_up(std::size_t n, std::size_t multiple)
+    {
+        return (n + multiple - 1) / multiple * multiple;
+    }
+
+    static std::size_t read_default_huge_page_size()
+    {
+        std::size_t kibibytes = 0;
+
+        if (std::FILE * meminfo = std::fopen("/proc/meminfo", "r"))
+        {
+            char line[128];
+            while (std::fgets(line, sizeof(line), meminfo))
+            {
+                if (std::sscanf(line, "Hugepagesize: %zu kB", &kibibytes) == 1)
+                {
+                    break;
+                }
+            }
+            std::fclose(meminfo);
+        }
+
+        const std::size_t size = kibibytes * 1024;
+        return size != 0 && detail::is_power_of_2(size) ? size : 2 * 1024 * 1024;
+    }
+
+    // the size of the units in which memory is mapped and unmapped
+    std::size_t mapping_granularity() const
+    {
+        if (m_options.explicit_huge_pages)
+        {
+            return m_options.explicit_huge_page_size ? m_options.explicit_huge_page_size : default_huge_page_size();
+        }
+        if (m_options.transparent_huge_pages)
+        {
+            return m_options.transparent_huge_page_size;
+        }
+        return page_size();
+    }
+
+    int map_flags() const
+    {
+        // no MAP_POPULATE: the pages must only be faulted in once advise has applied the huge page hint and the NUMA
+        //   policy to the mapping
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+        if (m_options.explicit_huge_pages)
+        {
+#if defined(MAP_HUGETLB)
+            flags |= MAP_HUGETLB;
+#  if defined(MAP_HUGE_SHIFT)
+            if (m_options.explicit_huge_page_size != 0)
+            {
+                flags |= static_cast<int>(detail::log2(m_options.explicit_huge_page_size)) << MAP_HUGE_SHIFT;
+            }
+#  endif
+#else
+            // explicit huge pages are unsupported, which is an error rather than a hint
+            throw std::bad_alloc();
+#endif
+        }
+
+        return flags;
+    }
+
+    // applies the huge page hint and the NUMA policy to a fresh mapping; returns false if the NUMA policy
+    //   couldn't be applied
+    bool advise(void * ptr, std::size_t size) const
+    {
+#if defined(MADV_HUGEPAGE)
+        if (m_options.transparent_huge_pages)
+        {
+            ::madvise(ptr, size, MADV_HUGEPAGE);
+        }
+#endif
+
+        if (m_options.policy == numa_policy::local)
+        {
+            return true;
+        }
+
+#if defined(__linux__) && defined(SYS_mbind)
+        // the values of MPOL_BIND and MPOL_INTERLEAVE from <linux/mempolicy.h>, which spares a dependency on libnuma
+        const int mode = m_options.policy == numa_policy::bind ? 2 : 3;
+        // the kernel only reads the first max_node - 1 bits of the mask
+        const unsigned long max_node = sizeof(m_options.node_mask) * 8 + 1;
+
+        return ::syscall(SYS_mbind, ptr, size, mode, &m_options.node_mask, max_node, 0) == 0;
+#else
+        (void)ptr;
+        (void)size;
+        return false;
+#endif
+    }
+
+    // faults in the pages of a mapping which advise has been applied to; returns false if they couldn't be allocated
+    bool populate(void * ptr, std::size_t size) const
+    {
+#if defined(MADV_POPULATE_WRITE)
+        if (::madvise(ptr, size, MADV_POPULATE_WRITE) == 0)
+        {
+            return true;
+        }
+        // kernels older than 5.14 don't know MADV_POPULATE_WRITE; any other error means that the pages are unavailable
+        if (errno != EINVAL)
+        {
+            return false;
+        }
+#endif
+
+        // anonymous memory is zeroed, so writing a zero to a page only faults it in
+        const std::size_t step = m_options.explicit_huge_pages ? mapping_granularity() : page_size();
+        volatile char * bytes = static_cast<volatile char *>(ptr);
+        for (std::size_t offset = 0; offset < size; offset += step)
+        {
+            bytes[offset] = 0;
+        }
+
+        return true;
+    }
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
+
+#endif // THRUST_MR_HAS_MMAP
@@ -1205,6 +1205,309 @@ template<typename InputIterator1,
                           Predicate pred);
 
 
+/*! \p partition3 reorders the elements <tt>[first, last)</tt> into three groups
+ *  based on the function objects \p pred1 and \p pred2. All of the elements that
+ *  satisfy \p pred1 precede all of the elements that fail to satisfy \p pred1 but
+ *  satisfy \p pred2, which in turn precede all of the remaining elements. The
+ *  postcondition is that, for some iterators \c middle1 and \c middle2 in the range
+ *  <tt>[first, last)</tt>, <tt>pred1(*i)</tt> is \c true for every iterator \c i in
+ *  the range <tt>[first, middle1)</tt>, <tt>!pred1(*i) && pred2(*i)</tt> is \c true
+ *  for every iterator \c i in the range <tt>[middle1, middle2)</tt>, and both
+ *  predicates are \c false for every iterator \c i in the range <tt>[middle2, last)</tt>.
+ *
+ *  \p partition3 is stable, i.e., the relative order of elements within each of
+ *  the three groups is preserved. It is equivalent to, but cheaper than, two
+ *  consecutive calls to \p stable_partition.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence to reorder.
+ *  \param last The end of the sequence to reorder.
+ *  \param pred1 A function object which selects the elements of the first group.
+ *  \param pred2 A function object which selects the elements of the second group
+ *               among those rejected by \p pred1.
+ *  \return A \p pair of iterators <tt>(middle1, middle2)</tt> referring to the first
+ *          element of the second group and the first element of the third group.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward Iterator</a>,
+ *          and \p ForwardIterator's \c value_type is convertible to \p Predicate1's and \p Predicate2's \c argument_type,
+ *          and \p ForwardIterator is mutable.
+ *  \tparam Predicate1 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *  \tparam Predicate2 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *
+ *  The following code snippet demonstrates how to use \p partition3 to reorder a
+ *  sequence so that multiples of three precede the remaining even numbers, which precede
+ *  the remaining odd numbers, using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/partition.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  struct is_multiple_of_three
+ *  {
+ *    __host__ __device__
+ *    bool operator()(const int &x)
+ *    {
+ *      return (x % 3) == 0;
+ *    }
+ *  };
+ *
+ *  struct is_even
+ *  {
+ *    __host__ __device__
+ *    bool operator()(const int &x)
+ *    {
+ *      return (x % 2) == 0;
+ *    }
+ *  };
+ *  ...
+ *  int A[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+ *  const int N = sizeof(A)/sizeof(int);
+ *  thrust::pair<int*,int*> ends = thrust::partition3(thrust::host,
+ *                                                    A, A + N,
+ *                                                    is_multiple_of_three(),
+ *                                                    is_even());
+ *  // A is now {3, 6, 9, 2, 4, 8, 10, 1, 5, 7}
+ *  // ends.first - A is 3
+ *  // ends.second - A is 7
+ *  \endcode
+ *
+ *  \see \p stable_partition
+ *  \see \p bucket_partition
+ */
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Predicate1,
+         typename Predicate2>
+_CCCL_HOST_DEVICE
+  thrust::pair<ForwardIterator,ForwardIterator>
+    partition3(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last,
+               Predicate1 pred1,
+               Predicate2 pred2);
+
+
+/*! \p partition3 reorders the elements <tt>[first, last)</tt> into three groups
+ *  based on the function objects \p pred1 and \p pred2. All of the elements that
+ *  satisfy \p pred1 precede all of the elements that fail to satisfy \p pred1 but
+ *  satisfy \p pred2, which in turn precede all of the remaining elements. The
+ *  postcondition is that, for some iterators \c middle1 and \c middle2 in the range
+ *  <tt>[first, last)</tt>, <tt>pred1(*i)</tt> is \c true for every iterator \c i in
+ *  the range <tt>[first, middle1)</tt>, <tt>!pred1(*i) && pred2(*i)</tt> is \c true
+ *  for every iterator \c i in the range <tt>[middle1, middle2)</tt>, and both
+ *  predicates are \c false for every iterator \c i in the range <tt>[middle2, last)</tt>.
+ *
+ *  \p partition3 is stable, i.e., the relative order of elements within each of
+ *  the three groups is preserved. It is equivalent to, but cheaper than, two
+ *  consecutive calls to \p stable_partition.
+ *
+ *  \param first The beginning of the sequence to reorder.
+ *  \param last The end of the sequence to reorder.
+ *  \param pred1 A function object which selects the elements of the first group.
+ *  \param pred2 A function object which selects the elements of the second group
+ *               among those rejected by \p pred1.
+ *  \return A \p pair of iterators <tt>(middle1, middle2)</tt> referring to the first
+ *          element of the second group and the first element of the third group.
+ *
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward Iterator</a>,
+ *          and \p ForwardIterator's \c value_type is convertible to \p Predicate1's and \p Predicate2's \c argument_type,
+ *          and \p ForwardIterator is mutable.
+ *  \tparam Predicate1 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *  \tparam Predicate2 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *
+ *  The following code snippet demonstrates how to use \p partition3 to reorder a
+ *  sequence so that multiples of three precede the remaining even numbers, which precede
+ *  the remaining odd numbers.
+ *
+ *  \code
+ *  #include <thrust/partition.h>
+ *  ...
+ *  struct is_multiple_of_three
+ *  {
+ *    __host__ __device__
+ *    bool operator()(const int &x)
+ *    {
+ *      return (x % 3) == 0;
+ *    }
+ *  };
+ *
+ *  struct is_even
+ *  {
+ *    __host__ __device__
+ *    bool operator()(const int &x)
+ *    {
+ *      return (x % 2) == 0;
+ *    }
+ *  };
+ *  ...
+ *  int A[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+ *  const int N = sizeof(A)/sizeof(int);
+ *  thrust::pair<int*,int*> ends = thrust::partition3(A, A + N,
+ *                                                    is_multiple_of_three(),
+ *                                                    is_even());
+ *  // A is now {3, 6, 9, 2, 4, 8, 10, 1, 5, 7}
+ *  // ends.first - A is 3
+ *  // ends.second - A is 7
+ *  \endcode
+ *
+ *  \see \p stable_partition
+ *  \see \p bucket_partition
+ */
+template<typename ForwardIterator,
+         typename Predicate1,
+         typename Predicate2>
+  thrust::pair<ForwardIterator,ForwardIterator>
+    partition3(ForwardIterator first,
+               ForwardIterator last,
+               Predicate1 pred1,
+               Predicate2 pred2);
+
+
+/*! \p bucket_partition reorders the elements <tt>[first, last)</tt> into
+ *  \p num_buckets contiguous groups. The function object \p bucket_op maps each
+ *  element to the index of its bucket in the range <tt>[0, num_buckets)</tt>, and
+ *  all of the elements of bucket \c i precede all of the elements of bucket \c i+1.
+ *  The relative order of elements within each bucket is preserved.
+ *
+ *  On return, <tt>offsets[i]</tt> holds the position of the first element of bucket \c i
+ *  relative to \p first for every \c i in <tt>[0, num_buckets)</tt>, and
+ *  <tt>offsets[num_buckets]</tt> holds <tt>last - first</tt>. Bucket \c i therefore
+ *  occupies <tt>[first + offsets[i], first + offsets[i+1])</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence to reorder.
+ *  \param last The end of the sequence to reorder.
+ *  \param bucket_op A function object which maps each element of <tt>[first, last)</tt>
+ *                   to its bucket index.
+ *  \param num_buckets The number of buckets.
+ *  \param offsets The beginning of the output sequence of <tt>num_buckets + 1</tt> bucket offsets.
+ *  \return The end of the output sequence of bucket offsets, <tt>offsets + num_buckets + 1</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward Iterator</a>,
+ *          and \p ForwardIterator's \c value_type is convertible to \p BucketFunction's \c argument_type,
+ *          and \p ForwardIterator is mutable.
+ *  \tparam BucketFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/unary_function">Unary Function</a>
+ *          whose \c result_type is convertible to \p Size.
+ *  \tparam Size is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>,
+ *          and \p ForwardIterator's \c difference_type is convertible to \p OutputIterator's \c value_type.
+ *
+ *  \pre <tt>bucket_op(*i)</tt> shall be in the range <tt>[0, num_buckets)</tt> for every iterator \c i in <tt>[first, last)</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p bucket_partition to group a
+ *  sequence by remainder modulo three using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/partition.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  struct mod_three
+ *  {
+ *    __host__ __device__
+ *    int operator()(const int &x)
+ *    {
+ *      return x % 3;
+ *    }
+ *  };
+ *  ...
+ *  int A[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+ *  int offsets[4];
+ *  const int N = sizeof(A)/sizeof(int);
+ *  thrust::bucket_partition(thrust::host, A, A + N, mod_three(), 3, offsets);
+ *  // A is now {3, 6, 9, 1, 4, 7, 10, 2, 5, 8}
+ *  // offsets is now {0, 3, 7, 10}
+ *  \endcode
+ *
+ *  \see \p partition3
+ *  \see \p stable_partition
+ */
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+_CCCL_HOST_DEVICE
+  OutputIterator bucket_partition(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  ForwardIterator first,
+                                  ForwardIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets);
+
+
+/*! \p bucket_partition reorders the elements <tt>[first, last)</tt> into
+ *  \p num_buckets contiguous groups. The function object \p bucket_op maps each
+ *  element to the index of its bucket in the range <tt>[0, num_buckets)</tt>, and
+ *  all of the elements of bucket \c i precede all of the elements of bucket \c i+1.
+ *  The relative order of elements within each bucket is preserved.
+ *
+ *  On return, <tt>offsets[i]</tt> holds the position of the first element of bucket \c i
+ *  relative to \p first for every \c i in <tt>[0, num_buckets)</tt>, and
+ *  <tt>offsets[num_buckets]</tt> holds <tt>last - first</tt>. Bucket \c i therefore
+ *  occupies <tt>[first + offsets[i], first + offsets[i+1])</tt>.
+ *
+ *  \param first The beginning of the sequence to reorder.
+ *  \param last The end of the sequence to reorder.
+ *  \param bucket_op A function object which maps each element of <tt>[first, last)</tt>
+ *                   to its bucket index.
+ *  \param num_buckets The number of buckets.
+ *  \param offsets The beginning of the output sequence of <tt>num_buckets + 1</tt> bucket offsets.
+ *  \return The end of the output sequence of bucket offsets, <tt>offsets + num_buckets + 1</tt>.
+ *
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward Iterator</a>,
+ *          and \p ForwardIterator's \c value_type is convertible to \p BucketFunction's \c argument_type,
+ *          and \p ForwardIterator is mutable.
+ *  \tparam BucketFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/unary_function">Unary Function</a>
+ *          whose \c result_type is convertible to \p Size.
+ *  \tparam Size is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>,
+ *          and \p ForwardIterator's \c difference_type is convertible to \p OutputIterator's \c value_type.
+ *
+ *  \pre <tt>bucket_op(*i)</tt> shall be in the range <tt>[0, num_buckets)</tt> for every iterator \c i in <tt>[first, last)</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p bucket_partition to group a
+ *  sequence by remainder modulo three.
+ *
+ *  \code
+ *  #include <thrust/partition.h>
+ *  ...
+ *  struct mod_three
+ *  {
+ *    __host__ __device__
+ *    int operator()(const int &x)
+ *    {
+ *      return x % 3;
+ *    }
+ *  };
+ *  ...
+ *  int A[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+ *  int offsets[4];
+ *  const int N = sizeof(A)/sizeof(int);
+ *  thrust::bucket_partition(A, A + N, mod_three(), 3, offsets);
+ *  // A is now {3, 6, 9, 1, 4, 7, 10, 2, 5, 8}
+ *  // offsets is now {0, 3, 7, 10}
+ *  \endcode
+ *
+ *  \see \p partition3
+ *  \see \p stable_partition
+ */
+template<typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator bucket_partition(ForwardIterator first,
+                                  ForwardIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets);
+
+
 /*! \} // end stream_compaction
  */
 
@@ -0,0 +1,285 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file pipeline.h
+ *  \brief Fuses transformations, filters, scans and reductions into a
+ *         single traversal
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/pipeline_expression.h>
+#include <thrust/detail/pipeline_stages.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/iterator_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup algorithms
+ */
+
+/*! \addtogroup pipelines
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p pipeline starts a lazy pipeline over the range <tt>[first, last)</tt>.
+ *  Stages from \p thrust::pipes are applied to it with <tt>operator|</tt>,
+ *  and nothing is evaluated until a terminal stage, \p pipes::into or
+ *  \p pipes::reduce, is applied.
+ *
+ *  A chain of \p transform, \p filter and \p scan algorithms writes each
+ *  intermediate result to memory and reads it back. A pipeline instead
+ *  passes each element through all of its stages before it moves on to the
+ *  next one, so no intermediate sequence is ever stored. The OpenMP and TBB
+ *  systems split the input into one tile per thread. Scans and filters
+ *  depend on the elements before them, so each scan adds a pass over the
+ *  input which only computes the carry into each tile; the extra memory is
+ *  proportional to the number of tiles.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \return An expression to which stages may be applied with <tt>operator|</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *
+ *  The following code snippet demonstrates how to use \p pipeline to scan the
+ *  squares of the odd elements of a sequence, without storing the squares
+ *  or the odd elements, using the \p thrust::host execution policy for
+ *  parallelization:
+ *
+ *  \code
+ *  #include <thrust/pipeline.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  struct square { __host__ __device__ int operator()(int x) const { return x * x; } };
+ *  struct is_odd { __host__ __device__ bool operator()(int x) const { return x % 2; } };
+ *  ...
+ *  int data[6] = {1, 2, 3, 4, 5, 6};
+ *  int result[6];
+ *
+ *  int *end = thrust::pipeline(thrust::host, data, data + 6)
+ *           | thrust::pipes::filter(is_odd())
+ *           | thrust::pipes::transform(square())
+ *           | thrust::pipes::inclusive_scan()
+ *           | thrust::pipes::into(result);
+ *
+ *  // result is now {1, 10, 35}
+ *  // end - result is 3
+ *  \endcode
+ *
+ *  \see \p pipes::transform
+ *  \see \p pipes::filter
+ *  \see \p pipes::inclusive_scan
+ *  \see \p pipes::exclusive_scan
+ *  \see \p pipes::into
+ *  \see \p pipes::reduce
+ */
+template<typename DerivedPolicy, typename InputIterator>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_expression<DerivedPolicy, InputIterator>
+    pipeline(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+             InputIterator first,
+             InputIterator last);
+
+
+/*! \p pipeline starts a lazy pipeline over the range <tt>[first, last)</tt>.
+ *  Stages from \p thrust::pipes are applied to it with <tt>operator|</tt>,
+ *  and nothing is evaluated until a terminal stage, \p pipes::into or
+ *  \p pipes::reduce, is applied.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \return An expression to which stages may be applied with <tt>operator|</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *
+ *  The following code snippet demonstrates how to use \p pipeline to sum the
+ *  even elements of a sequence.
+ *
+ *  \code
+ *  #include <thrust/pipeline.h>
+ *  #include <thrust/host_vector.h>
+ *  ...
+ *  struct is_even { __host__ __device__ bool operator()(int x) const { return x % 2 == 0; } };
+ *  ...
+ *  thrust::host_vector<int> v(6);
+ *  v[0] = 1; v[1] = 2; v[2] = 3; v[3] = 4; v[4] = 5; v[5] = 6;
+ *
+ *  int sum = thrust::pipeline(v.begin(), v.end())
+ *          | thrust::pipes::filter(is_even())
+ *          | thrust::pipes::reduce(0);
+ *
+ *  // sum is 12
+ *  \endcode
+ */
+template<typename InputIterator>
+  thrust::detail::pipeline_expression<typename thrust::iterator_system<InputIterator>::type, InputIterator>
+    pipeline(InputIterator first,
+             InputIterator last);
+
+
+/*! \p thrust::pipes contains the stages of a \p pipeline.
+ */
+namespace pipes
+{
+
+
+/*! \p transform applies \p f to each element which reaches it.
+ *
+ *  \param f The unary function to apply.
+ *
+ *  \tparam UnaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/unary_function">Unary Function</a>
+ *          whose argument type is the type of the elements which reach the stage.
+ */
+template<typename UnaryFunction>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::transform_stage<UnaryFunction>
+    transform(UnaryFunction f);
+
+
+/*! \p filter passes on the elements which reach it and satisfy \p pred, and
+ *  drops the others.
+ *
+ *  \param pred The predicate to test elements with.
+ *
+ *  \tparam Predicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/Predicate">Predicate</a>.
+ */
+template<typename Predicate>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::filter_stage<Predicate>
+    filter(Predicate pred);
+
+
+/*! \p inclusive_scan replaces each element which reaches it with the sum of
+ *  that element and all those which reached it before. Like
+ *  \p thrust::inclusive_scan, the sums have the type of the elements.
+ */
+_CCCL_HOST_DEVICE
+  inline thrust::detail::pipeline_detail::inclusive_scan_stage<thrust::plus<> >
+    inclusive_scan();
+
+
+/*! \p inclusive_scan replaces each element which reaches it with the result
+ *  of \p op applied to that element and all those which reached it before.
+ *
+ *  \param op The associative function used to combine elements.
+ *
+ *  \tparam AssociativeOperator is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>.
+ */
+template<typename AssociativeOperator>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::inclusive_scan_stage<AssociativeOperator>
+    inclusive_scan(AssociativeOperator op);
+
+
+/*! \p exclusive_scan replaces each element which reaches it with the sum of
+ *  \p init and all the elements which reached it before.
+ *
+ *  \param init The initial value.
+ *
+ *  \tparam T is the type of the sums.
+ */
+template<typename T>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::exclusive_scan_stage<T, thrust::plus<> >
+    exclusive_scan(T init);
+
+
+/*! \p exclusive_scan replaces each element which reaches it with the result
+ *  of \p op applied to \p init and all the elements which reached it before.
+ *
+ *  \param init The initial value.
+ *  \param op The associative function used to combine elements.
+ *
+ *  \tparam T is the type of the partial results.
+ *  \tparam AssociativeOperator is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>.
+ */
+template<typename T, typename AssociativeOperator>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::exclusive_scan_stage<T, AssociativeOperator>
+    exclusive_scan(T init, AssociativeOperator op);
+
+
+/*! \p into is a terminal stage which writes the elements which reach it to
+ *  consecutive positions starting at \p result. Applying it evaluates the
+ *  pipeline, and returns the end of the output sequence.
+ *
+ *  \param result The beginning of the output sequence.
+ *
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *
+ *  \pre The output sequence shall not overlap the input sequence.
+ */
+template<typename OutputIterator>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::into_stage<OutputIterator>
+    into(OutputIterator result);
+
+
+/*! \p reduce is a terminal stage which returns the sum of \p init and the
+ *  elements which reach it. Applying it evaluates the pipeline.
+ *
+ *  \param init The initial value.
+ *
+ *  \tparam T is the type of the result.
+ */
+template<typename T>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::reduce_stage<T, thrust::plus<> >
+    reduce(T init);
+
+
+/*! \p reduce is a terminal stage which returns the result of \p op applied
+ *  to \p init and the elements which reach it. Applying it evaluates the
+ *  pipeline.
+ *
+ *  \param init The initial value.
+ *  \param op The associative function used to combine elements.
+ *
+ *  \tparam T is the type of the result.
+ *  \tparam AssociativeOperator is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>.
+ */
+template<typename T, typename AssociativeOperator>
+_CCCL_HOST_DEVICE
+  thrust::detail::pipeline_detail::reduce_stage<T, AssociativeOperator>
+    reduce(T init, AssociativeOperator op);
+
+
+} // end pipes
+
+
+/*! \} // end pipelines
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/pipeline.inl>
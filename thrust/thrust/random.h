@@ -35,13 +35,17 @@
 #include <thrust/random/discard_block_engine.h>
 #include <thrust/random/linear_congruential_engine.h>
 #include <thrust/random/linear_feedback_shift_engine.h>
+#include <thrust/random/philox_engine.h>
 #include <thrust/random/subtract_with_carry_engine.h>
+#include <thrust/random/threefry_engine.h>
 #include <thrust/random/xor_combine_engine.h>
 
 // distributions
 #include <thrust/random/uniform_int_distribution.h>
 #include <thrust/random/uniform_real_distribution.h>
 #include <thrust/random/normal_distribution.h>
+#include <thrust/random/exponential_distribution.h>
+#include <thrust/random/poisson_distribution.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -0,0 +1,101 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/cstdint.h>
+#include <cstddef> // for size_t
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// operations on the multiword counters of counter-based engines, whose words
+// hold w bits each and whose least significant word comes first
+template<typename UIntType, size_t w, size_t n>
+  struct counter_based_engine_counter
+{
+  static const UIntType wordmask =
+    (w >= sizeof(UIntType) * 8) ? ~UIntType(0) : ((UIntType(1) << (w % (sizeof(UIntType) * 8))) - 1);
+
+  _CCCL_HOST_DEVICE
+  static void reset(UIntType (&c)[n])
+  {
+    for(size_t i = 0; i < n; ++i)
+    {
+      c[i] = 0;
+    }
+  }
+
+  // adds z to c, modulo 2^(n * w)
+  _CCCL_HOST_DEVICE
+  static void add(UIntType (&c)[n], unsigned long long z)
+  {
+    bool carry = false;
+
+    for(size_t i = 0; i < n && (z != 0 || carry); ++i)
+    {
+      const UIntType part = static_cast<UIntType>(z) & wordmask;
+      z = (w >= 64) ? 0 : (z >> (w % 64));
+
+      const UIntType old = c[i];
+      UIntType sum = (old + part) & wordmask;
+      bool overflow = sum < old;
+
+      if(carry)
+      {
+        sum = (sum + 1) & wordmask;
+        overflow |= (sum == 0);
+      }
+
+      c[i]  = sum;
+      carry = overflow;
+    }
+  }
+
+  _CCCL_HOST_DEVICE
+  static bool equal(const UIntType (&lhs)[n], const UIntType (&rhs)[n])
+  {
+    bool result = true;
+
+    for(size_t i = 0; i < n; ++i)
+    {
+      result &= (lhs[i] == rhs[i]);
+    }
+
+    return result;
+  }
+}; // end counter_based_engine_counter
+
+} // end detail
+
+} // end random
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,225 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/exponential_distribution.h>
+#include <thrust/random/uniform_real_distribution.h>
+#include <cmath>
+#include <limits>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+
+template<typename RealType>
+  _CCCL_HOST_DEVICE
+  exponential_distribution<RealType>
+    ::exponential_distribution(RealType lambda)
+      :m_param(lambda)
+{
+} // end exponential_distribution::exponential_distribution()
+
+template<typename RealType>
+  _CCCL_HOST_DEVICE
+  void exponential_distribution<RealType>
+    ::reset(void)
+{
+} // end exponential_distribution::reset()
+
+template<typename RealType>
+  template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    typename exponential_distribution<RealType>::result_type
+      exponential_distribution<RealType>
+        ::operator()(UniformRandomNumberGenerator &urng)
+{
+  return operator()(urng, m_param);
+} // end exponential_distribution::operator()()
+
+template<typename RealType>
+  template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    typename exponential_distribution<RealType>::result_type
+      exponential_distribution<RealType>
+        ::operator()(UniformRandomNumberGenerator &urng,
+                     const param_type &parm)
+{
+  // allow for Koenig lookup
+  using std::log;
+
+  // draw from [0,1), and take the logarithm of its complement, which is in (0,1]
+  uniform_real_distribution<RealType> u01;
+
+  return -log(RealType(1) - u01(urng)) / parm;
+} // end exponential_distribution::operator()()
+
+template<typename RealType>
+  _CCCL_HOST_DEVICE
+  typename exponential_distribution<RealType>::result_type
+    exponential_distribution<RealType>
+      ::lambda(void) const
+{
+  return m_param;
+} // end exponential_distribution::lambda()
+
+template<typename RealType>
+  _CCCL_HOST_DEVICE
+  typename exponential_distribution<RealType>::param_type
+    exponential_distribution<RealType>
+      ::param(void) const
+{
+  return m_param;
+} // end exponential_distribution::param()
+
+template<typename RealType>
+  _CCCL_HOST_DEVICE
+  void exponential_distribution<RealType>
+    ::param(const param_type &parm)
+{
+  m_param = parm;
+} // end exponential_distribution::param()
+
+template<typename RealType>
+  _CCCL_HOST_DEVICE
+  typename exponential_distribution<RealType>::result_type
+    exponential_distribution<RealType>
+      ::min THRUST_PREVENT_MACRO_SUBSTITUTION (void) const
+{
+  return 0;
+} // end exponential_distribution::min()
+
+template<typename RealType>
+  _CCCL_HOST_DEVICE
+  typename exponential_distribution<RealType>::result_type
+    exponential_distribution<RealType>
+      ::max THRUST_PREVENT_MACRO_SUBSTITUTION (void) const
+{
+  return std::numeric_limits<RealType>::max();
+} // end exponential_distribution::max()
+
+
+template<typename RealType>
+  _CCCL_HOST_DEVICE
+  bool exponential_distribution<RealType>
+    ::equal(const exponential_distribution &rhs) const
+{
+  return m_param == rhs.param();
+}
+
+
+template<typename RealType>
+  template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>&
+      exponential_distribution<RealType>
+        ::stream_out(std::basic_ostream<CharT,Traits> &os) const
+{
+  typedef std::basic_ostream<CharT,Traits> ostream_type;
+  typedef typename ostream_type::ios_base  ios_base;
+
+  // save old flags and fill character
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill = os.fill();
+
+  const CharT space = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  os << lambda();
+
+  // restore old flags and fill character
+  os.flags(flags);
+  os.fill(fill);
+  return os;
+}
+
+
+template<typename RealType>
+  template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>&
+      exponential_distribution<RealType>
+        ::stream_in(std::basic_istream<CharT,Traits> &is)
+{
+  typedef std::basic_istream<CharT,Traits> istream_type;
+  typedef typename istream_type::ios_base  ios_base;
+
+  // save old flags
+  const typename ios_base::fmtflags flags = is.flags();
+
+  is.flags(ios_base::skipws);
+
+  is >> m_param;
+
+  // restore old flags
+  is.flags(flags);
+  return is;
+}
+
+
+template<typename RealType>
+_CCCL_HOST_DEVICE
+bool operator==(const exponential_distribution<RealType> &lhs,
+                const exponential_distribution<RealType> &rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs,rhs);
+}
+
+
+template<typename RealType>
+_CCCL_HOST_DEVICE
+bool operator!=(const exponential_distribution<RealType> &lhs,
+                const exponential_distribution<RealType> &rhs)
+{
+  return !(lhs == rhs);
+}
+
+
+template<typename RealType,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const exponential_distribution<RealType> &d)
+{
+  return thrust::random::detail::random_core_access::stream_out(os,d);
+}
+
+
+template<typename RealType,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           exponential_distribution<RealType> &d)
+{
+  return thrust::random::detail::random_core_access::stream_in(is,d);
+}
+
+
+} // end random
+
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,353 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/philox_engine.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// computes the high and the low words of the product of two w-bit words
+template<typename UIntType, size_t w>
+  struct philox_mulhilo
+{
+  _CCCL_HOST_DEVICE
+  static UIntType hi(UIntType a, UIntType b, UIntType &lo)
+  {
+    const thrust::detail::uint64_t product = static_cast<thrust::detail::uint64_t>(a) * b;
+
+    lo = static_cast<UIntType>(product & 0xFFFFFFFFu);
+    return static_cast<UIntType>(product >> 32);
+  }
+}; // end philox_mulhilo
+
+template<typename UIntType>
+  struct philox_mulhilo<UIntType,64>
+{
+  _CCCL_HOST_DEVICE
+  static UIntType hi(UIntType a, UIntType b, UIntType &lo)
+  {
+    lo = a * b;
+
+    // schoolbook multiplication of the 32-bit halves
+    const thrust::detail::uint64_t a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+    const thrust::detail::uint64_t b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+
+    const thrust::detail::uint64_t ll = a_lo * b_lo;
+    const thrust::detail::uint64_t lh = a_lo * b_hi;
+    const thrust::detail::uint64_t hl = a_hi * b_lo;
+    const thrust::detail::uint64_t hh = a_hi * b_hi;
+
+    const thrust::detail::uint64_t middle = (ll >> 32) + (lh & 0xFFFFFFFFu) + (hl & 0xFFFFFFFFu);
+
+    return hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+  }
+}; // end philox_mulhilo
+
+} // end detail
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  _CCCL_HOST_DEVICE
+  philox_engine<UIntType,w,n,r,consts...>
+    ::philox_engine(result_type s)
+{
+  seed(s);
+} // end philox_engine::philox_engine()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  _CCCL_HOST_DEVICE
+  void philox_engine<UIntType,w,n,r,consts...>
+    ::seed(result_type s)
+{
+  for(size_t i = 0; i < n / 2; ++i)
+  {
+    m_key[i] = 0;
+  }
+
+  m_key[0] = s & max;
+
+  counter::reset(m_counter);
+  m_index = 0;
+} // end philox_engine::seed()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  _CCCL_HOST_DEVICE
+  void philox_engine<UIntType,w,n,r,consts...>
+    ::set_counter(const result_type (&c)[n])
+{
+  for(size_t i = 0; i < n; ++i)
+  {
+    m_counter[i] = c[i] & max;
+  }
+
+  m_index = 0;
+} // end philox_engine::set_counter()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  _CCCL_HOST_DEVICE
+  void philox_engine<UIntType,w,n,r,consts...>
+    ::generate()
+{
+  typedef detail::philox_mulhilo<result_type,w> mulhilo;
+
+  const result_type c[] = {consts...};
+
+  result_type key[n / 2];
+  for(size_t i = 0; i < n / 2; ++i)
+  {
+    key[i] = m_key[i];
+  }
+
+  result_type x[n];
+  for(size_t i = 0; i < n; ++i)
+  {
+    x[i] = m_counter[i];
+  }
+
+  for(size_t round = 0; round < r; ++round)
+  {
+    if(round > 0)
+    {
+      // bump the key
+      for(size_t i = 0; i < n / 2; ++i)
+      {
+        key[i] = (key[i] + c[2 * i + 1]) & max;
+      }
+    }
+
+    if(n == 2)
+    {
+      result_type lo0;
+      const result_type hi0 = mulhilo::hi(c[0], x[0], lo0);
+
+      x[0] = hi0 ^ key[0] ^ x[1];
+      x[1] = lo0;
+    }
+    else
+    {
+      result_type lo0, lo1;
+      const result_type hi0 = mulhilo::hi(c[0], x[0], lo0);
+      const result_type hi1 = mulhilo::hi(c[2 % n], x[2 % n], lo1);
+
+      x[0] = hi1 ^ x[1] ^ key[0];
+      x[1] = lo1;
+      x[2 % n] = hi0 ^ x[3 % n] ^ key[1 % (n / 2)];
+      x[3 % n] = lo0;
+    }
+  }
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    m_results[i] = x[i] & max;
+  }
+} // end philox_engine::generate()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  _CCCL_HOST_DEVICE
+  typename philox_engine<UIntType,w,n,r,consts...>::result_type
+    philox_engine<UIntType,w,n,r,consts...>
+      ::operator()(void)
+{
+  if(m_index == 0)
+  {
+    generate();
+  }
+
+  const result_type result = m_results[m_index];
+
+  if(++m_index == n)
+  {
+    m_index = 0;
+    counter::add(m_counter, 1);
+  }
+
+  return result;
+} // end philox_engine::operator()()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  _CCCL_HOST_DEVICE
+  void philox_engine<UIntType,w,n,r,consts...>
+    ::discard(unsigned long long z)
+{
+  // each counter produces a block of n results
+  unsigned long long blocks = z / n;
+  size_t index = m_index + static_cast<size_t>(z % n);
+
+  if(index >= n)
+  {
+    index -= n;
+    ++blocks;
+  }
+
+  counter::add(m_counter, blocks);
+  m_index = index;
+
+  if(m_index != 0)
+  {
+    generate();
+  }
+} // end philox_engine::discard()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& philox_engine<UIntType,w,n,r,consts...>
+      ::stream_out(std::basic_ostream<CharT,Traits> &os) const
+{
+  typedef std::basic_ostream<CharT,Traits> ostream_type;
+  typedef typename ostream_type::ios_base  ios_base;
+
+  // save old flags & fill character
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill = os.fill();
+
+  const CharT space = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  // output the key, the counter and the position within the block
+  for(size_t i = 0; i < n / 2; ++i)
+  {
+    os << m_key[i] << space;
+  }
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    os << m_counter[i] << space;
+  }
+
+  os << m_index;
+
+  // restore flags & fill character
+  os.flags(flags);
+  os.fill(fill);
+
+  return os;
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& philox_engine<UIntType,w,n,r,consts...>
+      ::stream_in(std::basic_istream<CharT,Traits> &is)
+{
+  typedef std::basic_istream<CharT,Traits> istream_type;
+  typedef typename istream_type::ios_base     ios_base;
+
+  // save old flags
+  const typename ios_base::fmtflags flags = is.flags();
+
+  is.flags(ios_base::dec | ios_base::skipws);
+
+  // input the key, the counter and the position within the block
+  for(size_t i = 0; i < n / 2; ++i)
+  {
+    is >> m_key[i];
+  }
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    is >> m_counter[i];
+  }
+
+  is >> m_index;
+
+  if(m_index != 0)
+  {
+    generate();
+  }
+
+  // restore flags
+  is.flags(flags);
+
+  return is;
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  _CCCL_HOST_DEVICE
+  bool philox_engine<UIntType,w,n,r,consts...>
+    ::equal(const philox_engine<UIntType,w,n,r,consts...> &rhs) const
+{
+  return detail::counter_based_engine_counter<result_type,w,n / 2>::equal(m_key, rhs.m_key) &&
+         counter::equal(m_counter, rhs.m_counter) &&
+         m_index == rhs.m_index;
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE
+bool operator==(const philox_engine<UIntType,w,n,r,consts...> &lhs,
+                const philox_engine<UIntType,w,n,r,consts...> &rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs,rhs);
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE
+bool operator!=(const philox_engine<UIntType,w,n,r,consts...> &lhs,
+                const philox_engine<UIntType,w,n,r,consts...> &rhs)
+{
+  return !(lhs == rhs);
+}
+
+
+template<typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const philox_engine<UIntType_,w_,n_,r_,consts_...> &e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os,e);
+}
+
+
+template<typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           philox_engine<UIntType_,w_,n_,r_,consts_...> &e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is,e);
+}
+
+
+} // end random
+
+THRUST_NAMESPACE_END
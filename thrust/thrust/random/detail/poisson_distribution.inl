@@ -0,0 +1,292 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/poisson_distribution.h>
+#include <thrust/random/uniform_real_distribution.h>
+#include <cmath>
+#include <limits>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+
+template<typename IntType>
+  _CCCL_HOST_DEVICE
+  poisson_distribution<IntType>
+    ::poisson_distribution(double mean)
+      :m_param(mean)
+{
+} // end poisson_distribution::poisson_distribution()
+
+template<typename IntType>
+  _CCCL_HOST_DEVICE
+  void poisson_distribution<IntType>
+    ::reset(void)
+{
+} // end poisson_distribution::reset()
+
+template<typename IntType>
+  template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    typename poisson_distribution<IntType>::result_type
+      poisson_distribution<IntType>
+        ::operator()(UniformRandomNumberGenerator &urng)
+{
+  return operator()(urng, m_param);
+} // end poisson_distribution::operator()()
+
+template<typename IntType>
+  template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    typename poisson_distribution<IntType>::result_type
+      poisson_distribution<IntType>
+        ::operator()(UniformRandomNumberGenerator &urng,
+                     const param_type &parm)
+{
+  // inversion takes O(mean) steps, so large means use rejection instead
+  return (parm < 10) ? sample_inversion(urng, parm) : sample_ptrs(urng, parm);
+} // end poisson_distribution::operator()()
+
+template<typename IntType>
+  template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    typename poisson_distribution<IntType>::result_type
+      poisson_distribution<IntType>
+        ::sample_inversion(UniformRandomNumberGenerator &urng, double mean)
+{
+  // allow for Koenig lookup
+  using std::exp;
+
+  uniform_real_distribution<double> u01;
+  const double u = u01(urng);
+
+  // walk the cumulative distribution function until it exceeds u
+  double p = exp(-mean);
+  double cdf = p;
+  result_type result = 0;
+
+  // p underflows to zero if rounding keeps cdf below u
+  while(u > cdf && p > 0)
+  {
+    ++result;
+    p *= mean / result;
+    cdf += p;
+  }
+
+  return result;
+} // end poisson_distribution::sample_inversion()
+
+template<typename IntType>
+  template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    typename poisson_distribution<IntType>::result_type
+      poisson_distribution<IntType>
+        ::sample_ptrs(UniformRandomNumberGenerator &urng, double mean)
+{
+  // Hormann: "The transformed rejection method for generating Poisson random variables", 1993
+  // allow for Koenig lookup
+  using std::sqrt; using std::log; using std::floor; using std::fabs; using std::lgamma;
+
+  const double log_mean  = log(mean);
+  const double b         = 0.931 + 2.53 * sqrt(mean);
+  const double a         = -0.059 + 0.02483 * b;
+  const double inv_alpha = 1.1239 + 1.1328 / (b - 3.4);
+  const double v_r       = 0.9277 - 3.6224 / (b - 2);
+
+  uniform_real_distribution<double> u01;
+
+  for(;;)
+  {
+    const double u  = u01(urng) - 0.5;
+    const double v  = u01(urng);
+    const double us = 0.5 - fabs(u);
+    const double k  = floor((2 * a / us + b) * u + mean + 0.43);
+
+    // the squeeze accepts most samples
+    if(us >= 0.07 && v <= v_r)
+    {
+      return static_cast<result_type>(k);
+    }
+
+    if(k < 0 || (us < 0.013 && v > us))
+    {
+      continue;
+    }
+
+    if(log(v) + log(inv_alpha) - log(a / (us * us) + b) <= -mean + k * log_mean - lgamma(k + 1))
+    {
+      return static_cast<result_type>(k);
+    }
+  }
+} // end poisson_distribution::sample_ptrs()
+
+template<typename IntType>
+  _CCCL_HOST_DEVICE
+  double poisson_distribution<IntType>
+      ::mean(void) const
+{
+  return m_param;
+} // end poisson_distribution::mean()
+
+template<typename IntType>
+  _CCCL_HOST_DEVICE
+  typename poisson_distribution<IntType>::param_type
+    poisson_distribution<IntType>
+      ::param(void) const
+{
+  return m_param;
+} // end poisson_distribution::param()
+
+template<typename IntType>
+  _CCCL_HOST_DEVICE
+  void poisson_distribution<IntType>
+    ::param(const param_type &parm)
+{
+  m_param = parm;
+} // end poisson_distribution::param()
+
+template<typename IntType>
+  _CCCL_HOST_DEVICE
+  typename poisson_distribution<IntType>::result_type
+    poisson_distribution<IntType>
+      ::min THRUST_PREVENT_MACRO_SUBSTITUTION (void) const
+{
+  return 0;
+} // end poisson_distribution::min()
+
+template<typename IntType>
+  _CCCL_HOST_DEVICE
+  typename poisson_distribution<IntType>::result_type
+    poisson_distribution<IntType>
+      ::max THRUST_PREVENT_MACRO_SUBSTITUTION (void) const
+{
+  return std::numeric_limits<IntType>::max();
+} // end poisson_distribution::max()
+
+
+template<typename IntType>
+  _CCCL_HOST_DEVICE
+  bool poisson_distribution<IntType>
+    ::equal(const poisson_distribution &rhs) const
+{
+  return m_param == rhs.param();
+}
+
+
+template<typename IntType>
+  template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>&
+      poisson_distribution<IntType>
+        ::stream_out(std::basic_ostream<CharT,Traits> &os) const
+{
+  typedef std::basic_ostream<CharT,Traits> ostream_type;
+  typedef typename ostream_type::ios_base  ios_base;
+
+  // save old flags and fill character
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill = os.fill();
+
+  const CharT space = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  os << mean();
+
+  // restore old flags and fill character
+  os.flags(flags);
+  os.fill(fill);
+  return os;
+}
+
+
+template<typename IntType>
+  template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>&
+      poisson_distribution<IntType>
+        ::stream_in(std::basic_istream<CharT,Traits> &is)
+{
+  typedef std::basic_istream<CharT,Traits> istream_type;
+  typedef typename istream_type::ios_base  ios_base;
+
+  // save old flags
+  const typename ios_base::fmtflags flags = is.flags();
+
+  is.flags(ios_base::skipws);
+
+  is >> m_param;
+
+  // restore old flags
+  is.flags(flags);
+  return is;
+}
+
+
+template<typename IntType>
+_CCCL_HOST_DEVICE
+bool operator==(const poisson_distribution<IntType> &lhs,
+                const poisson_distribution<IntType> &rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs,rhs);
+}
+
+
+template<typename IntType>
+_CCCL_HOST_DEVICE
+bool operator!=(const poisson_distribution<IntType> &lhs,
+                const poisson_distribution<IntType> &rhs)
+{
+  return !(lhs == rhs);
+}
+
+
+template<typename IntType,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const poisson_distribution<IntType> &d)
+{
+  return thrust::random::detail::random_core_access::stream_out(os,d);
+}
+
+
+template<typename IntType,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           poisson_distribution<IntType> &d)
+{
+  return thrust::random::detail::random_core_access::stream_in(is,d);
+}
+
+
+} // end random
+
+THRUST_NAMESPACE_END
+
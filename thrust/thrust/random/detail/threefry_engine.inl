@@ -0,0 +1,389 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/threefry_engine.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// the rotation constants of Threefry, for each word size and word count
+template<size_t w, size_t n>
+  struct threefry_rotation;
+
+template<>
+  struct threefry_rotation<32,2>
+{
+  _CCCL_HOST_DEVICE
+  static unsigned int get(size_t round, size_t)
+  {
+    const unsigned int r[8] = {13, 15, 26, 6, 17, 29, 16, 24};
+    return r[round % 8];
+  }
+};
+
+template<>
+  struct threefry_rotation<32,4>
+{
+  _CCCL_HOST_DEVICE
+  static unsigned int get(size_t round, size_t i)
+  {
+    const unsigned int r[8][2] = {{10, 26}, {11, 21}, {13, 27}, {23, 5}, {6, 20}, {17, 11}, {25, 10}, {18, 20}};
+    return r[round % 8][i];
+  }
+};
+
+template<>
+  struct threefry_rotation<64,2>
+{
+  _CCCL_HOST_DEVICE
+  static unsigned int get(size_t round, size_t)
+  {
+    const unsigned int r[8] = {16, 42, 12, 31, 16, 32, 24, 21};
+    return r[round % 8];
+  }
+};
+
+template<>
+  struct threefry_rotation<64,4>
+{
+  _CCCL_HOST_DEVICE
+  static unsigned int get(size_t round, size_t i)
+  {
+    const unsigned int r[8][2] = {{14, 16}, {52, 57}, {23, 40}, {5, 37}, {25, 33}, {46, 12}, {58, 22}, {32, 32}};
+    return r[round % 8][i];
+  }
+};
+
+// the parity constant of the key schedule
+template<size_t w>
+  struct threefry_parity
+{
+  static const thrust::detail::uint64_t value = 0x1BD11BDAu;
+};
+
+template<>
+  struct threefry_parity<64>
+{
+  static const thrust::detail::uint64_t value = 0x1BD11BDAA9FC1A22ull;
+};
+
+} // end detail
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  _CCCL_HOST_DEVICE
+  threefry_engine<UIntType,w,n,r>
+    ::threefry_engine(result_type s)
+{
+  seed(s);
+} // end threefry_engine::threefry_engine()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  _CCCL_HOST_DEVICE
+  void threefry_engine<UIntType,w,n,r>
+    ::seed(result_type s)
+{
+  for(size_t i = 0; i < n; ++i)
+  {
+    m_key[i] = 0;
+  }
+
+  m_key[0] = s & max;
+
+  counter::reset(m_counter);
+  m_index = 0;
+} // end threefry_engine::seed()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  _CCCL_HOST_DEVICE
+  void threefry_engine<UIntType,w,n,r>
+    ::set_counter(const result_type (&c)[n])
+{
+  for(size_t i = 0; i < n; ++i)
+  {
+    m_counter[i] = c[i] & max;
+  }
+
+  m_index = 0;
+} // end threefry_engine::set_counter()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  _CCCL_HOST_DEVICE
+  void threefry_engine<UIntType,w,n,r>
+    ::mix(result_type &x0, result_type &x1, unsigned int rotation)
+{
+  x0 = (x0 + x1) & max;
+  x1 = ((x1 << rotation) | (x1 >> (w - rotation))) & max;
+  x1 ^= x0;
+} // end threefry_engine::mix()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  _CCCL_HOST_DEVICE
+  void threefry_engine<UIntType,w,n,r>
+    ::generate()
+{
+  typedef detail::threefry_rotation<w,n> rotation;
+
+  // the key schedule has one more word than the key
+  result_type ks[n + 1];
+  ks[n] = static_cast<result_type>(detail::threefry_parity<w>::value);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    ks[i] = m_key[i];
+    ks[n] ^= m_key[i];
+  }
+
+  result_type x[n];
+  for(size_t i = 0; i < n; ++i)
+  {
+    x[i] = (m_counter[i] + ks[i]) & max;
+  }
+
+  for(size_t round = 0; round < r; ++round)
+  {
+    if(n == 2)
+    {
+      mix(x[0], x[1], rotation::get(round, 0));
+    }
+    else if(round % 2 == 0)
+    {
+      mix(x[0], x[1 % n], rotation::get(round, 0));
+      mix(x[2 % n], x[3 % n], rotation::get(round, 1));
+    }
+    else
+    {
+      mix(x[0], x[3 % n], rotation::get(round, 0));
+      mix(x[2 % n], x[1 % n], rotation::get(round, 1));
+    }
+
+    // inject the key every four rounds
+    if(round % 4 == 3)
+    {
+      const size_t s = (round + 1) / 4;
+
+      for(size_t i = 0; i < n; ++i)
+      {
+        x[i] = (x[i] + ks[(s + i) % (n + 1)]) & max;
+      }
+
+      x[n - 1] = (x[n - 1] + static_cast<result_type>(s)) & max;
+    }
+  }
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    m_results[i] = x[i] & max;
+  }
+} // end threefry_engine::generate()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  _CCCL_HOST_DEVICE
+  typename threefry_engine<UIntType,w,n,r>::result_type
+    threefry_engine<UIntType,w,n,r>
+      ::operator()(void)
+{
+  if(m_index == 0)
+  {
+    generate();
+  }
+
+  const result_type result = m_results[m_index];
+
+  if(++m_index == n)
+  {
+    m_index = 0;
+    counter::add(m_counter, 1);
+  }
+
+  return result;
+} // end threefry_engine::operator()()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  _CCCL_HOST_DEVICE
+  void threefry_engine<UIntType,w,n,r>
+    ::discard(unsigned long long z)
+{
+  // each counter produces a block of n results
+  unsigned long long blocks = z / n;
+  size_t index = m_index + static_cast<size_t>(z % n);
+
+  if(index >= n)
+  {
+    index -= n;
+    ++blocks;
+  }
+
+  counter::add(m_counter, blocks);
+  m_index = index;
+
+  if(m_index != 0)
+  {
+    generate();
+  }
+} // end threefry_engine::discard()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& threefry_engine<UIntType,w,n,r>
+      ::stream_out(std::basic_ostream<CharT,Traits> &os) const
+{
+  typedef std::basic_ostream<CharT,Traits> ostream_type;
+  typedef typename ostream_type::ios_base  ios_base;
+
+  // save old flags & fill character
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill = os.fill();
+
+  const CharT space = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  // output the key, the counter and the position within the block
+  for(size_t i = 0; i < n; ++i)
+  {
+    os << m_key[i] << space;
+  }
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    os << m_counter[i] << space;
+  }
+
+  os << m_index;
+
+  // restore flags & fill character
+  os.flags(flags);
+  os.fill(fill);
+
+  return os;
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& threefry_engine<UIntType,w,n,r>
+      ::stream_in(std::basic_istream<CharT,Traits> &is)
+{
+  typedef std::basic_istream<CharT,Traits> istream_type;
+  typedef typename istream_type::ios_base     ios_base;
+
+  // save old flags
+  const typename ios_base::fmtflags flags = is.flags();
+
+  is.flags(ios_base::dec | ios_base::skipws);
+
+  // input the key, the counter and the position within the block
+  for(size_t i = 0; i < n; ++i)
+  {
+    is >> m_key[i];
+  }
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    is >> m_counter[i];
+  }
+
+  is >> m_index;
+
+  if(m_index != 0)
+  {
+    generate();
+  }
+
+  // restore flags
+  is.flags(flags);
+
+  return is;
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  _CCCL_HOST_DEVICE
+  bool threefry_engine<UIntType,w,n,r>
+    ::equal(const threefry_engine<UIntType,w,n,r> &rhs) const
+{
+  return counter::equal(m_key, rhs.m_key) &&
+         counter::equal(m_counter, rhs.m_counter) &&
+         m_index == rhs.m_index;
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE
+bool operator==(const threefry_engine<UIntType,w,n,r> &lhs,
+                const threefry_engine<UIntType,w,n,r> &rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs,rhs);
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE
+bool operator!=(const threefry_engine<UIntType,w,n,r> &lhs,
+                const threefry_engine<UIntType,w,n,r> &rhs)
+{
+  return !(lhs == rhs);
+}
+
+
+template<typename UIntType_, size_t w_, size_t n_, size_t r_,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const threefry_engine<UIntType_,w_,n_,r_> &e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os,e);
+}
+
+
+template<typename UIntType_, size_t w_, size_t n_, size_t r_,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           threefry_engine<UIntType_,w_,n_,r_> &e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is,e);
+}
+
+
+} // end random
+
+THRUST_NAMESPACE_END
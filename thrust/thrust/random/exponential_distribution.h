@@ -0,0 +1,248 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file exponential_distribution.h
+ *  \brief An exponential distribution of floating point numbers
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/random/detail/random_core_access.h>
+#include <iostream>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+
+/*! \addtogroup random_number_distributions
+ *  \{
+ */
+
+/*! \class exponential_distribution
+ *  \brief An \p exponential_distribution random number distribution produces floating point
+ *         numbers from an exponential distribution, such as the waiting times between the
+ *         events of a Poisson process.
+ *
+ *  \tparam RealType The type of floating point number to produce.
+ *
+ *  The following code snippet demonstrates examples of using an \p exponential_distribution with a
+ *  random number engine to produce random waiting times:
+ *
+ *  \code
+ *  #include <thrust/random.h>
+ *
+ *  int main(void)
+ *  {
+ *    // create a minstd_rand object to act as our source of randomness
+ *    thrust::minstd_rand rng;
+ *
+ *    // create an exponential_distribution for 0.5 events per unit of time
+ *    thrust::random::exponential_distribution<float> dist(0.5f);
+ *
+ *    // write a random waiting time to standard output
+ *    std::cout << dist(rng) << std::endl;
+ *
+ *    // write the parameter of the distribution to standard output
+ *    std::cout << dist.lambda() << std::endl;
+ *
+ *    // 0.5 is printed
+ *
+ *    return 0;
+ *  }
+ *  \endcode
+ */
+template<typename RealType = double>
+  class exponential_distribution
+{
+  public:
+    // types
+
+    /*! \typedef result_type
+     *  \brief The type of the floating point number produced by this \p exponential_distribution.
+     */
+    typedef RealType result_type;
+
+    /*! \typedef param_type
+     *  \brief The type of the object encapsulating this \p exponential_distribution's parameters.
+     */
+    typedef RealType param_type;
+
+    // constructors and reset functions
+
+    /*! This constructor creates a new \p exponential_distribution from its rate parameter.
+     *
+     *  \param lambda The rate of the distribution, i.e. the inverse of its mean. Defaults to \c 1.0.
+     */
+    _CCCL_HOST_DEVICE
+    explicit exponential_distribution(RealType lambda = 1.0);
+
+    /*! This does nothing.  It is included to conform to the requirements of the RandomDistribution concept.
+     */
+    _CCCL_HOST_DEVICE
+    void reset(void);
+
+    // generating functions
+
+    /*! This method produces a new exponential random number using a \p UniformRandomNumberGenerator
+     *  as a source of randomness.
+     *
+     *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+     */
+    template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    result_type operator()(UniformRandomNumberGenerator &urng);
+
+    /*! This method produces a new exponential random number as if by creating a new \p exponential_distribution
+     *  from the given \p param_type object, and calling its <tt>operator()</tt> method with the given
+     *  \p UniformRandomNumberGenerator as a source of randomness.
+     *
+     *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+     *  \param parm A \p param_type object encapsulating the parameters of the \p exponential_distribution
+     *              to draw from.
+     */
+    template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    result_type operator()(UniformRandomNumberGenerator &urng, const param_type &parm);
+
+    // property functions
+
+    /*! This method returns the value of the parameter with which this \p exponential_distribution
+     *  was constructed.
+     *
+     *  \return The rate of this \p exponential_distribution.
+     */
+    _CCCL_HOST_DEVICE
+    result_type lambda(void) const;
+
+    /*! This method returns a \p param_type object encapsulating the parameters with which this
+     *  \p exponential_distribution was constructed.
+     *
+     *  \return A \p param_type object enapsulating the rate of this \p exponential_distribution.
+     */
+    _CCCL_HOST_DEVICE
+    param_type param(void) const;
+
+    /*! This method changes the parameters of this \p exponential_distribution using the values encapsulated
+     *  in a given \p param_type object.
+     *
+     *  \param parm A \p param_type object encapsulating the new rate of this \p exponential_distribution.
+     */
+    _CCCL_HOST_DEVICE
+    void param(const param_type &parm);
+
+    /*! This method returns the smallest floating point number this \p exponential_distribution can potentially produce.
+     *
+     *  \return \c 0
+     */
+    _CCCL_HOST_DEVICE
+    result_type min THRUST_PREVENT_MACRO_SUBSTITUTION (void) const;
+
+    /*! This method returns the largest floating point number this \p exponential_distribution can potentially produce.
+     *
+     *  \return The largest finite value of \p RealType.
+     */
+    _CCCL_HOST_DEVICE
+    result_type max THRUST_PREVENT_MACRO_SUBSTITUTION (void) const;
+
+    /*! \cond
+     */
+  private:
+    param_type m_param;
+
+    friend struct thrust::random::detail::random_core_access;
+
+    _CCCL_HOST_DEVICE
+    bool equal(const exponential_distribution &rhs) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& stream_out(std::basic_ostream<CharT,Traits> &os) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& stream_in(std::basic_istream<CharT,Traits> &is);
+    /*! \endcond
+     */
+}; // end exponential_distribution
+
+
+/*! This function checks two \p exponential_distributions for equality.
+ *  \param lhs The first \p exponential_distribution to test.
+ *  \param rhs The second \p exponential_distribution to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template<typename RealType>
+_CCCL_HOST_DEVICE
+bool operator==(const exponential_distribution<RealType> &lhs,
+                const exponential_distribution<RealType> &rhs);
+
+
+/*! This function checks two \p exponential_distributions for inequality.
+ *  \param lhs The first \p exponential_distribution to test.
+ *  \param rhs The second \p exponential_distribution to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template<typename RealType>
+_CCCL_HOST_DEVICE
+bool operator!=(const exponential_distribution<RealType> &lhs,
+                const exponential_distribution<RealType> &rhs);
+
+
+/*! This function streams an exponential_distribution to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param d The \p exponential_distribution to stream out.
+ *  \return \p os
+ */
+template<typename RealType,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const exponential_distribution<RealType> &d);
+
+
+/*! This function streams an exponential_distribution in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param d The \p exponential_distribution to stream in.
+ *  \return \p is
+ */
+template<typename RealType,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           exponential_distribution<RealType> &d);
+
+
+/*! \} // end random_number_distributions
+ */
+
+
+} // end random
+
+using random::exponential_distribution;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/exponential_distribution.inl>
+
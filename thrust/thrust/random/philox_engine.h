@@ -0,0 +1,309 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file philox_engine.h
+ *  \brief A counter-based pseudorandom number engine built on the
+ *         Philox bijection.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <iostream>
+#include <cstddef> // for size_t
+#include <thrust/detail/cstdint.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/random/detail/random_core_access.h>
+#include <thrust/random/detail/counter_based_engine_counter.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random_number_engine_templates
+ *  \{
+ */
+
+/*! \class philox_engine
+ *  \brief A \p philox_engine random number engine produces unsigned integer
+ *         random numbers by applying the Philox bijection of Salmon et al. to
+ *         a counter, under a key derived from the seed.
+ *
+ *         Unlike other engines, \p philox_engine holds no recurrence: its
+ *         <tt>i</tt>th result only depends on the key and on \c i.
+ *         Consequently, \p discard takes constant time, and
+ *         \c e.discard(i * k) is an inexpensive way to give each of many
+ *         parallel tasks a disjoint sequence of \c k random numbers.
+ *
+ *  \tparam UIntType The type of unsigned integer to produce.
+ *  \tparam w The word size of the produced values.
+ *  \tparam n The number of words in a counter, either \c 2 or \c 4.
+ *  \tparam r The number of rounds of the bijection.
+ *  \tparam consts The <tt>n / 2</tt> pairs of multipliers and round constants of
+ *          the bijection, as <tt>M0, C0, M1, C1</tt>.
+ *
+ *  The following code snippet shows how each element of a range may draw its
+ *  own random numbers from a common sequence:
+ *
+ *  \code
+ *  #include <thrust/random.h>
+ *  #include <thrust/transform.h>
+ *  #include <thrust/iterator/counting_iterator.h>
+ *  #include <thrust/device_vector.h>
+ *
+ *  struct draw
+ *  {
+ *    __host__ __device__
+ *    unsigned int operator()(unsigned long long i) const
+ *    {
+ *      thrust::philox4x32 rng(2011);
+ *
+ *      // skip to the ith number; this takes constant time
+ *      rng.discard(i);
+ *
+ *      return rng();
+ *    }
+ *  };
+ *
+ *  ...
+ *
+ *  thrust::device_vector<unsigned int> v(1000);
+ *
+ *  thrust::transform(thrust::counting_iterator<unsigned long long>(0),
+ *                    thrust::counting_iterator<unsigned long long>(1000),
+ *                    v.begin(),
+ *                    draw());
+ *  \endcode
+ *
+ *  \note Inexperienced users should not use this class template directly.  Instead, use
+ *        \p philox4x32 or \p philox4x64.
+ *  \see threefry_engine
+ */
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  class philox_engine
+{
+    /*! \cond
+     */
+    THRUST_STATIC_ASSERT_MSG(n == 2 || n == 4, "philox_engine's word count must be 2 or 4.");
+    THRUST_STATIC_ASSERT_MSG(sizeof...(consts) == n, "philox_engine requires n constants.");
+    THRUST_STATIC_ASSERT_MSG(w == 32 || w == 64, "philox_engine's word size must be 32 or 64.");
+    THRUST_STATIC_ASSERT_MSG(w <= sizeof(UIntType) * 8, "philox_engine's words don't fit in UIntType.");
+    THRUST_STATIC_ASSERT_MSG(r > 0, "philox_engine requires at least one round.");
+    /*! \endcond
+     */
+
+  public:
+    // types
+
+    /*! \typedef result_type
+     *  \brief The type of the unsigned integer produced by this \p philox_engine.
+     */
+    typedef UIntType result_type;
+
+    // engine characteristics
+
+    /*! The word size of the produced values.
+     */
+    static const size_t word_size = w;
+
+    /*! The number of words in a counter, and in each block of results.
+     */
+    static const size_t word_count = n;
+
+    /*! The number of rounds of the bijection.
+     */
+    static const size_t round_count = r;
+
+    /*! The smallest value this \p philox_engine may potentially produce.
+     */
+    static const result_type min = 0;
+
+    /*! The largest value this \p philox_engine may potentially produce.
+     */
+    static const result_type max = detail::counter_based_engine_counter<result_type,w,n>::wordmask;
+
+    /*! The default seed of this \p philox_engine.
+     */
+    static const result_type default_seed = 20111115u;
+
+    // constructors and seeding functions
+
+    /*! This constructor, which optionally accepts a seed, initializes a new
+     *  \p philox_engine.
+     *
+     *  \param s The seed used to intialize this \p philox_engine's state.
+     */
+    _CCCL_HOST_DEVICE
+    explicit philox_engine(result_type s = default_seed);
+
+    /*! This method initializes this \p philox_engine's state, and optionally accepts
+     *  a seed value. The seed becomes the first word of the key, and the
+     *  counter is reset to zero.
+     *
+     *  \param s The seed used to initializes this \p philox_engine's state.
+     */
+    _CCCL_HOST_DEVICE
+    void seed(result_type s = default_seed);
+
+    /*! This method sets the counter of this \p philox_engine. The next
+     *  results are those of the block with counter \p c.
+     *
+     *  \param c The counter, least significant word first.
+     */
+    _CCCL_HOST_DEVICE
+    void set_counter(const result_type (&c)[n]);
+
+    // generating functions
+
+    /*! This member function produces a new random value and updates this \p philox_engine's state.
+     *  \return A new random number.
+     */
+    _CCCL_HOST_DEVICE
+    result_type operator()(void);
+
+    /*! This member function advances this \p philox_engine's state a given number of times
+     *  and discards the results. It takes constant time.
+     *
+     *  \param z The number of random values to discard.
+     */
+    _CCCL_HOST_DEVICE
+    void discard(unsigned long long z);
+
+    /*! \cond
+     */
+  private:
+    typedef detail::counter_based_engine_counter<result_type,w,n> counter;
+
+    result_type m_key[n / 2];
+    result_type m_counter[n];
+    result_type m_results[n];
+    size_t      m_index;
+
+    friend struct thrust::random::detail::random_core_access;
+
+    _CCCL_HOST_DEVICE
+    void generate();
+
+    _CCCL_HOST_DEVICE
+    bool equal(const philox_engine &rhs) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& stream_out(std::basic_ostream<CharT,Traits> &os) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& stream_in(std::basic_istream<CharT,Traits> &is);
+
+    /*! \endcond
+     */
+}; // end philox_engine
+
+
+/*! This function checks two \p philox_engines for equality.
+ *  \param lhs The first \p philox_engine to test.
+ *  \param rhs The second \p philox_engine to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template<typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE
+bool operator==(const philox_engine<UIntType_,w_,n_,r_,consts_...> &lhs,
+                const philox_engine<UIntType_,w_,n_,r_,consts_...> &rhs);
+
+
+/*! This function checks two \p philox_engines for inequality.
+ *  \param lhs The first \p philox_engine to test.
+ *  \param rhs The second \p philox_engine to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template<typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE
+bool operator!=(const philox_engine<UIntType_,w_,n_,r_,consts_...> &lhs,
+                const philox_engine<UIntType_,w_,n_,r_,consts_...> &rhs);
+
+
+/*! This function streams a philox_engine to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param e The \p philox_engine to stream out.
+ *  \return \p os
+ */
+template<typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const philox_engine<UIntType_,w_,n_,r_,consts_...> &e);
+
+
+/*! This function streams a philox_engine in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param e The \p philox_engine to stream in.
+ *  \return \p is
+ */
+template<typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           philox_engine<UIntType_,w_,n_,r_,consts_...> &e);
+
+
+/*! \} // end random_number_engine_templates
+ */
+
+
+/*! \addtogroup predefined_random
+ *  \{
+ */
+
+/*! \typedef philox4x32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Philox4x32-10 counter-based random number generator of Random123.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p philox4x32
+ *        shall produce the value \c 1955073260 .
+ */
+typedef philox_engine<thrust::detail::uint32_t, 32, 4, 10,
+                      0xD2511F53u, 0x9E3779B9u, 0xCD9E8D57u, 0xBB67AE85u> philox4x32;
+
+
+/*! \typedef philox4x64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Philox4x64-10 counter-based random number generator of Random123.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p philox4x64
+ *        shall produce the value \c 3409172418970261260 .
+ */
+typedef philox_engine<thrust::detail::uint64_t, 64, 4, 10,
+                      0xD2E7470EE14C6C93ull, 0x9E3779B97F4A7C15ull, 0xCA5A826395121157ull, 0xBB67AE8584CAA73Bull> philox4x64;
+
+/*! \} // predefined_random
+ */
+
+} // end random
+
+// import names into thrust::
+using random::philox_engine;
+using random::philox4x32;
+using random::philox4x64;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/philox_engine.inl>
+
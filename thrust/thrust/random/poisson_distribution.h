@@ -0,0 +1,257 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file poisson_distribution.h
+ *  \brief A Poisson distribution of nonnegative integers
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/random/detail/random_core_access.h>
+#include <iostream>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+
+/*! \addtogroup random_number_distributions
+ *  \{
+ */
+
+/*! \class poisson_distribution
+ *  \brief A \p poisson_distribution random number distribution produces nonnegative integers
+ *         from a Poisson distribution, such as the number of events of a Poisson process
+ *         within a unit of time.
+ *
+ *  \tparam IntType The type of integer to produce.
+ *
+ *  Small means are sampled by inverting the cumulative distribution function, and large
+ *  means by Hormann's transformed rejection with squeeze (PTRS), so that the cost of a
+ *  sample doesn't grow with the mean.
+ *
+ *  \code
+ *  #include <thrust/random.h>
+ *
+ *  int main(void)
+ *  {
+ *    // create a minstd_rand object to act as our source of randomness
+ *    thrust::minstd_rand rng;
+ *
+ *    // create a poisson_distribution for 4.5 events per unit of time
+ *    thrust::random::poisson_distribution<int> dist(4.5);
+ *
+ *    // write a random number of events to standard output
+ *    std::cout << dist(rng) << std::endl;
+ *
+ *    // write the parameter of the distribution to standard output
+ *    std::cout << dist.mean() << std::endl;
+ *
+ *    // 4.5 is printed
+ *
+ *    return 0;
+ *  }
+ *  \endcode
+ */
+template<typename IntType = int>
+  class poisson_distribution
+{
+  public:
+    // types
+
+    /*! \typedef result_type
+     *  \brief The type of the integer produced by this \p poisson_distribution.
+     */
+    typedef IntType result_type;
+
+    /*! \typedef param_type
+     *  \brief The type of the object encapsulating this \p poisson_distribution's parameters.
+     */
+    typedef double param_type;
+
+    // constructors and reset functions
+
+    /*! This constructor creates a new \p poisson_distribution from its mean.
+     *
+     *  \param mean The mean of the distribution. Defaults to \c 1.0.
+     */
+    _CCCL_HOST_DEVICE
+    explicit poisson_distribution(double mean = 1.0);
+
+    /*! This does nothing.  It is included to conform to the requirements of the RandomDistribution concept.
+     */
+    _CCCL_HOST_DEVICE
+    void reset(void);
+
+    // generating functions
+
+    /*! This method produces a new Poisson random number using a \p UniformRandomNumberGenerator
+     *  as a source of randomness.
+     *
+     *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+     */
+    template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    result_type operator()(UniformRandomNumberGenerator &urng);
+
+    /*! This method produces a new Poisson random number as if by creating a new \p poisson_distribution
+     *  from the given \p param_type object, and calling its <tt>operator()</tt> method with the given
+     *  \p UniformRandomNumberGenerator as a source of randomness.
+     *
+     *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+     *  \param parm A \p param_type object encapsulating the parameters of the \p poisson_distribution
+     *              to draw from.
+     */
+    template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    result_type operator()(UniformRandomNumberGenerator &urng, const param_type &parm);
+
+    // property functions
+
+    /*! This method returns the value of the parameter with which this \p poisson_distribution
+     *  was constructed.
+     *
+     *  \return The mean of this \p poisson_distribution.
+     */
+    _CCCL_HOST_DEVICE
+    double mean(void) const;
+
+    /*! This method returns a \p param_type object encapsulating the parameters with which this
+     *  \p poisson_distribution was constructed.
+     *
+     *  \return A \p param_type object enapsulating the mean of this \p poisson_distribution.
+     */
+    _CCCL_HOST_DEVICE
+    param_type param(void) const;
+
+    /*! This method changes the parameters of this \p poisson_distribution using the values encapsulated
+     *  in a given \p param_type object.
+     *
+     *  \param parm A \p param_type object encapsulating the new mean of this \p poisson_distribution.
+     */
+    _CCCL_HOST_DEVICE
+    void param(const param_type &parm);
+
+    /*! This method returns the smallest integer this \p poisson_distribution can potentially produce.
+     *
+     *  \return \c 0
+     */
+    _CCCL_HOST_DEVICE
+    result_type min THRUST_PREVENT_MACRO_SUBSTITUTION (void) const;
+
+    /*! This method returns the largest integer this \p poisson_distribution can potentially produce.
+     *
+     *  \return The largest value of \p IntType.
+     */
+    _CCCL_HOST_DEVICE
+    result_type max THRUST_PREVENT_MACRO_SUBSTITUTION (void) const;
+
+    /*! \cond
+     */
+  private:
+    param_type m_param;
+
+    template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    static result_type sample_inversion(UniformRandomNumberGenerator &urng, double mean);
+
+    template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    static result_type sample_ptrs(UniformRandomNumberGenerator &urng, double mean);
+
+    friend struct thrust::random::detail::random_core_access;
+
+    _CCCL_HOST_DEVICE
+    bool equal(const poisson_distribution &rhs) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& stream_out(std::basic_ostream<CharT,Traits> &os) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& stream_in(std::basic_istream<CharT,Traits> &is);
+    /*! \endcond
+     */
+}; // end poisson_distribution
+
+
+/*! This function checks two \p poisson_distributions for equality.
+ *  \param lhs The first \p poisson_distribution to test.
+ *  \param rhs The second \p poisson_distribution to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template<typename IntType>
+_CCCL_HOST_DEVICE
+bool operator==(const poisson_distribution<IntType> &lhs,
+                const poisson_distribution<IntType> &rhs);
+
+
+/*! This function checks two \p poisson_distributions for inequality.
+ *  \param lhs The first \p poisson_distribution to test.
+ *  \param rhs The second \p poisson_distribution to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template<typename IntType>
+_CCCL_HOST_DEVICE
+bool operator!=(const poisson_distribution<IntType> &lhs,
+                const poisson_distribution<IntType> &rhs);
+
+
+/*! This function streams a poisson_distribution to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param d The \p poisson_distribution to stream out.
+ *  \return \p os
+ */
+template<typename IntType,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const poisson_distribution<IntType> &d);
+
+
+/*! This function streams a poisson_distribution in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param d The \p poisson_distribution to stream in.
+ *  \return \p is
+ */
+template<typename IntType,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           poisson_distribution<IntType> &d);
+
+
+/*! \} // end random_number_distributions
+ */
+
+
+} // end random
+
+using random::poisson_distribution;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/poisson_distribution.inl>
+
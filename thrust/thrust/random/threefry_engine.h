@@ -0,0 +1,296 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file threefry_engine.h
+ *  \brief A counter-based pseudorandom number engine built on the
+ *         Threefry bijection.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <iostream>
+#include <cstddef> // for size_t
+#include <thrust/detail/cstdint.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/random/detail/random_core_access.h>
+#include <thrust/random/detail/counter_based_engine_counter.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random_number_engine_templates
+ *  \{
+ */
+
+/*! \class threefry_engine
+ *  \brief A \p threefry_engine random number engine produces unsigned integer
+ *         random numbers by applying the Threefry bijection of Salmon et al.,
+ *         an add-rotate-xor cipher derived from Threefish, to a counter, under
+ *         a key derived from the seed.
+ *
+ *         Like \p philox_engine, it is stateless given its key and counter,
+ *         and \p discard takes constant time.
+ *
+ *  \tparam UIntType The type of unsigned integer to produce.
+ *  \tparam w The word size of the produced values.
+ *  \tparam n The number of words in a counter, either \c 2 or \c 4.
+ *  \tparam r The number of rounds of the bijection.
+ *
+ *  Threefry needs no multiplier, and may be faster than \p philox_engine
+ *  where wide multiplication is slow. See \p philox_engine for an example of
+ *  per-element random sequences.
+ *
+ *  \note Inexperienced users should not use this class template directly.  Instead, use
+ *        \p threefry2x32, \p threefry4x32, \p threefry2x64 or \p threefry4x64.
+ *  \see philox_engine
+ */
+template<typename UIntType, size_t w, size_t n, size_t r>
+  class threefry_engine
+{
+    /*! \cond
+     */
+    THRUST_STATIC_ASSERT_MSG(n == 2 || n == 4, "threefry_engine's word count must be 2 or 4.");
+    THRUST_STATIC_ASSERT_MSG(w == 32 || w == 64, "threefry_engine's word size must be 32 or 64.");
+    THRUST_STATIC_ASSERT_MSG(w <= sizeof(UIntType) * 8, "threefry_engine's words don't fit in UIntType.");
+    THRUST_STATIC_ASSERT_MSG(r > 0, "threefry_engine requires at least one round.");
+    /*! \endcond
+     */
+
+  public:
+    // types
+
+    /*! \typedef result_type
+     *  \brief The type of the unsigned integer produced by this \p threefry_engine.
+     */
+    typedef UIntType result_type;
+
+    // engine characteristics
+
+    /*! The word size of the produced values.
+     */
+    static const size_t word_size = w;
+
+    /*! The number of words in a counter, and in each block of results.
+     */
+    static const size_t word_count = n;
+
+    /*! The number of rounds of the bijection.
+     */
+    static const size_t round_count = r;
+
+    /*! The smallest value this \p threefry_engine may potentially produce.
+     */
+    static const result_type min = 0;
+
+    /*! The largest value this \p threefry_engine may potentially produce.
+     */
+    static const result_type max = detail::counter_based_engine_counter<result_type,w,n>::wordmask;
+
+    /*! The default seed of this \p threefry_engine.
+     */
+    static const result_type default_seed = 20111115u;
+
+    // constructors and seeding functions
+
+    /*! This constructor, which optionally accepts a seed, initializes a new
+     *  \p threefry_engine.
+     *
+     *  \param s The seed used to intialize this \p threefry_engine's state.
+     */
+    _CCCL_HOST_DEVICE
+    explicit threefry_engine(result_type s = default_seed);
+
+    /*! This method initializes this \p threefry_engine's state, and optionally accepts
+     *  a seed value. The seed becomes the first word of the key, and the
+     *  counter is reset to zero.
+     *
+     *  \param s The seed used to initializes this \p threefry_engine's state.
+     */
+    _CCCL_HOST_DEVICE
+    void seed(result_type s = default_seed);
+
+    /*! This method sets the counter of this \p threefry_engine. The next
+     *  results are those of the block with counter \p c.
+     *
+     *  \param c The counter, least significant word first.
+     */
+    _CCCL_HOST_DEVICE
+    void set_counter(const result_type (&c)[n]);
+
+    // generating functions
+
+    /*! This member function produces a new random value and updates this \p threefry_engine's state.
+     *  \return A new random number.
+     */
+    _CCCL_HOST_DEVICE
+    result_type operator()(void);
+
+    /*! This member function advances this \p threefry_engine's state a given number of times
+     *  and discards the results. It takes constant time.
+     *
+     *  \param z The number of random values to discard.
+     */
+    _CCCL_HOST_DEVICE
+    void discard(unsigned long long z);
+
+    /*! \cond
+     */
+  private:
+    typedef detail::counter_based_engine_counter<result_type,w,n> counter;
+
+    result_type m_key[n];
+    result_type m_counter[n];
+    result_type m_results[n];
+    size_t      m_index;
+
+    friend struct thrust::random::detail::random_core_access;
+
+    _CCCL_HOST_DEVICE
+    static void mix(result_type &x0, result_type &x1, unsigned int rotation);
+
+    _CCCL_HOST_DEVICE
+    void generate();
+
+    _CCCL_HOST_DEVICE
+    bool equal(const threefry_engine &rhs) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& stream_out(std::basic_ostream<CharT,Traits> &os) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& stream_in(std::basic_istream<CharT,Traits> &is);
+
+    /*! \endcond
+     */
+}; // end threefry_engine
+
+
+/*! This function checks two \p threefry_engines for equality.
+ *  \param lhs The first \p threefry_engine to test.
+ *  \param rhs The second \p threefry_engine to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template<typename UIntType_, size_t w_, size_t n_, size_t r_>
+_CCCL_HOST_DEVICE
+bool operator==(const threefry_engine<UIntType_,w_,n_,r_> &lhs,
+                const threefry_engine<UIntType_,w_,n_,r_> &rhs);
+
+
+/*! This function checks two \p threefry_engines for inequality.
+ *  \param lhs The first \p threefry_engine to test.
+ *  \param rhs The second \p threefry_engine to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template<typename UIntType_, size_t w_, size_t n_, size_t r_>
+_CCCL_HOST_DEVICE
+bool operator!=(const threefry_engine<UIntType_,w_,n_,r_> &lhs,
+                const threefry_engine<UIntType_,w_,n_,r_> &rhs);
+
+
+/*! This function streams a threefry_engine to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param e The \p threefry_engine to stream out.
+ *  \return \p os
+ */
+template<typename UIntType_, size_t w_, size_t n_, size_t r_,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const threefry_engine<UIntType_,w_,n_,r_> &e);
+
+
+/*! This function streams a threefry_engine in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param e The \p threefry_engine to stream in.
+ *  \return \p is
+ */
+template<typename UIntType_, size_t w_, size_t n_, size_t r_,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           threefry_engine<UIntType_,w_,n_,r_> &e);
+
+
+/*! \} // end random_number_engine_templates
+ */
+
+
+/*! \addtogroup predefined_random
+ *  \{
+ */
+
+/*! \typedef threefry2x32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry2x32-20 counter-based random number generator of Random123.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry2x32
+ *        shall produce the value \c 1363243192 .
+ */
+typedef threefry_engine<thrust::detail::uint32_t, 32, 2, 20> threefry2x32;
+
+
+/*! \typedef threefry4x32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry4x32-20 counter-based random number generator of Random123.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry4x32
+ *        shall produce the value \c 112810865 .
+ */
+typedef threefry_engine<thrust::detail::uint32_t, 32, 4, 20> threefry4x32;
+
+
+/*! \typedef threefry2x64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry2x64-20 counter-based random number generator of Random123.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry2x64
+ *        shall produce the value \c 10067442004315573443 .
+ */
+typedef threefry_engine<thrust::detail::uint64_t, 64, 2, 20> threefry2x64;
+
+
+/*! \typedef threefry4x64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry4x64-20 counter-based random number generator of Random123.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry4x64
+ *        shall produce the value \c 9253438642465275567 .
+ */
+typedef threefry_engine<thrust::detail::uint64_t, 64, 4, 20> threefry4x64;
+
+/*! \} // predefined_random
+ */
+
+} // end random
+
+// import names into thrust::
+using random::threefry_engine;
+using random::threefry2x32;
+using random::threefry4x32;
+using random::threefry2x64;
+using random::threefry4x64;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/threefry_engine.inl>
+
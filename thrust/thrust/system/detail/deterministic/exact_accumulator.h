@@ -0,0 +1,276 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cstdint.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace deterministic
+{
+
+
+// Accumulates a sum of doubles without rounding. Every finite double is an
+// integer multiple of 2^-1074 below 2^1024, so the sum is held as a fixed
+// point number of 32-bit digits, the first of which has the weight 2^-1074.
+// Each digit is kept in a 64-bit integer, so that up to 2^31 additions to it
+// need no carry propagation. The sum only depends on the values added, not
+// on their order, and it is rounded once, when it is read.
+class exact_accumulator
+{
+  public:
+    exact_accumulator()
+      : m_additions(0), m_has_special(false), m_special(0)
+    {
+      for(int i = 0; i < num_digits; ++i)
+      {
+        m_digits[i] = 0;
+      }
+    }
+
+    void add(double x)
+    {
+      thrust::detail::uint64_t bits;
+      std::memcpy(&bits, &x, sizeof(double));
+
+      const int biased_exponent = static_cast<int>((bits >> 52) & 0x7ff);
+
+      thrust::detail::uint64_t significand = bits & ((thrust::detail::uint64_t(1) << 52) - 1);
+
+      if(biased_exponent == 0x7ff)
+      {
+        // infinities and NaNs are summed separately
+        m_special     = m_has_special ? m_special + x : x;
+        m_has_special = true;
+        return;
+      }
+
+      // the position of the lowest bit of the significand
+      int position = 0;
+
+      if(biased_exponent != 0)
+      {
+        significand |= thrust::detail::uint64_t(1) << 52;
+        position = biased_exponent - 1;
+      }
+
+      const int digit = position / 32;
+      const int shift = position % 32;
+
+      // the significand has 53 bits, so it spans up to three digits
+      const thrust::detail::uint64_t low  = (significand & 0xffffffff) << shift;
+      const thrust::detail::uint64_t high = (significand >> 32) << shift;
+
+      const thrust::detail::int64_t d0 = static_cast<thrust::detail::int64_t>(low & 0xffffffff);
+      const thrust::detail::int64_t d1 = static_cast<thrust::detail::int64_t>((low >> 32) + (high & 0xffffffff));
+      const thrust::detail::int64_t d2 = static_cast<thrust::detail::int64_t>(high >> 32);
+
+      if(bits >> 63)
+      {
+        m_digits[digit]     -= d0;
+        m_digits[digit + 1] -= d1;
+        m_digits[digit + 2] -= d2;
+      }
+      else
+      {
+        m_digits[digit]     += d0;
+        m_digits[digit + 1] += d1;
+        m_digits[digit + 2] += d2;
+      }
+
+      if(++m_additions == max_additions)
+      {
+        normalize();
+      }
+    }
+
+    void add(const exact_accumulator &other)
+    {
+      exact_accumulator tmp = other;
+      tmp.normalize();
+      normalize();
+
+      for(int i = 0; i < num_digits; ++i)
+      {
+        m_digits[i] += tmp.m_digits[i];
+      }
+
+      if(other.m_has_special)
+      {
+        m_special     = m_has_special ? m_special + other.m_special : other.m_special;
+        m_has_special = true;
+      }
+    }
+
+    // the sum rounded to the nearest value of T, which is float or double
+    template<typename T>
+    T sum() const
+    {
+      if(m_has_special)
+      {
+        return static_cast<T>(m_special);
+      }
+
+      exact_accumulator tmp = *this;
+      tmp.normalize();
+
+      // the sign of the number is that of its top digit
+      const bool negative = tmp.m_digits[num_digits - 1] < 0;
+
+      if(negative)
+      {
+        for(int i = 0; i < num_digits; ++i)
+        {
+          tmp.m_digits[i] = -tmp.m_digits[i];
+        }
+
+        tmp.normalize();
+      }
+
+      int top = num_digits - 1;
+
+      while(top >= 0 && tmp.m_digits[top] == 0)
+      {
+        --top;
+      }
+
+      if(top < 0)
+      {
+        return T(0);
+      }
+
+      // gather the 64 highest bits of the number, and set the lowest of them
+      // if any of the bits below are set, so that the conversion of the 64
+      // bits rounds as the whole number would
+      const thrust::detail::uint64_t d0 = tmp.digit(top);
+      const thrust::detail::uint64_t d1 = tmp.digit(top - 1);
+      const thrust::detail::uint64_t d2 = tmp.digit(top - 2);
+
+      int leading_zeros = 0;
+
+      while(!(d0 & (thrust::detail::uint64_t(0x80000000) >> leading_zeros)))
+      {
+        ++leading_zeros;
+      }
+
+      thrust::detail::uint64_t bits = (d0 << (32 + leading_zeros)) | (d1 << leading_zeros) | (d2 >> (32 - leading_zeros));
+
+      bool sticky = (d2 & ((thrust::detail::uint64_t(1) << (32 - leading_zeros)) - 1)) != 0;
+
+      for(int i = top - 3; i >= 0 && !sticky; --i)
+      {
+        sticky = tmp.m_digits[i] != 0;
+      }
+
+      if(sticky)
+      {
+        bits |= 1;
+      }
+
+      const int exponent = 32 * (top - 2) + 32 - leading_zeros - 1074;
+
+      // The number is bits * 2^exponent, with the highest of the 64 bits set.
+      // Round it once to the precision of T, or to the lowest bit of T's
+      // subnormals if that is coarser; converting the 64 bits and scaling the
+      // result would round subnormal results twice.
+      const int lowest_exponent = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits;
+
+      int drop = 64 - std::numeric_limits<T>::digits;
+
+      if(lowest_exponent - exponent > drop)
+      {
+        drop = lowest_exponent - exponent;
+      }
+
+      // the number is below half the smallest subnormal
+      if(drop > 64)
+      {
+        return negative ? -T(0) : T(0);
+      }
+
+      // round to nearest, ties to even
+      thrust::detail::uint64_t significand = drop == 64 ? 0 : bits >> drop;
+
+      const thrust::detail::uint64_t remainder = drop == 64 ? bits : bits & ((thrust::detail::uint64_t(1) << drop) - 1);
+      const thrust::detail::uint64_t half      = thrust::detail::uint64_t(1) << (drop - 1);
+
+      if(remainder > half || (remainder == half && (significand & 1)))
+      {
+        ++significand;
+      }
+
+      // the significand fits in T, so only an overflow to infinity is left
+      const T result = std::ldexp(static_cast<T>(significand), exponent + drop);
+
+      return negative ? -result : result;
+    }
+
+  private:
+    // 2098 bits for the finite doubles, and two more digits for the carries
+    // out of sums which overflow
+    static const int num_digits = 68;
+
+    static const int max_additions = 1 << 30;
+
+    // propagates the carries, which leaves all the digits but the top one,
+    // which holds the sign, in [0, 2^32)
+    void normalize()
+    {
+      for(int i = 0; i + 1 < num_digits; ++i)
+      {
+        // arithmetic shift rounds towards negative infinity
+        const thrust::detail::int64_t carry = m_digits[i] >> 32;
+
+        m_digits[i]     -= carry * (thrust::detail::int64_t(1) << 32);
+        m_digits[i + 1] += carry;
+      }
+
+      m_additions = 0;
+    }
+
+    thrust::detail::uint64_t digit(int i) const
+    {
+      return i < 0 ? 0 : static_cast<thrust::detail::uint64_t>(m_digits[i]);
+    }
+
+    thrust::detail::int64_t m_digits[num_digits];
+    int                     m_additions;
+    bool                    m_has_special;
+    double                  m_special;
+};
+
+
+} // end namespace deterministic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
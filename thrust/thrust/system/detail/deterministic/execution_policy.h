@@ -0,0 +1,208 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/detail/execute_with_allocator.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/system/cpp/detail/execution_policy.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+
+// the systems' policies are only needed to name them
+namespace omp
+{
+namespace detail
+{
+template<typename> struct execution_policy;
+} // end detail
+} // end omp
+namespace tbb
+{
+namespace detail
+{
+template<typename> struct execution_policy;
+} // end detail
+} // end tbb
+
+namespace detail
+{
+namespace deterministic
+{
+
+
+// the partial results of floating point sums are combined in a fixed order
+struct ordered_summation_t {};
+
+// floating point sums are accumulated exactly, and rounded once
+struct exact_summation_t {};
+
+
+// the systems whose policies may be made deterministic
+template<template<typename> class BaseSystem>
+struct is_supported_system
+  : thrust::detail::false_type
+{};
+
+template<>
+struct is_supported_system<thrust::system::detail::sequential::execution_policy>
+  : thrust::detail::true_type
+{};
+
+template<>
+struct is_supported_system<thrust::system::cpp::detail::execution_policy>
+  : thrust::detail::true_type
+{};
+
+template<>
+struct is_supported_system<thrust::system::omp::detail::execution_policy>
+  : thrust::detail::true_type
+{};
+
+template<>
+struct is_supported_system<thrust::system::tbb::detail::execution_policy>
+  : thrust::detail::true_type
+{};
+
+
+// An execution policy of BaseSystem whose reductions and scans give the same
+// result whatever the number of threads. All the other algorithms are those
+// of BaseSystem. Temporary storage is allocated with Allocator, or by
+// BaseSystem if it is void.
+template<template<typename> class BaseSystem, typename Summation = ordered_summation_t, typename Allocator = void>
+  struct execution_policy
+    : BaseSystem<execution_policy<BaseSystem, Summation, Allocator> >
+{
+  typedef Summation summation_type;
+
+  execution_policy(Allocator alloc)
+    : m_alloc(alloc)
+  {}
+
+  typename thrust::detail::remove_reference<Allocator>::type &get_allocator()
+  {
+    return m_alloc;
+  }
+
+  private:
+    Allocator m_alloc;
+};
+
+template<template<typename> class BaseSystem, typename Summation>
+  struct execution_policy<BaseSystem, Summation, void>
+    : BaseSystem<execution_policy<BaseSystem, Summation, void> >
+{
+  typedef Summation summation_type;
+};
+
+
+// temporary storage of a policy with an allocator is allocated like that of
+// the policy par(alloc) it was made from
+template<typename T, template<typename> class BaseSystem, typename Summation, typename Allocator>
+typename thrust::detail::disable_if<
+  thrust::detail::is_same<Allocator, void>::value,
+  thrust::pair<T*, std::ptrdiff_t>
+>::type
+  get_temporary_buffer(execution_policy<BaseSystem, Summation, Allocator> &exec, std::ptrdiff_t n)
+{
+  typedef typename thrust::detail::remove_reference<Allocator>::type naked_allocator;
+
+  thrust::detail::execute_with_allocator<naked_allocator&, BaseSystem> with_allocator(exec.get_allocator());
+
+  return thrust::detail::get_temporary_buffer<T>(with_allocator, n);
+}
+
+template<typename Pointer, template<typename> class BaseSystem, typename Summation, typename Allocator>
+typename thrust::detail::disable_if<
+  thrust::detail::is_same<Allocator, void>::value
+>::type
+  return_temporary_buffer(execution_policy<BaseSystem, Summation, Allocator> &exec, Pointer p, std::ptrdiff_t n)
+{
+  typedef typename thrust::detail::remove_reference<Allocator>::type naked_allocator;
+
+  thrust::detail::execute_with_allocator<naked_allocator&, BaseSystem> with_allocator(exec.get_allocator());
+
+  thrust::detail::return_temporary_buffer(with_allocator, p, n);
+}
+
+
+// The number of consecutive elements which a single thread reduces or scans.
+// The results depend on it, so it must not depend on the number of threads.
+const std::ptrdiff_t block_size = 8192;
+
+
+template<typename Size>
+Size num_blocks(Size n)
+{
+  return (n + Size(block_size) - 1) / Size(block_size);
+}
+
+
+// the index past the end of the block which begins at begin
+template<typename Size>
+Size block_end(Size begin, Size n)
+{
+  return (n - begin < Size(block_size)) ? n : begin + Size(block_size);
+}
+
+
+// true if the blocks of Policy are executed one after the other by a single
+// thread, in which case each may be reduced and scanned in a single pass
+template<typename Policy>
+struct runs_in_order
+  : thrust::detail::false_type
+{};
+
+template<typename Summation, typename Allocator>
+struct runs_in_order<execution_policy<thrust::system::detail::sequential::execution_policy, Summation, Allocator> >
+  : thrust::detail::true_type
+{};
+
+template<typename Summation, typename Allocator>
+struct runs_in_order<execution_policy<thrust::system::cpp::detail::execution_policy, Summation, Allocator> >
+  : thrust::detail::true_type
+{};
+
+
+template<typename Iterator>
+struct is_random_access
+  : thrust::detail::is_convertible<
+      typename thrust::iterator_traversal<Iterator>::type,
+      thrust::random_access_traversal_tag
+    >
+{};
+
+
+} // end namespace deterministic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,258 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file reduce.h
+ *  \brief Reductions whose results do not depend on the number of threads.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/deterministic/exact_accumulator.h>
+#include <thrust/system/detail/deterministic/execution_policy.h>
+#include <thrust/system/detail/internal/simd.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace deterministic
+{
+namespace reduce_detail
+{
+
+
+// reduces each block of the input to a partial sum, in the same order
+// whichever thread it runs on
+template<typename RandomAccessIterator, typename Size, typename OutputType, typename BinaryFunction>
+struct reduce_block
+{
+  RandomAccessIterator first;
+  Size                 n;
+  OutputType          *partial_sums;
+  BinaryFunction       binary_op;
+
+  void operator()(Size block) const
+  {
+    const Size begin = block * Size(block_size);
+    const Size end   = block_end(begin, n);
+
+    OutputType sum = thrust::raw_reference_cast(first[begin]);
+
+    partial_sums[block] = thrust::system::detail::internal::reduce_range(first + begin + 1, end - begin - 1, sum, binary_op);
+  }
+};
+
+
+// accumulates each block of the input exactly
+template<typename RandomAccessIterator, typename Size, typename OutputType>
+struct accumulate_block
+{
+  RandomAccessIterator first;
+  Size                 n;
+  exact_accumulator   *partial_sums;
+
+  void operator()(Size block) const
+  {
+    const Size begin = block * Size(block_size);
+    const Size end   = block_end(begin, n);
+
+    exact_accumulator sum;
+
+    for(Size i = begin; i < end; ++i)
+    {
+      sum.add(static_cast<double>(static_cast<OutputType>(first[i])));
+    }
+
+    partial_sums[block] = sum;
+  }
+};
+
+
+// combines the partial sums pairwise, doubling the distance between the
+// partners at each step, which is a tree of a fixed shape for a given n
+template<typename OutputType, typename Size, typename BinaryFunction>
+OutputType combine_partial_sums(OutputType *partial_sums, Size n, BinaryFunction binary_op)
+{
+  thrust::detail::wrapped_function<BinaryFunction,OutputType> wrapped_binary_op(binary_op);
+
+  for(Size width = 1; width < n; width *= 2)
+  {
+    for(Size i = 0; i + width < n; i += 2 * width)
+    {
+      partial_sums[i] = wrapped_binary_op(partial_sums[i], partial_sums[i + width]);
+    }
+  }
+
+  return partial_sums[0];
+}
+
+
+// true if the sum may be accumulated exactly: the exact accumulator holds
+// doubles, so this is limited to sums of floats and doubles
+template<typename Summation, typename OutputType, typename BinaryFunction>
+struct use_exact_summation
+  : thrust::detail::integral_constant<
+      bool,
+      thrust::detail::is_same<Summation, exact_summation_t>::value
+        && (thrust::detail::is_same<OutputType, float>::value || thrust::detail::is_same<OutputType, double>::value)
+        && (thrust::detail::is_same<BinaryFunction, thrust::plus<OutputType> >::value
+            || thrust::detail::is_same<BinaryFunction, thrust::plus<void> >::value)
+    >
+{};
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator, typename OutputType, typename BinaryFunction>
+OutputType reduce_blocks(DerivedPolicy &exec,
+                         RandomAccessIterator first,
+                         RandomAccessIterator last,
+                         OutputType init,
+                         BinaryFunction binary_op,
+                         thrust::detail::false_type) // use_exact_summation
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  const Size n = thrust::distance(first, last);
+
+  if(n == 0)
+  {
+    return init;
+  }
+
+  const Size blocks = num_blocks(n);
+
+  thrust::detail::temporary_array<OutputType, DerivedPolicy> partial_sums(exec, blocks);
+
+  reduce_block<RandomAccessIterator, Size, OutputType, BinaryFunction> f = {first, n, thrust::raw_pointer_cast(partial_sums.data()), binary_op};
+
+  thrust::for_each_n(exec, thrust::counting_iterator<Size>(0), blocks, f);
+
+  thrust::detail::wrapped_function<BinaryFunction,OutputType> wrapped_binary_op(binary_op);
+
+  return wrapped_binary_op(init, combine_partial_sums(thrust::raw_pointer_cast(partial_sums.data()), blocks, binary_op));
+}
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator, typename OutputType, typename BinaryFunction>
+OutputType reduce_blocks(DerivedPolicy &exec,
+                         RandomAccessIterator first,
+                         RandomAccessIterator last,
+                         OutputType init,
+                         BinaryFunction,
+                         thrust::detail::true_type) // use_exact_summation
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  const Size n = thrust::distance(first, last);
+
+  if(n == 0)
+  {
+    return init;
+  }
+
+  const Size blocks = num_blocks(n);
+
+  thrust::detail::temporary_array<exact_accumulator, DerivedPolicy> partial_sums(exec, blocks);
+
+  accumulate_block<RandomAccessIterator, Size, OutputType> f = {first, n, thrust::raw_pointer_cast(partial_sums.data())};
+
+  thrust::for_each_n(exec, thrust::counting_iterator<Size>(0), blocks, f);
+
+  exact_accumulator sum;
+  sum.add(static_cast<double>(init));
+
+  for(Size block = 0; block < blocks; ++block)
+  {
+    sum.add(partial_sums[block]);
+  }
+
+  return sum.template sum<OutputType>();
+}
+
+
+template<typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction>
+OutputType reduce(DerivedPolicy &,
+                  InputIterator first,
+                  InputIterator last,
+                  OutputType init,
+                  BinaryFunction binary_op,
+                  thrust::detail::false_type) // is_random_access
+{
+  // the input cannot be split into blocks, so it is reduced in order
+  return thrust::reduce(thrust::seq, first, last, init, binary_op);
+}
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator, typename OutputType, typename BinaryFunction>
+OutputType reduce(DerivedPolicy &exec,
+                  RandomAccessIterator first,
+                  RandomAccessIterator last,
+                  OutputType init,
+                  BinaryFunction binary_op,
+                  thrust::detail::true_type) // is_random_access
+{
+  use_exact_summation<typename DerivedPolicy::summation_type, OutputType, BinaryFunction> use_exact;
+
+  return reduce_blocks(exec, first, last, init, binary_op, use_exact);
+}
+
+
+} // end namespace reduce_detail
+
+
+template<template<typename> class BaseSystem,
+         typename Summation,
+         typename Allocator,
+         typename InputIterator,
+         typename OutputType,
+         typename BinaryFunction>
+  OutputType reduce(execution_policy<BaseSystem, Summation, Allocator> &exec,
+                    InputIterator first,
+                    InputIterator last,
+                    OutputType init,
+                    BinaryFunction binary_op)
+{
+  is_random_access<InputIterator> random_access;
+
+  return reduce_detail::reduce(exec, first, last, init, binary_op, random_access);
+}
+
+
+} // end namespace deterministic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
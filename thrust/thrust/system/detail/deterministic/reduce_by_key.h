@@ -0,0 +1,266 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file reduce_by_key.h
+ *  \brief Keyed reductions whose results do not depend on the number of
+ *         threads.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/for_each.h>
+#include <thrust/pair.h>
+#include <thrust/reduce.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/deterministic/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace deterministic
+{
+namespace reduce_by_key_detail
+{
+
+
+// counts the keys of each block which begin a run of equal keys
+template<typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+struct count_heads
+{
+  RandomAccessIterator keys_first;
+  Size                 n;
+  Size                *counts;
+  BinaryPredicate      binary_pred;
+
+  void operator()(Size block) const
+  {
+    const Size begin = block * Size(block_size);
+    const Size end   = block_end(begin, n);
+
+    Size count = 0;
+
+    for(Size i = begin; i < end; ++i)
+    {
+      if(i == 0 || !binary_pred(keys_first[i - 1], keys_first[i]))
+      {
+        ++count;
+      }
+    }
+
+    counts[block] = count;
+  }
+};
+
+
+// reduces each run of equal keys which begins in a block, in order, even
+// where the run continues into the blocks after it, so that the sums are
+// those of a sequential reduction
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Size,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+struct reduce_runs
+{
+  RandomAccessIterator1 keys_first;
+  RandomAccessIterator2 values_first;
+  RandomAccessIterator3 keys_output;
+  RandomAccessIterator4 values_output;
+  Size                  n;
+  const Size           *offsets;
+  BinaryPredicate       binary_pred;
+  BinaryFunction        binary_op;
+
+  void operator()(Size block) const
+  {
+    // Use the input iterator's value type per https://wg21.link/P0571
+    typedef typename thrust::iterator_value<RandomAccessIterator2>::type ValueType;
+
+    thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+    const Size begin = block * Size(block_size);
+    const Size end   = block_end(begin, n);
+
+    Size output = offsets[block];
+
+    // skip the end of a run which began in an earlier block
+    Size i = begin;
+
+    while(i < end && i > 0 && binary_pred(keys_first[i - 1], keys_first[i]))
+    {
+      ++i;
+    }
+
+    while(i < end)
+    {
+      keys_output[output] = keys_first[i];
+
+      ValueType sum = values_first[i];
+
+      for(++i; i < n && binary_pred(keys_first[i - 1], keys_first[i]); ++i)
+      {
+        sum = wrapped_binary_op(sum, values_first[i]);
+      }
+
+      values_output[output] = sum;
+
+      ++output;
+    }
+  }
+};
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    reduce_by_key(DerivedPolicy &,
+                  InputIterator1 keys_first,
+                  InputIterator1 keys_last,
+                  InputIterator2 values_first,
+                  OutputIterator1 keys_output,
+                  OutputIterator2 values_output,
+                  BinaryPredicate binary_pred,
+                  BinaryFunction binary_op,
+                  thrust::detail::false_type) // are_random_access
+{
+  return thrust::reduce_by_key(thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    reduce_by_key(DerivedPolicy &exec,
+                  InputIterator1 keys_first,
+                  InputIterator1 keys_last,
+                  InputIterator2 values_first,
+                  OutputIterator1 keys_output,
+                  OutputIterator2 values_output,
+                  BinaryPredicate binary_pred,
+                  BinaryFunction binary_op,
+                  thrust::detail::true_type) // are_random_access
+{
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+
+  const Size n = keys_last - keys_first;
+
+  if(n == 0)
+  {
+    return thrust::make_pair(keys_output, values_output);
+  }
+
+  const Size blocks = num_blocks(n);
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> offsets(exec, blocks);
+
+  Size *raw_offsets = thrust::raw_pointer_cast(offsets.data());
+
+  count_heads<InputIterator1, Size, BinaryPredicate> count_f = {keys_first, n, raw_offsets, binary_pred};
+
+  thrust::for_each_n(exec, thrust::counting_iterator<Size>(0), blocks, count_f);
+
+  // the runs of each block are written after those of the blocks before it
+  Size total = 0;
+
+  for(Size block = 0; block < blocks; ++block)
+  {
+    const Size count = raw_offsets[block];
+
+    raw_offsets[block] = total;
+
+    total += count;
+  }
+
+  reduce_runs<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2, Size, BinaryPredicate, BinaryFunction> reduce_f =
+    {keys_first, values_first, keys_output, values_output, n, raw_offsets, binary_pred, binary_op};
+
+  thrust::for_each_n(exec, thrust::counting_iterator<Size>(0), blocks, reduce_f);
+
+  return thrust::make_pair(keys_output + total, values_output + total);
+}
+
+
+template<typename Iterator1, typename Iterator2, typename Iterator3, typename Iterator4>
+struct are_random_access
+  : thrust::detail::integral_constant<
+      bool,
+      is_random_access<Iterator1>::value && is_random_access<Iterator2>::value
+        && is_random_access<Iterator3>::value && is_random_access<Iterator4>::value
+    >
+{};
+
+
+} // end namespace reduce_by_key_detail
+
+
+template<template<typename> class BaseSystem,
+         typename Summation,
+         typename Allocator,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    reduce_by_key(execution_policy<BaseSystem, Summation, Allocator> &exec,
+                  InputIterator1 keys_first,
+                  InputIterator1 keys_last,
+                  InputIterator2 values_first,
+                  OutputIterator1 keys_output,
+                  OutputIterator2 values_output,
+                  BinaryPredicate binary_pred,
+                  BinaryFunction binary_op)
+{
+  reduce_by_key_detail::are_random_access<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2> random_access;
+
+  return reduce_by_key_detail::reduce_by_key(exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op, random_access);
+}
+
+
+} // end namespace deterministic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
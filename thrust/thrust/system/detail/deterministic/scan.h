@@ -0,0 +1,579 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file scan.h
+ *  \brief Scans whose results do not depend on the number of threads.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/for_each.h>
+#include <thrust/scan.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/deterministic/execution_policy.h>
+#include <thrust/system/detail/internal/simd.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace deterministic
+{
+namespace scan_detail
+{
+
+
+// reduces each block of the input into the carry into the block after it;
+// the sum of the last block is not needed
+template<typename InputIterator, typename Size, typename T, typename BinaryFunction>
+struct reduce_block
+{
+  InputIterator  first;
+  Size           n;
+  T             *carries;
+  BinaryFunction binary_op;
+
+  void operator()(Size block) const
+  {
+    const Size begin = block * Size(block_size);
+    const Size end   = block_end(begin, n);
+
+    if(end < n)
+    {
+      T sum = thrust::raw_reference_cast(first[begin]);
+
+      carries[block + 1] = thrust::system::detail::internal::reduce_range(first + begin + 1, end - begin - 1, sum, binary_op);
+    }
+  }
+};
+
+
+// scans each block of the input, starting from the carry into it; the first
+// block of an inclusive scan has no carry
+template<bool Exclusive, typename InputIterator, typename Size, typename OutputIterator, typename T, typename BinaryFunction>
+struct scan_block
+{
+  InputIterator  first;
+  Size           n;
+  OutputIterator result;
+  const T       *carries;
+  BinaryFunction binary_op;
+
+  void operator()(Size block) const
+  {
+    const Size begin = block * Size(block_size);
+    const Size end   = block_end(begin, n);
+
+    if(Exclusive)
+    {
+      thrust::exclusive_scan(thrust::seq, first + begin, first + end, result + begin, carries[block], binary_op);
+    }
+    else if(block == 0)
+    {
+      thrust::inclusive_scan(thrust::seq, first, first + end, result, binary_op);
+    }
+    else
+    {
+      thrust::detail::wrapped_function<BinaryFunction,T> wrapped_binary_op(binary_op);
+
+      T sum = carries[block];
+
+      for(Size i = begin; i < end; ++i)
+      {
+        result[i] = sum = wrapped_binary_op(sum, first[i]);
+      }
+    }
+  }
+};
+
+
+// writes the scan of each block, without its carry, to the output, and the
+// sum of the block to the carry into the block after it. The scan is
+// inclusive, or exclusive from zero if FromZero.
+template<bool FromZero, typename InputIterator, typename Size, typename T, typename BinaryFunction>
+struct scan_block_into_output
+{
+  InputIterator  first;
+  Size           n;
+  T             *result;
+  T             *carries;
+  BinaryFunction binary_op;
+
+  void operator()(Size block) const
+  {
+    const Size begin = block * Size(block_size);
+    const Size end   = block_end(begin, n);
+
+    if(FromZero)
+    {
+      // the scan may be in place
+      const T last = first[end - 1];
+
+      thrust::exclusive_scan(thrust::seq, first + begin, first + end, result + begin, T(), binary_op);
+
+      if(end < n)
+      {
+        carries[block + 1] = binary_op(result[end - 1], last);
+      }
+    }
+    else
+    {
+      thrust::inclusive_scan(thrust::seq, first + begin, first + end, result + begin, binary_op);
+
+      if(end < n)
+      {
+        carries[block + 1] = result[end - 1];
+      }
+    }
+  }
+};
+
+
+// combines the carry into each block with the scan of the block in the
+// output; when Shift, the inclusive scan is also shifted by one element into
+// an exclusive scan
+template<bool Exclusive, bool Shift, typename Size, typename T, typename BinaryFunction>
+struct add_carry_to_block
+{
+  Size           n;
+  T             *result;
+  const T       *carries;
+  BinaryFunction binary_op;
+
+  void operator()(Size block) const
+  {
+    if(!Exclusive && block == 0)
+    {
+      return;
+    }
+
+    const Size begin = block * Size(block_size);
+    const Size end   = block_end(begin, n);
+
+    thrust::system::detail::internal::use_simd_scan<T*, T*, T, BinaryFunction> use_simd;
+
+    add_carry(result + begin, end - begin, carries[block], use_simd);
+
+    if(Exclusive)
+    {
+      result[begin] = carries[block];
+    }
+  }
+
+  void add_carry(T *data, Size size, T carry, thrust::detail::false_type) const // use_simd_scan
+  {
+    thrust::detail::wrapped_function<BinaryFunction,T> wrapped_binary_op(binary_op);
+
+    if(Shift)
+    {
+      for(Size i = size - 1; i > 0; --i)
+      {
+        data[i] = wrapped_binary_op(carry, data[i - 1]);
+      }
+    }
+    else
+    {
+      for(Size i = 0; i < size; ++i)
+      {
+        data[i] = wrapped_binary_op(carry, data[i]);
+      }
+    }
+  }
+
+#if THRUST_SIMD_HAS_SHUFFLEVECTOR
+  void add_carry(T *data, Size size, T carry, thrust::detail::true_type) const // use_simd_scan
+  {
+    thrust::system::detail::internal::simd_combine_carry<Shift>(data, size, carry, binary_op);
+  }
+#endif // THRUST_SIMD_HAS_SHUFFLEVECTOR
+};
+
+
+// executes both passes over a block
+template<typename FirstPass, typename SecondPass>
+struct both_passes
+{
+  FirstPass  first_pass;
+  SecondPass second_pass;
+
+  template<typename Size>
+  void operator()(Size block) const
+  {
+    first_pass(block);
+    second_pass(block);
+  }
+};
+
+
+// executes both passes of scan_block_into_output and add_carry_to_block over
+// a block; the carry into the block is known before its scan, so a
+// vectorized scan combines the carry as it stores the scan
+template<bool Exclusive, bool FromZero, typename InputIterator, typename Size, typename T, typename BinaryFunction, typename FirstPass, typename SecondPass>
+struct scan_block_in_order
+{
+  FirstPass      first_pass;
+  SecondPass     second_pass;
+  InputIterator  first;
+  Size           n;
+  T             *result;
+  T             *carries;
+  BinaryFunction binary_op;
+
+  void operator()(Size block) const
+  {
+    thrust::detail::integral_constant<
+      bool,
+      (!Exclusive || FromZero) && thrust::system::detail::internal::use_simd_scan<InputIterator, T*, T, BinaryFunction>::value
+    > combine_while_scanning;
+
+    scan(block, combine_while_scanning);
+  }
+
+  void scan(Size block, thrust::detail::false_type) const
+  {
+    first_pass(block);
+    second_pass(block);
+  }
+
+#if THRUST_SIMD_HAS_SHUFFLEVECTOR
+  void scan(Size block, thrust::detail::true_type) const
+  {
+    if(!Exclusive && block == 0)
+    {
+      first_pass(block);
+      return;
+    }
+
+    const Size begin = block * Size(block_size);
+    const Size end   = block_end(begin, n);
+
+    const T carry = carries[block];
+
+    if(Exclusive)
+    {
+      // the scan may be in place
+      const T last = first[end - 1];
+
+      const T sum = thrust::system::detail::internal::simd_exclusive_scan_with_carry(first + begin, end - begin, result + begin, T(), carry, binary_op);
+
+      result[begin] = carry;
+
+      if(end < n)
+      {
+        carries[block + 1] = binary_op(sum, last);
+      }
+    }
+    else
+    {
+      const T sum = thrust::system::detail::internal::simd_inclusive_scan_with_carry(first + begin, end - begin, result + begin, carry, binary_op);
+
+      if(end < n)
+      {
+        carries[block + 1] = sum;
+      }
+    }
+  }
+#endif // THRUST_SIMD_HAS_SHUFFLEVECTOR
+};
+
+
+// true if the exclusive scan of each block may start from zero, the identity
+// of plus, which leaves the carries to be added without moving the sums
+template<bool Exclusive, typename T, typename BinaryFunction>
+struct scan_from_zero
+  : thrust::detail::integral_constant<
+      bool,
+      Exclusive
+        && thrust::detail::is_arithmetic<T>::value
+        && (thrust::detail::is_same<BinaryFunction, thrust::plus<T> >::value
+            || thrust::detail::is_same<BinaryFunction, thrust::plus<void> >::value)
+    >
+{};
+
+
+// true if the scan of each block may be written to the output without its
+// carry, and read back to add the carry, so that the input is read once
+template<typename InputIterator, typename OutputIterator, typename T>
+struct scan_into_output
+  : thrust::detail::integral_constant<
+      bool,
+      thrust::is_contiguous_iterator<OutputIterator>::value
+        && thrust::detail::is_same<typename thrust::iterator_value<InputIterator>::type, T>::value
+        && thrust::detail::is_same<typename thrust::iterator_value<OutputIterator>::type, T>::value
+    >
+{};
+
+
+// Scans the input in blocks in two passes. The first writes the sum of each
+// block to the carry into the block after it, the sums are then scanned in
+// order into the carries, which the second pass combines with the scan of
+// each block. The carry into the first block is init, if the scan has one.
+// When the blocks run in order, both passes are executed over each block by
+// in_order_pass instead.
+template<bool Exclusive, typename DerivedPolicy, typename Size, typename T, typename BinaryFunction, typename FirstPass, typename SecondPass, typename InOrderPass>
+void scan_blocks(DerivedPolicy &exec,
+                 Size n,
+                 T *carries,
+                 BinaryFunction binary_op,
+                 FirstPass first_pass,
+                 SecondPass second_pass,
+                 InOrderPass in_order_pass)
+{
+  thrust::detail::wrapped_function<BinaryFunction,T> wrapped_binary_op(binary_op);
+
+  const Size blocks = num_blocks(n);
+
+  if(runs_in_order<DerivedPolicy>::value)
+  {
+    // each block is still in the cache from the first pass when the second
+    // pass reaches it; the results are those of the parallel passes below
+    for(Size block = 0; block < blocks; ++block)
+    {
+      in_order_pass(block);
+
+      if(block + 1 < blocks && (Exclusive || block > 0))
+      {
+        carries[block + 1] = wrapped_binary_op(carries[block], carries[block + 1]);
+      }
+    }
+
+    return;
+  }
+
+  thrust::for_each_n(exec, thrust::counting_iterator<Size>(0), blocks, first_pass);
+
+  for(Size block = 1; block < blocks; ++block)
+  {
+    if(Exclusive || block > 1)
+    {
+      carries[block] = wrapped_binary_op(carries[block - 1], carries[block]);
+    }
+  }
+
+  thrust::for_each_n(exec, thrust::counting_iterator<Size>(0), blocks, second_pass);
+}
+
+
+template<bool Exclusive, typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename T, typename BinaryFunction>
+OutputIterator scan(DerivedPolicy &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    OutputIterator result,
+                    T init,
+                    BinaryFunction binary_op,
+                    thrust::detail::false_type) // scan_into_output
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  const Size n = last - first;
+
+  if(n == 0)
+  {
+    return result;
+  }
+
+  thrust::detail::temporary_array<T, DerivedPolicy> carries(exec, num_blocks(n));
+
+  T *raw_carries = thrust::raw_pointer_cast(carries.data());
+
+  raw_carries[0] = init;
+
+  reduce_block<RandomAccessIterator, Size, T, BinaryFunction> first_pass = {first, n, raw_carries, binary_op};
+
+  typedef scan_block<Exclusive, RandomAccessIterator, Size, OutputIterator, T, BinaryFunction> SecondPass;
+
+  SecondPass second_pass = {first, n, result, raw_carries, binary_op};
+
+  both_passes<reduce_block<RandomAccessIterator, Size, T, BinaryFunction>, SecondPass> in_order_pass = {first_pass, second_pass};
+
+  scan_blocks<Exclusive>(exec, n, raw_carries, binary_op, first_pass, second_pass, in_order_pass);
+
+  return result + n;
+}
+
+
+template<bool Exclusive, typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename T, typename BinaryFunction>
+OutputIterator scan(DerivedPolicy &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    OutputIterator result,
+                    T init,
+                    BinaryFunction binary_op,
+                    thrust::detail::true_type) // scan_into_output
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  const Size n = last - first;
+
+  if(n == 0)
+  {
+    return result;
+  }
+
+  thrust::detail::temporary_array<T, DerivedPolicy> carries(exec, num_blocks(n));
+
+  T *raw_carries = thrust::raw_pointer_cast(carries.data());
+  T *raw_result  = thrust::detail::contiguous_iterator_raw_pointer_cast(result);
+
+  raw_carries[0] = init;
+
+  const bool from_zero = scan_from_zero<Exclusive, T, BinaryFunction>::value;
+
+  typedef scan_block_into_output<from_zero, RandomAccessIterator, Size, T, BinaryFunction> FirstPass;
+  typedef add_carry_to_block<Exclusive, Exclusive && !from_zero, Size, T, BinaryFunction> SecondPass;
+
+  FirstPass  first_pass  = {first, n, raw_result, raw_carries, binary_op};
+  SecondPass second_pass = {n, raw_result, raw_carries, binary_op};
+
+  scan_block_in_order<Exclusive, from_zero, RandomAccessIterator, Size, T, BinaryFunction, FirstPass, SecondPass> in_order_pass =
+    {first_pass, second_pass, first, n, raw_result, raw_carries, binary_op};
+
+  scan_blocks<Exclusive>(exec, n, raw_carries, binary_op, first_pass, second_pass, in_order_pass);
+
+  return result + n;
+}
+
+
+template<typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(DerivedPolicy &,
+                              InputIterator first,
+                              InputIterator last,
+                              OutputIterator result,
+                              BinaryFunction binary_op,
+                              thrust::detail::false_type) // is_random_access
+{
+  return thrust::inclusive_scan(thrust::seq, first, last, result, binary_op);
+}
+
+
+template<typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(DerivedPolicy &exec,
+                              InputIterator first,
+                              InputIterator last,
+                              OutputIterator result,
+                              BinaryFunction binary_op,
+                              thrust::detail::true_type) // is_random_access
+{
+  // Use the input iterator's value type per https://wg21.link/P0571
+  typedef typename thrust::iterator_value<InputIterator>::type ValueType;
+
+  scan_into_output<InputIterator, OutputIterator, ValueType> into_output;
+
+  // the carry into the first block is unused
+  return scan<false>(exec, first, last, result, ValueType(), binary_op, into_output);
+}
+
+
+template<typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename InitialValueType, typename BinaryFunction>
+OutputIterator exclusive_scan(DerivedPolicy &,
+                              InputIterator first,
+                              InputIterator last,
+                              OutputIterator result,
+                              InitialValueType init,
+                              BinaryFunction binary_op,
+                              thrust::detail::false_type) // is_random_access
+{
+  return thrust::exclusive_scan(thrust::seq, first, last, result, init, binary_op);
+}
+
+
+template<typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename InitialValueType, typename BinaryFunction>
+OutputIterator exclusive_scan(DerivedPolicy &exec,
+                              InputIterator first,
+                              InputIterator last,
+                              OutputIterator result,
+                              InitialValueType init,
+                              BinaryFunction binary_op,
+                              thrust::detail::true_type) // is_random_access
+{
+  scan_into_output<InputIterator, OutputIterator, InitialValueType> into_output;
+
+  return scan<true>(exec, first, last, result, init, binary_op, into_output);
+}
+
+
+template<typename InputIterator, typename OutputIterator>
+struct are_random_access
+  : thrust::detail::integral_constant<
+      bool,
+      is_random_access<InputIterator>::value && is_random_access<OutputIterator>::value
+    >
+{};
+
+
+} // end namespace scan_detail
+
+
+template<template<typename> class BaseSystem,
+         typename Summation,
+         typename Allocator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan(execution_policy<BaseSystem, Summation, Allocator> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                BinaryFunction binary_op)
+{
+  scan_detail::are_random_access<InputIterator, OutputIterator> random_access;
+
+  return scan_detail::inclusive_scan(exec, first, last, result, binary_op, random_access);
+}
+
+
+template<template<typename> class BaseSystem,
+         typename Summation,
+         typename Allocator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename InitialValueType,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan(execution_policy<BaseSystem, Summation, Allocator> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                InitialValueType init,
+                                BinaryFunction binary_op)
+{
+  scan_detail::are_random_access<InputIterator, OutputIterator> random_access;
+
+  return scan_detail::exclusive_scan(exec, first, last, result, init, binary_op, random_access);
+}
+
+
+} // end namespace deterministic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,106 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/generic/batched_copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3>
+  struct batched_copy_functor
+{
+  RandomAccessIterator1 src_ptrs;
+  RandomAccessIterator2 dst_ptrs;
+  RandomAccessIterator3 sizes;
+
+  _CCCL_HOST_DEVICE
+  batched_copy_functor(RandomAccessIterator1 src_ptrs, RandomAccessIterator2 dst_ptrs, RandomAccessIterator3 sizes)
+    : src_ptrs(src_ptrs), dst_ptrs(dst_ptrs), sizes(sizes)
+  {}
+
+  // copies the buffer with the given index
+  _CCCL_EXEC_CHECK_DISABLE
+  template<typename Size>
+  _CCCL_HOST_DEVICE
+  void operator()(Size i)
+  {
+    typedef typename thrust::iterator_value<RandomAccessIterator1>::type InputIterator;
+    typedef typename thrust::iterator_value<RandomAccessIterator2>::type OutputIterator;
+    typedef typename thrust::iterator_value<RandomAccessIterator3>::type BufferSize;
+
+    InputIterator  src = src_ptrs[i];
+    OutputIterator dst = dst_ptrs[i];
+    const BufferSize n = sizes[i];
+
+    for(BufferSize j = 0; j < n; ++j, ++src, ++dst)
+    {
+      *dst = *src;
+    }
+  } // end operator()()
+}; // end batched_copy_functor
+
+
+} // end namespace detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename Size>
+_CCCL_HOST_DEVICE
+  void batched_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator1 src_ptrs,
+                    RandomAccessIterator2 dst_ptrs,
+                    RandomAccessIterator3 sizes,
+                    Size num_buffers)
+{
+  // copy one buffer per element of the for_each
+  detail::batched_copy_functor<RandomAccessIterator1,RandomAccessIterator2,RandomAccessIterator3> f(src_ptrs, dst_ptrs, sizes);
+
+  thrust::for_each_n(exec, thrust::counting_iterator<Size>(0), num_buffers, f);
+} // end batched_copy()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -148,6 +148,33 @@ _CCCL_HOST_DEVICE
                    Predicate pred);
 
 
+template<typename ExecutionPolicy,
+         typename ForwardIterator,
+         typename Predicate1,
+         typename Predicate2>
+_CCCL_HOST_DEVICE
+  thrust::pair<ForwardIterator,ForwardIterator>
+    partition3(thrust::execution_policy<ExecutionPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last,
+               Predicate1 pred1,
+               Predicate2 pred2);
+
+
+template<typename ExecutionPolicy,
+         typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+_CCCL_HOST_DEVICE
+  OutputIterator bucket_partition(thrust::execution_policy<ExecutionPolicy> &exec,
+                                  ForwardIterator first,
+                                  ForwardIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets);
+
+
 template<typename ExecutionPolicy,
          typename ForwardIterator,
          typename Predicate>
@@ -34,6 +34,10 @@
 #include <thrust/advance.h>
 #include <thrust/partition.h>
 #include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
 #include <thrust/detail/internal_functional.h>
@@ -222,6 +226,55 @@ _CCCL_HOST_DEVICE
 } // end partition_copy()
 
 
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Predicate1,
+         typename Predicate2>
+_CCCL_HOST_DEVICE
+  thrust::pair<ForwardIterator,ForwardIterator>
+    partition3(thrust::execution_policy<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last,
+               Predicate1 pred1,
+               Predicate2 pred2)
+{
+  // split off the first group, then split the remainder
+  ForwardIterator middle1 = thrust::stable_partition(exec, first, last, pred1);
+  ForwardIterator middle2 = thrust::stable_partition(exec, middle1, last, pred2);
+
+  return thrust::make_pair(middle1, middle2);
+} // end partition3()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+_CCCL_HOST_DEVICE
+  OutputIterator bucket_partition(thrust::execution_policy<DerivedPolicy> &exec,
+                                  ForwardIterator first,
+                                  ForwardIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets)
+{
+  // compute the bucket of each element
+  thrust::detail::temporary_array<Size,DerivedPolicy> buckets(exec, thrust::distance(first, last));
+  thrust::transform(exec, first, last, buckets.begin(), bucket_op);
+
+  // a stable sort by bucket groups the buckets and preserves the order within each
+  thrust::stable_sort_by_key(exec, buckets.begin(), buckets.end(), first);
+
+  // each bucket begins at the lower bound of its index, and the last offset is the size
+  return thrust::lower_bound(exec,
+                             buckets.begin(), buckets.end(),
+                             thrust::counting_iterator<Size>(0),
+                             thrust::counting_iterator<Size>(num_buckets + 1),
+                             offsets);
+} // end bucket_partition()
+
+
 template<typename DerivedPolicy,
          typename ForwardIterator,
          typename Predicate>
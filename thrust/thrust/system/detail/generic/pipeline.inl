@@ -0,0 +1,266 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/generic/pipeline.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+
+template<typename Chain>
+  struct pipeline_tile
+{
+  _CCCL_HOST_DEVICE
+  pipeline_tile(const Chain &chain)
+    : chain(chain), count(0)
+  {}
+
+  Chain chain;
+
+  // the number of elements which reached the last node of the last pass
+  std::ptrdiff_t count;
+};
+
+
+// runs pass Pass of the pipeline over a tile, starting from the tile's state
+template<int Pass, typename InputIterator, typename Chain>
+  struct pipeline_tile_functor
+{
+  InputIterator first;
+  thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> decomp;
+  pipeline_tile<Chain> *tiles;
+
+  _CCCL_HOST_DEVICE
+  pipeline_tile_functor(InputIterator first,
+                        thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> decomp,
+                        pipeline_tile<Chain> *tiles)
+    : first(first), decomp(decomp), tiles(tiles)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template<typename Size>
+  _CCCL_HOST_DEVICE
+  void operator()(Size tile) const
+  {
+    const thrust::system::detail::internal::index_range<std::ptrdiff_t> range = decomp[tile];
+
+    // work on a copy so that threads don't share cache lines while they run
+    Chain chain(tiles[tile].chain);
+    chain.begin_tile();
+
+    std::ptrdiff_t reached = 0;
+
+    InputIterator iter = first + range.begin();
+    for(std::ptrdiff_t i = range.begin(); i != range.end(); ++i, ++iter)
+    {
+      chain.template push<Pass>(*iter, reached);
+    }
+
+    tiles[tile].chain.assign_state(chain);
+    tiles[tile].count = reached;
+  } // end operator()()
+}; // end pipeline_tile_functor
+
+
+// combines the tiles' state after pass Pass, in order
+template<int Pass, typename Chain>
+  struct pipeline_combine_functor
+{
+  typedef typename Chain::sink_type sink_type;
+
+  static const int num_scans = Chain::num_scans;
+
+  // the pass after which the number of elements each tile outputs is known:
+  // the last pass which runs a filter, or none
+  static const int count_pass = Chain::filter_after_last_scan ? num_scans : num_scans - 1;
+
+  static const bool is_needed = (Pass >= 0 && Pass < num_scans) || Pass == count_pass || Pass == sink_type::final_pass;
+
+  thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> decomp;
+  pipeline_tile<Chain> *tiles;
+
+  _CCCL_HOST_DEVICE
+  pipeline_combine_functor(thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> decomp,
+                           pipeline_tile<Chain> *tiles)
+    : decomp(decomp), tiles(tiles)
+  {}
+
+  template<typename Size>
+  _CCCL_HOST_DEVICE
+  void operator()(Size) const
+  {
+    const std::ptrdiff_t num_tiles = decomp.size();
+
+    if(Pass >= 0 && Pass < num_scans)
+    {
+      for(std::ptrdiff_t i = 1; i < num_tiles; ++i)
+      {
+        tiles[i].chain.template propagate<Pass>(tiles[i - 1].chain);
+      }
+    }
+
+    if(Pass == count_pass)
+    {
+      for(std::ptrdiff_t i = 1; i < num_tiles; ++i)
+      {
+        const std::ptrdiff_t count = Pass < 0 ? decomp[i - 1].size() : tiles[i - 1].count;
+        tiles[i].chain.sink().place(tiles[i - 1].chain.sink(), count);
+      }
+    }
+
+    if(Pass == sink_type::final_pass)
+    {
+      for(std::ptrdiff_t i = 1; i < num_tiles; ++i)
+      {
+        tiles[0].chain.sink().merge(tiles[i].chain.sink());
+      }
+    }
+  } // end operator()()
+}; // end pipeline_combine_functor
+
+
+template<int Pass, int FinalPass, bool Done = (Pass > FinalPass)>
+  struct pipeline_passes
+{
+  template<typename DerivedPolicy, typename InputIterator, typename Chain>
+  _CCCL_HOST_DEVICE
+  static void run(thrust::execution_policy<DerivedPolicy> &exec,
+                  InputIterator first,
+                  thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> decomp,
+                  pipeline_tile<Chain> *tiles)
+  {
+    // pass -1 only places the output of pipelines without filters; the
+    // counting pass of into_node is skipped if no filter follows the last scan
+    const bool run_tiles = Pass >= 0 && !(Pass < FinalPass && Pass == Chain::num_scans && !Chain::filter_after_last_scan);
+
+    if(run_tiles)
+    {
+      thrust::for_each_n(exec,
+                         thrust::counting_iterator<std::ptrdiff_t>(0),
+                         decomp.size(),
+                         pipeline_tile_functor<Pass, InputIterator, Chain>(first, decomp, tiles));
+    }
+
+    if(pipeline_combine_functor<Pass, Chain>::is_needed)
+    {
+      thrust::for_each_n(exec,
+                         thrust::counting_iterator<std::ptrdiff_t>(0),
+                         1,
+                         pipeline_combine_functor<Pass, Chain>(decomp, tiles));
+    }
+
+    pipeline_passes<Pass + 1, FinalPass>::run(exec, first, decomp, tiles);
+  }
+}; // end pipeline_passes
+
+template<int Pass, int FinalPass>
+  struct pipeline_passes<Pass, FinalPass, true>
+{
+  template<typename DerivedPolicy, typename InputIterator, typename Chain>
+  _CCCL_HOST_DEVICE
+  static void run(thrust::execution_policy<DerivedPolicy> &,
+                  InputIterator,
+                  thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t>,
+                  pipeline_tile<Chain> *)
+  {}
+}; // end pipeline_passes
+
+
+} // end namespace detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Chain>
+_CCCL_HOST_DEVICE
+  typename Chain::result_type
+    evaluate_pipeline_in_tiles(thrust::execution_policy<DerivedPolicy> &exec,
+                               InputIterator first,
+                               InputIterator last,
+                               const Chain &chain,
+                               std::ptrdiff_t grain,
+                               std::ptrdiff_t max_tiles)
+{
+  typedef detail::pipeline_tile<Chain> tile_type;
+
+  const std::ptrdiff_t n = last - first;
+
+  if(n <= 0)
+  {
+    Chain result(chain);
+    return result.sink().result();
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> decomp(n, grain, max_tiles);
+
+  // the state of each tile lives between the passes
+  thrust::detail::temporary_array<tile_type, DerivedPolicy> tiles(exec, thrust::make_constant_iterator(tile_type(chain)), decomp.size());
+
+  detail::pipeline_passes<-1, Chain::sink_type::final_pass>::run(exec, first, decomp, thrust::raw_pointer_cast(tiles.data()));
+
+  // the final pass merged the result into the first tile
+  tile_type result = tiles[0];
+  return result.chain.sink().result();
+} // end evaluate_pipeline_in_tiles()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Chain>
+_CCCL_HOST_DEVICE
+  typename Chain::result_type
+    evaluate_pipeline(thrust::execution_policy<DerivedPolicy> &exec,
+                      InputIterator first,
+                      InputIterator last,
+                      const Chain &chain)
+{
+  // one tile per grain elements, for systems which can run many tiles at once
+  const std::ptrdiff_t grain = 1 << 12;
+  return thrust::system::detail::generic::evaluate_pipeline_in_tiles(exec, first, last, chain, grain, (last - first) / grain + 1);
+} // end evaluate_pipeline()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
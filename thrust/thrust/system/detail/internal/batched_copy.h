@@ -0,0 +1,131 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file batched_copy.h
+ *  \brief Building blocks of batched_copy shared by the host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/sequential/copy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// buffers up to this many elements are copied by a plain loop,
+// which is cheaper than a call to memmove
+const std::ptrdiff_t batched_copy_small_buffer_size = 16;
+
+
+// copies [first, first + n) to [result, result + n)
+_CCCL_EXEC_CHECK_DISABLE
+template<typename InputIterator, typename Size, typename OutputIterator>
+_CCCL_HOST_DEVICE
+void batched_copy_buffer(InputIterator first, Size n, OutputIterator result)
+{
+  if(n <= static_cast<Size>(batched_copy_small_buffer_size))
+  {
+    for(Size i = 0; i < n; ++i, ++first, ++result)
+    {
+      *result = *first;
+    }
+  }
+  else
+  {
+    thrust::system::detail::sequential::copy_detail::copy_n(first, n, result,
+      typename thrust::is_indirectly_trivially_relocatable_to<InputIterator,OutputIterator>::type());
+  }
+}
+
+
+// Copies the elements [begin, end) of the concatenation of all buffers, where
+// offsets[i] is the position of buffer i within the concatenation and
+// offsets[num_buffers] is the total number of elements. The buffers which
+// straddle begin or end are copied partially, so that the parallel backends
+// can split the work evenly regardless of the sizes of the buffers.
+_CCCL_EXEC_CHECK_DISABLE
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size>
+_CCCL_HOST_DEVICE
+void batched_copy_range(RandomAccessIterator1 src_ptrs,
+                        RandomAccessIterator2 dst_ptrs,
+                        const std::ptrdiff_t *offsets,
+                        Size num_buffers,
+                        std::ptrdiff_t begin,
+                        std::ptrdiff_t end)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type InputIterator;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type OutputIterator;
+
+  // find the last buffer starting at or before begin, skipping empty buffers
+  Size lo = 0;
+  Size hi = num_buffers;
+
+  while(lo + 1 < hi)
+  {
+    Size mid = lo + (hi - lo) / 2;
+
+    if(offsets[mid] <= begin)
+    {
+      lo = mid;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  for(Size i = lo; i < num_buffers && offsets[i] < end; ++i)
+  {
+    const std::ptrdiff_t first = (offsets[i] > begin) ? offsets[i] : begin;
+    const std::ptrdiff_t last  = (offsets[i + 1] < end) ? offsets[i + 1] : end;
+
+    if(first < last)
+    {
+      InputIterator  src = src_ptrs[i];
+      OutputIterator dst = dst_ptrs[i];
+
+      const std::ptrdiff_t skip = first - offsets[i];
+
+      batched_copy_buffer(src + skip, last - first, dst + skip);
+    }
+  }
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
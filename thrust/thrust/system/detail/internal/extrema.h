@@ -0,0 +1,197 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file extrema.h
+ *  \brief Building blocks of the parallel host backends' extrema algorithms.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/pair.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace extrema_detail
+{
+
+
+// updates the positions of the first smallest and the first largest element
+// seen so far with the elements [begin, end) of first
+template<bool FindMin, bool FindMax, typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+void update_extrema(RandomAccessIterator first,
+                    Size begin,
+                    Size end,
+                    BinaryPredicate &comp,
+                    Size &imin,
+                    Size &imax)
+{
+  for(Size i = begin; i != end; ++i)
+  {
+    if(FindMin && comp(first[i], first[imin]))
+    {
+      imin = i;
+    }
+
+    if(FindMax && comp(first[imax], first[i]))
+    {
+      imax = i;
+    }
+  }
+}
+
+
+template<bool FindMin, bool FindMax, typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+void extrema(RandomAccessIterator first,
+             Size n,
+             BinaryPredicate &comp,
+             Size &imin,
+             Size &imax,
+             thrust::detail::false_type) // is contiguous range of arithmetic type
+{
+  update_extrema<FindMin,FindMax>(first, Size(0), n, comp, imin, imax);
+}
+
+
+// Scans contiguous arithmetic data in blocks. Each block is first screened for
+// an element which would replace one of the current extrema, with a
+// branch-free loop over a fixed number of elements which the compiler can
+// vectorize. Only the rare blocks which pass the screen are rescanned element
+// by element, so the data is read from memory only once and the result is
+// the same as the one of the element by element scan.
+template<bool FindMin, bool FindMax, typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+void extrema(RandomAccessIterator first,
+             Size n,
+             BinaryPredicate &comp,
+             Size &imin,
+             Size &imax,
+             thrust::detail::true_type) // is contiguous range of arithmetic type
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type T;
+
+  const int block_size = 256;
+
+  const T *data = thrust::detail::contiguous_iterator_raw_pointer_cast(first);
+
+  Size i = 0;
+
+  for(; n - i >= block_size; i += block_size)
+  {
+    const T *block = data + i;
+    const T  vmin  = data[imin];
+    const T  vmax  = data[imax];
+
+    int found = 0;
+
+    for(int j = 0; j < block_size; ++j)
+    {
+      if(FindMin) found |= comp(block[j], vmin);
+      if(FindMax) found |= comp(vmax, block[j]);
+    }
+
+    if(found)
+    {
+      update_extrema<FindMin,FindMax>(data, i, i + block_size, comp, imin, imax);
+    }
+  }
+
+  update_extrema<FindMin,FindMax>(data, i, n, comp, imin, imax);
+}
+
+
+} // end namespace extrema_detail
+
+
+// returns the positions of the first smallest and the first largest element of
+// [first, first + n), as sequential::minmax_element would;
+// only the requested extrema are searched for
+template<bool FindMin, bool FindMax, typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+thrust::pair<Size,Size> extrema(RandomAccessIterator first, Size n, BinaryPredicate comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type T;
+
+  typedef thrust::detail::integral_constant<
+    bool,
+    thrust::is_contiguous_iterator<RandomAccessIterator>::value && std::is_arithmetic<T>::value
+  > use_blocks;
+
+  thrust::detail::wrapped_function<BinaryPredicate,bool> wrapped_comp(comp);
+
+  Size imin = 0;
+  Size imax = 0;
+
+  extrema_detail::extrema<FindMin,FindMax>(first, n, wrapped_comp, imin, imax, use_blocks());
+
+  return thrust::make_pair(imin, imax);
+}
+
+
+// combines the extrema of consecutive tiles of first, where
+// results[2 * i] and results[2 * i + 1] are the positions of the first
+// smallest and the first largest element of tile i
+template<bool FindMin, bool FindMax, typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+thrust::pair<Size,Size> combine_extrema(RandomAccessIterator first,
+                                        const Size *results,
+                                        Size num_tiles,
+                                        BinaryPredicate comp)
+{
+  thrust::detail::wrapped_function<BinaryPredicate,bool> wrapped_comp(comp);
+
+  Size imin = results[0];
+  Size imax = results[1];
+
+  for(Size tile = 1; tile < num_tiles; ++tile)
+  {
+    // ties go to the earlier tile
+    if(FindMin && wrapped_comp(first[results[2 * tile]], first[imin]))
+    {
+      imin = results[2 * tile];
+    }
+
+    if(FindMax && wrapped_comp(first[imax], first[results[2 * tile + 1]]))
+    {
+      imax = results[2 * tile + 1];
+    }
+  }
+
+  return thrust::make_pair(imin, imax);
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
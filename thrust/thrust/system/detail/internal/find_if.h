@@ -0,0 +1,127 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file find_if.h
+ *  \brief State shared by the threads of the parallel host backends' find_if.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+
+#include <atomic>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// The input of a parallel find_if is split into blocks which the threads claim
+// in increasing order. The position of the leftmost match found so far is
+// shared, and a thread stops as soon as the next unclaimed block begins past
+// it. A match near the beginning of a long sequence is therefore found after
+// scanning a few blocks per thread, instead of after a reduction over the
+// whole sequence.
+template<typename Size>
+class find_if_state
+{
+  public:
+    // blocks are small enough that a thread notices a match soon,
+    // and large enough to amortize claiming them
+    static const Size block_size = 1 << 12;
+
+    explicit find_if_state(Size n)
+      : m_n(n), m_next(0), m_result(n)
+    {}
+
+    // true if the sequence isn't worth scanning in parallel
+    bool is_small() const
+    {
+      return m_n <= block_size;
+    }
+
+    // scans blocks until none is left which could contain the leftmost match;
+    // every thread of the parallel find_if calls this once
+    template<typename InputIterator, typename Predicate>
+    void run(InputIterator first, Predicate pred)
+    {
+      thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+      for(;;)
+      {
+        const Size begin = m_next.fetch_add(block_size, std::memory_order_relaxed);
+
+        if(begin >= m_n || begin >= m_result.load(std::memory_order_relaxed))
+        {
+          return;
+        }
+
+        const Size end = (m_n - begin < block_size) ? m_n : begin + block_size;
+
+        InputIterator iter = first + begin;
+
+        for(Size i = begin; i != end; ++i, ++iter)
+        {
+          if(wrapped_pred(*iter))
+          {
+            update_result(i);
+
+            // the blocks left to claim all begin past i
+            return;
+          }
+        }
+      }
+    }
+
+    // the position of the leftmost match, or n if there is none
+    Size result() const
+    {
+      return m_result.load();
+    }
+
+  private:
+    void update_result(Size i)
+    {
+      Size current = m_result.load(std::memory_order_relaxed);
+
+      while(i < current && !m_result.compare_exchange_weak(current, i, std::memory_order_relaxed))
+      {}
+    }
+
+    const Size        m_n;
+    std::atomic<Size> m_next;
+    std::atomic<Size> m_result;
+};
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,329 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file generate_random.h
+ *  \brief The per-element samplers of generate_random, and the host kernel
+ *         which computes the Philox blocks of many elements at once.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cstdint.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/random/philox_engine.h>
+#include <thrust/random/uniform_real_distribution.h>
+#include <thrust/random/normal_distribution.h>
+#include <thrust/random/exponential_distribution.h>
+#include <cmath>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace generate_random_detail
+{
+
+
+// maps the words of a 32-bit engine to [0,1), with the full precision of RealType
+template<typename RealType>
+  struct unit_interval
+{
+  template<typename Engine>
+  _CCCL_HOST_DEVICE
+  static RealType draw(Engine &rng)
+  {
+    const thrust::detail::uint64_t hi = rng();
+    const thrust::detail::uint64_t lo = rng();
+
+    // 53 bits
+    return static_cast<RealType>(((hi << 21) ^ (lo >> 11)) * (1.0 / 9007199254740992.0));
+  }
+}; // end unit_interval
+
+template<>
+  struct unit_interval<float>
+{
+  template<typename Engine>
+  _CCCL_HOST_DEVICE
+  static float draw(Engine &rng)
+  {
+    // 24 bits
+    return static_cast<float>(rng() >> 8) * (1.0f / 16777216.0f);
+  }
+}; // end unit_interval
+
+
+// The words of the first Philox block of an element, which is all that the
+// closed form samplers below consume.
+struct block_words
+{
+  const thrust::detail::uint32_t *words;
+  int next;
+
+  _CCCL_HOST_DEVICE
+  thrust::detail::uint32_t operator()()
+  {
+    return words[next++];
+  }
+}; // end block_words
+
+
+} // end namespace generate_random_detail
+
+
+// draws a fresh copy of the distribution from the stream of an element, for
+// distributions which don't have a closed form sampler below
+_CCCL_EXEC_CHECK_DISABLE
+template<typename Distribution, typename Engine>
+_CCCL_HOST_DEVICE
+  typename Distribution::result_type sample(const Distribution &dist, Engine &rng)
+{
+  Distribution d = dist;
+  return d(rng);
+}
+
+
+template<typename RealType, typename Engine>
+_CCCL_HOST_DEVICE
+  RealType sample(const thrust::random::uniform_real_distribution<RealType> &dist, Engine &rng)
+{
+  return dist.a() + (dist.b() - dist.a()) * generate_random_detail::unit_interval<RealType>::draw(rng);
+}
+
+
+template<typename RealType, typename Engine>
+_CCCL_HOST_DEVICE
+  RealType sample(const thrust::random::normal_distribution<RealType> &dist, Engine &rng)
+{
+  // allow for Koenig lookup
+  using std::sqrt; using std::log; using std::cos;
+
+  const RealType pi = RealType(3.14159265358979323846);
+
+  // Box-Muller; 1 - u1 is in (0,1], so that its logarithm is finite
+  const RealType u1 = generate_random_detail::unit_interval<RealType>::draw(rng);
+  const RealType u2 = generate_random_detail::unit_interval<RealType>::draw(rng);
+
+  const RealType rho = sqrt(RealType(-2) * log(RealType(1) - u1));
+
+  return dist.mean() + dist.stddev() * rho * cos(RealType(2) * pi * u2);
+}
+
+
+template<typename RealType, typename Engine>
+_CCCL_HOST_DEVICE
+  RealType sample(const thrust::random::exponential_distribution<RealType> &dist, Engine &rng)
+{
+  // allow for Koenig lookup
+  using std::log;
+
+  return -log(RealType(1) - generate_random_detail::unit_interval<RealType>::draw(rng)) / dist.lambda();
+}
+
+
+// true if sample(dist, rng) consumes at most the four words of a single block
+template<typename Distribution>
+  struct is_closed_form_distribution
+    : thrust::detail::false_type
+{};
+
+template<typename RealType>
+  struct is_closed_form_distribution<thrust::random::uniform_real_distribution<RealType> >
+    : thrust::detail::true_type
+{};
+
+template<typename RealType>
+  struct is_closed_form_distribution<thrust::random::normal_distribution<RealType> >
+    : thrust::detail::true_type
+{};
+
+template<typename RealType>
+  struct is_closed_form_distribution<thrust::random::exponential_distribution<RealType> >
+    : thrust::detail::true_type
+{};
+
+
+// samples dist for the element with a given index, from the stream of
+// philox4x32 whose counters are {j, index, seed_hi} for j = 0, 1, 2, ...
+template<typename Distribution>
+  struct random_sampler
+{
+  typedef typename Distribution::result_type result_type;
+
+  unsigned long long seed;
+  Distribution dist;
+
+  _CCCL_HOST_DEVICE
+  random_sampler(unsigned long long seed, const Distribution &dist)
+    : seed(seed), dist(dist)
+  {}
+
+  template<typename Size>
+  _CCCL_HOST_DEVICE
+  result_type operator()(Size i) const
+  {
+    typedef thrust::random::philox4x32 Engine;
+
+    const thrust::detail::uint64_t index = static_cast<thrust::detail::uint64_t>(i);
+
+    const Engine::result_type counter[4] = {
+      0u,
+      static_cast<Engine::result_type>(index),
+      static_cast<Engine::result_type>(index >> 32),
+      static_cast<Engine::result_type>(seed >> 32)
+    };
+
+    Engine rng(static_cast<Engine::result_type>(seed));
+    rng.set_counter(counter);
+
+    return sample(dist, rng);
+  }
+}; // end random_sampler
+
+
+// Computes the first philox4x32 block of the streams of lanes consecutive
+// elements at once. The words of the lanes are stored in separate arrays, so
+// that every round is a loop over the lanes which the compiler vectorizes.
+template<int lanes>
+  struct philox4x32_lanes
+{
+  thrust::detail::uint32_t x0[lanes];
+  thrust::detail::uint32_t x1[lanes];
+  thrust::detail::uint32_t x2[lanes];
+  thrust::detail::uint32_t x3[lanes];
+
+  // the constants of thrust::random::philox4x32
+  static const thrust::detail::uint32_t m0 = 0xD2511F53u;
+  static const thrust::detail::uint32_t w0 = 0x9E3779B9u;
+  static const thrust::detail::uint32_t m1 = 0xCD9E8D57u;
+  static const thrust::detail::uint32_t w1 = 0xBB67AE85u;
+
+  void generate(unsigned long long seed, thrust::detail::uint64_t first_index)
+  {
+    thrust::detail::uint32_t key0 = static_cast<thrust::detail::uint32_t>(seed);
+    thrust::detail::uint32_t key1 = 0;
+
+    for(int l = 0; l < lanes; ++l)
+    {
+      const thrust::detail::uint64_t index = first_index + l;
+
+      x0[l] = 0;
+      x1[l] = static_cast<thrust::detail::uint32_t>(index);
+      x2[l] = static_cast<thrust::detail::uint32_t>(index >> 32);
+      x3[l] = static_cast<thrust::detail::uint32_t>(seed >> 32);
+    }
+
+    for(int round = 0; round < 10; ++round)
+    {
+      for(int l = 0; l < lanes; ++l)
+      {
+        const thrust::detail::uint64_t p0 = static_cast<thrust::detail::uint64_t>(m0) * x0[l];
+        const thrust::detail::uint64_t p1 = static_cast<thrust::detail::uint64_t>(m1) * x2[l];
+
+        const thrust::detail::uint32_t y0 = static_cast<thrust::detail::uint32_t>(p1 >> 32) ^ x1[l] ^ key0;
+        const thrust::detail::uint32_t y2 = static_cast<thrust::detail::uint32_t>(p0 >> 32) ^ x3[l] ^ key1;
+
+        x0[l] = y0;
+        x1[l] = static_cast<thrust::detail::uint32_t>(p1);
+        x2[l] = y2;
+        x3[l] = static_cast<thrust::detail::uint32_t>(p0);
+      }
+
+      // bump the key
+      key0 += w0;
+      key1 += w1;
+    }
+  }
+}; // end philox4x32_lanes
+
+
+template<typename RandomAccessIterator, typename Size, typename Distribution>
+  void generate_random(RandomAccessIterator first,
+                       Size begin,
+                       Size end,
+                       unsigned long long seed,
+                       const Distribution &dist,
+                       thrust::detail::false_type) // is_closed_form_distribution
+{
+  random_sampler<Distribution> sampler(seed, dist);
+
+  for(Size i = begin; i < end; ++i)
+  {
+    first[i] = sampler(i);
+  }
+}
+
+
+template<typename RandomAccessIterator, typename Size, typename Distribution>
+  void generate_random(RandomAccessIterator first,
+                       Size begin,
+                       Size end,
+                       unsigned long long seed,
+                       const Distribution &dist,
+                       thrust::detail::true_type) // is_closed_form_distribution
+{
+  const int lanes = 16;
+
+  philox4x32_lanes<lanes> blocks;
+
+  for(Size i = begin; i < end; i += lanes)
+  {
+    blocks.generate(seed, static_cast<thrust::detail::uint64_t>(i));
+
+    // the last group of elements may be partial
+    const int count = end - i < lanes ? static_cast<int>(end - i) : lanes;
+
+    for(int l = 0; l < count; ++l)
+    {
+      const thrust::detail::uint32_t words[4] = {blocks.x0[l], blocks.x1[l], blocks.x2[l], blocks.x3[l]};
+      generate_random_detail::block_words rng = {words, 0};
+
+      first[i + l] = sample(dist, rng);
+    }
+  }
+}
+
+
+// fills [first + begin, first + end) as generate_random fills the whole range
+// which begins at first; the results are the same as those of random_sampler
+template<typename RandomAccessIterator, typename Size, typename Distribution>
+  void generate_random(RandomAccessIterator first,
+                       Size begin,
+                       Size end,
+                       unsigned long long seed,
+                       const Distribution &dist)
+{
+  generate_random(first, begin, end, seed, dist, typename is_closed_form_distribution<Distribution>::type());
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,485 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file merge_shuffle.h
+ *  \brief Building blocks of the MergeShuffle algorithm used by the
+ *         parallel host backends' shuffle.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+
+#include <cmath>
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// A SplitMix64 generator. Each tile and each merge of a parallel shuffle
+// draws from its own stream, so that the result only depends on the seed
+// and on the decomposition, and not on the scheduling of the tasks.
+class shuffle_random_stream
+{
+  public:
+    _CCCL_HOST_DEVICE
+    shuffle_random_stream(std::uint64_t seed, std::uint64_t stream)
+      : m_state(mix(seed ^ mix(stream + golden_gamma))),
+        m_bits(0),
+        m_num_bits(0)
+    {}
+
+    _CCCL_HOST_DEVICE
+    std::uint64_t operator()()
+    {
+      m_state += golden_gamma;
+      return mix(m_state);
+    }
+
+    // returns a uniformly distributed bit
+    _CCCL_HOST_DEVICE
+    bool flip()
+    {
+      if(m_num_bits == 0)
+      {
+        m_bits     = (*this)();
+        m_num_bits = 64;
+      }
+
+      bool result = (m_bits & 1) != 0;
+      m_bits >>= 1;
+      --m_num_bits;
+
+      return result;
+    }
+
+    // returns a uniformly distributed integer in [0, bound), without modulo bias
+    _CCCL_HOST_DEVICE
+    std::uint64_t bounded(std::uint64_t bound)
+    {
+      if(bound <= UINT64_C(0xFFFFFFFF))
+      {
+        // Lemire's nearly divisionless method
+        std::uint64_t product = ((*this)() >> 32) * bound;
+        std::uint32_t low     = static_cast<std::uint32_t>(product);
+
+        if(low < bound)
+        {
+          std::uint32_t threshold = static_cast<std::uint32_t>(0u - static_cast<std::uint32_t>(bound)) % static_cast<std::uint32_t>(bound);
+
+          while(low < threshold)
+          {
+            product = ((*this)() >> 32) * bound;
+            low     = static_cast<std::uint32_t>(product);
+          }
+        }
+
+        return product >> 32;
+      }
+
+      std::uint64_t threshold = (UINT64_C(0) - bound) % bound;
+      std::uint64_t x         = (*this)();
+
+      while(x < threshold)
+      {
+        x = (*this)();
+      }
+
+      return x % bound;
+    }
+
+  private:
+    static constexpr std::uint64_t golden_gamma = UINT64_C(0x9E3779B97F4A7C15);
+
+    static _CCCL_HOST_DEVICE
+    std::uint64_t mix(std::uint64_t z)
+    {
+      z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+      z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+      return z ^ (z >> 31);
+    }
+
+    std::uint64_t m_state;
+    std::uint64_t m_bits;
+    int           m_num_bits;
+};
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename RandomAccessIterator, typename Size>
+_CCCL_HOST_DEVICE
+void shuffle_swap(RandomAccessIterator first, Size i, Size j)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type T;
+
+  T temp    = first[i];
+  first[i]  = first[j];
+  first[j]  = temp;
+}
+
+
+// shuffles [first, first + n) in place with the Fisher-Yates algorithm
+_CCCL_EXEC_CHECK_DISABLE
+template<typename RandomAccessIterator, typename Size>
+_CCCL_HOST_DEVICE
+void fisher_yates_shuffle(RandomAccessIterator first, Size n, shuffle_random_stream &rng)
+{
+  for(Size i = n; i > 1; --i)
+  {
+    Size j = static_cast<Size>(rng.bounded(static_cast<std::uint64_t>(i)));
+
+    if(j != i - 1)
+    {
+      shuffle_swap(first, i - 1, j);
+    }
+  }
+}
+
+
+// given that [first, first + n1) and [first + n1, first + n1 + n2) are both
+// uniformly shuffled, shuffles [first, first + n1 + n2) in place
+//
+// Bacher, Bodini, Hollender, Lumbroso: "MergeShuffle: A Very Fast,
+// Parallel Random Permutation Algorithm", 2015
+_CCCL_EXEC_CHECK_DISABLE
+template<typename RandomAccessIterator, typename Size>
+_CCCL_HOST_DEVICE
+void merge_shuffled(RandomAccessIterator first, Size n1, Size n2, shuffle_random_stream &rng)
+{
+  Size i = 0;
+  Size j = n1;
+  const Size n = n1 + n2;
+
+  // interleave the two runs by fair coin flips until one of them is exhausted
+  for(;;)
+  {
+    if(!rng.flip())
+    {
+      if(i == j) break;
+    }
+    else
+    {
+      if(j == n) break;
+      shuffle_swap(first, i, j);
+      ++j;
+    }
+
+    ++i;
+  }
+
+  // insert each of the remaining elements at a uniformly random position
+  for(; i < n; ++i)
+  {
+    Size k = static_cast<Size>(rng.bounded(static_cast<std::uint64_t>(i) + 1));
+
+    if(k != i)
+    {
+      shuffle_swap(first, i, k);
+    }
+  }
+}
+
+
+// returns the number of marked elements among n drawn without replacement from
+// a population of N elements of which K are marked, by inversion from the mode
+template<typename Size>
+Size hypergeometric(Size N, Size K, Size n, shuffle_random_stream &rng)
+{
+  const Size lo = (n > N - K) ? n - (N - K) : Size(0);
+  const Size hi = (n < K) ? n : K;
+
+  if(lo == hi) return lo;
+
+  const double dN = static_cast<double>(N);
+  const double dK = static_cast<double>(K);
+  const double dn = static_cast<double>(n);
+
+  Size mode = static_cast<Size>(std::floor((dn + 1) * (dK + 1) / (dN + 2)));
+  if(mode < lo) mode = lo;
+  if(mode > hi) mode = hi;
+
+  const double dm = static_cast<double>(mode);
+  const double log_p_mode = std::lgamma(dK + 1) - std::lgamma(dm + 1) - std::lgamma(dK - dm + 1)
+                          + std::lgamma(dN - dK + 1) - std::lgamma(dn - dm + 1) - std::lgamma(dN - dK - dn + dm + 1)
+                          - std::lgamma(dN + 1) + std::lgamma(dn + 1) + std::lgamma(dN - dn + 1);
+
+  // a uniform variate in [0, 1)
+  double u = static_cast<double>(rng() >> 11) * (1.0 / 9007199254740992.0);
+
+  double p_down = std::exp(log_p_mode);
+  double p_up   = p_down;
+
+  u -= p_down;
+  if(u < 0) return mode;
+
+  // visit the support in order of decreasing probability
+  Size down = mode;
+  Size up   = mode;
+
+  for(;;)
+  {
+    const double dd = static_cast<double>(down);
+    const double du = static_cast<double>(up);
+
+    const double next_down = (down > lo) ? p_down * dd * (dN - dK - dn + dd) / ((dK - dd + 1) * (dn - dd + 1)) : 0.0;
+    const double next_up   = (up   < hi) ? p_up * (dK - du) * (dn - du) / ((du + 1) * (dN - dK - dn + du + 1)) : 0.0;
+
+    // the probabilities left over from rounding are attributed to the mode
+    if(next_down <= 0.0 && next_up <= 0.0) return mode;
+
+    if(next_up >= next_down)
+    {
+      ++up;
+      p_up = next_up;
+      u -= p_up;
+      if(u < 0) return up;
+    }
+    else
+    {
+      --down;
+      p_down = next_down;
+      u -= p_down;
+      if(u < 0) return down;
+    }
+  }
+}
+
+
+// The plan of a parallel MergeShuffle: the input is split into tiles which are
+// shuffled independently, and then runs of tiles are merged pairwise in rounds
+// of doubling width.
+//
+// Every merge is itself split across the tiles of the merged run, so that each
+// round runs on all tiles in parallel. Since both runs are uniformly shuffled,
+// it suffices that each tile of the merged run receives the number of elements
+// of the left run that a uniform interleaving would place there. These numbers
+// are drawn from the multivariate hypergeometric distribution, the surplus
+// elements of each run are exchanged until every tile holds its share of both,
+// and then every tile merges its two parts with merge_shuffled. A round takes
+// three steps, with the tasks of each step being independent of each other.
+template<typename IndexType>
+class merge_shuffle_plan
+{
+  public:
+    template<typename URBG>
+    merge_shuffle_plan(IndexType n, IndexType max_tiles, URBG &g)
+      : m_seed(draw_seed(g)),
+        m_decomp(n, 1, num_tiles_for(n, max_tiles))
+    {}
+
+    IndexType num_tiles() const
+    {
+      return m_decomp.size();
+    }
+
+    // the number of independent merges in the round which merges runs of width tiles
+    IndexType num_merges(IndexType width) const
+    {
+      return (num_tiles() + 2 * width - 1) / (2 * width);
+    }
+
+    template<typename RandomAccessIterator>
+    void shuffle_tile(RandomAccessIterator first, IndexType tile) const
+    {
+      shuffle_random_stream rng(m_seed, static_cast<std::uint64_t>(tile));
+
+      fisher_yates_shuffle(first + m_decomp[tile].begin(), m_decomp[tile].size(), rng);
+    }
+
+    // the first step of a merge: draws the number of elements of the left run
+    // that each tile of the merged run receives into left_counts
+    void split_merge(IndexType width, IndexType merge, IndexType *left_counts) const
+    {
+      IndexType lo, mid, hi;
+      if(!merge_bounds(width, 2 * width * merge, lo, mid, hi)) return;
+
+      // tiles occupy [0, num_tiles) and merges [width * num_tiles, (width + 1) * num_tiles)
+      shuffle_random_stream rng(m_seed, static_cast<std::uint64_t>(width * num_tiles() + lo));
+
+      IndexType remaining      = m_decomp[hi - 1].end() - m_decomp[lo].begin();
+      IndexType remaining_left = m_decomp[mid].begin() - m_decomp[lo].begin();
+
+      for(IndexType tile = lo; tile < hi; ++tile)
+      {
+        const IndexType size = m_decomp[tile].size();
+
+        left_counts[tile] = hypergeometric(remaining, remaining_left, size, rng);
+
+        remaining      -= size;
+        remaining_left -= left_counts[tile];
+      }
+    }
+
+    // the second step of a merge: every tile of the merged run swaps an equal
+    // share of the surplus elements of the left run with those of the right run,
+    // after which each tile holds its elements of the left run at its front
+    template<typename RandomAccessIterator>
+    void exchange(RandomAccessIterator first, IndexType width, IndexType tile, const IndexType *left_counts) const
+    {
+      IndexType lo, mid, hi;
+      if(!merge_bounds(width, tile, lo, mid, hi)) return;
+
+      const IndexType split = m_decomp[mid].begin();
+
+      IndexType total = 0;
+      for(IndexType t = lo; t < hi; ++t)
+      {
+        total += left_surplus(t, split, left_counts);
+      }
+
+      // this tile's share of the surplus
+      const IndexType pieces = hi - lo;
+      IndexType i   = static_cast<IndexType>(static_cast<std::uint64_t>(total) * (tile - lo) / pieces);
+      IndexType end = static_cast<IndexType>(static_cast<std::uint64_t>(total) * (tile - lo + 1) / pieces);
+
+      // find the tiles that hold the i-th surplus element of either run
+      IndexType left_tile  = lo, left_offset  = i;
+      IndexType right_tile = lo, right_offset = i;
+
+      while(left_tile < hi && left_offset >= left_surplus(left_tile, split, left_counts))
+      {
+        left_offset -= left_surplus(left_tile, split, left_counts);
+        ++left_tile;
+      }
+
+      while(right_tile < hi && right_offset >= right_surplus(right_tile, split, left_counts))
+      {
+        right_offset -= right_surplus(right_tile, split, left_counts);
+        ++right_tile;
+      }
+
+      for(; i < end; ++i)
+      {
+        while(left_offset == left_surplus(left_tile, split, left_counts))
+        {
+          left_offset = 0;
+          ++left_tile;
+        }
+
+        while(right_offset == right_surplus(right_tile, split, left_counts))
+        {
+          right_offset = 0;
+          ++right_tile;
+        }
+
+        // the surplus of the left run follows the elements a tile keeps, and
+        // the surplus of the right run precedes them
+        shuffle_swap(first,
+                     m_decomp[left_tile].begin() + left_counts[left_tile] + left_offset,
+                     m_decomp[right_tile].begin() + native_left(right_tile, split) + right_offset);
+
+        ++left_offset;
+        ++right_offset;
+      }
+    }
+
+    // the last step of a merge: every tile of the merged run merges its
+    // elements of the left run with those of the right run
+    template<typename RandomAccessIterator>
+    void merge_tile(RandomAccessIterator first, IndexType width, IndexType tile, const IndexType *left_counts) const
+    {
+      IndexType lo, mid, hi;
+      if(!merge_bounds(width, tile, lo, mid, hi)) return;
+
+      // these streams follow those of the tiles and merges
+      const std::uint64_t stream = (UINT64_C(1) << 63) | static_cast<std::uint64_t>(width * num_tiles() + tile);
+      shuffle_random_stream rng(m_seed, stream);
+
+      merge_shuffled(first + m_decomp[tile].begin(), left_counts[tile], m_decomp[tile].size() - left_counts[tile], rng);
+    }
+
+  private:
+    // tiles smaller than this aren't worth a task of their own
+    static const IndexType min_tile_size = 1 << 14;
+
+    static IndexType num_tiles_for(IndexType n, IndexType max_tiles)
+    {
+      IndexType result = n / min_tile_size;
+
+      if(result > max_tiles) result = max_tiles;
+      if(result < 1)         result = 1;
+
+      return result;
+    }
+
+    template<typename URBG>
+    static std::uint64_t draw_seed(URBG &g)
+    {
+      std::uint64_t hi = static_cast<std::uint64_t>(g());
+      std::uint64_t lo = static_cast<std::uint64_t>(g());
+
+      return (hi << 32) ^ lo;
+    }
+
+    // finds the tiles [lo, hi) of the merge of a round that tile belongs to, and
+    // the first tile mid of its right run; returns false if the run has no partner
+    bool merge_bounds(IndexType width, IndexType tile, IndexType &lo, IndexType &mid, IndexType &hi) const
+    {
+      lo  = tile - tile % (2 * width);
+      mid = lo + width;
+      hi  = (mid + width < num_tiles()) ? mid + width : num_tiles();
+
+      return mid < hi;
+    }
+
+    // the number of elements of the left run that tile holds before the exchange
+    IndexType native_left(IndexType tile, IndexType split) const
+    {
+      const IndexType result = split - m_decomp[tile].begin();
+
+      if(result < 0)                      return 0;
+      if(result > m_decomp[tile].size())  return m_decomp[tile].size();
+
+      return result;
+    }
+
+    IndexType left_surplus(IndexType tile, IndexType split, const IndexType *left_counts) const
+    {
+      const IndexType result = native_left(tile, split) - left_counts[tile];
+      return result > 0 ? result : 0;
+    }
+
+    IndexType right_surplus(IndexType tile, IndexType split, const IndexType *left_counts) const
+    {
+      const IndexType result = left_counts[tile] - native_left(tile, split);
+      return result > 0 ? result : 0;
+    }
+
+    std::uint64_t m_seed;
+    uniform_decomposition<IndexType> m_decomp;
+};
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
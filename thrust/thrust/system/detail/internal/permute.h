@@ -0,0 +1,551 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file permute.h
+ *  \brief Building blocks of the parallel host backends' gather and scatter.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <cstddef>
+#include <type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace permute_detail
+{
+
+
+// how many elements ahead the direct path prefetches
+const std::ptrdiff_t prefetch_distance = 16;
+
+
+template<typename T>
+void prefetch_for_read(const T *ptr)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(ptr, 0);
+#else
+  (void) ptr;
+#endif
+}
+
+
+template<typename T>
+void prefetch_for_write(const T *ptr)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(ptr, 1);
+#else
+  (void) ptr;
+#endif
+}
+
+
+template<typename RandomAccessIterator, typename Index>
+void prefetch_for_read(RandomAccessIterator iter, Index i, thrust::detail::true_type) // is_contiguous_iterator
+{
+  prefetch_for_read(thrust::detail::contiguous_iterator_raw_pointer_cast(iter) + i);
+}
+
+
+template<typename RandomAccessIterator, typename Index>
+void prefetch_for_read(RandomAccessIterator, Index, thrust::detail::false_type) // is_contiguous_iterator
+{}
+
+
+template<typename RandomAccessIterator, typename Index>
+void prefetch_for_write(RandomAccessIterator iter, Index i, thrust::detail::true_type) // is_contiguous_iterator
+{
+  prefetch_for_write(thrust::detail::contiguous_iterator_raw_pointer_cast(iter) + i);
+}
+
+
+template<typename RandomAccessIterator, typename Index>
+void prefetch_for_write(RandomAccessIterator, Index, thrust::detail::false_type) // is_contiguous_iterator
+{}
+
+
+template<typename Iterator>
+struct is_random_access
+  : thrust::detail::is_convertible<
+      typename thrust::iterator_traversal<Iterator>::type,
+      thrust::random_access_traversal_tag
+    >
+{};
+
+
+} // end namespace permute_detail
+
+
+// true if a gather or a scatter through a map of type MapIterator, moving
+// elements of type T between the other iterators, can be partitioned by the
+// buckets of the map values
+template<typename T, typename MapIterator, typename Iterator1, typename Iterator2, typename Iterator3 = Iterator2>
+struct is_partitionable_permutation
+  : thrust::detail::integral_constant<
+      bool,
+      std::is_trivially_copyable<T>::value &&
+      std::is_integral<typename thrust::iterator_value<MapIterator>::type>::value &&
+      permute_detail::is_random_access<MapIterator>::value &&
+      permute_detail::is_random_access<Iterator1>::value &&
+      permute_detail::is_random_access<Iterator2>::value &&
+      permute_detail::is_random_access<Iterator3>::value
+    >
+{};
+
+
+// The buckets of the indices of a large randomly accessed range. Each bucket
+// covers a contiguous part of the range which is small enough to stay in
+// cache, and in the reach of the TLB, while its accesses are performed. Buckets
+// grow beyond that when the range would otherwise need more buckets than a
+// single partitioning pass can write to efficiently.
+//
+// The size of the range is only an estimate: the indices beyond it wrap around
+// the buckets, so that every bucket covers several parts of the range, which
+// keeps the buckets balanced at the cost of some locality.
+class permutation_buckets
+{
+  public:
+    // roughly the size of a L2 cache, and 64 small pages
+    static const std::size_t bucket_bytes = std::size_t(1) << 18;
+
+    // the number of streams the partitioning pass writes to at once
+    static const std::size_t max_buckets = std::size_t(1) << 10;
+
+    permutation_buckets(std::size_t range_size, std::size_t element_size)
+      : m_shift(0),
+        m_num_buckets(1)
+    {
+      while((element_size << m_shift) < bucket_bytes)
+      {
+        ++m_shift;
+      }
+
+      while(((range_size - 1) >> m_shift) + 1 > max_buckets)
+      {
+        ++m_shift;
+      }
+
+      // a power of two, so that indices wrap around with a mask
+      while(m_num_buckets < ((range_size - 1) >> m_shift) + 1)
+      {
+        m_num_buckets *= 2;
+      }
+    }
+
+    template<typename Index>
+    std::size_t operator()(Index i) const
+    {
+      return (static_cast<std::size_t>(i) >> m_shift) & (m_num_buckets - 1);
+    }
+
+    std::size_t size() const
+    {
+      return m_num_buckets;
+    }
+
+  private:
+    unsigned int m_shift;
+    std::size_t  m_num_buckets;
+};
+
+
+// The size of the range accessed by a gather or a scatter through the n values
+// of map, if they are worth partitioning, and 0 otherwise. They are when there
+// are enough accesses to amortize the partitioning passes, the range is much
+// larger than the caches, and the accesses are dense enough in it for each
+// bucket to be reused while it is cached.
+//
+// The range is estimated from the largest of a fixed number of evenly spaced
+// map values, so that the map is not read in full before the direct path. The
+// indices beyond the estimate wrap around the buckets.
+template<typename MapIterator, typename Size>
+std::size_t partitioned_permutation_span(MapIterator map, Size n, std::size_t element_size)
+{
+  const std::size_t num_accesses = static_cast<std::size_t>(n);
+
+  if(num_accesses < (std::size_t(1) << 20))
+  {
+    return 0;
+  }
+
+  const std::size_t num_samples = 256;
+
+  std::size_t largest = 0;
+
+  for(std::size_t s = 0; s < num_samples; ++s)
+  {
+    const std::size_t index = static_cast<std::size_t>(map[static_cast<Size>(s * (num_accesses / num_samples))]);
+
+    largest = index > largest ? index : largest;
+  }
+
+  // the expected gap between the largest sample and the largest value
+  const std::size_t span = largest + largest / num_samples + 1;
+
+  if(span * element_size < (std::size_t(1) << 24) || span / 16 > num_accesses)
+  {
+    return 0;
+  }
+
+  return span;
+}
+
+
+// The tables of a partitioned gather or scatter: each tile of the map counts
+// its elements in each bucket, and the counts are scanned bucket-major so that
+// the elements of a bucket are ordered by their position in the map.
+template<typename Size>
+class permutation_tables
+{
+  public:
+    // the number of Size elements of storage needed by the tables
+    static std::size_t storage_size(std::size_t num_tiles, std::size_t num_buckets)
+    {
+      return 2 * num_tiles * row_size(num_buckets) + num_buckets + 1;
+    }
+
+    permutation_tables(Size *storage, std::size_t num_tiles, std::size_t num_buckets)
+      : m_offsets(storage),
+        m_cursors(storage + num_tiles * row_size(num_buckets)),
+        m_bounds(storage + 2 * num_tiles * row_size(num_buckets)),
+        m_num_tiles(num_tiles),
+        m_num_buckets(num_buckets)
+    {}
+
+    // the per bucket counts of a tile, before scan()
+    Size *counts(std::size_t tile) const
+    {
+      return m_offsets + tile * row_size(m_num_buckets);
+    }
+
+    // the per bucket insertion positions of a tile, reset to its offsets
+    Size *reset_cursors(std::size_t tile) const
+    {
+      Size *offsets = m_offsets + tile * row_size(m_num_buckets);
+      Size *cursors = m_cursors + tile * row_size(m_num_buckets);
+
+      for(std::size_t b = 0; b < m_num_buckets; ++b)
+      {
+        cursors[b] = offsets[b];
+      }
+
+      return cursors;
+    }
+
+    // turns the counts of every tile into offsets
+    void scan() const
+    {
+      Size sum = 0;
+
+      for(std::size_t b = 0; b < m_num_buckets; ++b)
+      {
+        m_bounds[b] = sum;
+
+        for(std::size_t tile = 0; tile < m_num_tiles; ++tile)
+        {
+          Size &count = counts(tile)[b];
+          Size  temp  = count;
+          count = sum;
+          sum += temp;
+        }
+      }
+
+      m_bounds[m_num_buckets] = sum;
+    }
+
+    Size bucket_begin(std::size_t b) const
+    {
+      return m_bounds[b];
+    }
+
+    Size bucket_end(std::size_t b) const
+    {
+      return m_bounds[b + 1];
+    }
+
+  private:
+    // rows are padded to whole cache lines so that tiles don't share them
+    static std::size_t row_size(std::size_t num_buckets)
+    {
+      const std::size_t line = 64 / sizeof(Size) > 0 ? 64 / sizeof(Size) : 1;
+
+      return (num_buckets + line - 1) / line * line;
+    }
+
+    Size *m_offsets;
+    Size *m_cursors;
+    Size *m_bounds;
+    std::size_t m_num_tiles;
+    std::size_t m_num_buckets;
+};
+
+
+// gathers result[i] = input[map[i]] for the elements [begin, end) of map,
+// prefetching the elements of input which are about to be read
+template<typename MapIterator, typename RandomAccessIterator, typename OutputIterator, typename Size>
+void direct_gather(MapIterator map, RandomAccessIterator input, OutputIterator result, Size begin, Size end)
+{
+  typename thrust::is_contiguous_iterator<RandomAccessIterator>::type is_contiguous;
+
+  for(Size i = begin; i != end; ++i)
+  {
+    if(end - i > permute_detail::prefetch_distance)
+    {
+      permute_detail::prefetch_for_read(input, map[i + permute_detail::prefetch_distance], is_contiguous);
+    }
+
+    result[i] = input[map[i]];
+  }
+}
+
+
+// scatters output[map[i]] = first[i] for the elements [begin, end) of first
+// for which pred(stencil[i]) holds, prefetching the elements of output which
+// are about to be written
+template<typename InputIterator, typename MapIterator, typename StencilIterator, typename RandomAccessIterator, typename Predicate, typename Size>
+void direct_scatter_if(InputIterator first, MapIterator map, StencilIterator stencil, RandomAccessIterator output, Predicate pred, Size begin, Size end)
+{
+  typename thrust::is_contiguous_iterator<RandomAccessIterator>::type is_contiguous;
+
+  thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+  for(Size i = begin; i != end; ++i)
+  {
+    if(end - i > permute_detail::prefetch_distance)
+    {
+      permute_detail::prefetch_for_write(output, map[i + permute_detail::prefetch_distance], is_contiguous);
+    }
+
+    if(wrapped_pred(stencil[i]))
+    {
+      output[map[i]] = first[i];
+    }
+  }
+}
+
+
+// A gather whose map is first partitioned by the buckets of its values:
+//
+//   1. each tile of the map counts its elements in each bucket,
+//   2. each tile copies its map values into their buckets,
+//   3. each bucket reads its elements of input, within a cached part of it,
+//   4. each tile writes its results, reading them back from the buckets.
+//
+// Passes 1, 2 and 4 read the map sequentially, and only pass 3 accesses input
+// at random. Each pass is a member function called for each tile or bucket,
+// and calls within a pass are independent of each other.
+template<typename MapIterator, typename RandomAccessIterator, typename OutputIterator, typename Size>
+class partitioned_gather
+{
+  public:
+    typedef typename thrust::iterator_value<MapIterator>::type          index_type;
+    typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+    partitioned_gather(MapIterator map,
+                       RandomAccessIterator input,
+                       OutputIterator result,
+                       uniform_decomposition<Size> tiles,
+                       permutation_buckets buckets,
+                       permutation_tables<Size> tables,
+                       index_type *indices,
+                       value_type *values)
+      : m_map(map), m_input(input), m_result(result),
+        m_tiles(tiles), m_buckets(buckets), m_tables(tables),
+        m_indices(indices), m_values(values)
+    {}
+
+    void count(Size tile) const
+    {
+      Size *counts = m_tables.counts(tile);
+
+      for(std::size_t b = 0; b < m_buckets.size(); ++b)
+      {
+        counts[b] = 0;
+      }
+
+      for(Size i = m_tiles[tile].begin(); i != m_tiles[tile].end(); ++i)
+      {
+        ++counts[m_buckets(m_map[i])];
+      }
+    }
+
+    void scan() const
+    {
+      m_tables.scan();
+    }
+
+    void partition(Size tile) const
+    {
+      Size *cursors = m_tables.reset_cursors(tile);
+
+      for(Size i = m_tiles[tile].begin(); i != m_tiles[tile].end(); ++i)
+      {
+        const index_type index = m_map[i];
+
+        m_indices[cursors[m_buckets(index)]++] = index;
+      }
+    }
+
+    void fetch(Size bucket) const
+    {
+      for(Size j = m_tables.bucket_begin(bucket); j != m_tables.bucket_end(bucket); ++j)
+      {
+        m_values[j] = m_input[m_indices[j]];
+      }
+    }
+
+    void write(Size tile) const
+    {
+      Size *cursors = m_tables.reset_cursors(tile);
+
+      for(Size i = m_tiles[tile].begin(); i != m_tiles[tile].end(); ++i)
+      {
+        m_result[i] = m_values[cursors[m_buckets(m_map[i])]++];
+      }
+    }
+
+  private:
+    MapIterator                 m_map;
+    RandomAccessIterator        m_input;
+    OutputIterator              m_result;
+    uniform_decomposition<Size> m_tiles;
+    permutation_buckets         m_buckets;
+    permutation_tables<Size>    m_tables;
+    index_type                 *m_indices;
+    value_type                 *m_values;
+};
+
+
+// A scatter_if whose elements are first partitioned by the buckets of their
+// destinations:
+//
+//   1. each tile counts its selected elements in each bucket,
+//   2. each tile copies its selected elements and destinations into their buckets,
+//   3. each bucket writes its elements to output, within a cached part of it.
+//
+// Passes 1 and 2 read the input sequentially, and only pass 3 accesses output
+// at random.
+template<typename InputIterator, typename MapIterator, typename StencilIterator, typename RandomAccessIterator, typename Predicate, typename Size>
+class partitioned_scatter_if
+{
+  public:
+    typedef typename thrust::iterator_value<MapIterator>::type   index_type;
+    typedef typename thrust::iterator_value<InputIterator>::type value_type;
+
+    partitioned_scatter_if(InputIterator first,
+                           MapIterator map,
+                           StencilIterator stencil,
+                           RandomAccessIterator output,
+                           Predicate pred,
+                           uniform_decomposition<Size> tiles,
+                           permutation_buckets buckets,
+                           permutation_tables<Size> tables,
+                           index_type *indices,
+                           value_type *values)
+      : m_first(first), m_map(map), m_stencil(stencil), m_output(output), m_pred(pred),
+        m_tiles(tiles), m_buckets(buckets), m_tables(tables),
+        m_indices(indices), m_values(values)
+    {}
+
+    void count(Size tile) const
+    {
+      Size *counts = m_tables.counts(tile);
+
+      for(std::size_t b = 0; b < m_buckets.size(); ++b)
+      {
+        counts[b] = 0;
+      }
+
+      for(Size i = m_tiles[tile].begin(); i != m_tiles[tile].end(); ++i)
+      {
+        if(m_pred(m_stencil[i]))
+        {
+          ++counts[m_buckets(m_map[i])];
+        }
+      }
+    }
+
+    void scan() const
+    {
+      m_tables.scan();
+    }
+
+    void partition(Size tile) const
+    {
+      Size *cursors = m_tables.reset_cursors(tile);
+
+      for(Size i = m_tiles[tile].begin(); i != m_tiles[tile].end(); ++i)
+      {
+        if(m_pred(m_stencil[i]))
+        {
+          const index_type index = m_map[i];
+          const Size j = cursors[m_buckets(index)]++;
+
+          m_indices[j] = index;
+          m_values[j]  = m_first[i];
+        }
+      }
+    }
+
+    void write(Size bucket) const
+    {
+      for(Size j = m_tables.bucket_begin(bucket); j != m_tables.bucket_end(bucket); ++j)
+      {
+        m_output[m_indices[j]] = m_values[j];
+      }
+    }
+
+  private:
+    InputIterator                                    m_first;
+    MapIterator                                      m_map;
+    StencilIterator                                  m_stencil;
+    RandomAccessIterator                             m_output;
+    thrust::detail::wrapped_function<Predicate,bool> m_pred;
+    uniform_decomposition<Size>                      m_tiles;
+    permutation_buckets                              m_buckets;
+    permutation_tables<Size>                         m_tables;
+    index_type                                      *m_indices;
+    value_type                                      *m_values;
+};
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
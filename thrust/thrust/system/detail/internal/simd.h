@@ -0,0 +1,727 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file simd.h
+ *  \brief Vectorized host kernels for the reductions and scans of arithmetic
+ *         types with plus, maximum and minimum.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/functional.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/integer_sequence.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <cstring>
+#include <type_traits>
+
+// Reductions and scans of floating point values are reassociated by the
+// kernels below, which changes their rounding. Defining
+// THRUST_STRICT_FLOATING_POINT_ORDER keeps the element by element evaluation
+// for floating point types; integral types are always vectorized, as their
+// results do not depend on the order of evaluation.
+#if defined(THRUST_STRICT_FLOATING_POINT_ORDER)
+#  define THRUST_SIMD_REASSOCIATE_FLOATING_POINT 0
+#else
+#  define THRUST_SIMD_REASSOCIATE_FLOATING_POINT 1
+#endif
+
+// the explicitly vectorized kernels use the vector extensions of GCC and
+// Clang, which the compiler lowers to the SIMD instructions of the target
+// (SSE, AVX, NEON, ...); other compilers get the portable kernels
+#if (defined(_CCCL_COMPILER_GCC) || defined(_CCCL_COMPILER_CLANG)) && !defined(__CUDA_ARCH__)
+#  define THRUST_SIMD_HAS_VECTOR_EXTENSIONS 1
+#  if defined(__has_builtin)
+#    if __has_builtin(__builtin_shufflevector)
+#      define THRUST_SIMD_HAS_SHUFFLEVECTOR 1
+#    endif
+#  endif
+#endif
+
+#if !defined(THRUST_SIMD_HAS_VECTOR_EXTENSIONS)
+#  define THRUST_SIMD_HAS_VECTOR_EXTENSIONS 0
+#endif
+
+#if !defined(THRUST_SIMD_HAS_SHUFFLEVECTOR)
+#  define THRUST_SIMD_HAS_SHUFFLEVECTOR 0
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace simd_detail
+{
+
+
+// the width of a vector register which every target of the vector extensions
+// has: two registers of a narrower target are used for wider vectors, so a
+// wider choice would not be portable, and with a narrower one the
+// independent accumulators of a wider target would go unused
+const int vector_bytes = 16;
+
+// the number of independent vectors which a reduction accumulates into, to
+// hide the latency of the additions
+const int vectors_per_reduction = 8;
+
+
+// The operators which may be applied to the lanes in any order. Lanes are
+// combined with the same expressions as the thrust function objects, so the
+// operators also apply to vectors.
+struct plus_lanes
+{
+  static const bool idempotent = false;
+
+  template<typename V>
+  static V apply(const V &lhs, const V &rhs)
+  {
+    return lhs + rhs;
+  }
+};
+
+struct maximum_lanes
+{
+  static const bool idempotent = true;
+
+  template<typename V>
+  static V apply(const V &lhs, const V &rhs)
+  {
+    return lhs < rhs ? rhs : lhs;
+  }
+};
+
+struct minimum_lanes
+{
+  static const bool idempotent = true;
+
+  template<typename V>
+  static V apply(const V &lhs, const V &rhs)
+  {
+    return lhs < rhs ? lhs : rhs;
+  }
+};
+
+
+template<typename BinaryFunction, typename T>
+struct lane_operator
+{
+  typedef void type;
+};
+
+template<typename T>
+struct lane_operator<thrust::plus<T>, T>
+{
+  typedef plus_lanes type;
+};
+
+template<typename T>
+struct lane_operator<thrust::plus<void>, T>
+{
+  typedef plus_lanes type;
+};
+
+template<typename T>
+struct lane_operator<thrust::maximum<T>, T>
+{
+  typedef maximum_lanes type;
+};
+
+template<typename T>
+struct lane_operator<thrust::maximum<void>, T>
+{
+  typedef maximum_lanes type;
+};
+
+template<typename T>
+struct lane_operator<thrust::minimum<T>, T>
+{
+  typedef minimum_lanes type;
+};
+
+template<typename T>
+struct lane_operator<thrust::minimum<void>, T>
+{
+  typedef minimum_lanes type;
+};
+
+
+// signed integers are summed as unsigned integers of the same width, whose
+// overflow is defined and wraps to the same bits
+template<typename T, typename Operator>
+struct lane_type
+{
+  typedef typename thrust::detail::eval_if<
+    std::is_integral<T>::value && std::is_signed<T>::value && thrust::detail::is_same<Operator, plus_lanes>::value,
+    std::make_unsigned<T>,
+    thrust::detail::identity_<T>
+  >::type type;
+};
+
+
+// true if a reduction or a scan of T with BinaryFunction may be reassociated
+template<typename T, typename BinaryFunction>
+struct is_reassociable
+  : thrust::detail::integral_constant<
+      bool,
+      std::is_arithmetic<T>::value
+        && !thrust::detail::is_same<T, bool>::value
+        && !thrust::detail::is_same<typename lane_operator<BinaryFunction, T>::type, void>::value
+        && (std::is_integral<T>::value || THRUST_SIMD_REASSOCIATE_FLOATING_POINT)
+    >
+{};
+
+
+template<typename Iterator>
+struct is_random_access
+  : thrust::detail::is_convertible<
+      typename thrust::iterator_traversal<Iterator>::type,
+      thrust::random_access_traversal_tag
+    >
+{};
+
+
+// the number of lanes which a reduction of A accumulates into; the lanes of
+// both kernels are the same so that they produce the same result
+template<typename A>
+struct reduction_lanes
+{
+  static const int value = vectors_per_reduction * vector_bytes / (sizeof(A) < vector_bytes ? sizeof(A) : vector_bytes);
+};
+
+
+// combines the lanes pairwise, halving their number at each step
+template<typename Operator, int Lanes, typename A>
+A combine_lanes(A *lanes)
+{
+  for(int width = Lanes / 2; width > 0; width /= 2)
+  {
+    for(int j = 0; j < width; ++j)
+    {
+      lanes[j] = Operator::apply(lanes[j], lanes[j + width]);
+    }
+  }
+
+  return lanes[0];
+}
+
+
+// Element i of [first, first + n) is accumulated into lane i % Lanes, which
+// makes the lanes independent dependency chains. The compiler is free to
+// keep them in vector registers.
+// requires n >= Lanes
+template<typename Operator, typename A, typename RandomAccessIterator, typename Size>
+A reduce_lanes(RandomAccessIterator first, Size n, thrust::detail::false_type) // use vector extensions
+{
+  const int Lanes = reduction_lanes<A>::value;
+
+  A lanes[Lanes];
+
+  for(int j = 0; j < Lanes; ++j)
+  {
+    lanes[j] = static_cast<A>(first[j]);
+  }
+
+  Size i = Lanes;
+
+  for(; n - i >= Size(Lanes); i += Lanes)
+  {
+    for(int j = 0; j < Lanes; ++j)
+    {
+      lanes[j] = Operator::apply(lanes[j], static_cast<A>(first[i + j]));
+    }
+  }
+
+  for(int j = 0; i + j < n; ++j)
+  {
+    lanes[j] = Operator::apply(lanes[j], static_cast<A>(first[i + j]));
+  }
+
+  return combine_lanes<Operator,Lanes>(lanes);
+}
+
+
+#if THRUST_SIMD_HAS_VECTOR_EXTENSIONS
+
+template<typename A>
+struct vector
+{
+  static const int size = vector_bytes / sizeof(A);
+
+  typedef A type __attribute__((vector_size(vector_bytes)));
+};
+
+
+template<typename V, typename T>
+V load(const T *ptr)
+{
+  V result;
+  std::memcpy(&result, ptr, sizeof(V));
+  return result;
+}
+
+
+template<typename V, typename T>
+void store(T *ptr, const V &v)
+{
+  std::memcpy(ptr, &v, sizeof(V));
+}
+
+
+template<typename V, typename A>
+V broadcast(A x)
+{
+  V result;
+
+  for(int j = 0; j < int(sizeof(V) / sizeof(A)); ++j)
+  {
+    result[j] = x;
+  }
+
+  return result;
+}
+
+
+// the same lanes as the portable kernel, held in vectors; the bits of T are
+// loaded as A, which has the same width
+template<typename Operator, typename A, typename RandomAccessIterator, typename Size>
+A reduce_lanes(RandomAccessIterator first, Size n, thrust::detail::true_type) // use vector extensions
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type T;
+  typedef typename vector<A>::type                                    V;
+
+  const int Width = vector<A>::size;
+  const int Lanes = reduction_lanes<A>::value;
+
+  const T *data = thrust::detail::contiguous_iterator_raw_pointer_cast(first);
+
+  V acc[vectors_per_reduction];
+
+  for(int k = 0; k < vectors_per_reduction; ++k)
+  {
+    acc[k] = load<V>(data + k * Width);
+  }
+
+  Size i = Lanes;
+
+  for(; n - i >= Size(Lanes); i += Lanes)
+  {
+    for(int k = 0; k < vectors_per_reduction; ++k)
+    {
+      acc[k] = Operator::apply(acc[k], load<V>(data + i + k * Width));
+    }
+  }
+
+  A lanes[Lanes];
+  std::memcpy(lanes, acc, sizeof(lanes));
+
+  for(int j = 0; i + j < n; ++j)
+  {
+    lanes[j] = Operator::apply(lanes[j], static_cast<A>(data[i + j]));
+  }
+
+  return combine_lanes<Operator,Lanes>(lanes);
+}
+
+#endif // THRUST_SIMD_HAS_VECTOR_EXTENSIONS
+
+
+template<typename RandomAccessIterator>
+struct use_vector_extensions
+  : thrust::detail::integral_constant<
+      bool,
+      THRUST_SIMD_HAS_VECTOR_EXTENSIONS
+        && thrust::is_contiguous_iterator<RandomAccessIterator>::value
+        && sizeof(typename thrust::iterator_value<RandomAccessIterator>::type) <= 8
+    >
+{};
+
+
+#if THRUST_SIMD_HAS_SHUFFLEVECTOR
+
+// moves lane j of v to lane j + Shift, and lane j of fill to the lanes
+// j < Shift which are left free
+template<int Shift, typename V, int... Is>
+V shift_lanes(const V &v, const V &fill, thrust::integer_sequence<int, Is...>)
+{
+  return __builtin_shufflevector(v, fill, (Is < Shift ? int(sizeof...(Is)) + Is : Is - Shift)...);
+}
+
+
+// copies the last lane of v to all of its lanes
+template<typename V, int... Is>
+V broadcast_last_lane(const V &v, thrust::integer_sequence<int, Is...>)
+{
+  return __builtin_shufflevector(v, v, (Is * 0 + int(sizeof...(Is)) - 1)...);
+}
+
+
+// lane j of the result is the sum of the lanes 0, ..., j of v, computed in
+// log2(Width) steps which each add the lanes Shift positions below
+template<typename Operator, int Width, int Shift = 1, bool Done = (Shift >= Width)>
+struct prefix_sum
+{
+  template<typename V>
+  static V apply(const V &v, const V &zero)
+  {
+    // the maximum and minimum of a lane with itself do not change it
+    const V fill = Operator::idempotent ? v : zero;
+
+    const V sum = Operator::apply(shift_lanes<Shift>(v, fill, thrust::make_integer_sequence<int, Width>()), v);
+
+    return prefix_sum<Operator, Width, 2 * Shift>::apply(sum, zero);
+  }
+};
+
+template<typename Operator, int Width, int Shift>
+struct prefix_sum<Operator, Width, Shift, true>
+{
+  template<typename V>
+  static V apply(const V &v, const V &)
+  {
+    return v;
+  }
+};
+
+
+// scans [input, input + n) into output with the carry of the elements before
+// them, and returns the last partial sum stored; each vector is scanned in
+// registers, and the carry into the next one stays in all the lanes of a
+// vector. With Offset, offset is combined with each partial sum as it is
+// stored, which stores the results of combine_carry without the extra pass.
+template<bool Exclusive, typename Operator, bool Offset, typename T, typename Size>
+T scan_vectors(const T *input, Size n, T *output, T carry_in, T offset_in)
+{
+  typedef typename lane_type<T, Operator>::type A;
+  typedef typename vector<A>::type              V;
+
+  const int Width = vector<A>::size;
+
+  // the lanes shifted in by plus are zero, which the target shifts in for
+  // free; like any other reassociation, this may change the sign of a zero
+  // sum of floating point values
+  const V zero = V();
+
+  V carry = broadcast<V>(static_cast<A>(carry_in));
+
+  const V offset = broadcast<V>(static_cast<A>(offset_in));
+
+  const Size vectors = n / Width;
+
+  // the partial sums which an exclusive scan stores last
+  V stored = carry;
+
+  for(Size v = 0; v < vectors; ++v)
+  {
+    const Size i = v * Width;
+
+    const V x   = load<V>(input + i);
+    const V sum = Operator::apply(carry, prefix_sum<Operator, Width>::apply(x, zero));
+
+    if(Exclusive)
+    {
+      stored = shift_lanes<1>(sum, zero, thrust::make_integer_sequence<int, Width>());
+      stored[0] = carry[0];
+      store(output + i, Offset ? Operator::apply(offset, stored) : stored);
+    }
+    else
+    {
+      store(output + i, Offset ? Operator::apply(offset, sum) : sum);
+    }
+
+    carry = broadcast_last_lane(sum, thrust::make_integer_sequence<int, Width>());
+  }
+
+  A last = carry[0];
+
+  A last_stored = (Exclusive && vectors > 0) ? stored[Width - 1] : last;
+
+  for(Size i = vectors * Width; i < n; ++i)
+  {
+    const A x = static_cast<A>(input[i]);
+
+    if(Exclusive)
+    {
+      output[i] = static_cast<T>(Offset ? Operator::apply(offset[0], last) : last);
+      last_stored = last;
+      last = Operator::apply(last, x);
+    }
+    else
+    {
+      last = Operator::apply(last, x);
+      output[i] = static_cast<T>(Offset ? Operator::apply(offset[0], last) : last);
+      last_stored = last;
+    }
+  }
+
+  return static_cast<T>(last_stored);
+}
+
+// combines carry with each of the n partial sums at data, in place; when
+// Exclusive, the sums also move up by one element, and carry is written
+// first, so the vectors are visited from the end to read each sum before it
+// is overwritten
+// requires n > 0
+template<bool Exclusive, typename Operator, typename T, typename Size>
+void combine_carry(T *data, Size n, T carry_in)
+{
+  typedef typename lane_type<T, Operator>::type A;
+  typedef typename vector<A>::type              V;
+
+  const int Width = vector<A>::size;
+
+  const Size offset = Exclusive ? 1 : 0;
+
+  const V carry = broadcast<V>(static_cast<A>(carry_in));
+
+  // the elements which get a sum from a whole vector
+  const Size vectors = (n - offset) / Width;
+  const Size tail    = offset + vectors * Width;
+
+  for(Size i = n; i > tail; --i)
+  {
+    data[i - 1] = static_cast<T>(Operator::apply(static_cast<A>(carry_in), static_cast<A>(data[i - 1 - offset])));
+  }
+
+  for(Size v = vectors; v > 0; --v)
+  {
+    const Size i = offset + (v - 1) * Width;
+
+    store(data + i, Operator::apply(carry, load<V>(data + i - offset)));
+  }
+
+  if(Exclusive)
+  {
+    data[0] = carry_in;
+  }
+}
+
+#endif // THRUST_SIMD_HAS_SHUFFLEVECTOR
+
+
+} // end namespace simd_detail
+
+
+// true if simd_reduce may reduce [first, first + n) with binary_op into a
+// value of OutputType
+template<typename RandomAccessIterator, typename OutputType, typename BinaryFunction>
+struct use_simd_reduce
+  : thrust::detail::integral_constant<
+      bool,
+      simd_detail::is_random_access<RandomAccessIterator>::value
+        && thrust::detail::is_same<typename thrust::iterator_value<RandomAccessIterator>::type, OutputType>::value
+        && simd_detail::is_reassociable<OutputType, BinaryFunction>::value
+    >
+{};
+
+
+// true if simd_inclusive_scan and simd_exclusive_scan may scan the elements of
+// InputIterator into OutputIterator with binary_op, where T is the type of the
+// partial sums
+template<typename InputIterator, typename OutputIterator, typename T, typename BinaryFunction>
+struct use_simd_scan
+  : thrust::detail::integral_constant<
+      bool,
+      THRUST_SIMD_HAS_SHUFFLEVECTOR
+        && thrust::is_contiguous_iterator<InputIterator>::value
+        && thrust::is_contiguous_iterator<OutputIterator>::value
+        && thrust::detail::is_same<typename thrust::iterator_value<InputIterator>::type, T>::value
+        && thrust::detail::is_same<typename thrust::iterator_value<OutputIterator>::type, T>::value
+        && sizeof(T) <= 8
+        && simd_detail::is_reassociable<T, BinaryFunction>::value
+    >
+{};
+
+
+// Returns the sum of init and the elements of [first, first + n), like an
+// element by element reduction, but with the elements accumulated into
+// independent lanes which are combined at the end. Integral results are the
+// same as those of the element by element reduction.
+// requires use_simd_reduce
+template<typename RandomAccessIterator, typename Size, typename OutputType, typename BinaryFunction>
+OutputType simd_reduce(RandomAccessIterator first, Size n, OutputType init, BinaryFunction)
+{
+  typedef typename simd_detail::lane_operator<BinaryFunction, OutputType>::type Operator;
+  typedef typename simd_detail::lane_type<OutputType, Operator>::type           A;
+
+  if(n < Size(simd_detail::reduction_lanes<A>::value))
+  {
+    A result = static_cast<A>(init);
+
+    for(Size i = 0; i < n; ++i)
+    {
+      result = Operator::apply(result, static_cast<A>(first[i]));
+    }
+
+    return static_cast<OutputType>(result);
+  }
+
+  simd_detail::use_vector_extensions<RandomAccessIterator> use_vector_extensions;
+
+  const A sum = simd_detail::reduce_lanes<Operator, A>(first, n, use_vector_extensions);
+
+  return static_cast<OutputType>(Operator::apply(static_cast<A>(init), sum));
+}
+
+
+// returns the sum of init and the elements of [first, first + n), with
+// simd_reduce where possible
+template<typename RandomAccessIterator, typename Size, typename OutputType, typename BinaryFunction>
+OutputType reduce_range(RandomAccessIterator first,
+                        Size n,
+                        OutputType init,
+                        BinaryFunction binary_op,
+                        thrust::detail::true_type) // use_simd_reduce
+{
+  return simd_reduce(first, n, init, binary_op);
+}
+
+
+template<typename RandomAccessIterator, typename Size, typename OutputType, typename BinaryFunction>
+OutputType reduce_range(RandomAccessIterator first,
+                        Size n,
+                        OutputType init,
+                        BinaryFunction binary_op,
+                        thrust::detail::false_type) // use_simd_reduce
+{
+  thrust::detail::wrapped_function<BinaryFunction,OutputType> wrapped_binary_op(binary_op);
+
+  OutputType result = init;
+
+  for(Size i = 0; i < n; ++i)
+  {
+    result = wrapped_binary_op(result, first[i]);
+  }
+
+  return result;
+}
+
+
+template<typename RandomAccessIterator, typename Size, typename OutputType, typename BinaryFunction>
+OutputType reduce_range(RandomAccessIterator first, Size n, OutputType init, BinaryFunction binary_op)
+{
+  use_simd_reduce<RandomAccessIterator, OutputType, BinaryFunction> use_simd;
+
+  return reduce_range(first, n, init, binary_op, use_simd);
+}
+
+
+#if THRUST_SIMD_HAS_SHUFFLEVECTOR
+
+// writes the inclusive scan of [first, first + n) to result, with the partial
+// sums of each vector of elements computed in registers
+// requires use_simd_scan and n > 0
+template<typename InputIterator, typename Size, typename OutputIterator, typename BinaryFunction>
+void simd_inclusive_scan(InputIterator first, Size n, OutputIterator result, BinaryFunction)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type           T;
+  typedef typename simd_detail::lane_operator<BinaryFunction, T>::type Operator;
+
+  const T *input  = thrust::detail::contiguous_iterator_raw_pointer_cast(first);
+  T       *output = thrust::detail::contiguous_iterator_raw_pointer_cast(result);
+
+  const T head = input[0];
+  output[0] = head;
+
+  simd_detail::scan_vectors<false, Operator, false>(input + 1, n - 1, output + 1, head, head);
+}
+
+
+// writes the exclusive scan of [first, first + n) with init to result
+// requires use_simd_scan
+template<typename InputIterator, typename Size, typename OutputIterator, typename T, typename BinaryFunction>
+void simd_exclusive_scan(InputIterator first, Size n, OutputIterator result, T init, BinaryFunction)
+{
+  typedef typename simd_detail::lane_operator<BinaryFunction, T>::type Operator;
+
+  const T *input  = thrust::detail::contiguous_iterator_raw_pointer_cast(first);
+  T       *output = thrust::detail::contiguous_iterator_raw_pointer_cast(result);
+
+  simd_detail::scan_vectors<true, Operator, false>(input, n, output, init, init);
+}
+
+
+// writes the inclusive scan of [first, first + n), combined with carry, to
+// result, and returns the last element of the scan without carry; the results
+// are those of simd_inclusive_scan followed by simd_combine_carry<false>
+// requires use_simd_scan and n > 0
+template<typename InputIterator, typename Size, typename OutputIterator, typename T, typename BinaryFunction>
+T simd_inclusive_scan_with_carry(InputIterator first, Size n, OutputIterator result, T carry, BinaryFunction)
+{
+  typedef typename simd_detail::lane_operator<BinaryFunction, T>::type Operator;
+  typedef typename simd_detail::lane_type<T, Operator>::type           A;
+
+  const T *input  = thrust::detail::contiguous_iterator_raw_pointer_cast(first);
+  T       *output = thrust::detail::contiguous_iterator_raw_pointer_cast(result);
+
+  const T head = input[0];
+  output[0] = static_cast<T>(Operator::apply(static_cast<A>(carry), static_cast<A>(head)));
+
+  return simd_detail::scan_vectors<false, Operator, true>(input + 1, n - 1, output + 1, head, carry);
+}
+
+
+// writes the exclusive scan of [first, first + n) with init, combined with
+// carry, to result, and returns the last element of the scan without carry;
+// the results are those of simd_exclusive_scan followed by
+// simd_combine_carry<false>
+// requires use_simd_scan and n > 0
+template<typename InputIterator, typename Size, typename OutputIterator, typename T, typename BinaryFunction>
+T simd_exclusive_scan_with_carry(InputIterator first, Size n, OutputIterator result, T init, T carry, BinaryFunction)
+{
+  typedef typename simd_detail::lane_operator<BinaryFunction, T>::type Operator;
+
+  const T *input  = thrust::detail::contiguous_iterator_raw_pointer_cast(first);
+  T       *output = thrust::detail::contiguous_iterator_raw_pointer_cast(result);
+
+  return simd_detail::scan_vectors<true, Operator, true>(input, n, output, init, carry);
+}
+
+
+// combines carry with each of the n partial sums at result, in place, which
+// turns the inclusive scans of a block into the inclusive scans of the
+// elements before it as well; when Exclusive, the scans also move up by one
+// element to become the exclusive scans, with carry first
+// requires use_simd_scan and n > 0
+template<bool Exclusive, typename OutputIterator, typename Size, typename T, typename BinaryFunction>
+void simd_combine_carry(OutputIterator result, Size n, T carry, BinaryFunction)
+{
+  typedef typename simd_detail::lane_operator<BinaryFunction, T>::type Operator;
+
+  simd_detail::combine_carry<Exclusive, Operator>(thrust::detail::contiguous_iterator_raw_pointer_cast(result), n, carry);
+}
+
+#endif // THRUST_SIMD_HAS_SHUFFLEVECTOR
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,77 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file batched_copy.h
+ *  \brief Sequential implementation of batched_copy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/internal/batched_copy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename Size>
+_CCCL_HOST_DEVICE
+  void batched_copy(sequential::execution_policy<DerivedPolicy> &,
+                    RandomAccessIterator1 src_ptrs,
+                    RandomAccessIterator2 dst_ptrs,
+                    RandomAccessIterator3 sizes,
+                    Size num_buffers)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type InputIterator;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type OutputIterator;
+  typedef typename thrust::iterator_value<RandomAccessIterator3>::type BufferSize;
+
+  for(Size i = 0; i < num_buffers; ++i, ++src_ptrs, ++dst_ptrs, ++sizes)
+  {
+    InputIterator    src = *src_ptrs;
+    OutputIterator   dst = *dst_ptrs;
+    const BufferSize n   = *sizes;
+
+    thrust::system::detail::internal::batched_copy_buffer(src, n, dst);
+  }
+} // end batched_copy()
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
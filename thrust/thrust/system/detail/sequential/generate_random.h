@@ -0,0 +1,110 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file generate_random.h
+ *  \brief Sequential implementation of generate_random.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/generate_random.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+
+namespace generate_random_detail
+{
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename ForwardIterator, typename Distribution>
+_CCCL_HOST_DEVICE
+  void generate_random(ForwardIterator first,
+                       ForwardIterator last,
+                       unsigned long long seed,
+                       const Distribution &dist,
+                       thrust::incrementable_traversal_tag)
+{
+  thrust::system::detail::internal::random_sampler<Distribution> sampler(seed, dist);
+
+  for(thrust::detail::uint64_t i = 0; first != last; ++first, ++i)
+  {
+    *first = sampler(i);
+  }
+}
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename RandomAccessIterator, typename Distribution>
+_CCCL_HOST_DEVICE
+  void generate_random(RandomAccessIterator first,
+                       RandomAccessIterator last,
+                       unsigned long long seed,
+                       const Distribution &dist,
+                       thrust::random_access_traversal_tag)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+
+  // the Philox blocks of consecutive elements are computed together on the host
+  NV_IF_TARGET(NV_IS_HOST, (
+    thrust::system::detail::internal::generate_random(first, IndexType(0), IndexType(last - first), seed, dist);
+  ), ( // NV_IS_DEVICE:
+    generate_random(first, last, seed, dist, thrust::incrementable_traversal_tag());
+  ));
+}
+
+
+} // end namespace generate_random_detail
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Distribution>
+_CCCL_HOST_DEVICE
+  void generate_random(sequential::execution_policy<DerivedPolicy> &,
+                       ForwardIterator first,
+                       ForwardIterator last,
+                       unsigned long long seed,
+                       const Distribution &dist)
+{
+  generate_random_detail::generate_random(first, last, seed, dist,
+    typename thrust::iterator_traversal<ForwardIterator>::type());
+} // end generate_random()
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
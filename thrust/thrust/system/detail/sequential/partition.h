@@ -33,6 +33,9 @@
 #include <thrust/pair.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/detail/function.h>
+#include <thrust/detail/internal_functional.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/advance.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -346,6 +349,111 @@ _CCCL_HOST_DEVICE
 }
 
 
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+_CCCL_HOST_DEVICE
+  OutputIterator bucket_partition(sequential::execution_policy<DerivedPolicy> &exec,
+                                  ForwardIterator first,
+                                  ForwardIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets)
+{
+  // wrap bucket_op
+  thrust::detail::wrapped_function<
+    BucketFunction,
+    Size
+  > wrapped_bucket_op(bucket_op);
+
+  typedef typename thrust::iterator_value<ForwardIterator>::type      T;
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  typedef thrust::detail::temporary_array<T,DerivedPolicy> TempRange;
+  typedef typename TempRange::iterator                     TempIterator;
+
+  TempRange temp(exec, first, last);
+
+  // count the size of each bucket, shifted by one so that the
+  // prefix sum below yields the beginning of each bucket
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> temp_counts(exec, num_buckets + 1);
+  IndexType *counts = thrust::raw_pointer_cast(temp_counts.data());
+
+  for(Size i = 0; i <= num_buckets; ++i)
+  {
+    counts[i] = 0;
+  }
+
+  for(TempIterator iter = temp.begin(); iter != temp.end(); ++iter)
+  {
+    ++counts[wrapped_bucket_op(*iter) + 1];
+  }
+
+  for(Size i = 0; i < num_buckets; ++i)
+  {
+    counts[i + 1] += counts[i];
+  }
+
+  for(Size i = 0; i <= num_buckets; ++i, ++offsets)
+  {
+    *offsets = counts[i];
+  }
+
+  // scatter each element to the next free slot of its bucket
+  for(TempIterator iter = temp.begin(); iter != temp.end(); ++iter)
+  {
+    IndexType &cursor = counts[wrapped_bucket_op(*iter)];
+
+    ForwardIterator dst = first;
+    thrust::advance(dst, cursor);
+    *dst = *iter;
+
+    ++cursor;
+  }
+
+  return offsets;
+}
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Predicate1,
+         typename Predicate2>
+_CCCL_HOST_DEVICE
+  thrust::pair<ForwardIterator,ForwardIterator>
+    partition3(sequential::execution_policy<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last,
+               Predicate1 pred1,
+               Predicate2 pred2)
+{
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  IndexType offsets[4];
+
+  // Fully qualify name to disambiguate overloads found via ADL.
+  THRUST_NS_QUALIFIER::system::detail::sequential::bucket_partition(
+    exec,
+    first,
+    last,
+    thrust::detail::partition3_bucket<Predicate1,Predicate2,IndexType>(pred1, pred2),
+    IndexType(3),
+    offsets);
+
+  ForwardIterator middle1 = first;
+  thrust::advance(middle1, offsets[1]);
+
+  ForwardIterator middle2 = first;
+  thrust::advance(middle2, offsets[2]);
+
+  return thrust::make_pair(middle1, middle2);
+}
+
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
@@ -0,0 +1,75 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file pipeline.h
+ *  \brief Sequential implementation of evaluate_pipeline.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+
+// a single tile, whose carries are known from the start, needs a single pass
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Chain>
+_CCCL_HOST_DEVICE
+  typename Chain::result_type
+    evaluate_pipeline(sequential::execution_policy<DerivedPolicy> &,
+                      InputIterator first,
+                      InputIterator last,
+                      const Chain &chain)
+{
+  Chain result(chain);
+  result.begin_tile();
+
+  std::ptrdiff_t reached = 0;
+
+  for(; first != last; ++first)
+  {
+    result.template push<Chain::sink_type::final_pass>(*first, reached);
+  }
+
+  return result.sink().result();
+} // end evaluate_pipeline()
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -31,6 +31,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/function.h>
+#include <thrust/system/detail/internal/simd.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -42,17 +43,20 @@ namespace sequential
 {
 
 
+namespace reduce_detail
+{
+
+
 _CCCL_EXEC_CHECK_DISABLE
-template<typename DerivedPolicy,
-         typename InputIterator,
+template<typename InputIterator,
          typename OutputType,
          typename BinaryFunction>
 _CCCL_HOST_DEVICE
-  OutputType reduce(sequential::execution_policy<DerivedPolicy> &,
-                    InputIterator begin,
+  OutputType reduce(InputIterator begin,
                     InputIterator end,
                     OutputType init,
-                    BinaryFunction binary_op)
+                    BinaryFunction binary_op,
+                    thrust::detail::false_type) // use_simd_reduce
 {
   // wrap binary_op
   thrust::detail::wrapped_function<
@@ -73,6 +77,45 @@ _CCCL_HOST_DEVICE
 }
 
 
+template<typename InputIterator,
+         typename OutputType,
+         typename BinaryFunction>
+  OutputType reduce(InputIterator begin,
+                    InputIterator end,
+                    OutputType init,
+                    BinaryFunction binary_op,
+                    thrust::detail::true_type) // use_simd_reduce
+{
+  return thrust::system::detail::internal::simd_reduce(begin, end - begin, init, binary_op);
+}
+
+
+} // end namespace reduce_detail
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputType,
+         typename BinaryFunction>
+_CCCL_HOST_DEVICE
+  OutputType reduce(sequential::execution_policy<DerivedPolicy> &,
+                    InputIterator begin,
+                    InputIterator end,
+                    OutputType init,
+                    BinaryFunction binary_op)
+{
+  // reductions of arithmetic types with plus, maximum and minimum are
+  // vectorized on the host
+  NV_IF_TARGET(NV_IS_HOST, (
+    thrust::system::detail::internal::use_simd_reduce<InputIterator, OutputType, BinaryFunction> use_simd;
+    return reduce_detail::reduce(begin, end, init, binary_op, use_simd);
+  ), ( // NV_IS_DEVICE:
+    return reduce_detail::reduce(begin, end, init, binary_op, thrust::detail::false_type());
+  ));
+}
+
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
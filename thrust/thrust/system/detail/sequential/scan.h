@@ -36,6 +36,7 @@
 #include <thrust/detail/type_traits/function_traits.h>
 #include <thrust/detail/type_traits/iterator/is_output_iterator.h>
 #include <thrust/detail/function.h>
+#include <thrust/system/detail/internal/simd.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -46,17 +47,20 @@ namespace sequential
 {
 
 
+namespace scan_detail
+{
+
+
 _CCCL_EXEC_CHECK_DISABLE
-template<typename DerivedPolicy,
-         typename InputIterator,
+template<typename InputIterator,
          typename OutputIterator,
          typename BinaryFunction>
 _CCCL_HOST_DEVICE
-  OutputIterator inclusive_scan(sequential::execution_policy<DerivedPolicy> &,
-                                InputIterator first,
+  OutputIterator inclusive_scan(InputIterator first,
                                 InputIterator last,
                                 OutputIterator result,
-                                BinaryFunction binary_op)
+                                BinaryFunction binary_op,
+                                thrust::detail::false_type) // use_simd_scan
 {
   using namespace thrust::detail;
 
@@ -84,18 +88,17 @@ _CCCL_HOST_DEVICE
 
 
 _CCCL_EXEC_CHECK_DISABLE
-template<typename DerivedPolicy,
-         typename InputIterator,
+template<typename InputIterator,
          typename OutputIterator,
          typename InitialValueType,
          typename BinaryFunction>
 _CCCL_HOST_DEVICE
-  OutputIterator exclusive_scan(sequential::execution_policy<DerivedPolicy> &,
-                                InputIterator first,
+  OutputIterator exclusive_scan(InputIterator first,
                                 InputIterator last,
                                 OutputIterator result,
                                 InitialValueType init,
-                                BinaryFunction binary_op)
+                                BinaryFunction binary_op,
+                                thrust::detail::false_type) // use_simd_scan
 {
   using namespace thrust::detail;
 
@@ -122,6 +125,101 @@ _CCCL_HOST_DEVICE
 }
 
 
+#if THRUST_SIMD_HAS_SHUFFLEVECTOR
+
+template<typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan(InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                BinaryFunction binary_op,
+                                thrust::detail::true_type) // use_simd_scan
+{
+  const typename thrust::iterator_difference<InputIterator>::type n = last - first;
+
+  if(n > 0)
+  {
+    thrust::system::detail::internal::simd_inclusive_scan(first, n, result, binary_op);
+  }
+
+  return result + n;
+}
+
+
+template<typename InputIterator,
+         typename OutputIterator,
+         typename InitialValueType,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan(InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                InitialValueType init,
+                                BinaryFunction binary_op,
+                                thrust::detail::true_type) // use_simd_scan
+{
+  const typename thrust::iterator_difference<InputIterator>::type n = last - first;
+
+  thrust::system::detail::internal::simd_exclusive_scan(first, n, result, init, binary_op);
+
+  return result + n;
+}
+
+#endif // THRUST_SIMD_HAS_SHUFFLEVECTOR
+
+
+} // end namespace scan_detail
+
+
+// scans of arithmetic types with plus, maximum and minimum between contiguous
+// ranges are vectorized on the host
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction>
+_CCCL_HOST_DEVICE
+  OutputIterator inclusive_scan(sequential::execution_policy<DerivedPolicy> &,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                BinaryFunction binary_op)
+{
+  using ValueType = typename thrust::iterator_value<InputIterator>::type;
+
+  NV_IF_TARGET(NV_IS_HOST, (
+    thrust::system::detail::internal::use_simd_scan<InputIterator, OutputIterator, ValueType, BinaryFunction> use_simd;
+    return scan_detail::inclusive_scan(first, last, result, binary_op, use_simd);
+  ), ( // NV_IS_DEVICE:
+    return scan_detail::inclusive_scan(first, last, result, binary_op, thrust::detail::false_type());
+  ));
+}
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename InitialValueType,
+         typename BinaryFunction>
+_CCCL_HOST_DEVICE
+  OutputIterator exclusive_scan(sequential::execution_policy<DerivedPolicy> &,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                InitialValueType init,
+                                BinaryFunction binary_op)
+{
+  NV_IF_TARGET(NV_IS_HOST, (
+    thrust::system::detail::internal::use_simd_scan<InputIterator, OutputIterator, InitialValueType, BinaryFunction> use_simd;
+    return scan_detail::exclusive_scan(first, last, result, init, binary_op, use_simd);
+  ), ( // NV_IS_DEVICE:
+    return scan_detail::exclusive_scan(first, last, result, init, binary_op, thrust::detail::false_type());
+  ));
+}
+
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
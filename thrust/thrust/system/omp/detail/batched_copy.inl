@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/omp/detail/batched_copy.h>
+#include <thrust/system/detail/internal/batched_copy.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <cstddef>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename Size>
+  void batched_copy(execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator1 src_ptrs,
+                    RandomAccessIterator2 dst_ptrs,
+                    RandomAccessIterator3 sizes,
+                    Size num_buffers)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  if(num_buffers <= 0) return;
+
+  // find the position of each buffer within the concatenation of all buffers
+  thrust::detail::temporary_array<std::ptrdiff_t,DerivedPolicy> temp_offsets(0, exec, num_buffers + 1);
+  std::ptrdiff_t *offsets = thrust::raw_pointer_cast(temp_offsets.data());
+
+  offsets[0] = 0;
+  thrust::inclusive_scan(exec,
+                         thrust::make_transform_iterator(sizes, thrust::identity<std::ptrdiff_t>()),
+                         thrust::make_transform_iterator(sizes + num_buffers, thrust::identity<std::ptrdiff_t>()),
+                         offsets + 1);
+
+  // split the elements rather than the buffers evenly among threads
+  // so that a few large buffers don't serialize the copy
+  const std::ptrdiff_t grain = 1 << 12;
+  thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> decomp(offsets[num_buffers], grain, omp_get_max_threads());
+
+  const std::ptrdiff_t num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(std::ptrdiff_t tile = 0; tile < num_tiles; ++tile)
+  {
+    thrust::system::detail::internal::batched_copy_range(src_ptrs, dst_ptrs, offsets, num_buffers, decomp[tile].begin(), decomp[tile].end());
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end batched_copy()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
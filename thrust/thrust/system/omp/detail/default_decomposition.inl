@@ -56,7 +56,9 @@ thrust::system::detail::internal::uniform_decomposition<IndexType> default_decom
   );
 
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, omp_get_num_procs());
+  // one interval per thread of a parallel region, so that a static schedule
+  // over the intervals hands interval i to thread i in every kernel
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, omp_get_max_threads());
 #else
   return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, 1);
 #endif
@@ -26,7 +26,17 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/omp/detail/execution_policy.h>
-#include <thrust/system/detail/generic/extrema.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/extrema.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,14 +46,86 @@ namespace omp
 namespace detail
 {
 
+namespace extrema_detail
+{
+
+
+// returns the positions of the first smallest and the first largest element
+template <bool FindMin, bool FindMax, typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<
+  typename thrust::iterator_difference<ForwardIterator>::type,
+  typename thrust::iterator_difference<ForwardIterator>::type
+>
+  extrema(execution_policy<DerivedPolicy> &exec,
+          ForwardIterator first,
+          ForwardIterator last,
+          BinaryPredicate comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      ForwardIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  const IndexType n = last - first;
+
+  // tiles smaller than this aren't worth a thread of their own
+  const IndexType grain = 1 << 14;
+
+  IndexType max_tiles = 1;
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  max_tiles = omp_get_max_threads();
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, grain, max_tiles);
+
+  const IndexType num_tiles = decomp.size();
+
+  if(num_tiles <= 1)
+  {
+    return thrust::system::detail::internal::extrema<FindMin,FindMax>(first, n, comp);
+  }
+
+  // the extrema of each tile, relative to first
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> temp_results(0, exec, 2 * num_tiles);
+  IndexType *results = thrust::raw_pointer_cast(temp_results.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType tile = 0; tile < num_tiles; ++tile)
+  {
+    const IndexType begin = decomp[tile].begin();
+
+    thrust::pair<IndexType,IndexType> tile_result =
+      thrust::system::detail::internal::extrema<FindMin,FindMax>(first + begin, decomp[tile].size(), comp);
+
+    results[2 * tile]     = begin + tile_result.first;
+    results[2 * tile + 1] = begin + tile_result.second;
+  }
+
+  return thrust::system::detail::internal::combine_extrema<FindMin,FindMax>(first, results, num_tiles, comp);
+} // end extrema()
+
+
+} // end extrema_detail
+
+
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 ForwardIterator max_element(execution_policy<DerivedPolicy> &exec,
                             ForwardIterator first,
                             ForwardIterator last,
                             BinaryPredicate comp)
 {
-  // omp prefers generic::max_element to cpp::max_element
-  return thrust::system::detail::generic::max_element(exec, first, last, comp);
+  if(first == last) return last;
+
+  return first + extrema_detail::extrema<false,true>(exec, first, last, comp).second;
 } // end max_element()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
@@ -52,8 +134,9 @@ ForwardIterator min_element(execution_policy<DerivedPolicy> &exec,
                             ForwardIterator last,
                             BinaryPredicate comp)
 {
-  // omp prefers generic::min_element to cpp::min_element
-  return thrust::system::detail::generic::min_element(exec, first, last, comp);
+  if(first == last) return last;
+
+  return first + extrema_detail::extrema<true,false>(exec, first, last, comp).first;
 } // end min_element()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
@@ -62,8 +145,14 @@ thrust::pair<ForwardIterator,ForwardIterator> minmax_element(execution_policy<De
                                                              ForwardIterator last,
                                                              BinaryPredicate comp)
 {
-  // omp prefers generic::minmax_element to cpp::minmax_element
-  return thrust::system::detail::generic::minmax_element(exec, first, last, comp);
+  if(first == last) return thrust::make_pair(last, last);
+
+  thrust::pair<
+    typename thrust::iterator_difference<ForwardIterator>::type,
+    typename thrust::iterator_difference<ForwardIterator>::type
+  > result = extrema_detail::extrema<true,true>(exec, first, last, comp);
+
+  return thrust::make_pair(first + result.first, first + result.second);
 } // end minmax_element()
 
 } // end detail
@@ -30,8 +30,14 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/system/detail/generic/find.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/detail/internal/find_if.h>
+#include <thrust/iterator/iterator_traits.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -42,13 +48,41 @@ namespace detail
 {
 
 template <typename DerivedPolicy, typename InputIterator, typename Predicate>
-InputIterator find_if(execution_policy<DerivedPolicy> &exec,
+InputIterator find_if(execution_policy<DerivedPolicy> &,
                       InputIterator first,
                       InputIterator last,
                       Predicate pred)
 {
-  // omp prefers generic::find_if to cpp::find_if
-  return thrust::system::detail::generic::find_if(exec, first, last, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator>::type IndexType;
+
+  thrust::system::detail::internal::find_if_state<IndexType> state(last - first);
+
+  if(state.is_small())
+  {
+    state.run(first, pred);
+  }
+  else
+  {
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    // threads stop claiming blocks once a match before them has been found
+    THRUST_PRAGMA_OMP(parallel)
+    state.run(first, pred);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+  }
+
+  return first + state.result();
 }
 
 } // end namespace detail
@@ -30,6 +30,7 @@
 #include <thrust/distance.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -70,13 +71,29 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy> &,
   typedef typename thrust::iterator_difference<RandomAccessIterator>::type DifferenceType;
   DifferenceType signed_n = n;
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for(DifferenceType i = 0;
-      i < signed_n;
-      ++i)
+  // Every thread applies f to one interval of the default decomposition,
+  // which reduce splits its input into as well. Vectors construct, fill and
+  // copy their elements through here, so the first touch of each page of a
+  // new vector happens on the thread which processes that part of the range
+  // later on, which places the page on that thread's NUMA node.
+  thrust::system::detail::internal::uniform_decomposition<DifferenceType> decomp =
+    thrust::system::omp::detail::default_decomposition(signed_n);
+
+  const DifferenceType num_intervals = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for schedule(static))
+  for(DifferenceType interval = 0;
+      interval < num_intervals;
+      ++interval)
   {
-    RandomAccessIterator temp = first + i;
-    wrapped_f(*temp);
+    const DifferenceType begin = decomp[interval].begin();
+    const DifferenceType end   = decomp[interval].end();
+
+    for(DifferenceType i = begin; i < end; ++i)
+    {
+      RandomAccessIterator temp = first + i;
+      wrapped_f(*temp);
+    }
   }
 
   return first + n;
@@ -0,0 +1,127 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/omp/detail/generate_random.h>
+#include <thrust/system/detail/generic/generate_random.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/generate_random.h>
+#include <thrust/iterator/iterator_traits.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace dispatch
+{
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Distribution>
+  void generate_random(execution_policy<DerivedPolicy> &exec,
+                       ForwardIterator first,
+                       ForwardIterator last,
+                       unsigned long long seed,
+                       const Distribution &dist,
+                       thrust::incrementable_traversal_tag)
+{
+  // elements can't be found in parallel without random access
+  thrust::system::detail::generic::generate_random(exec, first, last, seed, dist);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename Distribution>
+  void generate_random(execution_policy<DerivedPolicy> &,
+                       RandomAccessIterator first,
+                       RandomAccessIterator last,
+                       unsigned long long seed,
+                       const Distribution &dist,
+                       thrust::random_access_traversal_tag)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+
+  // every thread computes the Philox blocks of a contiguous tile of
+  // elements, many elements at a time
+  const IndexType grain = 1 << 12;
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, grain, omp_get_max_threads());
+
+  const IndexType num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType tile = 0; tile < num_tiles; ++tile)
+  {
+    thrust::system::detail::internal::generate_random(first, decomp[tile].begin(), decomp[tile].end(), seed, dist);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+
+} // end namespace dispatch
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Distribution>
+  void generate_random(execution_policy<DerivedPolicy> &exec,
+                       ForwardIterator first,
+                       ForwardIterator last,
+                       unsigned long long seed,
+                       const Distribution &dist)
+{
+  dispatch::generate_random(exec, first, last, seed, dist,
+    typename thrust::iterator_traversal<ForwardIterator>::type());
+} // end generate_random()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -89,6 +89,30 @@ template<typename DerivedPolicy,
                           Predicate pred);
 
 
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Predicate1,
+         typename Predicate2>
+  thrust::pair<ForwardIterator,ForwardIterator>
+    partition3(execution_policy<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last,
+               Predicate1 pred1,
+               Predicate2 pred2);
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator bucket_partition(execution_policy<DerivedPolicy> &exec,
+                                  ForwardIterator first,
+                                  ForwardIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets);
+
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
@@ -32,6 +32,20 @@
 #endif // no system header
 #include <thrust/system/omp/detail/partition.h>
 #include <thrust/system/detail/generic/partition.h>
+#include <thrust/system/detail/sequential/partition.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/internal_functional.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/advance.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -41,7 +55,6 @@ namespace omp
 namespace detail
 {
 
-
 template<typename DerivedPolicy,
          typename ForwardIterator,
          typename Predicate>
@@ -108,6 +121,195 @@ template<typename DerivedPolicy,
 } // end stable_partition_copy()
 
 
+namespace dispatch
+{
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator bucket_partition(execution_policy<DerivedPolicy> &exec,
+                                  ForwardIterator first,
+                                  ForwardIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets,
+                                  thrust::incrementable_traversal_tag)
+{
+  return thrust::system::detail::sequential::bucket_partition(exec, first, last, bucket_op, num_buckets, offsets);
+} // end bucket_partition()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator bucket_partition(execution_policy<DerivedPolicy> &exec,
+                                  RandomAccessIterator first,
+                                  RandomAccessIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets,
+                                  thrust::random_access_traversal_tag)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+
+  // wrap bucket_op
+  thrust::detail::wrapped_function<BucketFunction,IndexType> wrapped_bucket_op(bucket_op);
+
+  const IndexType n = thrust::distance(first, last);
+  const IndexType buckets = static_cast<IndexType>(num_buckets);
+
+  // scatter from a copy of the input so that the result may overwrite it
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> temp(exec, first, last);
+  const ValueType *src = thrust::raw_pointer_cast(temp.data());
+
+  // every thread owns a row of bucket counters padded to a whole number
+  // of cache lines, so that counting does not cause false sharing
+  const IndexType counters_per_line = static_cast<IndexType>(64 / sizeof(IndexType));
+  const IndexType row_size = (buckets + counters_per_line - 1) / counters_per_line * counters_per_line;
+
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> temp_counts(0, exec, omp_get_max_threads() * row_size);
+  IndexType *counts = thrust::raw_pointer_cast(temp_counts.data());
+
+  OutputIterator result = offsets;
+
+  THRUST_PRAGMA_OMP(parallel)
+  {
+    const IndexType num_threads = omp_get_num_threads();
+
+    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, 1, num_threads);
+
+    // process id
+    const IndexType p_i = omp_get_thread_num();
+
+    IndexType *my_counts = counts + p_i * row_size;
+
+    for(IndexType b = 0; b < buckets; ++b)
+    {
+      my_counts[b] = 0;
+    }
+
+    // every thread counts the buckets of its own tile
+    if(p_i < decomp.size())
+    {
+      for(IndexType i = decomp[p_i].begin(); i < decomp[p_i].end(); ++i)
+      {
+        ++my_counts[wrapped_bucket_op(src[i])];
+      }
+    }
+
+    THRUST_PRAGMA_OMP(barrier)
+
+    // turn the counts into the position at which each thread begins writing each bucket,
+    // ordering buckets first and threads second so that the result is stable
+    THRUST_PRAGMA_OMP(single)
+    {
+      IndexType sum = 0;
+
+      for(IndexType b = 0; b < buckets; ++b)
+      {
+        *result = sum;
+        ++result;
+
+        for(IndexType t = 0; t < num_threads; ++t)
+        {
+          IndexType count = counts[t * row_size + b];
+          counts[t * row_size + b] = sum;
+          sum += count;
+        }
+      }
+
+      *result = sum;
+      ++result;
+    } // implicit barrier
+
+    // every thread scatters its own tile
+    if(p_i < decomp.size())
+    {
+      for(IndexType i = decomp[p_i].begin(); i < decomp[p_i].end(); ++i)
+      {
+        IndexType &cursor = my_counts[wrapped_bucket_op(src[i])];
+        first[cursor] = src[i];
+        ++cursor;
+      }
+    }
+  }
+
+  return result;
+#else
+  return offsets;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end bucket_partition()
+
+
+} // end dispatch
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator bucket_partition(execution_policy<DerivedPolicy> &exec,
+                                  ForwardIterator first,
+                                  ForwardIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
+
+  // the parallel scatter writes its result at random positions
+  return thrust::system::omp::detail::dispatch::bucket_partition(exec, first, last, bucket_op, num_buckets, offsets, traversal());
+} // end bucket_partition()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Predicate1,
+         typename Predicate2>
+  thrust::pair<ForwardIterator,ForwardIterator>
+    partition3(execution_policy<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last,
+               Predicate1 pred1,
+               Predicate2 pred2)
+{
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  IndexType offsets[4];
+
+  // a single bucketing pass replaces the two passes of consecutive stable partitions
+  thrust::system::omp::detail::bucket_partition(
+    exec,
+    first,
+    last,
+    thrust::detail::partition3_bucket<Predicate1,Predicate2,IndexType>(pred1, pred2),
+    IndexType(3),
+    offsets);
+
+  return thrust::make_pair(thrust::next(first, offsets[1]), thrust::next(first, offsets[2]));
+} // end partition3()
+
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
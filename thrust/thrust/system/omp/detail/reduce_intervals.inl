@@ -29,6 +29,7 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/function.h>
 #include <thrust/detail/cstdint.h>
+#include <thrust/system/detail/internal/simd.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -64,14 +65,12 @@ void reduce_intervals(execution_policy<DerivedPolicy> &,
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   typedef typename thrust::iterator_value<OutputIterator>::type OutputType;
 
-  // wrap binary_op
-  thrust::detail::wrapped_function<BinaryFunction,OutputType> wrapped_binary_op(binary_op);
-
   typedef thrust::detail::intptr_t index_type;
 
   index_type n = static_cast<index_type>(decomp.size());
 
-  THRUST_PRAGMA_OMP(parallel for)
+  // the same intervals go to the same threads as in for_each
+  THRUST_PRAGMA_OMP(parallel for schedule(static))
   for(index_type i = 0; i < n; i++)
   {
     InputIterator begin = input + decomp[i].begin();
@@ -83,11 +82,7 @@ void reduce_intervals(execution_policy<DerivedPolicy> &,
 
       ++begin;
 
-      while (begin != end)
-      {
-        sum = wrapped_binary_op(sum, *begin);
-        ++begin;
-      }
+      sum = thrust::system::detail::internal::reduce_range(begin, end - begin, sum, binary_op);
 
       OutputIterator tmp = output + i;
       *tmp = sum;
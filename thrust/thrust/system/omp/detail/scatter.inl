@@ -0,0 +1,266 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/omp/detail/scatter.h>
+#include <thrust/scatter.h>
+#include <thrust/system/detail/generic/scatter.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/permute.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scatter_detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename RandomAccessIterator,
+         typename Predicate>
+  void scatter_if(execution_policy<DerivedPolicy> &exec,
+                  InputIterator1 first,
+                  InputIterator1 last,
+                  InputIterator2 map,
+                  InputIterator3 stencil,
+                  RandomAccessIterator output,
+                  Predicate pred)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  namespace internal = thrust::system::detail::internal;
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+  typedef typename thrust::iterator_value<InputIterator2>::type      IndexType;
+  typedef typename thrust::iterator_value<InputIterator1>::type      ValueType;
+
+  const Size n = last - first;
+
+  internal::uniform_decomposition<Size> tiles(n, 1, omp_get_max_threads());
+  const Size num_tiles = tiles.size();
+
+  const std::size_t span = internal::partitioned_permutation_span(map, n, sizeof(ValueType));
+
+  if(span != 0)
+  {
+    internal::permutation_buckets buckets(span, sizeof(ValueType));
+    const Size num_buckets = static_cast<Size>(buckets.size());
+
+    typedef internal::permutation_tables<Size> Tables;
+    thrust::detail::temporary_array<Size,DerivedPolicy> table_storage(0, exec, Tables::storage_size(num_tiles, num_buckets));
+    thrust::detail::temporary_array<IndexType,DerivedPolicy> indices(0, exec, n);
+    thrust::detail::temporary_array<ValueType,DerivedPolicy> values(0, exec, n);
+
+    internal::partitioned_scatter_if<InputIterator1,InputIterator2,InputIterator3,RandomAccessIterator,Predicate,Size>
+      plan(first, map, stencil, output, pred, tiles, buckets,
+           Tables(thrust::raw_pointer_cast(table_storage.data()), num_tiles, num_buckets),
+           thrust::raw_pointer_cast(indices.data()),
+           thrust::raw_pointer_cast(values.data()));
+
+    THRUST_PRAGMA_OMP(parallel)
+    {
+      THRUST_PRAGMA_OMP(for)
+      for(Size tile = 0; tile < num_tiles; ++tile)
+      {
+        plan.count(tile);
+      }
+
+      THRUST_PRAGMA_OMP(single)
+      plan.scan();
+
+      THRUST_PRAGMA_OMP(for)
+      for(Size tile = 0; tile < num_tiles; ++tile)
+      {
+        plan.partition(tile);
+      }
+
+      // buckets have different sizes
+      THRUST_PRAGMA_OMP(for schedule(dynamic))
+      for(Size bucket = 0; bucket < num_buckets; ++bucket)
+      {
+        plan.write(bucket);
+      }
+    }
+
+    return;
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(Size tile = 0; tile < num_tiles; ++tile)
+  {
+    internal::direct_scatter_if(first, map, stencil, output, pred, tiles[tile].begin(), tiles[tile].end());
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end scatter_if()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename RandomAccessIterator>
+  void scatter(execution_policy<DerivedPolicy> &exec,
+               InputIterator1 first,
+               InputIterator1 last,
+               InputIterator2 map,
+               RandomAccessIterator output,
+               thrust::detail::false_type) // is_partitionable_permutation
+{
+  // omp prefers generic::scatter to cpp::scatter
+  thrust::system::detail::generic::scatter(exec, first, last, map, output);
+} // end scatter()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename RandomAccessIterator>
+  void scatter(execution_policy<DerivedPolicy> &exec,
+               InputIterator1 first,
+               InputIterator1 last,
+               InputIterator2 map,
+               RandomAccessIterator output,
+               thrust::detail::true_type) // is_partitionable_permutation
+{
+  // select every element
+  scatter_detail::scatter_if(exec, first, last, map, thrust::make_constant_iterator(true), output, thrust::identity<bool>());
+} // end scatter()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename RandomAccessIterator,
+         typename Predicate>
+  void scatter_if(execution_policy<DerivedPolicy> &exec,
+                  InputIterator1 first,
+                  InputIterator1 last,
+                  InputIterator2 map,
+                  InputIterator3 stencil,
+                  RandomAccessIterator output,
+                  Predicate pred,
+                  thrust::detail::false_type) // is_partitionable_permutation
+{
+  // omp prefers generic::scatter_if to cpp::scatter_if
+  thrust::system::detail::generic::scatter_if(exec, first, last, map, stencil, output, pred);
+} // end scatter_if()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename RandomAccessIterator,
+         typename Predicate>
+  void scatter_if(execution_policy<DerivedPolicy> &exec,
+                  InputIterator1 first,
+                  InputIterator1 last,
+                  InputIterator2 map,
+                  InputIterator3 stencil,
+                  RandomAccessIterator output,
+                  Predicate pred,
+                  thrust::detail::true_type) // is_partitionable_permutation
+{
+  scatter_detail::scatter_if(exec, first, last, map, stencil, output, pred);
+} // end scatter_if()
+
+
+} // end scatter_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename RandomAccessIterator>
+  void scatter(execution_policy<DerivedPolicy> &exec,
+               InputIterator1 first,
+               InputIterator1 last,
+               InputIterator2 map,
+               RandomAccessIterator output)
+{
+  // large scatters of plain data are partitioned by the map values
+  typedef typename thrust::iterator_value<InputIterator1>::type ValueType;
+
+  scatter_detail::scatter(exec, first, last, map, output,
+    typename thrust::system::detail::internal::is_partitionable_permutation<ValueType,InputIterator2,InputIterator1,RandomAccessIterator>::type());
+} // end scatter()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename RandomAccessIterator,
+         typename Predicate>
+  void scatter_if(execution_policy<DerivedPolicy> &exec,
+                  InputIterator1 first,
+                  InputIterator1 last,
+                  InputIterator2 map,
+                  InputIterator3 stencil,
+                  RandomAccessIterator output,
+                  Predicate pred)
+{
+  // large scatters of plain data are partitioned by the map values
+  typedef typename thrust::iterator_value<InputIterator1>::type ValueType;
+
+  scatter_detail::scatter_if(exec, first, last, map, stencil, output, pred,
+    typename thrust::system::detail::internal::is_partitionable_permutation<ValueType,InputIterator2,InputIterator1,RandomAccessIterator,InputIterator3>::type());
+} // end scatter_if()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/omp/detail/shuffle.h>
+#include <thrust/system/detail/internal/merge_shuffle.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/copy.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename URBG>
+  void shuffle(execution_policy<DerivedPolicy> &exec,
+               RandomIterator first,
+               RandomIterator last,
+               URBG &&g)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef typename thrust::iterator_difference<RandomIterator>::type IndexType;
+
+  // the permutation depends only on the state of g and the maximum number of threads
+  thrust::system::detail::internal::merge_shuffle_plan<IndexType> plan(last - first, omp_get_max_threads(), g);
+
+  const IndexType num_tiles = plan.num_tiles();
+
+  // every thread shuffles its own tiles
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType tile = 0; tile < num_tiles; ++tile)
+  {
+    plan.shuffle_tile(first, tile);
+  }
+
+  // the number of elements of the left run of a merge that each tile receives
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> temp_counts(exec, num_tiles);
+  IndexType *left_counts = thrust::raw_pointer_cast(temp_counts.data());
+
+  // merge runs of shuffled tiles pairwise until a single run is left
+  for(IndexType width = 1; width < num_tiles; width *= 2)
+  {
+    const IndexType num_merges = plan.num_merges(width);
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for(IndexType merge = 0; merge < num_merges; ++merge)
+    {
+      plan.split_merge(width, merge, left_counts);
+    }
+
+    // every merge is spread across the tiles it covers
+    THRUST_PRAGMA_OMP(parallel for)
+    for(IndexType tile = 0; tile < num_tiles; ++tile)
+    {
+      plan.exchange(first, width, tile, left_counts);
+    }
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for(IndexType tile = 0; tile < num_tiles; ++tile)
+    {
+      plan.merge_tile(first, width, tile, left_counts);
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end shuffle()
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+  void shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &&g)
+{
+  // shuffle the copy in place rather than compacting a bijection over the next power of two
+  OutputIterator result_last = thrust::copy(exec, first, last, result);
+
+  thrust::system::omp::detail::shuffle(exec, result, result_last, g);
+} // end shuffle_copy()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,122 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/tbb/detail/batched_copy.h>
+#include <thrust/system/detail/internal/batched_copy.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <cstddef>
+#include <thread>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace batched_copy_detail
+{
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size>
+  struct body
+{
+  RandomAccessIterator1 src_ptrs;
+  RandomAccessIterator2 dst_ptrs;
+  const std::ptrdiff_t *offsets;
+  Size num_buffers;
+  thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> decomp;
+
+  body(RandomAccessIterator1 src_ptrs,
+       RandomAccessIterator2 dst_ptrs,
+       const std::ptrdiff_t *offsets,
+       Size num_buffers,
+       thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> decomp)
+    : src_ptrs(src_ptrs), dst_ptrs(dst_ptrs), offsets(offsets), num_buffers(num_buffers), decomp(decomp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<std::ptrdiff_t> &r) const
+  {
+    for(std::ptrdiff_t tile = r.begin(); tile != r.end(); ++tile)
+    {
+      thrust::system::detail::internal::batched_copy_range(src_ptrs, dst_ptrs, offsets, num_buffers, decomp[tile].begin(), decomp[tile].end());
+    }
+  }
+}; // end body
+
+
+} // end batched_copy_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename Size>
+  void batched_copy(execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator1 src_ptrs,
+                    RandomAccessIterator2 dst_ptrs,
+                    RandomAccessIterator3 sizes,
+                    Size num_buffers)
+{
+  if(num_buffers <= 0) return;
+
+  // find the position of each buffer within the concatenation of all buffers
+  thrust::detail::temporary_array<std::ptrdiff_t,DerivedPolicy> temp_offsets(0, exec, num_buffers + 1);
+  std::ptrdiff_t *offsets = thrust::raw_pointer_cast(temp_offsets.data());
+
+  offsets[0] = 0;
+  thrust::inclusive_scan(exec,
+                         thrust::make_transform_iterator(sizes, thrust::identity<std::ptrdiff_t>()),
+                         thrust::make_transform_iterator(sizes + num_buffers, thrust::identity<std::ptrdiff_t>()),
+                         offsets + 1);
+
+  // split the elements rather than the buffers evenly among tiles
+  // so that a few large buffers don't serialize the copy
+  const std::ptrdiff_t grain = 1 << 12;
+  const std::ptrdiff_t max_tiles = static_cast<std::ptrdiff_t>(std::thread::hardware_concurrency());
+  thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> decomp(offsets[num_buffers], grain, max_tiles > 0 ? max_tiles : 1);
+
+  ::tbb::parallel_for(::tbb::blocked_range<std::ptrdiff_t>(0, decomp.size(), 1),
+                      batched_copy_detail::body<RandomAccessIterator1,RandomAccessIterator2,Size>(src_ptrs, dst_ptrs, offsets, num_buffers, decomp),
+                      ::tbb::simple_partitioner());
+} // end batched_copy()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -26,10 +26,15 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/tbb/detail/copy.h>
-#include <thrust/system/detail/generic/copy.h>
 #include <thrust/system/detail/sequential/copy.h>
 #include <thrust/detail/type_traits/minimum_type.h>
 #include <thrust/detail/copy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/distance.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -38,6 +43,49 @@ namespace tbb
 {
 namespace detail
 {
+namespace copy_detail
+{
+
+
+template<typename InputIterator, typename OutputIterator, typename Size>
+  struct body
+{
+  InputIterator  m_first;
+  OutputIterator m_result;
+
+  body(InputIterator first, OutputIterator result)
+    : m_first(first), m_result(result)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    // each block is copied sequentially, which lowers to memmove when possible
+    thrust::copy_n(thrust::system::detail::sequential::seq, m_first + r.begin(), r.size(), m_result + r.begin());
+  } // end operator()()
+}; // end body
+
+
+// Copies with a static partition: each worker thread copies one contiguous
+// block, and the same blocks go to the same threads from call to call. When
+// the copy is the first touch of freshly allocated memory, e.g. when a vector
+// is constructed or grows, this places each page on the NUMA node of the
+// thread which processes that part of the range later on.
+template<typename InputIterator, typename Size, typename OutputIterator>
+  OutputIterator copy_n(InputIterator first, Size n, OutputIterator result)
+{
+  if(n <= 0) return result;
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n),
+                      body<InputIterator,OutputIterator,Size>(first, result),
+                      ::tbb::static_partitioner());
+
+  return result + n;
+} // end copy_n()
+
+
+} // end copy_detail
+
+
 namespace dispatch
 {
 
@@ -58,13 +106,13 @@ template<typename DerivedPolicy,
 template<typename DerivedPolicy,
          typename InputIterator,
          typename OutputIterator>
-  OutputIterator copy(execution_policy<DerivedPolicy> &exec,
+  OutputIterator copy(execution_policy<DerivedPolicy> &,
                       InputIterator first,
                       InputIterator last,
                       OutputIterator result,
                       thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy(exec, first, last, result);
+  return copy_detail::copy_n(first, thrust::distance(first, last), result);
 } // end copy()
 
 
@@ -86,13 +134,13 @@ template<typename DerivedPolicy,
          typename InputIterator,
          typename Size,
          typename OutputIterator>
-  OutputIterator copy_n(execution_policy<DerivedPolicy> &exec,
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &,
                         InputIterator first,
                         Size n,
                         OutputIterator result,
                         thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+  return copy_detail::copy_n(first, n, result);
 } // end copy_n()
 
 
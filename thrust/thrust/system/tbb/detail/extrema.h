@@ -26,7 +26,16 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/tbb/detail/execution_policy.h>
-#include <thrust/system/detail/generic/extrema.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/extrema.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <thread>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,14 +45,94 @@ namespace tbb
 namespace detail
 {
 
+namespace extrema_detail
+{
+
+
+template <bool FindMin, bool FindMax, typename ForwardIterator, typename BinaryPredicate, typename IndexType>
+struct body
+{
+  ForwardIterator first;
+  BinaryPredicate comp;
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp;
+  IndexType *results;
+
+  body(ForwardIterator first,
+       BinaryPredicate comp,
+       thrust::system::detail::internal::uniform_decomposition<IndexType> decomp,
+       IndexType *results)
+    : first(first), comp(comp), decomp(decomp), results(results)
+  {}
+
+  void operator()(const ::tbb::blocked_range<IndexType> &r) const
+  {
+    for(IndexType tile = r.begin(); tile != r.end(); ++tile)
+    {
+      const IndexType begin = decomp[tile].begin();
+
+      thrust::pair<IndexType,IndexType> tile_result =
+        thrust::system::detail::internal::extrema<FindMin,FindMax>(first + begin, decomp[tile].size(), comp);
+
+      results[2 * tile]     = begin + tile_result.first;
+      results[2 * tile + 1] = begin + tile_result.second;
+    }
+  }
+}; // end body
+
+
+// returns the positions of the first smallest and the first largest element
+template <bool FindMin, bool FindMax, typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<
+  typename thrust::iterator_difference<ForwardIterator>::type,
+  typename thrust::iterator_difference<ForwardIterator>::type
+>
+  extrema(execution_policy<DerivedPolicy> &exec,
+          ForwardIterator first,
+          ForwardIterator last,
+          BinaryPredicate comp)
+{
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  const IndexType n = last - first;
+
+  // tiles smaller than this aren't worth a task of their own
+  const IndexType grain = 1 << 14;
+
+  const IndexType max_tiles = static_cast<IndexType>(std::thread::hardware_concurrency());
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, grain, max_tiles > 0 ? max_tiles : 1);
+
+  const IndexType num_tiles = decomp.size();
+
+  if(num_tiles <= 1)
+  {
+    return thrust::system::detail::internal::extrema<FindMin,FindMax>(first, n, comp);
+  }
+
+  // the extrema of each tile, relative to first
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> temp_results(0, exec, 2 * num_tiles);
+  IndexType *results = thrust::raw_pointer_cast(temp_results.data());
+
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, num_tiles, 1),
+                      body<FindMin,FindMax,ForwardIterator,BinaryPredicate,IndexType>(first, comp, decomp, results),
+                      ::tbb::simple_partitioner());
+
+  return thrust::system::detail::internal::combine_extrema<FindMin,FindMax>(first, results, num_tiles, comp);
+} // end extrema()
+
+
+} // end extrema_detail
+
+
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 ForwardIterator max_element(execution_policy<DerivedPolicy> &exec,
                             ForwardIterator first,
                             ForwardIterator last,
                             BinaryPredicate comp)
 {
-  // tbb prefers generic::max_element to cpp::max_element
-  return thrust::system::detail::generic::max_element(exec, first, last, comp);
+  if(first == last) return last;
+
+  return first + extrema_detail::extrema<false,true>(exec, first, last, comp).second;
 } // end max_element()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
@@ -52,8 +141,9 @@ ForwardIterator min_element(execution_policy<DerivedPolicy> &exec,
                             ForwardIterator last,
                             BinaryPredicate comp)
 {
-  // tbb prefers generic::min_element to cpp::min_element
-  return thrust::system::detail::generic::min_element(exec, first, last, comp);
+  if(first == last) return last;
+
+  return first + extrema_detail::extrema<true,false>(exec, first, last, comp).first;
 } // end min_element()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
@@ -62,8 +152,14 @@ thrust::pair<ForwardIterator,ForwardIterator> minmax_element(execution_policy<De
                                                              ForwardIterator last,
                                                              BinaryPredicate comp)
 {
-  // tbb prefers generic::minmax_element to cpp::minmax_element
-  return thrust::system::detail::generic::minmax_element(exec, first, last, comp);
+  if(first == last) return thrust::make_pair(last, last);
+
+  thrust::pair<
+    typename thrust::iterator_difference<ForwardIterator>::type,
+    typename thrust::iterator_difference<ForwardIterator>::type
+  > result = extrema_detail::extrema<true,true>(exec, first, last, comp);
+
+  return thrust::make_pair(first + result.first, first + result.second);
 } // end minmax_element()
 
 } // end detail
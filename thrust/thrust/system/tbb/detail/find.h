@@ -25,8 +25,13 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/system/detail/generic/find.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/detail/internal/find_if.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <thread>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -35,15 +40,56 @@ namespace tbb
 {
 namespace detail
 {
+namespace find_detail
+{
+
+template <typename InputIterator, typename Predicate, typename IndexType>
+struct body
+{
+  InputIterator first;
+  Predicate pred;
+  thrust::system::detail::internal::find_if_state<IndexType> &state;
+
+  body(InputIterator first, Predicate pred, thrust::system::detail::internal::find_if_state<IndexType> &state)
+    : first(first), pred(pred), state(state)
+  {}
+
+  void operator()(const ::tbb::blocked_range<int> &r) const
+  {
+    for(int worker = r.begin(); worker != r.end(); ++worker)
+    {
+      state.run(first, pred);
+    }
+  }
+}; // end body
+
+} // end find_detail
 
 template <typename DerivedPolicy, typename InputIterator, typename Predicate>
-InputIterator find_if(execution_policy<DerivedPolicy> &exec,
+InputIterator find_if(execution_policy<DerivedPolicy> &,
                       InputIterator first,
                       InputIterator last,
                       Predicate pred)
 {
-  // tbb prefers generic::find_if to cpp::find_if
-  return thrust::system::detail::generic::find_if(exec, first, last, pred);
+  typedef typename thrust::iterator_difference<InputIterator>::type IndexType;
+
+  thrust::system::detail::internal::find_if_state<IndexType> state(last - first);
+
+  if(state.is_small())
+  {
+    state.run(first, pred);
+  }
+  else
+  {
+    // workers stop claiming blocks once a match before them has been found
+    const int num_workers = static_cast<int>(std::thread::hardware_concurrency());
+
+    ::tbb::parallel_for(::tbb::blocked_range<int>(0, num_workers > 0 ? num_workers : 1, 1),
+                        find_detail::body<InputIterator,Predicate,IndexType>(first, pred, state),
+                        ::tbb::simple_partitioner());
+  }
+
+  return first + state.result();
 }
 
 } // end namespace detail
@@ -14,6 +14,10 @@
  *  limitations under the License.
  */
 
+/*! \file gather.h
+ *  \brief TBB implementation of gather.
+ */
+
 #pragma once
 
 #include <thrust/detail/config.h>
@@ -25,7 +29,32 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+  OutputIterator gather(execution_policy<DerivedPolicy> &exec,
+                        InputIterator map_first,
+                        InputIterator map_last,
+                        RandomAccessIterator input_first,
+                        OutputIterator result);
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
 
-// this system inherits gather
-#include <thrust/system/cpp/detail/gather.h>
+#include <thrust/system/tbb/detail/gather.inl>
 
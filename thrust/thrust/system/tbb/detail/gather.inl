@@ -0,0 +1,221 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/tbb/detail/gather.h>
+#include <thrust/gather.h>
+#include <thrust/system/detail/generic/gather.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/permute.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <thread>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace permute_detail
+{
+
+
+// calls one pass of a partitioned gather or scatter for each tile or bucket
+template<typename Plan, typename Size>
+  struct pass_body
+{
+  typedef void (Plan::*pass_type)(Size) const;
+
+  const Plan &plan;
+  pass_type pass;
+
+  pass_body(const Plan &plan, pass_type pass)
+    : plan(plan), pass(pass)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size i = r.begin(); i != r.end(); ++i)
+    {
+      (plan.*pass)(i);
+    }
+  }
+}; // end pass_body
+
+
+template<typename Plan, typename Size>
+  void run_pass(const Plan &plan, void (Plan::*pass)(Size) const, Size n)
+{
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n, 1), pass_body<Plan,Size>(plan, pass), ::tbb::simple_partitioner());
+} // end run_pass()
+
+
+template<typename MapIterator, typename RandomAccessIterator, typename OutputIterator, typename Size>
+  struct direct_gather_body
+{
+  MapIterator map;
+  RandomAccessIterator input;
+  OutputIterator result;
+  thrust::system::detail::internal::uniform_decomposition<Size> tiles;
+
+  direct_gather_body(MapIterator map, RandomAccessIterator input, OutputIterator result, thrust::system::detail::internal::uniform_decomposition<Size> tiles)
+    : map(map), input(input), result(result), tiles(tiles)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size tile = r.begin(); tile != r.end(); ++tile)
+    {
+      thrust::system::detail::internal::direct_gather(map, input, result, tiles[tile].begin(), tiles[tile].end());
+    }
+  }
+}; // end direct_gather_body
+
+
+// the number of tiles the map of a gather or a scatter is split into
+template<typename Size>
+  Size max_tiles()
+{
+  const Size result = static_cast<Size>(std::thread::hardware_concurrency());
+
+  return result > 0 ? result : 1;
+} // end max_tiles()
+
+
+} // end permute_detail
+
+
+namespace gather_detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+  OutputIterator gather(execution_policy<DerivedPolicy> &exec,
+                        InputIterator map_first,
+                        InputIterator map_last,
+                        RandomAccessIterator input_first,
+                        OutputIterator result,
+                        thrust::detail::false_type) // is_partitionable_permutation
+{
+  // tbb prefers generic::gather to cpp::gather
+  return thrust::system::detail::generic::gather(exec, map_first, map_last, input_first, result);
+} // end gather()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+  OutputIterator gather(execution_policy<DerivedPolicy> &exec,
+                        InputIterator map_first,
+                        InputIterator map_last,
+                        RandomAccessIterator input_first,
+                        OutputIterator result,
+                        thrust::detail::true_type) // is_partitionable_permutation
+{
+  namespace internal = thrust::system::detail::internal;
+
+  typedef typename thrust::iterator_difference<InputIterator>::type  Size;
+  typedef typename thrust::iterator_value<InputIterator>::type       IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type ValueType;
+
+  const Size n = map_last - map_first;
+
+  internal::uniform_decomposition<Size> tiles(n, 1, permute_detail::max_tiles<Size>());
+  const Size num_tiles = tiles.size();
+
+  const std::size_t span = internal::partitioned_permutation_span(map_first, n, sizeof(ValueType));
+
+  if(span != 0)
+  {
+    internal::permutation_buckets buckets(span, sizeof(ValueType));
+    const Size num_buckets = static_cast<Size>(buckets.size());
+
+    typedef internal::permutation_tables<Size> Tables;
+    thrust::detail::temporary_array<Size,DerivedPolicy> table_storage(0, exec, Tables::storage_size(num_tiles, num_buckets));
+    thrust::detail::temporary_array<IndexType,DerivedPolicy> indices(0, exec, n);
+    thrust::detail::temporary_array<ValueType,DerivedPolicy> values(0, exec, n);
+
+    typedef internal::partitioned_gather<InputIterator,RandomAccessIterator,OutputIterator,Size> Plan;
+
+    Plan plan(map_first, input_first, result, tiles, buckets,
+              Tables(thrust::raw_pointer_cast(table_storage.data()), num_tiles, num_buckets),
+              thrust::raw_pointer_cast(indices.data()),
+              thrust::raw_pointer_cast(values.data()));
+
+    permute_detail::run_pass(plan, &Plan::count, num_tiles);
+    plan.scan();
+    permute_detail::run_pass(plan, &Plan::partition, num_tiles);
+    permute_detail::run_pass(plan, &Plan::fetch, num_buckets);
+    permute_detail::run_pass(plan, &Plan::write, num_tiles);
+
+    return result + n;
+  }
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1),
+                      permute_detail::direct_gather_body<InputIterator,RandomAccessIterator,OutputIterator,Size>(map_first, input_first, result, tiles),
+                      ::tbb::simple_partitioner());
+
+  return result + n;
+} // end gather()
+
+
+} // end gather_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+  OutputIterator gather(execution_policy<DerivedPolicy> &exec,
+                        InputIterator map_first,
+                        InputIterator map_last,
+                        RandomAccessIterator input_first,
+                        OutputIterator result)
+{
+  // large gathers of plain data are partitioned by the map values
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type ValueType;
+
+  return gather_detail::gather(exec, map_first, map_last, input_first, result,
+    typename thrust::system::detail::internal::is_partitionable_permutation<ValueType,InputIterator,RandomAccessIterator,OutputIterator>::type());
+} // end gather()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
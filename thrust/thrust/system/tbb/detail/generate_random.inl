@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/tbb/detail/generate_random.h>
+#include <thrust/system/detail/generic/generate_random.h>
+#include <thrust/system/detail/internal/generate_random.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace generate_random_detail
+{
+
+
+template<typename RandomAccessIterator, typename Distribution>
+  struct body
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+
+  RandomAccessIterator first;
+  unsigned long long seed;
+  Distribution dist;
+
+  body(RandomAccessIterator first, unsigned long long seed, const Distribution &dist)
+    : first(first), seed(seed), dist(dist)
+  {}
+
+  void operator()(const ::tbb::blocked_range<IndexType> &r) const
+  {
+    thrust::system::detail::internal::generate_random(first, r.begin(), r.end(), seed, dist);
+  }
+}; // end body
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Distribution>
+  void generate_random(execution_policy<DerivedPolicy> &exec,
+                       ForwardIterator first,
+                       ForwardIterator last,
+                       unsigned long long seed,
+                       const Distribution &dist,
+                       thrust::incrementable_traversal_tag)
+{
+  // elements can't be found in parallel without random access
+  thrust::system::detail::generic::generate_random(exec, first, last, seed, dist);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename Distribution>
+  void generate_random(execution_policy<DerivedPolicy> &,
+                       RandomAccessIterator first,
+                       RandomAccessIterator last,
+                       unsigned long long seed,
+                       const Distribution &dist,
+                       thrust::random_access_traversal_tag)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+
+  // every task computes the Philox blocks of a contiguous range of
+  // elements, many elements at a time
+  const IndexType grain = 1 << 12;
+
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, last - first, grain),
+                      body<RandomAccessIterator,Distribution>(first, seed, dist));
+}
+
+
+} // end generate_random_detail
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Distribution>
+  void generate_random(execution_policy<DerivedPolicy> &exec,
+                       ForwardIterator first,
+                       ForwardIterator last,
+                       unsigned long long seed,
+                       const Distribution &dist)
+{
+  generate_random_detail::generate_random(exec, first, last, seed, dist,
+    typename thrust::iterator_traversal<ForwardIterator>::type());
+} // end generate_random()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
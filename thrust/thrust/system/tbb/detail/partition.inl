@@ -27,6 +27,19 @@
 #endif // no system header
 #include <thrust/system/tbb/detail/partition.h>
 #include <thrust/system/detail/generic/partition.h>
+#include <thrust/system/detail/sequential/partition.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/internal_functional.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/advance.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -35,6 +48,85 @@ namespace tbb
 {
 namespace detail
 {
+namespace partition_detail
+{
+
+
+template<typename ValueType,
+         typename BucketFunction,
+         typename IndexType>
+  struct count_body
+{
+  const ValueType *src;
+  thrust::detail::wrapped_function<BucketFunction,IndexType> bucket_op;
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp;
+  IndexType *counts;
+  IndexType row_size;
+
+  count_body(const ValueType *src,
+             BucketFunction bucket_op,
+             thrust::system::detail::internal::uniform_decomposition<IndexType> decomp,
+             IndexType *counts,
+             IndexType row_size)
+    : src(src), bucket_op(bucket_op), decomp(decomp), counts(counts), row_size(row_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<IndexType> &r) const
+  {
+    for(IndexType tile = r.begin(); tile != r.end(); ++tile)
+    {
+      IndexType *tile_counts = counts + tile * row_size;
+
+      for(IndexType i = decomp[tile].begin(); i < decomp[tile].end(); ++i)
+      {
+        ++tile_counts[bucket_op(src[i])];
+      }
+    }
+  }
+}; // end count_body
+
+
+template<typename ValueType,
+         typename RandomAccessIterator,
+         typename BucketFunction,
+         typename IndexType>
+  struct scatter_body
+{
+  const ValueType *src;
+  RandomAccessIterator result;
+  thrust::detail::wrapped_function<BucketFunction,IndexType> bucket_op;
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp;
+  IndexType *cursors;
+  IndexType row_size;
+
+  scatter_body(const ValueType *src,
+               RandomAccessIterator result,
+               BucketFunction bucket_op,
+               thrust::system::detail::internal::uniform_decomposition<IndexType> decomp,
+               IndexType *cursors,
+               IndexType row_size)
+    : src(src), result(result), bucket_op(bucket_op), decomp(decomp), cursors(cursors), row_size(row_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<IndexType> &r) const
+  {
+    for(IndexType tile = r.begin(); tile != r.end(); ++tile)
+    {
+      IndexType *tile_cursors = cursors + tile * row_size;
+
+      for(IndexType i = decomp[tile].begin(); i < decomp[tile].end(); ++i)
+      {
+        IndexType &cursor = tile_cursors[bucket_op(src[i])];
+        result[cursor] = src[i];
+        ++cursor;
+      }
+    }
+  }
+}; // end scatter_body
+
+
+} // end partition_detail
+
 
 
 template<typename DerivedPolicy,
@@ -102,6 +194,150 @@ template<typename DerivedPolicy,
 } // end stable_partition_copy()
 
 
+namespace dispatch
+{
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator bucket_partition(execution_policy<DerivedPolicy> &exec,
+                                  ForwardIterator first,
+                                  ForwardIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets,
+                                  thrust::incrementable_traversal_tag)
+{
+  return thrust::system::detail::sequential::bucket_partition(exec, first, last, bucket_op, num_buckets, offsets);
+} // end bucket_partition()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator bucket_partition(execution_policy<DerivedPolicy> &exec,
+                                  RandomAccessIterator first,
+                                  RandomAccessIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets,
+                                  thrust::random_access_traversal_tag)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+
+  const IndexType n = thrust::distance(first, last);
+  const IndexType buckets = static_cast<IndexType>(num_buckets);
+
+  // decompose the input into a fixed number of tiles, one per thread of the current arena
+  const IndexType p = thrust::max<IndexType>(1, static_cast<IndexType>(::tbb::this_task_arena::max_concurrency()));
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, 1, p);
+  const IndexType num_tiles = decomp.size();
+
+  // scatter from a copy of the input so that the result may overwrite it
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> temp(exec, first, last);
+  const ValueType *src = thrust::raw_pointer_cast(temp.data());
+
+  // every tile owns a row of bucket counters padded to a whole number
+  // of cache lines, so that counting does not cause false sharing
+  const IndexType counters_per_line = static_cast<IndexType>(64 / sizeof(IndexType));
+  const IndexType row_size = (buckets + counters_per_line - 1) / counters_per_line * counters_per_line;
+
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> temp_counts(0, exec, num_tiles * row_size);
+  IndexType *counts = thrust::raw_pointer_cast(temp_counts.data());
+
+  for(IndexType i = 0; i < num_tiles * row_size; ++i)
+  {
+    counts[i] = 0;
+  }
+
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, num_tiles, 1),
+                      partition_detail::count_body<ValueType,BucketFunction,IndexType>(src, bucket_op, decomp, counts, row_size),
+                      ::tbb::simple_partitioner());
+
+  // turn the counts into the position at which each tile begins writing each bucket,
+  // ordering buckets first and tiles second so that the result is stable
+  IndexType sum = 0;
+
+  for(IndexType b = 0; b < buckets; ++b)
+  {
+    *offsets = sum;
+    ++offsets;
+
+    for(IndexType tile = 0; tile < num_tiles; ++tile)
+    {
+      IndexType count = counts[tile * row_size + b];
+      counts[tile * row_size + b] = sum;
+      sum += count;
+    }
+  }
+
+  *offsets = sum;
+  ++offsets;
+
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, num_tiles, 1),
+                      partition_detail::scatter_body<ValueType,RandomAccessIterator,BucketFunction,IndexType>(src, first, bucket_op, decomp, counts, row_size),
+                      ::tbb::simple_partitioner());
+
+  return offsets;
+} // end bucket_partition()
+
+
+} // end dispatch
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BucketFunction,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator bucket_partition(execution_policy<DerivedPolicy> &exec,
+                                  ForwardIterator first,
+                                  ForwardIterator last,
+                                  BucketFunction bucket_op,
+                                  Size num_buckets,
+                                  OutputIterator offsets)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
+
+  // the parallel scatter writes its result at random positions
+  return thrust::system::tbb::detail::dispatch::bucket_partition(exec, first, last, bucket_op, num_buckets, offsets, traversal());
+} // end bucket_partition()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Predicate1,
+         typename Predicate2>
+  thrust::pair<ForwardIterator,ForwardIterator>
+    partition3(execution_policy<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last,
+               Predicate1 pred1,
+               Predicate2 pred2)
+{
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  IndexType offsets[4];
+
+  // a single bucketing pass replaces the two passes of consecutive stable partitions
+  thrust::system::tbb::detail::bucket_partition(
+    exec,
+    first,
+    last,
+    thrust::detail::partition3_bucket<Predicate1,Predicate2,IndexType>(pred1, pred2),
+    IndexType(3),
+    offsets);
+
+  return thrust::make_pair(thrust::next(first, offsets[1]), thrust::next(first, offsets[2]));
+} // end partition3()
+
+
 } // end namespace detail
 } // end namespace tbb
 } // end namespace system
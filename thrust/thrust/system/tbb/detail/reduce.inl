@@ -31,6 +31,7 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
 #include <thrust/reduce.h>
+#include <thrust/system/detail/internal/simd.h>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_reduce.h>
 
@@ -52,7 +53,7 @@ struct body
   RandomAccessIterator first;
   OutputType sum;
   bool first_call;  // TBB can invoke operator() multiple times on the same body
-  thrust::detail::wrapped_function<BinaryFunction,OutputType> binary_op;
+  BinaryFunction binary_op;
 
   // note: we only initalize sum with init to avoid calling OutputType's default constructor
   body(RandomAccessIterator first, OutputType init, BinaryFunction binary_op)
@@ -71,14 +72,15 @@ struct body
 
     if (r.empty()) return; // nothing to do
 
+    thrust::detail::wrapped_function<BinaryFunction,OutputType> wrapped_binary_op(binary_op);
+
     RandomAccessIterator iter = first + r.begin();
 
     OutputType temp = thrust::raw_reference_cast(*iter);
 
     ++iter;
 
-    for (Size i = r.begin() + 1; i != r.end(); ++i, ++iter)
-      temp = binary_op(temp, *iter);
+    temp = thrust::system::detail::internal::reduce_range(iter, Size(r.size() - 1), temp, binary_op);
 
 
     if (first_call)
@@ -90,13 +92,15 @@ struct body
     else
     {
       // body has been previously invoked, accumulate temp into sum
-      sum = binary_op(sum, temp);
+      sum = wrapped_binary_op(sum, temp);
     }
   } // end operator()()
 
   void join(body& b)
   {
-    sum = binary_op(sum, b.sum);
+    thrust::detail::wrapped_function<BinaryFunction,OutputType> wrapped_binary_op(binary_op);
+
+    sum = wrapped_binary_op(sum, b.sum);
   }
 }; // end body
 
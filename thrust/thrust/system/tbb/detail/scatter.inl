@@ -0,0 +1,253 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/tbb/detail/scatter.h>
+#include <thrust/system/tbb/detail/gather.h>
+#include <thrust/scatter.h>
+#include <thrust/system/detail/generic/scatter.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/permute.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace scatter_detail
+{
+
+
+template<typename InputIterator1, typename InputIterator2, typename InputIterator3, typename RandomAccessIterator, typename Predicate, typename Size>
+  struct direct_scatter_if_body
+{
+  InputIterator1 first;
+  InputIterator2 map;
+  InputIterator3 stencil;
+  RandomAccessIterator output;
+  Predicate pred;
+  thrust::system::detail::internal::uniform_decomposition<Size> tiles;
+
+  direct_scatter_if_body(InputIterator1 first, InputIterator2 map, InputIterator3 stencil, RandomAccessIterator output, Predicate pred, thrust::system::detail::internal::uniform_decomposition<Size> tiles)
+    : first(first), map(map), stencil(stencil), output(output), pred(pred), tiles(tiles)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size tile = r.begin(); tile != r.end(); ++tile)
+    {
+      thrust::system::detail::internal::direct_scatter_if(first, map, stencil, output, pred, tiles[tile].begin(), tiles[tile].end());
+    }
+  }
+}; // end direct_scatter_if_body
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename RandomAccessIterator,
+         typename Predicate>
+  void scatter_if(execution_policy<DerivedPolicy> &exec,
+                  InputIterator1 first,
+                  InputIterator1 last,
+                  InputIterator2 map,
+                  InputIterator3 stencil,
+                  RandomAccessIterator output,
+                  Predicate pred)
+{
+  namespace internal = thrust::system::detail::internal;
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+  typedef typename thrust::iterator_value<InputIterator2>::type      IndexType;
+  typedef typename thrust::iterator_value<InputIterator1>::type      ValueType;
+
+  const Size n = last - first;
+
+  internal::uniform_decomposition<Size> tiles(n, 1, permute_detail::max_tiles<Size>());
+  const Size num_tiles = tiles.size();
+
+  const std::size_t span = internal::partitioned_permutation_span(map, n, sizeof(ValueType));
+
+  if(span != 0)
+  {
+    internal::permutation_buckets buckets(span, sizeof(ValueType));
+    const Size num_buckets = static_cast<Size>(buckets.size());
+
+    typedef internal::permutation_tables<Size> Tables;
+    thrust::detail::temporary_array<Size,DerivedPolicy> table_storage(0, exec, Tables::storage_size(num_tiles, num_buckets));
+    thrust::detail::temporary_array<IndexType,DerivedPolicy> indices(0, exec, n);
+    thrust::detail::temporary_array<ValueType,DerivedPolicy> values(0, exec, n);
+
+    typedef internal::partitioned_scatter_if<InputIterator1,InputIterator2,InputIterator3,RandomAccessIterator,Predicate,Size> Plan;
+
+    Plan plan(first, map, stencil, output, pred, tiles, buckets,
+              Tables(thrust::raw_pointer_cast(table_storage.data()), num_tiles, num_buckets),
+              thrust::raw_pointer_cast(indices.data()),
+              thrust::raw_pointer_cast(values.data()));
+
+    permute_detail::run_pass(plan, &Plan::count, num_tiles);
+    plan.scan();
+    permute_detail::run_pass(plan, &Plan::partition, num_tiles);
+    permute_detail::run_pass(plan, &Plan::write, num_buckets);
+
+    return;
+  }
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1),
+                      direct_scatter_if_body<InputIterator1,InputIterator2,InputIterator3,RandomAccessIterator,Predicate,Size>(first, map, stencil, output, pred, tiles),
+                      ::tbb::simple_partitioner());
+} // end scatter_if()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename RandomAccessIterator>
+  void scatter(execution_policy<DerivedPolicy> &exec,
+               InputIterator1 first,
+               InputIterator1 last,
+               InputIterator2 map,
+               RandomAccessIterator output,
+               thrust::detail::false_type) // is_partitionable_permutation
+{
+  // tbb prefers generic::scatter to cpp::scatter
+  thrust::system::detail::generic::scatter(exec, first, last, map, output);
+} // end scatter()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename RandomAccessIterator>
+  void scatter(execution_policy<DerivedPolicy> &exec,
+               InputIterator1 first,
+               InputIterator1 last,
+               InputIterator2 map,
+               RandomAccessIterator output,
+               thrust::detail::true_type) // is_partitionable_permutation
+{
+  // select every element
+  scatter_detail::scatter_if(exec, first, last, map, thrust::make_constant_iterator(true), output, thrust::identity<bool>());
+} // end scatter()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename RandomAccessIterator,
+         typename Predicate>
+  void scatter_if(execution_policy<DerivedPolicy> &exec,
+                  InputIterator1 first,
+                  InputIterator1 last,
+                  InputIterator2 map,
+                  InputIterator3 stencil,
+                  RandomAccessIterator output,
+                  Predicate pred,
+                  thrust::detail::false_type) // is_partitionable_permutation
+{
+  // tbb prefers generic::scatter_if to cpp::scatter_if
+  thrust::system::detail::generic::scatter_if(exec, first, last, map, stencil, output, pred);
+} // end scatter_if()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename RandomAccessIterator,
+         typename Predicate>
+  void scatter_if(execution_policy<DerivedPolicy> &exec,
+                  InputIterator1 first,
+                  InputIterator1 last,
+                  InputIterator2 map,
+                  InputIterator3 stencil,
+                  RandomAccessIterator output,
+                  Predicate pred,
+                  thrust::detail::true_type) // is_partitionable_permutation
+{
+  scatter_detail::scatter_if(exec, first, last, map, stencil, output, pred);
+} // end scatter_if()
+
+
+} // end scatter_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename RandomAccessIterator>
+  void scatter(execution_policy<DerivedPolicy> &exec,
+               InputIterator1 first,
+               InputIterator1 last,
+               InputIterator2 map,
+               RandomAccessIterator output)
+{
+  // large scatters of plain data are partitioned by the map values
+  typedef typename thrust::iterator_value<InputIterator1>::type ValueType;
+
+  scatter_detail::scatter(exec, first, last, map, output,
+    typename thrust::system::detail::internal::is_partitionable_permutation<ValueType,InputIterator2,InputIterator1,RandomAccessIterator>::type());
+} // end scatter()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename RandomAccessIterator,
+         typename Predicate>
+  void scatter_if(execution_policy<DerivedPolicy> &exec,
+                  InputIterator1 first,
+                  InputIterator1 last,
+                  InputIterator2 map,
+                  InputIterator3 stencil,
+                  RandomAccessIterator output,
+                  Predicate pred)
+{
+  // large scatters of plain data are partitioned by the map values
+  typedef typename thrust::iterator_value<InputIterator1>::type ValueType;
+
+  scatter_detail::scatter_if(exec, first, last, map, stencil, output, pred,
+    typename thrust::system::detail::internal::is_partitionable_permutation<ValueType,InputIterator2,InputIterator1,RandomAccessIterator,InputIterator3>::type());
+} // end scatter_if()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
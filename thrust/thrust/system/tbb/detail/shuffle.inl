@@ -0,0 +1,204 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/tbb/detail/shuffle.h>
+#include <thrust/system/detail/internal/merge_shuffle.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/copy.h>
+#include <thrust/detail/minmax.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace shuffle_detail
+{
+
+
+template<typename RandomIterator, typename IndexType>
+  struct shuffle_tiles_body
+{
+  RandomIterator first;
+  const thrust::system::detail::internal::merge_shuffle_plan<IndexType> &plan;
+
+  shuffle_tiles_body(RandomIterator first, const thrust::system::detail::internal::merge_shuffle_plan<IndexType> &plan)
+    : first(first), plan(plan)
+  {}
+
+  void operator()(const ::tbb::blocked_range<IndexType> &r) const
+  {
+    for(IndexType tile = r.begin(); tile != r.end(); ++tile)
+    {
+      plan.shuffle_tile(first, tile);
+    }
+  }
+}; // end shuffle_tiles_body
+
+
+template<typename IndexType>
+  struct split_merges_body
+{
+  const thrust::system::detail::internal::merge_shuffle_plan<IndexType> &plan;
+  IndexType width;
+  IndexType *left_counts;
+
+  split_merges_body(const thrust::system::detail::internal::merge_shuffle_plan<IndexType> &plan, IndexType width, IndexType *left_counts)
+    : plan(plan), width(width), left_counts(left_counts)
+  {}
+
+  void operator()(const ::tbb::blocked_range<IndexType> &r) const
+  {
+    for(IndexType merge = r.begin(); merge != r.end(); ++merge)
+    {
+      plan.split_merge(width, merge, left_counts);
+    }
+  }
+}; // end split_merges_body
+
+
+template<typename RandomIterator, typename IndexType>
+  struct exchange_body
+{
+  RandomIterator first;
+  const thrust::system::detail::internal::merge_shuffle_plan<IndexType> &plan;
+  IndexType width;
+  const IndexType *left_counts;
+
+  exchange_body(RandomIterator first, const thrust::system::detail::internal::merge_shuffle_plan<IndexType> &plan, IndexType width, const IndexType *left_counts)
+    : first(first), plan(plan), width(width), left_counts(left_counts)
+  {}
+
+  void operator()(const ::tbb::blocked_range<IndexType> &r) const
+  {
+    for(IndexType tile = r.begin(); tile != r.end(); ++tile)
+    {
+      plan.exchange(first, width, tile, left_counts);
+    }
+  }
+}; // end exchange_body
+
+
+template<typename RandomIterator, typename IndexType>
+  struct merge_tiles_body
+{
+  RandomIterator first;
+  const thrust::system::detail::internal::merge_shuffle_plan<IndexType> &plan;
+  IndexType width;
+  const IndexType *left_counts;
+
+  merge_tiles_body(RandomIterator first, const thrust::system::detail::internal::merge_shuffle_plan<IndexType> &plan, IndexType width, const IndexType *left_counts)
+    : first(first), plan(plan), width(width), left_counts(left_counts)
+  {}
+
+  void operator()(const ::tbb::blocked_range<IndexType> &r) const
+  {
+    for(IndexType tile = r.begin(); tile != r.end(); ++tile)
+    {
+      plan.merge_tile(first, width, tile, left_counts);
+    }
+  }
+}; // end merge_tiles_body
+
+
+} // end shuffle_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename URBG>
+  void shuffle(execution_policy<DerivedPolicy> &exec,
+               RandomIterator first,
+               RandomIterator last,
+               URBG &&g)
+{
+  typedef typename thrust::iterator_difference<RandomIterator>::type IndexType;
+
+  // the permutation depends only on the state of g and the number of threads
+  // of the task arena
+  const IndexType p = thrust::max<IndexType>(1, static_cast<IndexType>(::tbb::this_task_arena::max_concurrency()));
+  thrust::system::detail::internal::merge_shuffle_plan<IndexType> plan(last - first, p, g);
+
+  const IndexType num_tiles = plan.num_tiles();
+
+  // shuffle every tile independently
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, num_tiles, 1),
+                      shuffle_detail::shuffle_tiles_body<RandomIterator,IndexType>(first, plan),
+                      ::tbb::simple_partitioner());
+
+  // the number of elements of the left run of a merge that each tile receives
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> temp_counts(exec, num_tiles);
+  IndexType *left_counts = thrust::raw_pointer_cast(temp_counts.data());
+
+  // merge runs of shuffled tiles pairwise until a single run is left,
+  // spreading every merge across the tiles it covers
+  for(IndexType width = 1; width < num_tiles; width *= 2)
+  {
+    ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, plan.num_merges(width), 1),
+                        shuffle_detail::split_merges_body<IndexType>(plan, width, left_counts),
+                        ::tbb::simple_partitioner());
+
+    ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, num_tiles, 1),
+                        shuffle_detail::exchange_body<RandomIterator,IndexType>(first, plan, width, left_counts),
+                        ::tbb::simple_partitioner());
+
+    ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, num_tiles, 1),
+                        shuffle_detail::merge_tiles_body<RandomIterator,IndexType>(first, plan, width, left_counts),
+                        ::tbb::simple_partitioner());
+  }
+} // end shuffle()
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+  void shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &&g)
+{
+  // shuffle the copy in place rather than compacting a bijection over the next power of two
+  OutputIterator result_last = thrust::copy(exec, first, last, result);
+
+  thrust::system::tbb::detail::shuffle(exec, result, result_last, g);
+} // end shuffle_copy()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -25,7 +25,39 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/tbb/detail/execution_policy.h>
 
-// this system inherits uninitialized_fill
-#include <thrust/system/cpp/detail/uninitialized_fill.h>
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
 
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename T>
+void uninitialized_fill(execution_policy<DerivedPolicy> &exec,
+                        ForwardIterator first,
+                        ForwardIterator last,
+                        const T &x);
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Size,
+         typename T>
+ForwardIterator uninitialized_fill_n(execution_policy<DerivedPolicy> &exec,
+                                     ForwardIterator first,
+                                     Size n,
+                                     const T &x);
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/tbb/detail/uninitialized_fill.inl>
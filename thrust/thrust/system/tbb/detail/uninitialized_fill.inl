@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/tbb/detail/uninitialized_fill.h>
+#include <thrust/system/detail/generic/uninitialized_fill.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/uninitialized_fill.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/distance.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace uninitialized_fill_detail
+{
+
+
+template<typename RandomAccessIterator, typename T, typename Size>
+  struct body
+{
+  RandomAccessIterator m_first;
+  const T &m_x;
+
+  body(RandomAccessIterator first, const T &x)
+    : m_first(first), m_x(x)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    thrust::uninitialized_fill_n(thrust::system::detail::sequential::seq, m_first + r.begin(), r.size(), m_x);
+  } // end operator()()
+}; // end body
+
+
+} // end uninitialized_fill_detail
+
+
+namespace dispatch
+{
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Size,
+         typename T>
+  ForwardIterator uninitialized_fill_n(execution_policy<DerivedPolicy> &exec,
+                                       ForwardIterator first,
+                                       Size n,
+                                       const T &x,
+                                       thrust::incrementable_traversal_tag)
+{
+  return thrust::system::detail::generic::uninitialized_fill_n(exec, first, n, x);
+} // end uninitialized_fill_n()
+
+
+// Uninitialized storage is usually freshly allocated, so this fill is the
+// first touch of its pages. A static partition gives each worker thread one
+// contiguous block, the same from call to call, so that the pages land on the
+// NUMA node of the thread which processes that part of the range later on.
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename Size,
+         typename T>
+  RandomAccessIterator uninitialized_fill_n(execution_policy<DerivedPolicy> &,
+                                            RandomAccessIterator first,
+                                            Size n,
+                                            const T &x,
+                                            thrust::random_access_traversal_tag)
+{
+  if(n <= 0) return first;
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n),
+                      uninitialized_fill_detail::body<RandomAccessIterator,T,Size>(first, x),
+                      ::tbb::static_partitioner());
+
+  return first + n;
+} // end uninitialized_fill_n()
+
+
+} // end dispatch
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename T>
+void uninitialized_fill(execution_policy<DerivedPolicy> &exec,
+                        ForwardIterator first,
+                        ForwardIterator last,
+                        const T &x)
+{
+  tbb::detail::uninitialized_fill_n(exec, first, thrust::distance(first, last), x);
+} // end uninitialized_fill()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Size,
+         typename T>
+ForwardIterator uninitialized_fill_n(execution_policy<DerivedPolicy> &exec,
+                                     ForwardIterator first,
+                                     Size n,
+                                     const T &x)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
+
+  return thrust::system::tbb::detail::dispatch::uninitialized_fill_n(exec, first, n, x, traversal());
+} // end uninitialized_fill_n()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
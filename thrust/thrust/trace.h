@@ -0,0 +1,410 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/trace.h
+ *  \brief Instrumentation of Thrust algorithms and their temporary storage.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The installed callback is shared by every translation unit, whether it
+// defines THRUST_TRACE or not, so it is declared outside of the inline
+// namespace of the traced build; see thrust/detail/config/namespace.h.
+THRUST_NS_PREFIX
+namespace thrust
+{
+THRUST_DETAIL_ABI_NS_BEGIN
+
+/*! \addtogroup utility
+ *  \{
+ */
+
+/*! \addtogroup tracing Tracing
+ *  \ingroup utility
+ *  \{
+ */
+
+/*! \namespace thrust::trace
+ *  \brief \p thrust::trace contains the hooks through which an application
+ *         can observe the Thrust algorithms it runs.
+ *
+ *  Tracing is opt-in at compile time: only translation units compiled with
+ *  \c THRUST_TRACE defined report events. Without it, the instrumentation
+ *  compiles to nothing. With it, an algorithm costs a relaxed atomic load
+ *  while no callback is installed.
+ *
+ *  Every translation unit of a program should agree on \c THRUST_TRACE, so
+ *  define it for the whole project, e.g. with
+ *  <tt>target_compile_definitions(app PRIVATE THRUST_TRACE)</tt>, rather
+ *  than in some source files. With \c THRUST_TRACE, Thrust is declared in
+ *  the distinct inline namespace \c thrust::traced, so the instrumented and
+ *  plain definitions of an algorithm are never merged at link time. Thrust
+ *  types therefore differ between the two builds, too: a function which
+ *  takes a \p thrust::host_vector and is defined in a traced translation
+ *  unit fails to link when called from a plain one. The callback set by
+ *  \p set_callback is shared by both.
+ *
+ *  When tracing is enabled, every algorithm reports its entry and exit,
+ *  including the algorithms a backend runs internally, which appear nested
+ *  inside the algorithm which called them. Every temporary allocation and
+ *  deallocation made through Thrust's temporary storage is reported too.
+ *  Only host code is traced.
+ *
+ *  The following code snippet demonstrates how to record a trace of a call
+ *  to \p reduce_by_key and write it in a format which \c chrome://tracing
+ *  and Perfetto can display.
+ *
+ *  \code
+ *  #define THRUST_TRACE
+ *  #include <thrust/trace.h>
+ *  #include <thrust/reduce.h>
+ *  #include <fstream>
+ *  ...
+ *  thrust::trace::chrome_trace_recorder recorder;
+ *
+ *  thrust::reduce_by_key(thrust::host, keys.begin(), keys.end(), values.begin(),
+ *                        keys_output.begin(), values_output.begin());
+ *
+ *  std::ofstream file("reduce_by_key.json");
+ *  recorder.write(file);
+ *  \endcode
+ */
+namespace trace
+{
+
+/*! \p event_kind enumerates the events reported to a trace callback.
+ */
+enum class event_kind
+{
+  algorithm_begin,        //!< an algorithm was entered
+  algorithm_end,          //!< an algorithm returned
+  temporary_allocation,   //!< temporary storage was allocated
+  temporary_deallocation  //!< temporary storage was deallocated
+};
+
+/*! \p event describes an event reported to a trace callback.
+ */
+struct event
+{
+  /*! The kind of event.
+   */
+  event_kind kind;
+
+  /*! The name of the algorithm, e.g. \c "reduce_by_key". For temporary
+   *  storage events, the innermost algorithm running on the calling thread,
+   *  or \c nullptr if there is none.
+   */
+  const char *algorithm;
+
+  /*! The system the event happened on: \c "cpp", \c "omp", \c "tbb",
+   *  \c "cuda", \c "seq", or \c "unknown" for user-defined systems.
+   */
+  const char *backend;
+
+  /*! The number of elements of the algorithm's input, or \c -1 if it cannot
+   *  be computed in constant time. Zero for temporary storage events.
+   */
+  std::ptrdiff_t n;
+
+  /*! The size in bytes of the temporary storage. Zero for algorithm events.
+   */
+  std::size_t bytes;
+
+  /*! The number of traced algorithms running on the calling thread, not
+   *  counting the algorithm this event is about.
+   */
+  std::size_t depth;
+
+  /*! The time of the event.
+   */
+  std::chrono::steady_clock::time_point time;
+
+  /*! For \p algorithm_end events, the wall time the algorithm took. Zero
+   *  otherwise.
+   */
+  std::chrono::steady_clock::duration duration;
+};
+
+/*! The type of a trace callback. It may be invoked concurrently from every
+ *  thread which runs Thrust algorithms.
+ */
+using callback = void (*)(const event &e, void *user_data);
+
+namespace detail
+{
+
+struct callback_binding
+{
+  thrust::trace::callback cb;
+  void                   *user_data;
+};
+
+// The installed callback and its user data are only read and replaced
+// together, under the mutex, so that no thread ever sees the callback of
+// one binding with the user data of another. The callback itself is invoked
+// outside of the mutex.
+struct callback_state
+{
+  std::mutex       mutex;
+  callback_binding binding{nullptr, nullptr};
+
+  // a copy of binding.cb, which algorithms check without taking the mutex
+  std::atomic<thrust::trace::callback> installed{nullptr};
+};
+
+inline callback_state &callback_storage()
+{
+  static callback_state result;
+  return result;
+}
+
+// installs a binding and returns the previous one, as a single step
+inline callback_binding exchange_binding(callback_binding binding)
+{
+  callback_state &state = callback_storage();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  const callback_binding previous = state.binding;
+  state.binding = binding;
+  state.installed.store(binding.cb, std::memory_order_relaxed);
+
+  return previous;
+}
+
+inline callback_binding load_binding()
+{
+  callback_state &state = callback_storage();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  return state.binding;
+}
+
+struct algorithm_frame
+{
+  const char *algorithm;
+  const char *backend;
+};
+
+// the traced algorithms running on this thread, innermost last
+inline std::vector<algorithm_frame> &algorithm_stack()
+{
+  thread_local std::vector<algorithm_frame> result;
+  return result;
+}
+
+} // end detail
+
+/*! \p set_callback installs the function which receives trace events,
+ *  replacing the previous one. Passing \c nullptr disables tracing.
+ *
+ *  \param cb The callback.
+ *  \param user_data A pointer passed to every invocation of \p cb.
+ *  \return The previous callback.
+ *
+ *  \note The callback and its user data are replaced together, so every
+ *        event is delivered to a callback along with its own user data.
+ *        An event which another thread is reporting at the time of the
+ *        change may still reach the previous callback, so the callback
+ *        should not be changed while algorithms are running on other
+ *        threads.
+ */
+inline callback set_callback(callback cb, void *user_data = nullptr)
+{
+  return thrust::trace::detail::exchange_binding(thrust::trace::detail::callback_binding{cb, user_data}).cb;
+}
+
+/*! \p get_callback returns the installed trace callback, or \c nullptr.
+ */
+inline callback get_callback()
+{
+  return thrust::trace::detail::callback_storage().installed.load(std::memory_order_relaxed);
+}
+
+/*! \p get_user_data returns the user data installed along with the trace
+ *  callback.
+ */
+inline void *get_user_data()
+{
+  return thrust::trace::detail::load_binding().user_data;
+}
+
+/*! \p chrome_trace_recorder records trace events for as long as it is alive,
+ *  and writes them in the Trace Event Format read by \c chrome://tracing and
+ *  Perfetto.
+ *
+ *  Algorithms become complete events on the track of the thread which ran
+ *  them. Temporary allocations become instant events, and a counter tracks
+ *  the live temporary storage of each system.
+ *
+ *  The recorder installs itself as the trace callback on construction and
+ *  restores the previous callback and its user data on destruction.
+ */
+class chrome_trace_recorder
+{
+  public:
+    /*! Starts recording.
+     */
+    chrome_trace_recorder()
+      : m_origin(std::chrono::steady_clock::now())
+    {
+      m_previous = thrust::trace::detail::exchange_binding(
+        thrust::trace::detail::callback_binding{&chrome_trace_recorder::record, this});
+    }
+
+    /*! Stops recording.
+     */
+    ~chrome_trace_recorder()
+    {
+      thrust::trace::detail::exchange_binding(m_previous);
+    }
+
+    chrome_trace_recorder(const chrome_trace_recorder &) = delete;
+    chrome_trace_recorder &operator=(const chrome_trace_recorder &) = delete;
+
+    /*! Returns the number of events recorded so far.
+     */
+    std::size_t size() const
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_events.size();
+    }
+
+    /*! Discards the events recorded so far.
+     */
+    void clear()
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_events.clear();
+    }
+
+    /*! Writes the events recorded so far as a JSON trace.
+     *
+     *  \param os The stream to write to.
+     */
+    void write(std::ostream &os) const
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+      std::map<std::string, long long> live_bytes;
+      bool first = true;
+
+      for(const recorded_event &r : m_events)
+      {
+        const event &e = r.e;
+
+        if(e.kind == event_kind::algorithm_begin)
+        {
+          continue;
+        }
+
+        os << (first ? "\n" : ",\n");
+        first = false;
+
+        os << "{\"pid\":0,\"tid\":" << r.thread;
+
+        if(e.kind == event_kind::algorithm_end)
+        {
+          os << ",\"ph\":\"X\",\"name\":\"" << e.algorithm << "\",\"cat\":\"" << e.backend << '"'
+             << ",\"ts\":" << microseconds(e.time - e.duration - m_origin)
+             << ",\"dur\":" << microseconds(e.duration)
+             << ",\"args\":{\"n\":" << e.n << ",\"depth\":" << e.depth << "}}";
+        }
+        else
+        {
+          const bool allocation = e.kind == event_kind::temporary_allocation;
+          long long &live       = live_bytes[e.backend];
+          live += allocation ? static_cast<long long>(e.bytes) : -static_cast<long long>(e.bytes);
+
+          const double ts = microseconds(e.time - m_origin);
+
+          os << ",\"ph\":\"i\",\"s\":\"t\",\"name\":\""
+             << (allocation ? "temporary_allocation" : "temporary_deallocation")
+             << "\",\"cat\":\"" << e.backend << "\",\"ts\":" << ts
+             << ",\"args\":{\"bytes\":" << e.bytes << ",\"algorithm\":\""
+             << (e.algorithm ? e.algorithm : "") << "\"}},\n"
+             << "{\"pid\":0,\"ph\":\"C\",\"name\":\"temporary storage (" << e.backend
+             << ")\",\"ts\":" << ts << ",\"args\":{\"bytes\":" << live << "}}";
+        }
+      }
+
+      os << "\n]}\n";
+    }
+
+  private:
+    struct recorded_event
+    {
+      event       e;
+      std::size_t thread;
+    };
+
+    static void record(const event &e, void *self)
+    {
+      chrome_trace_recorder &recorder = *static_cast<chrome_trace_recorder*>(self);
+
+      std::lock_guard<std::mutex> lock(recorder.m_mutex);
+
+      // number the threads in the order they were first seen
+      const std::size_t thread = recorder.m_threads.emplace(std::this_thread::get_id(), recorder.m_threads.size()).first->second;
+
+      recorder.m_events.push_back(recorded_event{e, thread});
+    }
+
+    static double microseconds(std::chrono::steady_clock::duration d)
+    {
+      return std::chrono::duration<double, std::micro>(d).count();
+    }
+
+    std::chrono::steady_clock::time_point   m_origin;
+    thrust::trace::detail::callback_binding m_previous;
+
+    mutable std::mutex                      m_mutex;
+    std::vector<recorded_event>             m_events;
+    std::map<std::thread::id,std::size_t>   m_threads;
+};
+
+} // end trace
+
+/*! \} // tracing
+ */
+
+/*! \} // utility
+ */
+
+THRUST_DETAIL_ABI_NS_END
+} // end namespace thrust
+THRUST_NS_POSTFIX